@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Lock-free single-producer single-consumer block ring for
+ * the audio capture, see audio_ring.h.
+ */
+
+#include <stddef.h>
+#include "audio_ring.h"
+
+AudioRing::AudioRing(uint8_t *buffer, uint32_t block_size, uint32_t blocks)
+  : buffer(buffer),
+    block_size(block_size),
+    mask(blocks - 1),
+    head(0),
+    overrun_count(0),
+    tail(0)
+{
+}
+
+bool AudioRing::commit()
+{
+  uint32_t h = head.load(std::memory_order_relaxed);
+  /* the slot after this one must not hold blocks the consumer has yet to release */
+  if (h + 1 - tail.load(std::memory_order_acquire) > mask)
+  {
+    overrun_count.store(overrun_count.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+    return false;
+  }
+  head.store(h + 1, std::memory_order_release);
+  return true;
+}
+
+uint32_t AudioRing::available() const
+{
+  return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+}
+
+bool AudioRing::peek(uint32_t blocks, AudioSpan *span) const
+{
+  if (available() < blocks)
+  {
+    return false;
+  }
+  uint32_t t = tail.load(std::memory_order_relaxed);
+  uint32_t first_blocks = mask + 1 - (t & mask);
+  if (first_blocks > blocks)
+  {
+    first_blocks = blocks;
+  }
+  span->first = slot(t);
+  span->first_size = first_blocks * block_size;
+  span->second = (first_blocks < blocks) ? buffer : NULL;
+  span->second_size = (blocks - first_blocks) * block_size;
+  return true;
+}
+
+void AudioRing::release(uint32_t blocks)
+{
+  uint32_t unread = available();
+  if (blocks > unread)
+  {
+    blocks = unread;
+  }
+  tail.store(tail.load(std::memory_order_relaxed) + blocks, std::memory_order_release);
+}
+
+void AudioRing::reset()
+{
+  tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+}
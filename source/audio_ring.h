@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __AUDIO_RING_H__
+#define __AUDIO_RING_H__
+
+#include <stdint.h>
+#include <atomic>
+
+/*
+ * Unread blocks read in place: first, then second when they wrap around
+ * the end of the buffer (second is NULL otherwise). Sizes are in bytes.
+ */
+typedef struct {
+  const uint8_t *first;
+  uint32_t first_size;
+  const uint8_t *second;
+  uint32_t second_size;
+} AudioSpan;
+
+/*
+ * Single-producer single-consumer ring of fixed size audio blocks over a
+ * caller's buffer (the DMA capture buffer). The number of blocks must be a
+ * power of two. Head and tail are free-running block counts, so slots are
+ * count & mask and head - tail is the unread count even across overflow.
+ *
+ * The producer (capture interrupt) fills write_block() and publishes it
+ * with commit(), a release store of the head. The consumer reads the
+ * oldest unread blocks with peek() after an acquire load of the head, and
+ * hands them back with release(), a release store of the tail, which the
+ * producer loads with acquire before reusing a slot. Neither side ever
+ * writes the other's index, so no lock or interrupt masking is needed.
+ *
+ * The slot being filled is never unread, so at most blocks - 1 are unread.
+ * When the consumer falls that far behind, commit() keeps the new block in
+ * the same slot to be overwritten, and counts an overrun: the newest audio
+ * is lost, never audio the consumer may be reading.
+ */
+class AudioRing
+{
+  private:
+    uint8_t *buffer;
+    uint32_t block_size;
+    uint32_t mask;
+    /* written by the producer only */
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> overrun_count;
+    /* written by the consumer only */
+    std::atomic<uint32_t> tail;
+
+    uint8_t *slot(uint32_t count) const { return buffer + (count & mask) * block_size; }
+
+  public:
+    AudioRing(uint8_t *buffer, uint32_t block_size, uint32_t blocks);
+
+    /* Producer */
+    uint8_t *write_block() const { return slot(head.load(std::memory_order_relaxed)); }
+    /* false if the ring was full and the block dropped */
+    bool commit();
+    /* Blocks committed since start, wraps at 2^32 */
+    uint32_t committed() const { return head.load(std::memory_order_relaxed); }
+    /* Last committed block, for the playback loop */
+    const uint8_t *newest_block() const { return slot(head.load(std::memory_order_acquire) - 1); }
+
+    /* Consumer */
+    uint32_t available() const;
+    /* false if fewer than blocks are unread */
+    bool peek(uint32_t blocks, AudioSpan *span) const;
+    void release(uint32_t blocks);
+    /* Releases every unread block */
+    void reset();
+
+    uint32_t capacity() const { return mask; }
+    uint32_t block_bytes() const { return block_size; }
+    uint32_t overruns() const { return overrun_count.load(std::memory_order_relaxed); }
+};
+
+#endif
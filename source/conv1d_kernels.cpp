@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Register blocked float kernel for the model's 1xK
+ * convolutions, shared by the CONV_2D override and the streaming model.
+ */
+
+#include <string.h>
+#include "conv1d_kernels.h"
+
+static inline float clamp(float x, float lo, float hi)
+{
+  return (x < lo) ? lo : ((x > hi) ? hi : x);
+}
+
+int Conv1dPackedSize(int out_ch, int kernel, int in_ch)
+{
+  int blocks = (out_ch + CONV1D_BLOCK_CH - 1) / CONV1D_BLOCK_CH;
+  return blocks * kernel * in_ch * CONV1D_BLOCK_CH;
+}
+
+void Conv1dPackWeights(const float *weights, int out_ch, int kernel, int in_ch, float *packed)
+{
+  int depth = kernel * in_ch;
+  memset(packed, 0, sizeof(float) * Conv1dPackedSize(out_ch, kernel, in_ch));
+  for (int o = 0; o < out_ch; o++) {
+    float *block = packed + (o / CONV1D_BLOCK_CH) * depth * CONV1D_BLOCK_CH;
+    for (int i = 0; i < depth; i++)
+      block[i * CONV1D_BLOCK_CH + (o % CONV1D_BLOCK_CH)] = weights[o * depth + i];
+  }
+}
+
+/* One column over taps [k0, k1) of the kernel */
+static void conv1d_column(const Conv1dParams &p, const float *x, const float *packed,
+                          const float *bias, float *y, int k0, int k1)
+{
+  int depth = p.kernel * p.in_ch;
+  int len = (k1 - k0) * p.in_ch;
+
+  for (int ob = 0; ob < p.out_ch; ob += CONV1D_BLOCK_CH) {
+    const float *w = packed + ob * depth + k0 * p.in_ch * CONV1D_BLOCK_CH;
+    float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    for (int i = 0; i < len; i++) {
+      float xi = x[i];
+      acc0 += xi * w[0];
+      acc1 += xi * w[1];
+      acc2 += xi * w[2];
+      acc3 += xi * w[3];
+      w += CONV1D_BLOCK_CH;
+    }
+    float acc[CONV1D_BLOCK_CH] = {acc0, acc1, acc2, acc3};
+    for (int c = 0; c < CONV1D_BLOCK_CH && ob + c < p.out_ch; c++) {
+      float v = acc[c] + (bias ? bias[ob + c] : 0.0f);
+      y[ob + c] = clamp(v, p.act_min, p.act_max);
+    }
+  }
+}
+
+/* Two adjacent columns with the full kernel inside the input */
+static void conv1d_column_pair(const Conv1dParams &p, const float *x, const float *packed,
+                               const float *bias, float *y)
+{
+  int depth = p.kernel * p.in_ch;
+  const float *x1 = x + p.stride * p.in_ch;
+  float *y1 = y + p.out_ch;
+
+  for (int ob = 0; ob < p.out_ch; ob += CONV1D_BLOCK_CH) {
+    const float *w = packed + ob * depth;
+    float a00 = 0.0f, a01 = 0.0f, a02 = 0.0f, a03 = 0.0f;
+    float a10 = 0.0f, a11 = 0.0f, a12 = 0.0f, a13 = 0.0f;
+    for (int i = 0; i < depth; i++) {
+      float xa = x[i];
+      float xb = x1[i];
+      float w0 = w[0], w1 = w[1], w2 = w[2], w3 = w[3];
+      a00 += xa * w0; a01 += xa * w1; a02 += xa * w2; a03 += xa * w3;
+      a10 += xb * w0; a11 += xb * w1; a12 += xb * w2; a13 += xb * w3;
+      w += CONV1D_BLOCK_CH;
+    }
+    float acc0[CONV1D_BLOCK_CH] = {a00, a01, a02, a03};
+    float acc1[CONV1D_BLOCK_CH] = {a10, a11, a12, a13};
+    for (int c = 0; c < CONV1D_BLOCK_CH && ob + c < p.out_ch; c++) {
+      float b = bias ? bias[ob + c] : 0.0f;
+      y[ob + c] = clamp(acc0[c] + b, p.act_min, p.act_max);
+      y1[ob + c] = clamp(acc1[c] + b, p.act_min, p.act_max);
+    }
+  }
+}
+
+/* Output columns [begin, end) */
+void Conv1dFloat(const Conv1dParams &p, const float *in, const float *packed,
+                 const float *bias, float *out, int begin, int end)
+{
+  int j = begin;
+  while (j < end) {
+    int start = j * p.stride - p.pad;
+    int k0 = (start < 0) ? -start : 0;
+    int k1 = (start + p.kernel > p.in_len) ? p.in_len - start : p.kernel;
+    const float *x = in + start * p.in_ch;
+    float *y = out + j * p.out_ch;
+
+    bool full = (k0 == 0 && k1 == p.kernel);
+    bool next_full = (j + 1 < end) && (start + p.stride + p.kernel <= p.in_len);
+    if (full && next_full) {
+      conv1d_column_pair(p, x, packed, bias, y);
+      j += CONV1D_BLOCK_T;
+    } else {
+      conv1d_column(p, x + k0 * p.in_ch, packed, bias, y, k0, k1);
+      j++;
+    }
+  }
+}
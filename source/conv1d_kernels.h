@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CONV1D_KERNELS_H__
+#define __CONV1D_KERNELS_H__
+
+/* Output channels per packed weight block, and time columns per micro-kernel */
+#define CONV1D_BLOCK_CH 4
+#define CONV1D_BLOCK_T 2
+
+/*
+ * Float convolution along one (time) axis, NHWC activations [len x ch] and
+ * OHWI weights with the kernel along time, bias and clamp activation fused.
+ * pad is the leading padding, positions outside the input contribute zero.
+ */
+typedef struct {
+  int in_len;
+  int in_ch;
+  int out_len;
+  int out_ch;
+  int kernel;
+  int stride;
+  int pad;
+  float act_min;
+  float act_max;
+} Conv1dParams;
+
+/*
+ * Weights are repacked once into blocks of CONV1D_BLOCK_CH output channels,
+ * [out_ch / CONV1D_BLOCK_CH][kernel * in_ch][CONV1D_BLOCK_CH], zero padded,
+ * so the inner loop streams one packed row per input value. The micro-kernel
+ * computes CONV1D_BLOCK_T x CONV1D_BLOCK_CH outputs in registers, each input
+ * and weight load feeding several MACs; columns that reach into the padding
+ * use a single-column variant over the valid taps only.
+ */
+int Conv1dPackedSize(int out_ch, int kernel, int in_ch);
+void Conv1dPackWeights(const float *weights, int out_ch, int kernel, int in_ch, float *packed);
+void Conv1dFloat(const Conv1dParams &params, const float *in, const float *packed,
+                 const float *bias, float *out, int begin, int end);
+
+#endif
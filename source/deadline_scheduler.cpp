@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Capture time stamps, staleness test and drop counters for
+ * live windows, see deadline_scheduler.h.
+ */
+
+#include "deadline_scheduler.h"
+#include "timer.h"
+
+DeadlineScheduler::DeadlineScheduler(int deadline)
+  : captured_seq(0),
+    captured_us(0),
+    current_seq(0),
+    current_us(0),
+    deadline_us(deadline)
+{
+  reset_stats();
+}
+
+/* Capture interrupt: the stamp is written before the sequence publishes it */
+void DeadlineScheduler::captured(int capture_us)
+{
+  captured_us = capture_us;
+  captured_seq = captured_seq + 1;
+}
+
+int DeadlineScheduler::next()
+{
+  uint32_t seq;
+  int us;
+  /* an interrupt between the two reads would pair a stamp with the wrong window */
+  do
+  {
+    seq = captured_seq;
+    us = captured_us;
+  } while (seq != captured_seq);
+
+  if (seq == current_seq)
+  {
+    return -1;
+  }
+  int skipped = seq - current_seq - 1;
+  windows_dropped += skipped;
+  current_seq = seq;
+  current_us = us;
+  return skipped;
+}
+
+void DeadlineScheduler::finish(bool completed)
+{
+  if (!completed)
+  {
+    windows_cancelled++;
+    return;
+  }
+  int latency = GetTimeInUS() - current_us;
+  windows_processed++;
+  if (latency > deadline_us)
+  {
+    windows_late++;
+  }
+  if (latency > latency_max_us)
+  {
+    latency_max_us = latency;
+  }
+}
+
+void DeadlineScheduler::reset_stats()
+{
+  windows_processed = 0;
+  windows_dropped = 0;
+  windows_cancelled = 0;
+  windows_late = 0;
+  latency_max_us = 0;
+}
+
+bool DeadlineScheduler::check_cancelled(void *scheduler)
+{
+  return ((const DeadlineScheduler *)scheduler)->stale();
+}
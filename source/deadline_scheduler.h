@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DEADLINE_SCHEDULER_H__
+#define __DEADLINE_SCHEDULER_H__
+
+#include <stdint.h>
+
+/*
+ * Keeps live inference on the newest captured window. The capture
+ * interrupt stamps every complete window with its capture time through
+ * captured(); the main loop takes windows with next(), which jumps to the
+ * newest one and counts those it skipped as dropped.
+ *
+ * While a window is processed, stale() turns true as soon as a newer
+ * window is complete. check_cancelled() is the same test in the form
+ * Interpreter::SetCancellationFunction takes, so a running Invoke is
+ * abandoned instead of finishing on obsolete audio. finish() closes the
+ * window: completed windows whose result came later than deadline_us after
+ * capture are counted as late, the others as cancelled.
+ */
+class DeadlineScheduler
+{
+  private:
+    /* written by the capture interrupt */
+    volatile uint32_t captured_seq;
+    volatile int captured_us;
+
+    uint32_t current_seq;
+    int current_us;
+    int deadline_us;
+    uint32_t windows_processed;
+    uint32_t windows_dropped;
+    uint32_t windows_cancelled;
+    uint32_t windows_late;
+    int latency_max_us;
+
+  public:
+    DeadlineScheduler(int deadline_us);
+    void captured(int capture_us);
+    /* -1 without a new window, else the number of windows skipped to reach it */
+    int next();
+    bool stale() const { return captured_seq != current_seq; }
+    void finish(bool completed);
+    void reset_stats();
+    static bool check_cancelled(void *scheduler);
+
+    int deadline() const { return deadline_us; }
+    uint32_t processed_windows() const { return windows_processed; }
+    uint32_t dropped_windows() const { return windows_dropped; }
+    uint32_t cancelled_windows() const { return windows_cancelled; }
+    uint32_t late_windows() const { return windows_late; }
+    /* Worst capture to result time of a completed window */
+    int max_latency() const { return latency_max_us; }
+};
+
+#endif
@@ -1,1541 +1,1541 @@
-const unsigned char ds_cnn_s_model[] = {
-  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x8c, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xc8, 0x3c, 0x00, 0x00,
-  0xd8, 0x3c, 0x00, 0x00, 0x80, 0x47, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x12, 0xc3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
-  0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x08, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
-  0xe4, 0x3b, 0x00, 0x00, 0x94, 0x3b, 0x00, 0x00, 0x64, 0x3b, 0x00, 0x00,
-  0x4c, 0x3b, 0x00, 0x00, 0xfc, 0x0b, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00,
-  0xfc, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
-  0x9c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-  0x6c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
-  0x54, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbe, 0xc3, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x35, 0x2e,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe0, 0xb9, 0xff, 0xff, 0xe4, 0xb9, 0xff, 0xff, 0xe8, 0xb9, 0xff, 0xff,
-  0xec, 0xb9, 0xff, 0xff, 0xf0, 0xb9, 0xff, 0xff, 0xf4, 0xb9, 0xff, 0xff,
-  0xf8, 0xb9, 0xff, 0xff, 0xfc, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff,
-  0x04, 0xba, 0xff, 0xff, 0x08, 0xba, 0xff, 0xff, 0x06, 0xc4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x22, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x3e, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5a, 0xc4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x76, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0x09, 0xda, 0xce, 0xbd, 0x64, 0x86, 0x92, 0xbe, 0x95, 0xa4, 0x73, 0xbe,
-  0x95, 0xff, 0x40, 0x3e, 0x73, 0x7d, 0x8e, 0xbe, 0x89, 0x26, 0xdd, 0xbe,
-  0xd6, 0x25, 0xd3, 0x3e, 0xef, 0xf7, 0xf8, 0xbd, 0x2a, 0x01, 0x6a, 0x3e,
-  0xb2, 0x0e, 0x56, 0xbe, 0x66, 0x2d, 0xa2, 0xbe, 0xc6, 0x5d, 0xca, 0xbd,
-  0x2d, 0x14, 0x8b, 0xbe, 0xc0, 0x9d, 0xd2, 0xbe, 0x4f, 0x03, 0x0b, 0x3e,
-  0x43, 0x93, 0x0d, 0xbe, 0xac, 0x1a, 0x16, 0x3e, 0xc3, 0x91, 0x07, 0xbe,
-  0x69, 0x5b, 0x8a, 0x3e, 0xce, 0x1f, 0x1b, 0x3e, 0x1c, 0xf6, 0x12, 0xbe,
-  0x03, 0x3e, 0x36, 0x3e, 0x0d, 0x91, 0xae, 0x3e, 0x26, 0x36, 0x53, 0x3c,
-  0x4f, 0x82, 0x40, 0xbe, 0x78, 0xc2, 0x86, 0x3e, 0x34, 0xd1, 0x89, 0xbe,
-  0xbb, 0x55, 0x8b, 0xbe, 0x08, 0x69, 0x7a, 0x3c, 0xa8, 0x1b, 0xc0, 0xbd,
-  0x21, 0xc2, 0x97, 0x3d, 0x34, 0x33, 0x86, 0x3e, 0xc1, 0x70, 0x33, 0xbe,
-  0x94, 0x2c, 0x1f, 0xbe, 0xa8, 0x2f, 0x0a, 0xbe, 0x0f, 0xe5, 0x54, 0x3d,
-  0x1b, 0xb7, 0xd2, 0xbd, 0xd6, 0x28, 0xf8, 0x3d, 0x0b, 0x3c, 0x00, 0xbe,
-  0x49, 0x3e, 0x07, 0x3e, 0xd3, 0x45, 0x72, 0x3e, 0x9f, 0xaa, 0x8a, 0x3e,
-  0x20, 0xd8, 0x0d, 0x3d, 0x12, 0x2e, 0x87, 0x3e, 0x3f, 0xdf, 0x87, 0x3e,
-  0x4d, 0xe2, 0x6d, 0xbd, 0x5f, 0xd5, 0xe9, 0xbd, 0xcb, 0xe0, 0xa8, 0x3d,
-  0x19, 0xda, 0x8e, 0xbe, 0xb7, 0x98, 0x21, 0x3e, 0xec, 0xe9, 0x8e, 0xbe,
-  0xcd, 0x57, 0x81, 0xbe, 0x57, 0x24, 0x91, 0x3d, 0x02, 0x06, 0x70, 0x3e,
-  0x6d, 0x91, 0x33, 0xbe, 0x93, 0xa9, 0x96, 0xbd, 0x84, 0x00, 0xbd, 0x3e,
-  0x12, 0xf8, 0x78, 0xbd, 0x08, 0x6a, 0xee, 0xbd, 0x89, 0x64, 0xba, 0x3e,
-  0xab, 0x63, 0x88, 0x3e, 0xc5, 0xf7, 0x9f, 0x3c, 0x7a, 0x61, 0x28, 0xbe,
-  0x16, 0x8e, 0xc3, 0x3e, 0x48, 0x3d, 0xcc, 0x3c, 0x95, 0x29, 0xcb, 0xbd,
-  0x6c, 0x84, 0xb1, 0xbd, 0x75, 0xd4, 0x09, 0xbe, 0x31, 0xf2, 0xc8, 0x3d,
-  0x20, 0xd3, 0x1d, 0x3e, 0xf8, 0x12, 0x1d, 0x3d, 0x7c, 0xf4, 0x6c, 0x3e,
-  0x8f, 0x72, 0x82, 0xbe, 0x99, 0xa2, 0x87, 0x3d, 0xd1, 0x8c, 0x12, 0xbc,
-  0x06, 0x37, 0xb1, 0xbc, 0xe5, 0x0b, 0xb8, 0xbd, 0xf7, 0x59, 0x47, 0x3e,
-  0x77, 0x22, 0x19, 0xbe, 0x24, 0x6e, 0x04, 0x3e, 0xee, 0x43, 0x2c, 0xbe,
-  0x8e, 0xfa, 0xc4, 0xbd, 0xcb, 0x41, 0xc5, 0xbc, 0x23, 0x70, 0x86, 0x3e,
-  0xda, 0x02, 0x37, 0x3e, 0x71, 0x39, 0x65, 0x3e, 0x59, 0x2c, 0x15, 0x3e,
-  0x18, 0xcf, 0x1d, 0xbe, 0x67, 0xd6, 0xab, 0xbd, 0x1e, 0x4e, 0xa0, 0xbe,
-  0xcc, 0x07, 0xd0, 0x3d, 0x4d, 0x83, 0x12, 0x3c, 0x3f, 0xe7, 0xcc, 0xbd,
-  0x60, 0x82, 0x06, 0x3e, 0xcb, 0x0b, 0x1d, 0x3e, 0x80, 0xef, 0x5a, 0xbe,
-  0x4b, 0xfd, 0x20, 0x3d, 0x82, 0x2f, 0x40, 0xbc, 0x63, 0xc7, 0x01, 0x3e,
-  0xb7, 0x77, 0x27, 0xbd, 0xd4, 0x06, 0xfc, 0x3d, 0x85, 0xb7, 0x28, 0xbe,
-  0x6b, 0x87, 0x27, 0xbe, 0x47, 0xa6, 0x39, 0x3e, 0xad, 0x49, 0x9f, 0xbe,
-  0x9b, 0x89, 0xd9, 0xbd, 0xf7, 0xd8, 0x82, 0xbd, 0xdd, 0x79, 0x95, 0xbd,
-  0x96, 0x85, 0xae, 0xbd, 0x84, 0xba, 0x4e, 0xbe, 0xd8, 0x92, 0xeb, 0x3c,
-  0xb2, 0xf0, 0x97, 0x3e, 0xf3, 0x7d, 0x91, 0x3e, 0xc6, 0xb4, 0x9b, 0xbe,
-  0xd2, 0x10, 0xf4, 0x3d, 0x3a, 0xd3, 0x87, 0x3e, 0x2c, 0x86, 0x0e, 0xbe,
-  0xe8, 0x1c, 0x83, 0x3e, 0x1d, 0xfb, 0x54, 0xbe, 0xa2, 0x04, 0x75, 0x3e,
-  0x3a, 0x4c, 0x0d, 0x3e, 0xc7, 0x99, 0x32, 0xbe, 0xb0, 0x42, 0x6a, 0xbe,
-  0xc3, 0xe0, 0x44, 0x3d, 0x79, 0x74, 0xc7, 0x3e, 0xa1, 0xa5, 0xa1, 0x3e,
-  0xc1, 0xa4, 0x5d, 0xbd, 0x5f, 0xe9, 0xa5, 0x3e, 0xff, 0xe8, 0x5f, 0xbe,
-  0x18, 0x48, 0x4b, 0xbe, 0x74, 0x4e, 0x50, 0xbe, 0xe4, 0x07, 0xc4, 0x3d,
-  0xda, 0x7f, 0x78, 0x3e, 0x26, 0x78, 0xa5, 0x3e, 0x26, 0xc8, 0x12, 0xbe,
-  0x5e, 0xdf, 0x61, 0xbd, 0xe4, 0x64, 0x03, 0xbd, 0xc7, 0x4f, 0xe2, 0x3c,
-  0x81, 0x69, 0x36, 0xba, 0x12, 0x32, 0xb3, 0xbd, 0xc8, 0xcd, 0xcc, 0x3e,
-  0x79, 0xe6, 0x74, 0xbd, 0x70, 0x80, 0x35, 0xbe, 0x6a, 0x5b, 0x1b, 0x3e,
-  0x99, 0x97, 0x42, 0x3e, 0xf6, 0x1e, 0x11, 0xbc, 0x79, 0x85, 0xd5, 0x3d,
-  0x33, 0x74, 0x83, 0x3e, 0x69, 0x57, 0xfc, 0x3d, 0xd4, 0x00, 0xbc, 0x3d,
-  0x67, 0xb5, 0x4b, 0xbe, 0x83, 0xca, 0x3d, 0x3e, 0x33, 0x46, 0x5c, 0x3d,
-  0x9e, 0x60, 0xa6, 0xbd, 0x54, 0x33, 0x90, 0x3d, 0x7e, 0x1f, 0x65, 0xbe,
-  0x95, 0xcf, 0x30, 0x3c, 0x24, 0xac, 0x87, 0x3e, 0xa6, 0xc5, 0x05, 0xbe,
-  0x2a, 0xb7, 0x63, 0xbe, 0xdc, 0x10, 0xf6, 0xbd, 0x29, 0x42, 0xdb, 0x3d,
-  0x39, 0x1e, 0x05, 0xbe, 0x20, 0xff, 0x18, 0xbd, 0xa1, 0x80, 0x8a, 0x3e,
-  0xe6, 0x3a, 0x67, 0xbe, 0xb2, 0x3a, 0xc9, 0xbd, 0x19, 0x6c, 0x0e, 0xbd,
-  0x7c, 0xbb, 0x69, 0xbe, 0x3d, 0x66, 0x76, 0xbe, 0x95, 0x1b, 0x52, 0x3e,
-  0xb2, 0xca, 0xad, 0x3b, 0xa6, 0x03, 0x6d, 0xbb, 0xdc, 0x70, 0x77, 0x3e,
-  0x10, 0x77, 0x25, 0x3e, 0x42, 0xe9, 0x46, 0x3c, 0x52, 0xfe, 0x2b, 0xbd,
-  0x0d, 0x60, 0xb4, 0xbe, 0xbc, 0xe9, 0x38, 0xbe, 0xe8, 0x86, 0x95, 0x3d,
-  0x27, 0xfa, 0xba, 0x3e, 0x40, 0x15, 0xfe, 0x3d, 0xf6, 0xc3, 0x40, 0x3e,
-  0x6a, 0x59, 0xb6, 0xbe, 0x5d, 0x50, 0xb9, 0xbe, 0x36, 0xef, 0xac, 0xbe,
-  0xc2, 0x7d, 0x3d, 0xbe, 0x29, 0xbf, 0x6c, 0x3c, 0xa1, 0x2d, 0x89, 0x3e,
-  0xdc, 0x75, 0x82, 0x3d, 0x62, 0x43, 0x05, 0xbe, 0xc8, 0xf0, 0xfd, 0x3d,
-  0x96, 0x09, 0x35, 0xbe, 0xcb, 0xde, 0x55, 0xbe, 0x52, 0x52, 0xa0, 0x3e,
-  0x1e, 0xca, 0x0d, 0xbe, 0xe6, 0xf6, 0x28, 0xbe, 0x41, 0x9d, 0xec, 0xbd,
-  0x30, 0xe4, 0x41, 0x3d, 0x36, 0xdd, 0x32, 0x3e, 0x3f, 0x4d, 0xac, 0xbd,
-  0x81, 0xae, 0x07, 0xbe, 0x33, 0xa3, 0x4e, 0xbe, 0x49, 0x0b, 0x24, 0x3e,
-  0xc7, 0x88, 0xb1, 0x3d, 0x3f, 0x6c, 0x57, 0xbd, 0x54, 0x39, 0x93, 0x3e,
-  0xc4, 0xdf, 0x1c, 0x3e, 0x99, 0xb0, 0xab, 0xbc, 0xaa, 0x0d, 0xaf, 0xbe,
-  0x2b, 0x31, 0x07, 0x3e, 0x49, 0xb7, 0x8f, 0xbe, 0x81, 0x67, 0xfe, 0xbd,
-  0xf1, 0x75, 0x90, 0xbe, 0x18, 0xc9, 0xb2, 0x3e, 0xb2, 0x57, 0x67, 0x3d,
-  0x34, 0x46, 0x82, 0xbe, 0xf1, 0x94, 0x26, 0xbe, 0xa4, 0x34, 0x30, 0x3e,
-  0xff, 0x4d, 0xb4, 0xbd, 0xf9, 0xbb, 0x0d, 0x3e, 0xa5, 0xfc, 0x24, 0x3e,
-  0x96, 0x32, 0xb9, 0xbe, 0xe1, 0x3c, 0x45, 0xbe, 0xd4, 0x18, 0x1b, 0xbe,
-  0xcb, 0x00, 0x8d, 0x3e, 0x86, 0x9d, 0xc8, 0x3e, 0x6c, 0x6a, 0x84, 0xbe,
-  0xd1, 0xdb, 0x71, 0x3d, 0x68, 0xbe, 0x71, 0x3d, 0x8f, 0x67, 0x81, 0x3d,
-  0xa8, 0x53, 0x7b, 0xbe, 0x39, 0x3e, 0x83, 0xbe, 0x3e, 0xf0, 0x6d, 0x3d,
-  0x4e, 0x7c, 0x9e, 0x3e, 0xea, 0xe8, 0x64, 0x3c, 0x82, 0x39, 0xcc, 0xbc,
-  0x73, 0x0d, 0x29, 0xbd, 0x38, 0x1f, 0xe5, 0xbb, 0xab, 0x34, 0xd0, 0xbd,
-  0x90, 0x5b, 0xd3, 0x3c, 0x40, 0x94, 0x2e, 0xbc, 0x55, 0x5c, 0x86, 0x3d,
-  0x89, 0xb1, 0x86, 0xbd, 0xf8, 0xe1, 0x27, 0xbe, 0xd5, 0xc3, 0xa8, 0xbe,
-  0xd6, 0x8a, 0x52, 0xbd, 0x5d, 0x0c, 0x9d, 0x3c, 0x9f, 0xe8, 0xff, 0x3e,
-  0xe8, 0x28, 0xc2, 0xbc, 0xf5, 0x1e, 0x53, 0x3c, 0x8e, 0xb7, 0xdb, 0x3d,
-  0x6f, 0x28, 0x83, 0x3d, 0xa9, 0xe4, 0x0e, 0xbd, 0x80, 0xa1, 0xac, 0x3e,
-  0x9a, 0xa1, 0x4c, 0xbe, 0xa5, 0x19, 0x4b, 0x3d, 0xe2, 0x42, 0x09, 0xbe,
-  0x90, 0xcd, 0x02, 0xbe, 0xd9, 0x1e, 0x8a, 0xbe, 0xf3, 0x19, 0x5a, 0xbe,
-  0x08, 0x99, 0x31, 0xbe, 0xb0, 0xa6, 0xc1, 0x3e, 0x5a, 0x91, 0x7c, 0xbd,
-  0x34, 0x57, 0xb8, 0x3d, 0xde, 0xc5, 0x43, 0xbe, 0x84, 0xc9, 0x88, 0xbd,
-  0x3f, 0x4f, 0xa6, 0x3d, 0xd0, 0xa1, 0x16, 0xbe, 0x01, 0x48, 0x23, 0xbe,
-  0x02, 0x5c, 0x31, 0x3e, 0xae, 0x62, 0x1a, 0x3c, 0xb5, 0x36, 0xc0, 0xbd,
-  0x71, 0x3b, 0x31, 0x3e, 0x8e, 0x49, 0x2e, 0x3e, 0x89, 0x4f, 0xfa, 0xbd,
-  0xdf, 0x7e, 0x6a, 0xbe, 0x8c, 0xfb, 0xde, 0xbb, 0xba, 0xae, 0x98, 0x3d,
-  0x09, 0x18, 0x91, 0x3e, 0xa9, 0x0f, 0x2d, 0x3e, 0x96, 0x38, 0x8c, 0x3b,
-  0x68, 0xf8, 0x7d, 0xbe, 0xe0, 0xfc, 0x79, 0x3e, 0x94, 0x01, 0x29, 0x3e,
-  0x1e, 0x2d, 0x82, 0xbe, 0x35, 0x70, 0x5d, 0x3e, 0xd3, 0xf4, 0x71, 0x3d,
-  0x70, 0xf1, 0x58, 0x3e, 0x4e, 0x83, 0x8d, 0x3a, 0x16, 0x86, 0x99, 0xbe,
-  0x31, 0xe7, 0xba, 0xbd, 0xc3, 0x39, 0x98, 0x3d, 0x41, 0x10, 0x80, 0x3e,
-  0x6e, 0xef, 0x38, 0xbc, 0x3f, 0x9c, 0x37, 0xbe, 0x08, 0xad, 0x65, 0xbd,
-  0x5f, 0x40, 0xa7, 0xbd, 0x1e, 0x70, 0x2a, 0x3e, 0x13, 0xbf, 0xd1, 0xbc,
-  0x0d, 0x39, 0x2f, 0x3e, 0xe7, 0x2a, 0x8b, 0xbe, 0x17, 0xe7, 0xce, 0x3c,
-  0xee, 0xb2, 0x55, 0x3e, 0x32, 0xbd, 0x91, 0x3d, 0x00, 0x89, 0xd0, 0x3d,
-  0x88, 0xbe, 0x5f, 0xbe, 0x12, 0xa4, 0x36, 0xbe, 0x6a, 0x02, 0xcc, 0xbd,
-  0x8c, 0x13, 0x38, 0x3e, 0xf5, 0x98, 0xcd, 0xbd, 0xb5, 0x66, 0x7b, 0x3e,
-  0xa6, 0x77, 0x8b, 0xbe, 0xb0, 0x18, 0xa8, 0xbc, 0x9d, 0x04, 0x46, 0xbe,
-  0x32, 0x36, 0xb0, 0x3e, 0x10, 0xbb, 0x43, 0xbc, 0xba, 0xa9, 0xf6, 0xbd,
-  0x75, 0xb5, 0x3d, 0xbd, 0x53, 0x20, 0xdb, 0xbe, 0x2e, 0xd1, 0xad, 0xbe,
-  0x39, 0x35, 0x69, 0xbe, 0x42, 0xfa, 0x3a, 0x3d, 0x03, 0x4b, 0xb4, 0x3c,
-  0x09, 0xeb, 0xe5, 0x3e, 0xc9, 0x1d, 0xdc, 0x3d, 0x9b, 0xd1, 0x23, 0xbe,
-  0x62, 0x0a, 0x6c, 0xbe, 0x4e, 0x0d, 0xa9, 0xbe, 0xdf, 0xc3, 0x8a, 0xbe,
-  0x41, 0xfa, 0x81, 0xbd, 0x32, 0x57, 0x63, 0x3e, 0x75, 0xca, 0x8e, 0x3e,
-  0x6e, 0x9d, 0xff, 0x3d, 0x63, 0xda, 0x95, 0x3d, 0x30, 0x91, 0x29, 0xbe,
-  0xc1, 0xd4, 0xf0, 0xbd, 0xe4, 0x62, 0x8a, 0x3e, 0xd7, 0x74, 0xae, 0x3e,
-  0x6f, 0x04, 0x96, 0x3d, 0x8f, 0x83, 0x8e, 0xbe, 0xb2, 0xd4, 0x95, 0x3e,
-  0xa8, 0xf3, 0xd8, 0xbe, 0xc7, 0xe6, 0xd1, 0xbe, 0x4b, 0x91, 0xa9, 0xbd,
-  0x50, 0x92, 0x99, 0x3e, 0xe7, 0x39, 0xbd, 0x3c, 0xef, 0x10, 0x9c, 0xbc,
-  0xd9, 0xbc, 0xc1, 0x3d, 0x69, 0x0f, 0xb1, 0x3d, 0x14, 0x62, 0x71, 0xbe,
-  0xdd, 0x31, 0xaf, 0xbe, 0xc1, 0x1b, 0x22, 0xbe, 0x16, 0x19, 0xbe, 0x3e,
-  0xce, 0xa6, 0xa0, 0x3e, 0xca, 0x80, 0x2d, 0xbe, 0x7f, 0x88, 0x97, 0xbd,
-  0x50, 0x55, 0x29, 0x3e, 0xa6, 0x9a, 0x1f, 0xbe, 0x12, 0xe3, 0x8b, 0xbe,
-  0x46, 0x0e, 0xb5, 0x3e, 0x71, 0x01, 0x46, 0x3d, 0x6f, 0x24, 0x02, 0xbe,
-  0xc2, 0x65, 0x44, 0x3e, 0x63, 0x0e, 0x3d, 0xbe, 0x1e, 0x6d, 0x98, 0xbe,
-  0x69, 0xac, 0xeb, 0xbd, 0x82, 0xd1, 0x19, 0x3d, 0x8d, 0x8a, 0x18, 0xbd,
-  0xb1, 0x27, 0x48, 0x3d, 0x91, 0x0f, 0x80, 0xbd, 0x65, 0x85, 0x8d, 0xbe,
-  0xeb, 0xda, 0x90, 0x3d, 0x30, 0x76, 0xf8, 0x3d, 0xc1, 0x94, 0xe4, 0x3e,
-  0x4d, 0xe8, 0xcf, 0x3d, 0x7a, 0x21, 0x8a, 0x3e, 0x99, 0xc4, 0x5c, 0xbe,
-  0x58, 0x89, 0xc1, 0x3d, 0x84, 0x04, 0x6b, 0xbe, 0xcc, 0x9c, 0x0e, 0xbe,
-  0xb2, 0xb5, 0x10, 0x3e, 0x77, 0x3c, 0x97, 0xbd, 0x24, 0xf5, 0x7b, 0x3e,
-  0x82, 0xca, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00,
-  0x0f, 0xe0, 0xf2, 0xbe, 0x43, 0x4c, 0x87, 0x3e, 0x02, 0xda, 0xa3, 0xbe,
-  0x04, 0x52, 0xc6, 0x3d, 0xb7, 0xb7, 0x5f, 0x3e, 0xc1, 0x52, 0x79, 0xbe,
-  0xb5, 0x64, 0xeb, 0x3d, 0xd5, 0x35, 0xab, 0x3e, 0x20, 0x46, 0x76, 0x3c,
-  0x9b, 0x3a, 0xb9, 0xbe, 0x0e, 0x5b, 0xb9, 0xbd, 0x83, 0x60, 0x28, 0xbd,
-  0x1f, 0x5a, 0x78, 0xbc, 0xda, 0xfe, 0xfc, 0x3e, 0x41, 0x77, 0x11, 0xbe,
-  0xbc, 0x48, 0xa7, 0xbe, 0xc1, 0xa1, 0x6f, 0x3b, 0x17, 0xe7, 0xc9, 0xbd,
-  0xdc, 0x31, 0x06, 0x3c, 0x1b, 0x8b, 0x8a, 0xbd, 0x37, 0xc3, 0x82, 0xbe,
-  0x63, 0x3a, 0xee, 0x3b, 0x90, 0xc3, 0xd8, 0xbc, 0x98, 0x75, 0xb2, 0x3e,
-  0x77, 0x44, 0xb2, 0x3e, 0xf3, 0x93, 0x86, 0x3e, 0x59, 0x77, 0xc3, 0xbe,
-  0x1d, 0x14, 0x59, 0xbe, 0x1e, 0xd8, 0xb1, 0x3e, 0xc5, 0x90, 0x53, 0xbe,
-  0xed, 0x71, 0xf8, 0xbd, 0x0c, 0x7c, 0xa4, 0x3d, 0xa4, 0xc1, 0x61, 0x3b,
-  0x92, 0x26, 0xb1, 0xbd, 0xc7, 0xba, 0x1d, 0x3e, 0x3d, 0x3a, 0x47, 0x3e,
-  0x97, 0x1f, 0xcd, 0xbe, 0xbe, 0xb5, 0xaf, 0xbe, 0x39, 0x57, 0x0c, 0xbe,
-  0xee, 0xc4, 0xc1, 0x3d, 0x33, 0xc3, 0xe3, 0xbd, 0x7e, 0x2c, 0x98, 0xbe,
-  0xc4, 0x78, 0x0f, 0xbe, 0x09, 0x7c, 0xdb, 0x3d, 0x05, 0xec, 0x81, 0xbd,
-  0x1b, 0xd3, 0x8b, 0x3d, 0x7f, 0x9b, 0xc4, 0xbe, 0x9f, 0x01, 0xa9, 0x3d,
-  0xcc, 0xa3, 0x5e, 0x3e, 0x70, 0x7f, 0x44, 0x3e, 0x1b, 0xb2, 0x8f, 0xbe,
-  0xc9, 0xf3, 0xdd, 0x3e, 0x90, 0x34, 0x70, 0x3e, 0xd4, 0x27, 0x71, 0xbd,
-  0xee, 0x60, 0x9b, 0x3d, 0x25, 0x0f, 0x5c, 0x3d, 0x56, 0xa0, 0xd6, 0x3d,
-  0xd4, 0x5d, 0xd1, 0x3c, 0xcc, 0x63, 0x0e, 0xbd, 0xa7, 0xf3, 0xa7, 0xbe,
-  0x82, 0x1d, 0xb4, 0x3e, 0x86, 0xf8, 0x0b, 0xbe, 0x41, 0x7a, 0x29, 0xbe,
-  0xc3, 0x5a, 0x88, 0x3d, 0x4b, 0x8e, 0x3b, 0x3e, 0xb7, 0x11, 0x25, 0x3d,
-  0x9b, 0x2b, 0x8f, 0x38, 0x1a, 0xfa, 0xaa, 0xbe, 0x0b, 0xcb, 0xa1, 0x3e,
-  0xf6, 0xd1, 0x32, 0x3d, 0xc3, 0xe3, 0x28, 0xbe, 0x92, 0x9e, 0x88, 0x3d,
-  0x3a, 0x2f, 0x78, 0xbe, 0xd2, 0x3f, 0x9b, 0x3c, 0x77, 0xb0, 0x18, 0xbe,
-  0x00, 0x1b, 0xbb, 0x3d, 0x28, 0xb2, 0x9f, 0xbd, 0x4c, 0x9a, 0x84, 0x3e,
-  0xa0, 0x24, 0x99, 0x3e, 0x79, 0x0a, 0x15, 0xbe, 0xa0, 0xfe, 0x90, 0xbe,
-  0xfe, 0x81, 0xb0, 0x3e, 0x60, 0xcb, 0x38, 0xbe, 0x85, 0xb8, 0xe8, 0xbd,
-  0x77, 0x18, 0x34, 0xbe, 0x5a, 0x89, 0x90, 0x3d, 0x57, 0x8e, 0x11, 0xbd,
-  0x47, 0xbb, 0xce, 0xbd, 0x76, 0xb8, 0x6b, 0x3c, 0x94, 0x3a, 0x16, 0x3e,
-  0x1f, 0x50, 0x25, 0x3e, 0x05, 0x73, 0xc3, 0x3e, 0xb1, 0x21, 0x03, 0xbe,
-  0xef, 0x6b, 0xf2, 0xbe, 0x22, 0x69, 0x28, 0x3e, 0x6c, 0xcd, 0x15, 0xbd,
-  0x48, 0x0d, 0xa4, 0xbc, 0x55, 0xf2, 0x94, 0x3d, 0x27, 0x9a, 0x21, 0xbe,
-  0xd3, 0x15, 0xaa, 0x3d, 0x7e, 0xb4, 0xb2, 0xbc, 0x6b, 0xde, 0x83, 0x3d,
-  0xb8, 0x2e, 0xa9, 0xbd, 0xf0, 0xac, 0xfb, 0x3d, 0x17, 0x06, 0x88, 0x3e,
-  0x6c, 0xb3, 0x8b, 0xbe, 0x08, 0x59, 0xb9, 0xbe, 0x1a, 0x5f, 0x6e, 0x3d,
-  0x72, 0xff, 0x2f, 0xbe, 0x7a, 0x6a, 0xe2, 0x3c, 0x26, 0xef, 0x7f, 0x3c,
-  0xb6, 0xee, 0x80, 0xbe, 0x89, 0x0e, 0xc9, 0xbd, 0x6d, 0x0d, 0x8f, 0x3d,
-  0x51, 0x72, 0xaa, 0xbd, 0x88, 0x19, 0xae, 0xbd, 0x35, 0x63, 0x04, 0x3e,
-  0xbd, 0xf5, 0xcd, 0xbe, 0x38, 0x57, 0xad, 0x3e, 0x87, 0x1c, 0x5f, 0xbc,
-  0x62, 0x05, 0x84, 0x3e, 0xd7, 0x40, 0xef, 0x3d, 0xbb, 0x66, 0x5a, 0xbe,
-  0xa3, 0xa3, 0xb4, 0xbc, 0xbf, 0x33, 0x4c, 0x3e, 0xd2, 0xea, 0x13, 0xbe,
-  0x96, 0x71, 0x55, 0xbb, 0x68, 0x7b, 0x1e, 0x3d, 0x2c, 0x5b, 0xa3, 0x3d,
-  0x26, 0x16, 0xaa, 0x3b, 0x9e, 0xfe, 0x70, 0x3e, 0x54, 0x2f, 0xb0, 0x3e,
-  0x53, 0x27, 0xf6, 0xbd, 0xa5, 0x00, 0x87, 0x3d, 0xec, 0x65, 0x0f, 0xbe,
-  0xd1, 0x95, 0x38, 0xbe, 0xf4, 0xb2, 0xa7, 0xbe, 0x8a, 0x99, 0x95, 0x3d,
-  0xcc, 0xd8, 0x8f, 0x3d, 0x5e, 0xd8, 0x18, 0x3e, 0xb7, 0xaf, 0x57, 0xbe,
-  0x69, 0xd4, 0x7f, 0x3e, 0x4c, 0x8a, 0xb3, 0xbd, 0x78, 0x1a, 0x46, 0xbe,
-  0xf5, 0x80, 0x29, 0xbe, 0x29, 0x4b, 0x06, 0xbc, 0x4c, 0x89, 0x65, 0x3e,
-  0xfa, 0xf7, 0xe9, 0xbd, 0xd2, 0x6f, 0xbb, 0x3d, 0xab, 0x2b, 0x9c, 0xbd,
-  0xff, 0xe5, 0x50, 0xbd, 0x72, 0x9d, 0x22, 0xbe, 0x52, 0x3c, 0xf5, 0x3d,
-  0x39, 0x33, 0xbe, 0xbd, 0xa9, 0xd0, 0x9a, 0x3e, 0x62, 0xbc, 0x9d, 0xbd,
-  0xf5, 0x29, 0x23, 0xbe, 0x6e, 0x57, 0x17, 0x3e, 0x09, 0x29, 0x02, 0xbe,
-  0x46, 0xb0, 0x45, 0x3e, 0xcb, 0x07, 0x57, 0x3b, 0x95, 0x46, 0x91, 0x3c,
-  0x41, 0x9c, 0x44, 0xbe, 0xd1, 0x69, 0xd6, 0x3d, 0xc7, 0x87, 0xc4, 0xbe,
-  0xf4, 0xb4, 0x06, 0x3e, 0x65, 0x67, 0xf3, 0xbd, 0x49, 0xb0, 0x1a, 0x3e,
-  0x43, 0x96, 0xa9, 0xbd, 0x60, 0x66, 0x4e, 0xbc, 0xc9, 0xe0, 0xb1, 0xbc,
-  0x78, 0xfe, 0x40, 0xbe, 0x18, 0xd6, 0x90, 0x3e, 0xd1, 0x4a, 0xc7, 0xbe,
-  0x17, 0xb2, 0xbd, 0x3e, 0xd0, 0x61, 0x0b, 0xbf, 0x81, 0xef, 0xca, 0x3e,
-  0x05, 0xf2, 0xd1, 0xbe, 0x03, 0x2a, 0xb9, 0x3e, 0x24, 0x61, 0xd6, 0xbe,
-  0x19, 0xa1, 0x82, 0x3e, 0xb6, 0x29, 0x1f, 0xbe, 0xa8, 0xec, 0x39, 0xbe,
-  0xd3, 0x14, 0x8a, 0xbe, 0xe8, 0x07, 0xb9, 0x3e, 0xa6, 0xfe, 0x90, 0xbe,
-  0x63, 0xe0, 0xcd, 0x3d, 0x8f, 0xb7, 0x69, 0xbe, 0xd2, 0x2c, 0xac, 0x3e,
-  0x4e, 0x3e, 0x44, 0xbe, 0x91, 0x94, 0x96, 0xbd, 0x23, 0x10, 0xb1, 0xbe,
-  0xfe, 0xb7, 0x90, 0x3e, 0xd0, 0x00, 0x33, 0xbb, 0xc6, 0xd9, 0xfc, 0xbd,
-  0x0c, 0xd6, 0xa9, 0x3e, 0xb1, 0x90, 0x7d, 0xbd, 0xba, 0x3b, 0x5f, 0x3d,
-  0xf5, 0x30, 0x56, 0xbe, 0xf0, 0x2f, 0xd2, 0x3d, 0xe9, 0x33, 0x5a, 0xbe,
-  0x44, 0x48, 0x86, 0x3e, 0xa8, 0x3a, 0x46, 0xbe, 0x5d, 0xac, 0x6d, 0x3e,
-  0xe9, 0x03, 0x1c, 0xbe, 0xbb, 0xb7, 0x95, 0x3d, 0xd7, 0x12, 0x22, 0xbe,
-  0xa7, 0x35, 0x42, 0x3e, 0x55, 0xef, 0x81, 0x3d, 0x36, 0xd5, 0x24, 0x3d,
-  0xda, 0x4c, 0x78, 0xbd, 0x58, 0x29, 0x1b, 0x3e, 0xf5, 0x9e, 0x8a, 0x3d,
-  0x0b, 0x16, 0xcf, 0xbd, 0x6a, 0x2c, 0x41, 0x3e, 0xac, 0xf0, 0xe0, 0x3d,
-  0x2d, 0x9d, 0x81, 0x3d, 0xdf, 0x21, 0x2b, 0x3e, 0x57, 0x37, 0x87, 0xbd,
-  0x67, 0x99, 0x9f, 0xbd, 0x7d, 0x82, 0x1e, 0xbd, 0x42, 0xe1, 0xbf, 0x3e,
-  0xa3, 0x88, 0x63, 0xbd, 0x7c, 0xcc, 0xef, 0xbd, 0xf1, 0xd0, 0x88, 0x3d,
-  0xc6, 0x90, 0x86, 0x3b, 0x9a, 0x6f, 0x50, 0x3e, 0x05, 0x04, 0x91, 0xbe,
-  0x91, 0x53, 0x21, 0x3e, 0x62, 0xff, 0x81, 0xbe, 0xf2, 0xf5, 0xa4, 0x3e,
-  0xaf, 0x4e, 0x02, 0xbe, 0x2d, 0x21, 0x45, 0x3c, 0xe3, 0xb2, 0xd4, 0xbd,
-  0x83, 0xa0, 0x9d, 0xbe, 0x06, 0x7f, 0xb4, 0xbe, 0x16, 0x25, 0xee, 0x3c,
-  0x42, 0x54, 0x97, 0xbe, 0x21, 0x01, 0x5b, 0x3e, 0x10, 0x6c, 0x60, 0xbd,
-  0xcb, 0x08, 0x8f, 0x3e, 0x54, 0xd7, 0x71, 0x3d, 0x77, 0x71, 0x30, 0xbe,
-  0x17, 0xff, 0xc2, 0x3e, 0xdc, 0xf5, 0x12, 0xbe, 0x2e, 0xb5, 0x2c, 0x3e,
-  0x2c, 0x6c, 0x54, 0xbc, 0x25, 0x0a, 0x91, 0xbd, 0x12, 0x9a, 0x30, 0x3e,
-  0x25, 0x3c, 0x9c, 0x3d, 0x9b, 0x14, 0xcf, 0x3e, 0x02, 0x9f, 0x54, 0xbe,
-  0x34, 0x04, 0x19, 0xbd, 0xba, 0x6f, 0x1a, 0xbe, 0x11, 0x19, 0xaf, 0xbe,
-  0x00, 0xeb, 0x78, 0x3e, 0x38, 0x50, 0x8b, 0xbd, 0x4e, 0x74, 0x43, 0x3e,
-  0xf5, 0x72, 0xc0, 0xbe, 0x5f, 0x57, 0xa7, 0xbe, 0x85, 0xab, 0x7f, 0xbe,
-  0x88, 0xb3, 0x82, 0xbe, 0x5b, 0xe0, 0xd8, 0x3e, 0xec, 0x46, 0xb5, 0xbd,
-  0xc4, 0x6a, 0xa3, 0xbe, 0x3c, 0xa8, 0x82, 0xbe, 0x59, 0x8d, 0x6c, 0xbd,
-  0xd3, 0xfa, 0x48, 0x3e, 0x84, 0xb2, 0xdc, 0x3d, 0xd0, 0x8a, 0x92, 0x3e,
-  0xe6, 0xd1, 0xa3, 0x3c, 0xfe, 0xfd, 0xc3, 0xbe, 0x5e, 0x8a, 0x8d, 0xbe,
-  0x73, 0xa8, 0xf8, 0xbc, 0xe1, 0xa7, 0x89, 0x3c, 0x69, 0x63, 0xe5, 0x3c,
-  0x39, 0x10, 0x43, 0x3e, 0x82, 0x5b, 0x29, 0x3e, 0x19, 0xb7, 0x88, 0xbd,
-  0xa9, 0x2f, 0x54, 0x3e, 0x3a, 0x9d, 0x95, 0x3d, 0x5d, 0x2f, 0xfb, 0x3d,
-  0xb3, 0x10, 0x1a, 0x3e, 0x18, 0x1d, 0xa2, 0xbe, 0x5e, 0xf4, 0x26, 0x3d,
-  0x46, 0x7a, 0x30, 0x3d, 0x1f, 0x29, 0x2b, 0x3f, 0xf1, 0x13, 0xec, 0xbd,
-  0x6b, 0x68, 0x93, 0x3e, 0x2b, 0xeb, 0x83, 0xbe, 0xa2, 0xca, 0x20, 0x3e,
-  0x7f, 0x96, 0x87, 0x3e, 0x7b, 0x26, 0x9f, 0xbe, 0xe3, 0xff, 0x55, 0x3e,
-  0x18, 0x8d, 0x2e, 0x3d, 0x2f, 0x75, 0x7f, 0x3e, 0x85, 0xd3, 0x4a, 0x3e,
-  0x26, 0xfd, 0x24, 0x3e, 0x8b, 0x58, 0xa2, 0xbc, 0xd1, 0xea, 0x74, 0xbe,
-  0x0a, 0xc5, 0x18, 0xbe, 0x49, 0xc1, 0xb5, 0x3e, 0xe0, 0x8c, 0x8d, 0x3e,
-  0x14, 0xc6, 0xbc, 0xbd, 0xc1, 0x77, 0xbc, 0x3c, 0x38, 0x58, 0x95, 0x3e,
-  0x21, 0x3b, 0x27, 0xbe, 0x59, 0x50, 0x64, 0x3d, 0xe6, 0xc4, 0xfc, 0xbd,
-  0xbe, 0x3c, 0x47, 0x3e, 0xc1, 0x80, 0x8e, 0xbd, 0x2b, 0xf6, 0xde, 0x3d,
-  0x6e, 0xcf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x2f, 0x00, 0x00,
-  0x88, 0x82, 0xbd, 0xbc, 0x8e, 0xd6, 0xfa, 0xbd, 0xcb, 0xe1, 0x7c, 0xbd,
-  0x45, 0x10, 0xa1, 0x3d, 0x42, 0xa6, 0x84, 0xbc, 0x5b, 0xe3, 0x64, 0xbd,
-  0xd3, 0x2f, 0x87, 0xbc, 0xdb, 0xf0, 0xe7, 0x3d, 0x3b, 0x4c, 0x5a, 0xbd,
-  0xf9, 0xed, 0x90, 0x3d, 0x1a, 0xd6, 0xc0, 0x3c, 0x4f, 0xb1, 0x2b, 0x3d,
-  0xa9, 0x70, 0x8d, 0x3d, 0xf6, 0x7e, 0x82, 0x3e, 0xac, 0x74, 0x95, 0x3d,
-  0x8a, 0x40, 0x97, 0xbc, 0xed, 0xad, 0x07, 0xbd, 0x65, 0x1e, 0x6f, 0x3c,
-  0xa7, 0x71, 0x21, 0xbe, 0x78, 0x11, 0x5c, 0x3b, 0x35, 0x4d, 0x9b, 0xbc,
-  0x8a, 0x28, 0x8c, 0x3d, 0xf9, 0xaa, 0x84, 0x3d, 0x95, 0xdb, 0x19, 0x3e,
-  0x8b, 0x5d, 0x81, 0x3d, 0xf5, 0xdd, 0x0b, 0xbb, 0xe2, 0x52, 0xd3, 0x3b,
-  0xfd, 0x55, 0x83, 0xbc, 0x4c, 0xbc, 0x86, 0xbd, 0x67, 0x03, 0x90, 0x3e,
-  0x1b, 0x8a, 0x30, 0xbb, 0x66, 0x23, 0x43, 0xbd, 0xa8, 0xdf, 0x33, 0x3c,
-  0xb9, 0x61, 0xd7, 0x3d, 0x55, 0x09, 0x58, 0xbd, 0x3f, 0x1f, 0x18, 0xbd,
-  0x93, 0xd8, 0x61, 0xbd, 0x7c, 0xf7, 0x2b, 0x3d, 0xce, 0xa5, 0xdb, 0xbd,
-  0xd5, 0x27, 0x75, 0x3d, 0x4e, 0x5f, 0xdd, 0xbc, 0x22, 0xe6, 0x36, 0x3c,
-  0xeb, 0xaa, 0x0f, 0xbd, 0xb5, 0x6c, 0x3f, 0xbd, 0xbe, 0x65, 0x5b, 0xbc,
-  0xcc, 0xcc, 0x43, 0x3a, 0xe2, 0xed, 0x57, 0x3d, 0xc0, 0xbf, 0x43, 0xbd,
-  0x3b, 0xcd, 0xda, 0xbd, 0xe7, 0xb2, 0x96, 0xbd, 0x40, 0x0e, 0xb5, 0xbc,
-  0x21, 0x8a, 0x95, 0xbc, 0x3b, 0x7d, 0xef, 0xbc, 0x52, 0x05, 0xdb, 0x3c,
-  0x69, 0x52, 0x8a, 0x3d, 0x8f, 0x73, 0xe0, 0x3d, 0x62, 0xe1, 0xbf, 0xbd,
-  0x59, 0x7a, 0x0d, 0x3d, 0xfe, 0x25, 0x39, 0xbe, 0x6f, 0x4b, 0xf5, 0xbd,
-  0xa3, 0xb2, 0xa5, 0xbd, 0x1d, 0x31, 0x07, 0x3e, 0x63, 0x80, 0x54, 0x3e,
-  0xa4, 0xba, 0x5a, 0xbd, 0xf3, 0xa2, 0xfd, 0xbd, 0xd2, 0x11, 0x89, 0xb8,
-  0x58, 0xb3, 0x1b, 0x3c, 0x03, 0xaa, 0x61, 0xbc, 0x18, 0x30, 0xb0, 0x3b,
-  0x4a, 0x09, 0xeb, 0x3d, 0x09, 0x9a, 0x88, 0x3d, 0x83, 0x10, 0x14, 0x3d,
-  0x85, 0xd1, 0x99, 0xbd, 0x1d, 0x31, 0x2e, 0x3d, 0x27, 0x65, 0xf6, 0xbd,
-  0x00, 0x91, 0x9c, 0xbd, 0xd5, 0x4e, 0x3c, 0xbd, 0xfa, 0x7a, 0x90, 0x3d,
-  0x3b, 0x2f, 0x8b, 0x3d, 0x23, 0x64, 0x43, 0xbd, 0x98, 0xed, 0xb6, 0xbc,
-  0x9c, 0x55, 0x11, 0x3d, 0x92, 0xca, 0x09, 0x3d, 0xf4, 0x17, 0xc2, 0xbd,
-  0xae, 0x00, 0x31, 0x3d, 0xb7, 0x2f, 0x16, 0xbd, 0xfb, 0x1a, 0x99, 0xbd,
-  0x07, 0xc2, 0x03, 0xbc, 0xb4, 0x01, 0xbb, 0xbc, 0x66, 0x55, 0x00, 0xbd,
-  0x61, 0x7d, 0xfd, 0xbc, 0x44, 0x8d, 0xd9, 0xbc, 0x28, 0xfc, 0x18, 0x3d,
-  0x41, 0x0e, 0x99, 0x3d, 0x76, 0xe5, 0x8e, 0x3d, 0x7f, 0x25, 0x45, 0xbd,
-  0xab, 0x79, 0x2c, 0xbe, 0x5e, 0x4c, 0x14, 0xbd, 0x00, 0xe2, 0xdc, 0xbc,
-  0x1b, 0xfa, 0x34, 0x3c, 0x46, 0xb8, 0xc8, 0xbd, 0x10, 0xda, 0x14, 0xbd,
-  0x7f, 0x32, 0x2b, 0xbd, 0x3e, 0x4f, 0x84, 0x3d, 0x33, 0x3a, 0x8a, 0xbd,
-  0x37, 0xd3, 0x7b, 0x3c, 0x55, 0xbf, 0x0c, 0xbe, 0xaf, 0x96, 0x76, 0xbd,
-  0x96, 0x44, 0x78, 0xbc, 0xf7, 0x51, 0x45, 0x3e, 0x2f, 0xb1, 0xea, 0x3b,
-  0x3f, 0x0d, 0x03, 0xbd, 0x12, 0xd2, 0x3c, 0xbe, 0x63, 0x57, 0xcb, 0xbb,
-  0x72, 0xff, 0xdd, 0x3b, 0x68, 0xb8, 0xd9, 0xbc, 0x7f, 0x98, 0x5b, 0x3d,
-  0x58, 0x96, 0x84, 0x3d, 0x8e, 0x55, 0x4b, 0x3c, 0x69, 0xc7, 0xf0, 0x3d,
-  0x1c, 0xfa, 0xa6, 0xbc, 0x13, 0x35, 0x89, 0x3d, 0x80, 0xda, 0xe0, 0xbd,
-  0x15, 0xa4, 0xdb, 0xbd, 0x31, 0x2a, 0x63, 0xbd, 0x80, 0x20, 0x6c, 0x3e,
-  0x76, 0xe2, 0x1d, 0x3d, 0x4a, 0x4b, 0x21, 0xbe, 0xf9, 0x3f, 0x20, 0xbe,
-  0xb0, 0xcd, 0x33, 0x3c, 0x6f, 0x59, 0xf6, 0xbb, 0xe9, 0x8a, 0x5a, 0x3d,
-  0x74, 0x1f, 0x87, 0x3c, 0xe5, 0x8e, 0x9f, 0x3d, 0xa9, 0x70, 0x41, 0x3c,
-  0x93, 0xf3, 0x0d, 0x3e, 0x4f, 0x67, 0x0b, 0xbb, 0x6b, 0xbd, 0xbe, 0x3d,
-  0xa1, 0x87, 0xae, 0xbd, 0x6b, 0x1a, 0xa2, 0xbb, 0x84, 0x36, 0x8d, 0x3c,
-  0x4c, 0xc7, 0x4c, 0x3e, 0xc0, 0xa3, 0x59, 0x3d, 0xbb, 0xb0, 0x36, 0xbe,
-  0xa0, 0x83, 0x9d, 0xbd, 0x52, 0x99, 0x8d, 0x3d, 0x47, 0xbd, 0x88, 0xbd,
-  0xe2, 0xff, 0x4d, 0x3d, 0x0e, 0xdc, 0x0f, 0x3d, 0x70, 0xe3, 0xd0, 0xbb,
-  0x51, 0xc2, 0xde, 0xbd, 0xdf, 0x6c, 0x16, 0x3d, 0x1f, 0xf9, 0x17, 0x3d,
-  0xe3, 0x69, 0x4f, 0x3d, 0xff, 0xee, 0x5f, 0xbd, 0x61, 0xb2, 0x35, 0xbd,
-  0xa7, 0xa3, 0xd5, 0xbd, 0xd1, 0x1d, 0x4f, 0x3e, 0x42, 0x16, 0x73, 0x3c,
-  0xeb, 0x7f, 0xef, 0xbd, 0x6a, 0x24, 0x72, 0xbd, 0xa7, 0xa1, 0xcc, 0x3b,
-  0xd2, 0x3d, 0x34, 0xbc, 0x47, 0xbc, 0x8b, 0xbd, 0xee, 0x4f, 0x69, 0xbd,
-  0xd3, 0x90, 0xd0, 0x3c, 0x2e, 0x5b, 0x6f, 0x3d, 0x65, 0x43, 0xb8, 0x3d,
-  0x33, 0xe2, 0x7d, 0xbd, 0xba, 0x07, 0x91, 0x3b, 0xad, 0xf8, 0x92, 0xbd,
-  0x00, 0x83, 0xa3, 0x3c, 0x5c, 0x9a, 0x93, 0x3c, 0xe6, 0x91, 0x36, 0x3e,
-  0x75, 0x1f, 0xcb, 0x3d, 0x3d, 0x61, 0x25, 0x3c, 0x90, 0xb4, 0x0e, 0xbe,
-  0x6c, 0xa0, 0x83, 0xbd, 0xa7, 0x2f, 0xc3, 0xbd, 0x5c, 0xc4, 0x99, 0x3d,
-  0x3c, 0x4b, 0x4c, 0x3b, 0x02, 0x9a, 0x66, 0x3c, 0x29, 0x75, 0x76, 0x3d,
-  0x03, 0x76, 0x8d, 0xbc, 0x27, 0x32, 0x15, 0xbd, 0xaa, 0x00, 0xbd, 0xbb,
-  0x36, 0xc5, 0x12, 0xbd, 0x67, 0x01, 0x99, 0xbd, 0x5c, 0xa2, 0x52, 0xbc,
-  0x5b, 0x6e, 0x05, 0x3e, 0xdb, 0xab, 0xb5, 0x3d, 0xfb, 0x20, 0x5e, 0xbd,
-  0xdd, 0x93, 0x05, 0xbc, 0x86, 0xd6, 0x04, 0xbd, 0xa8, 0x33, 0xe8, 0xbc,
-  0x31, 0xa9, 0x5b, 0x39, 0xfb, 0xe1, 0xd8, 0xbd, 0x4e, 0x6d, 0xee, 0x3d,
-  0x89, 0x1d, 0x28, 0x3d, 0x91, 0x0c, 0xbe, 0x3d, 0xcf, 0xd2, 0xec, 0xbc,
-  0xf3, 0xb9, 0x81, 0xbc, 0xd9, 0x9b, 0x65, 0xbb, 0xe7, 0x4b, 0xbd, 0xbd,
-  0xaa, 0xa3, 0x84, 0xbd, 0x28, 0xbe, 0x42, 0x3e, 0x23, 0x1a, 0x7c, 0x3d,
-  0x59, 0x19, 0x23, 0xbd, 0x26, 0xe2, 0x9c, 0xbd, 0x4a, 0x86, 0x88, 0xbd,
-  0xe0, 0xa8, 0x9b, 0x3c, 0x0d, 0xa1, 0xb9, 0x3d, 0xd2, 0xaa, 0x58, 0xbd,
-  0x56, 0x5f, 0x97, 0x3d, 0x30, 0x24, 0x66, 0x3d, 0x75, 0xa2, 0x82, 0x3d,
-  0x42, 0x4c, 0xfc, 0x3b, 0x52, 0xd2, 0xea, 0x3d, 0x38, 0x2f, 0xe9, 0xbb,
-  0xbb, 0x6c, 0x1d, 0xbe, 0x82, 0x92, 0xa4, 0x3d, 0xa6, 0x64, 0x87, 0x3c,
-  0x70, 0xec, 0xa1, 0x3d, 0xc6, 0x61, 0x63, 0xbd, 0x4b, 0x39, 0xa0, 0xbd,
-  0x36, 0xba, 0x22, 0xbd, 0xda, 0x0b, 0x88, 0xbb, 0x0b, 0xb7, 0xd4, 0x39,
-  0xd5, 0x93, 0x10, 0x3d, 0xdf, 0x2d, 0xa5, 0x3d, 0xfc, 0x98, 0x8a, 0xbd,
-  0x85, 0x32, 0x1b, 0x3d, 0x61, 0x54, 0x8d, 0xbc, 0x8a, 0xba, 0x3d, 0xbd,
-  0xb9, 0x57, 0xb7, 0xbd, 0x0d, 0x88, 0x2a, 0x3d, 0xb2, 0xc2, 0x3c, 0x3d,
-  0xb2, 0x6c, 0x23, 0xbc, 0x98, 0x65, 0x08, 0x3c, 0xd7, 0x03, 0x48, 0x3c,
-  0x14, 0x0f, 0xa7, 0xbd, 0x06, 0xb8, 0x01, 0xbc, 0xc1, 0x0b, 0x3a, 0x3d,
-  0xcb, 0x56, 0x2d, 0xbc, 0x07, 0xdd, 0x86, 0x3d, 0x71, 0x44, 0xc4, 0x3b,
-  0xa4, 0x8b, 0x26, 0xbd, 0xdc, 0x6a, 0x90, 0xbd, 0x28, 0x49, 0xc4, 0xbb,
-  0xb8, 0xbc, 0xd3, 0x3c, 0x8c, 0x46, 0x03, 0xbe, 0xd5, 0x32, 0x31, 0xbc,
-  0x13, 0x36, 0x3f, 0xbd, 0x20, 0xf7, 0x9c, 0x3d, 0xf4, 0x45, 0x0c, 0x3c,
-  0x8b, 0x64, 0x6c, 0xbd, 0xf4, 0x7b, 0xd1, 0xbd, 0xeb, 0x48, 0xcc, 0x3c,
-  0x27, 0x13, 0xf7, 0xbd, 0xe3, 0x88, 0x4e, 0x3c, 0x29, 0x9f, 0xd4, 0x3a,
-  0x62, 0x0a, 0xaf, 0x3d, 0xab, 0x78, 0x71, 0x3d, 0xf2, 0xc5, 0x12, 0x3c,
-  0xe0, 0xc6, 0xfa, 0x3c, 0xe0, 0x71, 0x0d, 0x3d, 0x28, 0x7b, 0x16, 0xbd,
-  0x30, 0xea, 0x0a, 0x3d, 0xc6, 0xcd, 0xe4, 0x3b, 0x12, 0xc2, 0x2d, 0x3e,
-  0x1e, 0xa2, 0xaf, 0x3d, 0x19, 0xda, 0x4f, 0xbd, 0x10, 0x6b, 0x26, 0x3d,
-  0x94, 0xad, 0xa4, 0xbc, 0x71, 0x79, 0xe0, 0xbd, 0xd2, 0x12, 0xa7, 0xbd,
-  0x5f, 0xdf, 0xa9, 0x3b, 0xa7, 0xc7, 0x4c, 0xbc, 0x1f, 0xe8, 0x74, 0x3b,
-  0x72, 0xbb, 0x87, 0x3d, 0xd3, 0x54, 0x0c, 0xbd, 0xa9, 0xf6, 0x76, 0x3a,
-  0xb4, 0x82, 0xad, 0x3c, 0xd5, 0xd8, 0xe3, 0xbd, 0x66, 0x3a, 0x00, 0x3d,
-  0xf4, 0x46, 0xb0, 0x3d, 0xdc, 0x8f, 0x1a, 0x3e, 0x75, 0xba, 0xcf, 0xbd,
-  0xb6, 0x21, 0x1a, 0x3d, 0x70, 0xa3, 0x82, 0xbb, 0x1d, 0xfc, 0x2d, 0xbd,
-  0xc5, 0x30, 0x1d, 0xbc, 0xe1, 0x8d, 0xf5, 0xbd, 0x29, 0xb8, 0x95, 0x3d,
-  0x81, 0x44, 0xcf, 0xbc, 0xf1, 0x1c, 0xc7, 0x3c, 0xc9, 0x36, 0x14, 0xbd,
-  0x9a, 0xe3, 0xb9, 0x3c, 0x78, 0x7a, 0xf1, 0xb8, 0x14, 0x24, 0x20, 0xbc,
-  0xe6, 0xf5, 0x12, 0xbd, 0x61, 0x11, 0x57, 0xba, 0x1a, 0xd9, 0x18, 0x3e,
-  0x9a, 0x76, 0x8b, 0xbd, 0x81, 0xce, 0x5b, 0xbd, 0x1e, 0x25, 0x24, 0x3e,
-  0xef, 0x51, 0xce, 0xbd, 0xdb, 0xb7, 0x73, 0x3d, 0x84, 0x8c, 0xdc, 0x3c,
-  0xeb, 0x7f, 0x19, 0xba, 0xac, 0xb4, 0x71, 0x3d, 0xb2, 0x65, 0x5f, 0x3d,
-  0xd8, 0x70, 0xe3, 0xbd, 0xfd, 0x40, 0x92, 0x3d, 0x74, 0xc8, 0xfd, 0xbd,
-  0x8e, 0x74, 0x9e, 0xba, 0xea, 0xb9, 0xba, 0x3c, 0xa7, 0x47, 0x5b, 0x3e,
-  0x86, 0x62, 0x2c, 0x3e, 0xc9, 0x8d, 0xe3, 0xbd, 0xc3, 0x90, 0x61, 0xbe,
-  0xbb, 0x33, 0x04, 0x3d, 0x0f, 0xb7, 0x65, 0xbc, 0x70, 0x16, 0x8d, 0x3c,
-  0xfe, 0xf8, 0x91, 0xbd, 0x54, 0x9b, 0xd0, 0x3d, 0x8d, 0x73, 0xe3, 0x3d,
-  0xa3, 0xe9, 0x0a, 0x3c, 0x49, 0x40, 0x43, 0x3d, 0xce, 0xcc, 0x8b, 0x3d,
-  0xd1, 0xe1, 0xc9, 0xbc, 0x36, 0x20, 0x2b, 0xbd, 0x5f, 0x8f, 0x72, 0x3c,
-  0x70, 0x53, 0x6e, 0x3e, 0xb4, 0x43, 0x33, 0x3e, 0xe8, 0xd7, 0xef, 0xbc,
-  0xe1, 0x78, 0xd4, 0xbd, 0x5c, 0x37, 0x3c, 0xbd, 0x9b, 0x48, 0x2f, 0xbd,
-  0x37, 0xb1, 0x90, 0x3d, 0x87, 0xa0, 0x86, 0xbc, 0x9c, 0xe0, 0x1f, 0x3d,
-  0x89, 0xb5, 0x47, 0x3d, 0x69, 0x91, 0xf6, 0x3d, 0x1f, 0xd6, 0x00, 0xbd,
-  0x2e, 0xec, 0x7e, 0x3d, 0xa5, 0x5a, 0x63, 0xbd, 0xed, 0x79, 0x21, 0xbb,
-  0x53, 0x27, 0x0e, 0xbd, 0x4c, 0x65, 0x90, 0x3e, 0xfd, 0x9e, 0x0b, 0x3d,
-  0x0a, 0xd8, 0x4a, 0xbd, 0xf2, 0x15, 0x0d, 0xbd, 0xdb, 0x3c, 0xf9, 0x3c,
-  0x36, 0x9c, 0x46, 0xbc, 0x9f, 0xb2, 0x11, 0x3d, 0x80, 0xa2, 0x59, 0xbd,
-  0xcc, 0xee, 0x6c, 0x3d, 0x6f, 0x25, 0xf1, 0xbc, 0xb7, 0x1d, 0xab, 0xbc,
-  0x67, 0x77, 0x83, 0xbc, 0x51, 0x2f, 0xa2, 0x3d, 0xf5, 0xd8, 0xe0, 0xbc,
-  0xf2, 0x03, 0x41, 0xbc, 0xd7, 0x5b, 0xcf, 0xbd, 0x07, 0xae, 0x73, 0x3e,
-  0xba, 0x82, 0xb9, 0x3c, 0x16, 0x7b, 0x41, 0xbd, 0x53, 0x4e, 0x81, 0xbd,
-  0x1d, 0x16, 0x76, 0x3c, 0x0c, 0x18, 0x2a, 0xbd, 0x12, 0x57, 0x84, 0x3c,
-  0xbd, 0x8f, 0xe0, 0xbc, 0xe3, 0x95, 0xf4, 0x3c, 0xa2, 0xbf, 0x32, 0x3d,
-  0x2f, 0xda, 0xd9, 0xbc, 0x19, 0x06, 0x4d, 0xbc, 0x5f, 0x99, 0xc8, 0x3c,
-  0x34, 0x1e, 0xc3, 0xbd, 0xaf, 0x43, 0xdb, 0xbd, 0x9c, 0x2f, 0x36, 0xbc,
-  0xc3, 0x5d, 0x45, 0x3e, 0xff, 0x7f, 0xfb, 0x3d, 0xe9, 0x21, 0x10, 0xbd,
-  0x43, 0x5f, 0xe5, 0xbd, 0xcf, 0x7b, 0x13, 0xbd, 0x2a, 0x07, 0x96, 0xbd,
-  0xae, 0xd2, 0x8d, 0x3d, 0x2b, 0x71, 0x64, 0xbd, 0x2a, 0x69, 0xb5, 0x3c,
-  0x1d, 0x09, 0xae, 0x3d, 0xa4, 0xa8, 0x9a, 0x3d, 0xf6, 0xf0, 0x94, 0x3d,
-  0x76, 0x27, 0x9b, 0x3d, 0x31, 0x66, 0x1d, 0xbd, 0xce, 0xe2, 0x86, 0x3c,
-  0xa7, 0x54, 0xca, 0xbc, 0x71, 0xd0, 0xa6, 0x3d, 0x7a, 0xae, 0x60, 0x3d,
-  0xea, 0xfc, 0xbf, 0xbd, 0xb1, 0xa4, 0x15, 0x3d, 0x7e, 0x45, 0x6d, 0xbc,
-  0x6f, 0xe6, 0xa9, 0xbc, 0x3a, 0x65, 0xe9, 0x3c, 0xd8, 0x3b, 0x15, 0x3c,
-  0xf2, 0x08, 0x12, 0x3d, 0x5a, 0x04, 0x53, 0x3d, 0x88, 0x81, 0x9a, 0x3d,
-  0xcf, 0x3c, 0x16, 0x3d, 0x4b, 0xa6, 0xaf, 0x3d, 0xbe, 0x1c, 0xe7, 0x3c,
-  0xb8, 0x92, 0x18, 0xbd, 0x9a, 0x62, 0x7c, 0xbc, 0x26, 0xce, 0x27, 0x3e,
-  0x09, 0x4e, 0x92, 0x3d, 0xe2, 0xa2, 0x16, 0xbd, 0x2d, 0xc3, 0x49, 0xbd,
-  0x78, 0xc4, 0xe1, 0x3c, 0xc2, 0x3a, 0x1c, 0xbd, 0xc4, 0xfb, 0xf5, 0xbc,
-  0xb9, 0xcf, 0xa1, 0xbd, 0xbf, 0x9e, 0x16, 0x3d, 0x31, 0x4a, 0x1c, 0xbc,
-  0x48, 0x01, 0x89, 0x3d, 0xb8, 0x61, 0x7f, 0x3b, 0x66, 0xe0, 0x04, 0x3b,
-  0x9a, 0x5d, 0x87, 0xbd, 0xaa, 0x97, 0x27, 0xbd, 0x43, 0x6f, 0xb5, 0x3b,
-  0xd3, 0x45, 0xda, 0x3d, 0x1e, 0xdb, 0x52, 0xbd, 0xbc, 0x3f, 0x96, 0xbd,
-  0x6c, 0x18, 0x25, 0xbd, 0x03, 0x75, 0x51, 0x3c, 0x97, 0xc9, 0x85, 0xbd,
-  0xf4, 0x0a, 0xa4, 0xbb, 0x87, 0x41, 0xcc, 0x3c, 0x41, 0x10, 0x85, 0x3d,
-  0x89, 0x3a, 0x91, 0x3c, 0x6e, 0xd0, 0x92, 0xbd, 0xae, 0x9f, 0xa5, 0xbc,
-  0x92, 0x2d, 0x88, 0x3d, 0x0d, 0xc5, 0xe8, 0xbd, 0x6a, 0xf3, 0x6a, 0xbd,
-  0x5e, 0x5a, 0xb0, 0x3c, 0xff, 0x6c, 0x9e, 0x3d, 0x0e, 0x76, 0xc8, 0x3d,
-  0x6b, 0x56, 0xb9, 0xbd, 0x3a, 0x23, 0x34, 0xbd, 0xb3, 0x1e, 0x15, 0x3d,
-  0x76, 0x9b, 0x41, 0xbd, 0x82, 0x0f, 0x0c, 0xbd, 0x9b, 0x71, 0x8b, 0x3d,
-  0x30, 0x62, 0x2c, 0xbc, 0x9f, 0x2f, 0xb6, 0x3d, 0xe5, 0xf0, 0x60, 0xbd,
-  0x23, 0x9f, 0xbc, 0x3d, 0x93, 0x36, 0x15, 0x3e, 0x8e, 0x65, 0xf0, 0xbd,
-  0xcc, 0x65, 0x85, 0x3d, 0x47, 0xb6, 0x36, 0x3d, 0x72, 0x12, 0xa6, 0x3d,
-  0x2e, 0x48, 0x50, 0x3d, 0x00, 0x44, 0x12, 0xbe, 0xfa, 0x73, 0xfb, 0xbc,
-  0x20, 0xb4, 0x67, 0xbd, 0xe1, 0x90, 0x06, 0xbe, 0x8f, 0xf1, 0xc1, 0x3c,
-  0x1d, 0x64, 0x63, 0xbd, 0x2d, 0x3e, 0x4f, 0x3d, 0xf2, 0x6a, 0xb0, 0x3d,
-  0xba, 0x49, 0x33, 0x3e, 0xc9, 0x74, 0xf0, 0x3b, 0xd5, 0x12, 0x7e, 0x3d,
-  0xe0, 0x5b, 0xfa, 0xbd, 0xea, 0x94, 0x1c, 0xbb, 0x15, 0xe7, 0x92, 0x3b,
-  0x41, 0xc1, 0x72, 0x3e, 0x08, 0x3a, 0x6a, 0xbb, 0xb2, 0x37, 0x01, 0xbe,
-  0x5e, 0x4d, 0xab, 0xbc, 0x00, 0x6b, 0x43, 0xbd, 0xe7, 0x3a, 0x6b, 0xbd,
-  0xc9, 0xd5, 0xee, 0xbb, 0x10, 0x39, 0x79, 0xbd, 0x49, 0x96, 0xd2, 0x3d,
-  0x84, 0xc8, 0x19, 0x3d, 0x28, 0x4c, 0xe9, 0xbc, 0x0c, 0xc6, 0x37, 0xbd,
-  0x36, 0x77, 0x8b, 0x3d, 0xdf, 0xf3, 0xda, 0xbd, 0xa7, 0x78, 0xb8, 0xbd,
-  0x7f, 0x5a, 0x85, 0xbd, 0x5d, 0xf7, 0xe7, 0x3d, 0x89, 0x34, 0xf4, 0x3d,
-  0x72, 0xed, 0x16, 0xbe, 0xe8, 0x9e, 0xb1, 0xbd, 0x80, 0x4d, 0x4d, 0x3d,
-  0x13, 0x10, 0x3c, 0xbe, 0xbb, 0x3a, 0x5e, 0xbc, 0x53, 0x3f, 0x9d, 0x3b,
-  0x7f, 0x15, 0x15, 0xbb, 0x71, 0xca, 0x00, 0xbd, 0x70, 0x05, 0xf0, 0xba,
-  0xb2, 0x95, 0x30, 0xbd, 0x0d, 0x0b, 0x06, 0x3e, 0xd4, 0xab, 0x83, 0xbd,
-  0x53, 0x45, 0x9d, 0xbd, 0x98, 0xe1, 0xf8, 0xbc, 0x65, 0xe4, 0x4a, 0x3e,
-  0xde, 0xcd, 0xb4, 0x3d, 0xb9, 0x0c, 0x01, 0xbe, 0x9e, 0x4c, 0x95, 0xbd,
-  0xf7, 0xaa, 0xec, 0x3c, 0xc9, 0xba, 0x81, 0x3c, 0x43, 0xba, 0xb1, 0x3d,
-  0x7e, 0xae, 0x29, 0x3d, 0x21, 0x1d, 0x36, 0xbc, 0x8e, 0x01, 0xa0, 0xbd,
-  0xbe, 0xd2, 0xcd, 0x3d, 0xeb, 0x22, 0xf3, 0x3d, 0x23, 0x24, 0xf2, 0x3d,
-  0xb9, 0x97, 0xf3, 0xbc, 0xc0, 0x5d, 0x3c, 0xbc, 0x4b, 0x0d, 0xc2, 0xbd,
-  0x17, 0xa5, 0x7d, 0x3e, 0x5e, 0x15, 0x89, 0x3d, 0x37, 0xa5, 0x10, 0xbe,
-  0xf6, 0x8e, 0xf3, 0x3a, 0xa8, 0x4e, 0xd8, 0xbd, 0x8e, 0x41, 0xf2, 0x3c,
-  0xcb, 0x9b, 0x90, 0xbc, 0x1a, 0xd6, 0x05, 0xbd, 0x78, 0xfe, 0x8a, 0x3d,
-  0x1c, 0x0a, 0x21, 0x3d, 0x54, 0x79, 0xc5, 0x3d, 0xc9, 0x3f, 0x6a, 0xbc,
-  0x0c, 0x59, 0xcf, 0x3d, 0xa7, 0xfe, 0x24, 0xbe, 0xbd, 0xbd, 0x40, 0xbd,
-  0x62, 0x14, 0x8a, 0xbd, 0xe5, 0x8e, 0x4d, 0x3e, 0xf7, 0x87, 0x6a, 0x3d,
-  0x56, 0x68, 0x2a, 0xbe, 0xa7, 0xd1, 0x12, 0x3d, 0xda, 0xc5, 0xdf, 0xb9,
-  0x3f, 0x26, 0x7f, 0x3b, 0xbc, 0xd7, 0x63, 0x3d, 0x73, 0x6f, 0xcb, 0xbd,
-  0xff, 0x2c, 0x12, 0xbd, 0x7e, 0x90, 0x92, 0x3c, 0x05, 0xee, 0xfc, 0x3c,
-  0x64, 0xfe, 0x95, 0xbd, 0xd0, 0x30, 0xe7, 0x3c, 0x4c, 0x0b, 0xf9, 0xbd,
-  0xeb, 0xa5, 0xe7, 0xbc, 0x6c, 0x4f, 0x58, 0xbd, 0xac, 0x96, 0x36, 0x3e,
-  0x5b, 0xb2, 0x9d, 0x3d, 0xaf, 0x49, 0x18, 0xbd, 0x61, 0x86, 0x05, 0xbe,
-  0x79, 0xb1, 0x43, 0x3d, 0xa5, 0x66, 0x18, 0xbe, 0xd7, 0xdf, 0x92, 0x3d,
-  0x0e, 0xaa, 0xee, 0xbb, 0x9e, 0x70, 0x4b, 0xbb, 0x2b, 0x49, 0x45, 0x3d,
-  0x5d, 0x0b, 0x90, 0x3d, 0x38, 0x0a, 0xa0, 0xbd, 0xe8, 0xd7, 0x0f, 0x3d,
-  0xca, 0xf2, 0x93, 0xbd, 0x5c, 0xd1, 0xbd, 0xbd, 0xc4, 0x9b, 0xb6, 0xbd,
-  0x07, 0x7d, 0x27, 0x3e, 0x32, 0x96, 0xa4, 0x3d, 0x67, 0x8b, 0x6c, 0xbd,
-  0x11, 0xb6, 0xdd, 0xbd, 0x04, 0xa6, 0x9d, 0xbd, 0x42, 0xa0, 0xf5, 0xbc,
-  0x5d, 0xe3, 0x00, 0xbc, 0x8a, 0x49, 0x1a, 0x3c, 0xb6, 0xd1, 0xd9, 0x3d,
-  0x8f, 0xb0, 0x54, 0x3d, 0x97, 0x4c, 0xb3, 0x3d, 0x3b, 0xe5, 0x3e, 0xbd,
-  0xff, 0x12, 0x95, 0x3c, 0x44, 0xa9, 0xed, 0xbc, 0x86, 0x10, 0x6c, 0xbd,
-  0x58, 0x7f, 0x00, 0xbd, 0xd3, 0x40, 0x61, 0x3e, 0x7c, 0xa9, 0x2d, 0x3e,
-  0xbd, 0x9e, 0xd6, 0xbc, 0x18, 0x27, 0x13, 0xbe, 0xf9, 0x0d, 0x5f, 0x3c,
-  0x0a, 0xdc, 0xcd, 0xbd, 0x23, 0x6f, 0x16, 0xbd, 0x7a, 0xc9, 0x4f, 0xbc,
-  0xba, 0x00, 0xe5, 0x3c, 0x30, 0x54, 0x4b, 0x3c, 0xab, 0x2d, 0x87, 0x3d,
-  0x24, 0x07, 0x9c, 0xbc, 0x9a, 0x5a, 0x1c, 0x3c, 0x66, 0x1a, 0x91, 0x39,
-  0xc5, 0xe5, 0xdc, 0xbc, 0xe6, 0xa8, 0xe3, 0x3c, 0x78, 0x90, 0xb8, 0x3d,
-  0x60, 0x56, 0xef, 0x3d, 0xfc, 0x1f, 0xf3, 0xbc, 0xb2, 0x0d, 0x20, 0x3c,
-  0xf6, 0x2d, 0x51, 0xbd, 0xcb, 0x2c, 0x98, 0xbd, 0xd2, 0x59, 0xa6, 0xbd,
-  0x0e, 0x28, 0x71, 0x3d, 0x78, 0x7e, 0x29, 0xbd, 0x7b, 0x7e, 0x8b, 0xbd,
-  0xfd, 0x05, 0xd4, 0x3c, 0x28, 0x13, 0xd6, 0xbd, 0x3a, 0x09, 0x11, 0x3d,
-  0x65, 0xd5, 0x91, 0x3d, 0xc6, 0xa1, 0xe1, 0x3c, 0x64, 0x2a, 0x82, 0x3d,
-  0x1b, 0x53, 0x51, 0xbd, 0x54, 0xdc, 0xea, 0x3d, 0x79, 0xd3, 0x24, 0xbe,
-  0x09, 0x1d, 0x4c, 0x3c, 0x61, 0xea, 0xb0, 0x3d, 0xd8, 0x22, 0x6c, 0xbc,
-  0x85, 0xf6, 0xd5, 0x3c, 0x3d, 0xd0, 0x96, 0x3c, 0x8b, 0xff, 0x9c, 0x3c,
-  0x47, 0x42, 0xca, 0xbc, 0x98, 0x3a, 0xce, 0xbc, 0x54, 0x98, 0x06, 0x3d,
-  0x96, 0x92, 0x5c, 0xbd, 0xb2, 0xa1, 0x9c, 0xbd, 0x8d, 0x4b, 0x02, 0xbb,
-  0x0c, 0xb1, 0x5e, 0x3c, 0xa5, 0x7a, 0x9e, 0x3d, 0x83, 0x81, 0x81, 0x3d,
-  0x66, 0x00, 0xef, 0x3c, 0x46, 0x68, 0x55, 0xbd, 0xd1, 0x2f, 0x82, 0xbc,
-  0x5d, 0x21, 0xcc, 0x3c, 0x9a, 0xdd, 0x3c, 0xbd, 0x8a, 0xcf, 0x4d, 0xbc,
-  0x8d, 0x26, 0x78, 0xbb, 0xe5, 0xf1, 0x51, 0x3d, 0x88, 0x8d, 0xa6, 0xbd,
-  0x0e, 0xa7, 0xda, 0xbd, 0x5a, 0x25, 0xc8, 0xbc, 0x90, 0xca, 0x95, 0xbd,
-  0xf2, 0x36, 0xa6, 0xbd, 0x59, 0x5f, 0xb4, 0x3c, 0xfe, 0x00, 0x18, 0x3e,
-  0xa5, 0x19, 0x6b, 0x3d, 0xe8, 0xdb, 0x0d, 0xbe, 0x5e, 0xb5, 0xb8, 0xbd,
-  0x7a, 0xac, 0xa7, 0xbd, 0x18, 0xc7, 0x89, 0xbd, 0x45, 0x8d, 0x54, 0x3c,
-  0x6e, 0x63, 0x80, 0x3d, 0x0e, 0x27, 0x4d, 0x3d, 0xb9, 0xe6, 0x4b, 0x3d,
-  0x87, 0x1d, 0xca, 0xbd, 0xdf, 0x85, 0x5f, 0xbd, 0x66, 0xed, 0x95, 0x3d,
-  0x00, 0xe4, 0x2e, 0xbd, 0xa4, 0x16, 0x4f, 0xbd, 0xa1, 0x4c, 0xc7, 0xbd,
-  0x7d, 0x10, 0xd0, 0x3d, 0x1a, 0x1a, 0xa1, 0x3d, 0x56, 0x60, 0xdf, 0xbd,
-  0x55, 0xd6, 0xb6, 0xbc, 0x29, 0x25, 0x59, 0xbc, 0x98, 0x1a, 0xef, 0x3c,
-  0x95, 0x18, 0x9d, 0x3c, 0xb6, 0xac, 0x0c, 0x3b, 0xa7, 0xb0, 0xa0, 0xbd,
-  0x2b, 0xcd, 0x9f, 0xbb, 0xa8, 0x9c, 0xa5, 0xbc, 0xa8, 0x36, 0x86, 0xbd,
-  0xf7, 0xa1, 0xda, 0x3c, 0xb4, 0xc6, 0xbc, 0xbd, 0x84, 0x34, 0x28, 0x3a,
-  0xbb, 0x45, 0xa0, 0x3b, 0xaf, 0x13, 0x1e, 0x3e, 0xf2, 0xc3, 0xe5, 0x3d,
-  0xc9, 0xec, 0x4f, 0xbc, 0xb6, 0x9d, 0xb1, 0xbc, 0xfa, 0x64, 0xa5, 0xbc,
-  0xc4, 0x2e, 0xd9, 0xbd, 0x79, 0x12, 0x89, 0x3c, 0xc2, 0x18, 0x43, 0xbd,
-  0xdb, 0x61, 0xd7, 0xbc, 0x18, 0x29, 0x5f, 0x3d, 0xe2, 0xc3, 0x73, 0xbc,
-  0x1a, 0x85, 0x64, 0xbd, 0x5a, 0x35, 0x89, 0x3c, 0x5c, 0x23, 0xba, 0x3c,
-  0x6c, 0x33, 0x29, 0xbc, 0x29, 0x3b, 0x1f, 0xbd, 0x32, 0x4e, 0xe1, 0x3d,
-  0x20, 0xa4, 0x07, 0x3e, 0xea, 0x14, 0x04, 0xbd, 0xe3, 0xbb, 0x76, 0xbd,
-  0xa5, 0x53, 0x5d, 0x3d, 0x96, 0xe5, 0x01, 0x3d, 0xb6, 0xbd, 0xc9, 0x3c,
-  0x54, 0x1e, 0x03, 0x3d, 0x53, 0xfe, 0x17, 0xbb, 0xf3, 0x65, 0xd2, 0x3c,
-  0xd2, 0x19, 0xc8, 0x3d, 0x77, 0x9c, 0xb9, 0x3d, 0xf0, 0x8d, 0x8f, 0x3d,
-  0x39, 0x0a, 0x85, 0xbd, 0x45, 0x12, 0x10, 0x3c, 0xbb, 0x8b, 0x15, 0x3d,
-  0xdc, 0xcc, 0x55, 0x3e, 0x42, 0x06, 0x24, 0x3e, 0x3c, 0xb4, 0x3e, 0xbe,
-  0x14, 0xdf, 0x12, 0xbc, 0x48, 0xc2, 0x90, 0x3d, 0x3b, 0xea, 0x9b, 0x3c,
-  0x83, 0x9e, 0x8f, 0x3d, 0x97, 0x62, 0x34, 0xbc, 0xa0, 0xcc, 0xf0, 0x3d,
-  0xa1, 0x64, 0x2c, 0x3d, 0xbc, 0x55, 0xb5, 0x3d, 0x15, 0x23, 0xaf, 0x3d,
-  0x56, 0x1a, 0xd4, 0x3d, 0xf9, 0x6b, 0xf1, 0xbc, 0x29, 0x69, 0x45, 0xbc,
-  0x36, 0x3a, 0x0d, 0xbc, 0x23, 0xb2, 0x6f, 0x3e, 0xed, 0xbb, 0xb0, 0x3d,
-  0xcf, 0x20, 0xfb, 0xbd, 0xfc, 0x11, 0xc5, 0x3c, 0xda, 0x3e, 0xb6, 0xbd,
-  0x74, 0x2c, 0x2f, 0x3d, 0xf5, 0xaa, 0x97, 0x3d, 0x4b, 0x9c, 0xd4, 0x3d,
-  0x3c, 0x8d, 0xa5, 0x3b, 0x9c, 0x1d, 0xf3, 0x3c, 0x86, 0xa5, 0xaa, 0x3c,
-  0xf1, 0xbc, 0xe8, 0xbc, 0x26, 0x9f, 0x24, 0x3d, 0xc1, 0xb9, 0x9c, 0xbd,
-  0x4a, 0x27, 0x31, 0xbc, 0x5d, 0x6a, 0x76, 0x3c, 0x39, 0xa4, 0x5a, 0x3e,
-  0x5c, 0x26, 0x0b, 0xbd, 0xb5, 0xaa, 0xb2, 0xbd, 0xea, 0xcc, 0x5f, 0xbc,
-  0x8b, 0x0c, 0x9e, 0xbd, 0x9d, 0x87, 0x25, 0xbd, 0x39, 0x4a, 0x15, 0x3d,
-  0x58, 0x19, 0x27, 0x3d, 0xd3, 0x20, 0x14, 0x3e, 0x81, 0xe5, 0x56, 0xbd,
-  0x20, 0x70, 0x4f, 0x3d, 0x05, 0xce, 0x48, 0x3a, 0xd5, 0x24, 0x01, 0x3d,
-  0x02, 0x4d, 0x8d, 0xbd, 0x4d, 0x07, 0x81, 0xbd, 0xed, 0x6a, 0x35, 0x3d,
-  0xc9, 0xf7, 0xb4, 0x3d, 0xee, 0xfe, 0xa7, 0x3d, 0x06, 0x35, 0x73, 0xbd,
-  0x81, 0xdc, 0xb5, 0xbd, 0x91, 0x07, 0xe6, 0xbd, 0x53, 0x55, 0x71, 0xbd,
-  0x0a, 0x6a, 0x74, 0x3d, 0x58, 0xc6, 0x0a, 0xbd, 0x8c, 0xa9, 0xba, 0x3c,
-  0x39, 0x37, 0xae, 0xbc, 0xc9, 0x1b, 0xe2, 0x3b, 0x64, 0x20, 0x07, 0xbd,
-  0xeb, 0xfa, 0xb3, 0x3d, 0x3f, 0xe3, 0xa7, 0xbd, 0xd9, 0x0f, 0x52, 0xbd,
-  0x4b, 0xde, 0xb3, 0xbd, 0x7c, 0x70, 0x38, 0x3e, 0xa8, 0x67, 0x45, 0x3d,
-  0xac, 0x91, 0x1c, 0xbe, 0xd5, 0xdf, 0xf9, 0xbd, 0x4e, 0x4f, 0x03, 0xbe,
-  0x02, 0x62, 0x26, 0xbe, 0x1c, 0x59, 0x39, 0x3b, 0x89, 0x60, 0x90, 0xbd,
-  0xdd, 0xc1, 0x5e, 0x3d, 0x33, 0xa3, 0xb9, 0x3d, 0x45, 0x4f, 0x7b, 0x3c,
-  0x46, 0x1f, 0xc0, 0xbd, 0x02, 0x47, 0x0c, 0x3e, 0x67, 0x1a, 0xde, 0xbd,
-  0xdf, 0x7e, 0x25, 0x3c, 0xdc, 0x94, 0xcf, 0x3c, 0xbd, 0x4d, 0x11, 0x3e,
-  0xaa, 0xcf, 0xfe, 0x3c, 0xd8, 0xee, 0xe8, 0x3b, 0x75, 0xd2, 0x9b, 0xbd,
-  0xc7, 0x3e, 0x34, 0x3b, 0xc4, 0x5d, 0x1a, 0xbe, 0xed, 0x42, 0x9e, 0x3d,
-  0x6f, 0xae, 0x0d, 0xbd, 0xac, 0xf0, 0x5e, 0x3d, 0xbf, 0x5c, 0x7a, 0xbc,
-  0x4a, 0x8b, 0xd1, 0x3c, 0x41, 0x14, 0x7a, 0xbd, 0xe2, 0x02, 0x02, 0x3d,
-  0xcd, 0xb4, 0xb4, 0xbc, 0x62, 0x36, 0x8e, 0x3c, 0xd6, 0x60, 0xb7, 0xbd,
-  0xd2, 0x08, 0x5f, 0x3e, 0x21, 0xf8, 0xda, 0x3b, 0x9a, 0x7b, 0xab, 0xbd,
-  0x86, 0xa1, 0x62, 0xbd, 0x58, 0xfd, 0xb6, 0xbd, 0x1f, 0xf2, 0x9c, 0xbd,
-  0x7a, 0x13, 0xae, 0xbd, 0x5c, 0x17, 0x20, 0x3d, 0x56, 0x8c, 0x80, 0x3d,
-  0x06, 0x2f, 0xaf, 0x3d, 0xae, 0x3e, 0xac, 0x3b, 0xae, 0xf8, 0xbb, 0xbd,
-  0x1f, 0xc4, 0xb9, 0x3d, 0x24, 0x31, 0x10, 0xbd, 0x68, 0x97, 0xc9, 0xbc,
-  0xf4, 0x85, 0x19, 0xbb, 0x7a, 0xfa, 0x00, 0xbb, 0xb3, 0x21, 0xc3, 0x3d,
-  0xfd, 0x73, 0x98, 0xbd, 0x18, 0xf8, 0x2d, 0xbe, 0x47, 0x9a, 0x9b, 0xbd,
-  0x8c, 0xa8, 0x76, 0xbd, 0xbb, 0x96, 0xdb, 0xbb, 0xf4, 0x10, 0x9f, 0xbc,
-  0xe6, 0x9f, 0x8b, 0x3d, 0xca, 0x6d, 0xc1, 0x3b, 0x2f, 0x68, 0x80, 0x3c,
-  0x78, 0x56, 0x88, 0xbd, 0x7a, 0x61, 0x49, 0x3d, 0x82, 0x01, 0x9b, 0xbd,
-  0xb6, 0x61, 0x6b, 0xbd, 0x47, 0xb6, 0x0a, 0xbc, 0xd0, 0xb0, 0x61, 0x3d,
-  0x29, 0xe6, 0xb4, 0x3d, 0xba, 0x9e, 0x08, 0xbe, 0x49, 0x03, 0xb7, 0xbc,
-  0x31, 0xd6, 0x03, 0xbe, 0x34, 0x9d, 0x22, 0x3c, 0x1b, 0x88, 0x43, 0x3d,
-  0xf3, 0x24, 0xb3, 0x3c, 0xcd, 0xa1, 0xfb, 0xbb, 0x45, 0x57, 0x9b, 0xbc,
-  0x18, 0x34, 0x90, 0x3b, 0x39, 0x36, 0x8e, 0x3c, 0x7e, 0xd6, 0x97, 0x3c,
-  0x42, 0x0d, 0x37, 0xbe, 0x28, 0x56, 0x15, 0xbe, 0x8e, 0xfa, 0x1f, 0x3d,
-  0xfe, 0xc3, 0x97, 0x3b, 0x39, 0xfc, 0x06, 0x3e, 0x51, 0x26, 0x0c, 0xbe,
-  0xc2, 0x1d, 0x20, 0xbd, 0xe1, 0xa2, 0xf4, 0xbd, 0x54, 0xb9, 0xef, 0xbb,
-  0xbc, 0x14, 0xaf, 0x3c, 0x65, 0x57, 0x08, 0xbe, 0xde, 0xde, 0x23, 0xbd,
-  0xe6, 0x8f, 0x5d, 0x3d, 0xfc, 0x64, 0xda, 0x3c, 0x19, 0x3c, 0x08, 0xbd,
-  0xf1, 0xbb, 0x65, 0x3d, 0x07, 0xf4, 0x16, 0xbd, 0x2b, 0x6f, 0xed, 0xbb,
-  0xf5, 0xe8, 0x0f, 0xbc, 0x37, 0x63, 0x94, 0x3d, 0x23, 0x78, 0x5a, 0x3e,
-  0xc4, 0x03, 0xb8, 0xbc, 0x0b, 0x4b, 0x45, 0xbd, 0xef, 0xe4, 0x3b, 0x3c,
-  0xd6, 0x3e, 0x63, 0x3c, 0x31, 0x0d, 0x23, 0x3d, 0xb8, 0x0d, 0x5d, 0x3d,
-  0x42, 0xb2, 0x68, 0x3c, 0x07, 0x1b, 0x04, 0xbd, 0xe9, 0x18, 0xb4, 0x3c,
-  0x5d, 0x30, 0x54, 0xbc, 0x8b, 0x1d, 0x15, 0x3a, 0x69, 0xd0, 0x94, 0xbd,
-  0x53, 0x70, 0x71, 0xbd, 0x2e, 0xc3, 0x95, 0x3c, 0xce, 0x76, 0x70, 0x3d,
-  0x90, 0x99, 0xf3, 0x3d, 0xbd, 0xb2, 0x01, 0xbe, 0x8d, 0xe0, 0x1a, 0xbe,
-  0x67, 0x9e, 0x65, 0xbd, 0xcf, 0x4c, 0x0e, 0xbe, 0x12, 0x12, 0x90, 0xbc,
-  0xca, 0xb5, 0x28, 0x3b, 0xb6, 0xfb, 0xc2, 0xbb, 0x7a, 0x55, 0x25, 0x3b,
-  0x61, 0x9c, 0xfd, 0x3c, 0x8e, 0x5b, 0x4d, 0xbd, 0x2e, 0xe4, 0xc5, 0x3d,
-  0x75, 0xb3, 0x85, 0xbd, 0x3a, 0x86, 0x9c, 0xbd, 0xdf, 0xc9, 0x9e, 0xbd,
-  0x86, 0x59, 0x21, 0x3d, 0x92, 0xaa, 0x17, 0x3d, 0x1c, 0x03, 0x09, 0xbe,
-  0xf9, 0x1c, 0x17, 0xbe, 0x4a, 0x35, 0xc2, 0x3d, 0x67, 0x54, 0x12, 0x3d,
-  0xcd, 0x2d, 0xb5, 0xbc, 0xf6, 0x1c, 0x88, 0xbd, 0xa1, 0x24, 0xba, 0x3d,
-  0x7c, 0x15, 0x41, 0xbd, 0x5e, 0xca, 0x2a, 0x3e, 0x84, 0x4a, 0x45, 0x3c,
-  0x8f, 0x46, 0x86, 0x3d, 0x12, 0x53, 0x15, 0xbd, 0x59, 0x10, 0x20, 0xbc,
-  0xf2, 0x7a, 0x1d, 0x3d, 0x54, 0x07, 0x2f, 0x3e, 0x71, 0x60, 0x94, 0x3d,
-  0x62, 0xff, 0x13, 0xbe, 0x74, 0x6f, 0x24, 0x3c, 0x6a, 0x87, 0xb0, 0xbd,
-  0xc9, 0xb0, 0x60, 0x3d, 0x64, 0x41, 0x26, 0x3d, 0x10, 0x2d, 0x16, 0xbc,
-  0x5e, 0xe2, 0xd5, 0x3b, 0x85, 0x87, 0x6a, 0xbd, 0x5f, 0x73, 0xae, 0x3d,
-  0x43, 0xfe, 0x15, 0xbc, 0x21, 0x5b, 0xa5, 0x3d, 0xd0, 0x0b, 0x51, 0xbd,
-  0x55, 0x1d, 0x03, 0xbd, 0x98, 0x0e, 0x96, 0x3c, 0x25, 0x43, 0x53, 0x3e,
-  0x51, 0x02, 0x5e, 0x3e, 0x73, 0xf4, 0x97, 0xbd, 0x3a, 0x59, 0x60, 0xbd,
-  0x85, 0x8f, 0x8e, 0xbd, 0xa6, 0xaa, 0x01, 0xbd, 0x54, 0xc2, 0x3d, 0xbc,
-  0x0c, 0x38, 0x2f, 0xbd, 0x99, 0xfb, 0x7f, 0x3d, 0x5b, 0xc8, 0x11, 0xbd,
-  0x35, 0xf1, 0xf6, 0x3d, 0x0d, 0x42, 0xf2, 0xba, 0xb0, 0x87, 0x04, 0xbc,
-  0xfe, 0xa5, 0xcd, 0xbc, 0x06, 0x80, 0xb2, 0x3c, 0xe8, 0x4d, 0x89, 0xbc,
-  0x00, 0xf5, 0x4e, 0x3e, 0x10, 0xd0, 0x7f, 0x3d, 0x6c, 0x01, 0x90, 0xbc,
-  0x58, 0x80, 0xe5, 0xbc, 0x1d, 0x1c, 0x57, 0x3d, 0xe0, 0x4b, 0x7c, 0xbd,
-  0x11, 0x52, 0xde, 0xbc, 0x70, 0x55, 0x6b, 0xbd, 0x11, 0x0b, 0x8f, 0x3b,
-  0xb9, 0xda, 0x71, 0x3d, 0x1a, 0xbf, 0x91, 0xbc, 0x96, 0x58, 0xa6, 0xbd,
-  0xdb, 0x9e, 0x88, 0x3d, 0xf2, 0xa5, 0x66, 0x39, 0xfb, 0x2f, 0x70, 0xbb,
-  0x12, 0x54, 0x28, 0xbd, 0x6c, 0x96, 0xeb, 0x3d, 0xed, 0x1a, 0xd2, 0x3d,
-  0xf1, 0xe8, 0x27, 0xbe, 0x06, 0x34, 0x83, 0xbc, 0x5a, 0x93, 0x5b, 0x3b,
-  0xf3, 0x20, 0xba, 0xbb, 0x47, 0x80, 0x6e, 0xbd, 0x92, 0x5a, 0x9d, 0xbc,
-  0x14, 0xbb, 0x90, 0x3d, 0xfd, 0x74, 0xfd, 0x3d, 0x60, 0x16, 0xf8, 0x3c,
-  0x0d, 0xf2, 0x12, 0xbc, 0x77, 0x64, 0x09, 0xbd, 0xa9, 0x1b, 0xd6, 0xbc,
-  0x7f, 0x12, 0xd3, 0xbd, 0xac, 0x07, 0x4b, 0x3d, 0x10, 0x96, 0x58, 0x3d,
-  0xd0, 0x48, 0xab, 0x3d, 0x4f, 0x01, 0xe2, 0xbc, 0x2c, 0xba, 0x8b, 0xbc,
-  0x08, 0x2d, 0x08, 0x3d, 0x42, 0x9f, 0xb4, 0xbd, 0x83, 0x1b, 0x2e, 0x3d,
-  0xbf, 0x38, 0x6a, 0x3d, 0xb9, 0x9f, 0x1d, 0xbd, 0xc1, 0xea, 0x2d, 0x3d,
-  0xb0, 0xdb, 0x66, 0xbd, 0x4c, 0xfd, 0xc9, 0x3d, 0x2f, 0x4a, 0x0a, 0x3d,
-  0x2f, 0xcb, 0x9d, 0xbd, 0x52, 0xf0, 0x1e, 0xbc, 0x1c, 0x4a, 0xf7, 0xbb,
-  0x20, 0x24, 0xaa, 0xbd, 0xb0, 0x5a, 0xa3, 0x3d, 0xef, 0x44, 0x54, 0xbd,
-  0x49, 0xde, 0xb5, 0x3d, 0x9e, 0x35, 0x20, 0x3e, 0x91, 0x3d, 0xbc, 0xbd,
-  0x6d, 0x1c, 0xe5, 0xbc, 0xc5, 0x74, 0xba, 0x3d, 0x23, 0xfa, 0xcd, 0x3c,
-  0x50, 0xca, 0x86, 0xbd, 0x1e, 0xc2, 0x1d, 0x3d, 0x22, 0xd6, 0x02, 0x3e,
-  0x62, 0x45, 0x57, 0x3c, 0x75, 0x7f, 0x08, 0xbe, 0x9d, 0x61, 0x84, 0x3d,
-  0xe8, 0xa7, 0x5d, 0x3d, 0x8b, 0x59, 0x29, 0xbe, 0x37, 0xe3, 0x19, 0xbd,
-  0xee, 0x01, 0x74, 0x3d, 0x22, 0x53, 0xd3, 0xbc, 0x54, 0x80, 0x12, 0x3d,
-  0xbb, 0x54, 0xad, 0xbd, 0x17, 0xa8, 0xe2, 0xbc, 0xbf, 0x2a, 0x61, 0x3c,
-  0x65, 0x8a, 0xba, 0xbd, 0x18, 0x9e, 0x69, 0xbd, 0xb1, 0x63, 0x0c, 0xbe,
-  0x80, 0xc2, 0x1e, 0xbc, 0x93, 0xa5, 0xe5, 0x3d, 0x87, 0xd5, 0x64, 0xbd,
-  0x50, 0x47, 0xb2, 0x3c, 0x40, 0xb0, 0x50, 0x3d, 0xcb, 0x84, 0x8c, 0xbe,
-  0xe7, 0xe9, 0x8c, 0x3d, 0x33, 0xc1, 0xa1, 0x3c, 0x8d, 0xd0, 0x68, 0x3d,
-  0xe8, 0xfc, 0x02, 0x3d, 0x2b, 0x86, 0x42, 0x3b, 0x5b, 0x63, 0x19, 0x3c,
-  0x33, 0xd4, 0x33, 0x3c, 0xef, 0xcd, 0x3a, 0xbd, 0x41, 0x31, 0xc3, 0xbc,
-  0xed, 0x0e, 0xb3, 0x3c, 0xcb, 0x44, 0x96, 0x3d, 0x42, 0x02, 0x98, 0xbb,
-  0x27, 0xb0, 0x7a, 0x3d, 0x49, 0x66, 0xbb, 0xba, 0x55, 0x0d, 0x50, 0xbd,
-  0xd6, 0xf3, 0x12, 0xbe, 0x46, 0x7d, 0x8a, 0xbd, 0x3e, 0x59, 0x47, 0x3d,
-  0x1e, 0x4d, 0xf9, 0x3d, 0x23, 0x69, 0x97, 0xbd, 0x53, 0x07, 0xd4, 0xbd,
-  0xd7, 0xa5, 0x02, 0x3d, 0x99, 0x59, 0x28, 0xbd, 0x8a, 0x0f, 0xdb, 0xbd,
-  0xc5, 0x5c, 0x74, 0xbd, 0xaa, 0xc1, 0x89, 0xbd, 0xb4, 0x64, 0x22, 0x3d,
-  0x1c, 0xc4, 0x8f, 0x3c, 0x9b, 0x0e, 0xea, 0x3d, 0x44, 0xbb, 0x14, 0xbd,
-  0x15, 0x16, 0x3e, 0x3d, 0x91, 0xa5, 0x29, 0xbe, 0x60, 0x1b, 0x34, 0xbd,
-  0x60, 0xcb, 0x0a, 0x3e, 0x3f, 0x22, 0x23, 0x3e, 0x4f, 0x70, 0x6e, 0x3d,
-  0xf5, 0x10, 0xff, 0xbd, 0x4d, 0xa7, 0x58, 0xbd, 0x29, 0x9a, 0x32, 0x3d,
-  0xe6, 0xf9, 0x9f, 0xbd, 0x1f, 0xac, 0x53, 0xbb, 0x4d, 0x3d, 0xc6, 0x3c,
-  0x89, 0x60, 0xef, 0x3c, 0xf0, 0x95, 0x3d, 0x3c, 0xbe, 0x7d, 0x87, 0x3d,
-  0x85, 0x87, 0xbb, 0x3c, 0xb1, 0xb6, 0x02, 0x3d, 0xf4, 0x9c, 0xa3, 0xbd,
-  0xdf, 0xfd, 0xaa, 0xbd, 0xe0, 0xbd, 0x7b, 0xbc, 0x3e, 0x1d, 0x1c, 0x3e,
-  0x3b, 0x0a, 0x10, 0x3d, 0x49, 0xaf, 0x09, 0xbe, 0x5b, 0x29, 0x78, 0x3d,
-  0x58, 0x9f, 0x45, 0xbd, 0x5a, 0xc3, 0xc5, 0x3b, 0x9f, 0xb2, 0x36, 0x3d,
-  0xb1, 0x29, 0x2a, 0x3d, 0x78, 0x5b, 0x12, 0xbb, 0xe7, 0x35, 0x94, 0x3d,
-  0x16, 0x09, 0x9c, 0xbc, 0x07, 0xf3, 0x2b, 0x3d, 0x67, 0xa8, 0xeb, 0xbc,
-  0xc0, 0x2c, 0xa3, 0x3d, 0xdb, 0xd6, 0x61, 0x3d, 0x98, 0x05, 0x5b, 0xbd,
-  0xdb, 0xcb, 0x37, 0x3e, 0xb7, 0xf8, 0xda, 0x3c, 0x93, 0xf9, 0xed, 0x3d,
-  0x7e, 0x49, 0xaf, 0x3d, 0x19, 0x03, 0xa1, 0xbc, 0xae, 0x78, 0x25, 0xbc,
-  0x10, 0xb1, 0xec, 0x3d, 0xf6, 0x56, 0x3e, 0x3d, 0xa1, 0xe2, 0xba, 0x3d,
-  0x68, 0x66, 0xaa, 0x3d, 0xc5, 0xc0, 0x33, 0x3d, 0x81, 0x18, 0x89, 0x3c,
-  0x91, 0x11, 0x78, 0x3c, 0xec, 0xa9, 0x9e, 0xbd, 0x81, 0xbd, 0xbe, 0x3d,
-  0x97, 0xe5, 0x06, 0x3d, 0xef, 0x34, 0x90, 0x3d, 0x56, 0xcc, 0x2e, 0xbd,
-  0x1d, 0x05, 0x23, 0xbe, 0xfb, 0xf3, 0xd0, 0xbb, 0x2b, 0xe5, 0x05, 0x3d,
-  0x74, 0x06, 0x13, 0xbe, 0x48, 0x32, 0x2d, 0x3d, 0x55, 0x38, 0x27, 0xbd,
-  0x7a, 0xa6, 0xee, 0xbd, 0x6a, 0x86, 0x81, 0x3b, 0x5f, 0xe3, 0x81, 0x3d,
-  0xcd, 0xa4, 0x82, 0x3d, 0x91, 0xd8, 0x6f, 0xbb, 0x26, 0x13, 0x28, 0xbe,
-  0x3a, 0x3f, 0x8c, 0x3d, 0x9f, 0x7d, 0xf5, 0x3c, 0x85, 0x65, 0x4b, 0x3e,
-  0xca, 0x94, 0xd7, 0xbb, 0x14, 0x83, 0xac, 0xbd, 0x05, 0xc9, 0x36, 0x3d,
-  0xcc, 0xed, 0x10, 0xbc, 0x9b, 0xe1, 0x2b, 0xbd, 0x1c, 0x61, 0x11, 0xbd,
-  0x09, 0xab, 0xc2, 0xbc, 0xbe, 0x6f, 0xa2, 0x3d, 0x12, 0xca, 0x20, 0xbc,
-  0xf0, 0x1f, 0xcd, 0x3d, 0x40, 0x25, 0x85, 0xbd, 0x5f, 0x6e, 0x76, 0xbb,
-  0x5b, 0xbb, 0x0e, 0xbe, 0xb7, 0xc6, 0x8e, 0x3b, 0x2e, 0x86, 0x3c, 0x3e,
-  0x9f, 0xad, 0xe9, 0x3b, 0x58, 0x09, 0xf1, 0xbc, 0xa5, 0x36, 0x0b, 0xbd,
-  0x40, 0xde, 0xf7, 0x3d, 0x11, 0x1f, 0xaa, 0xbd, 0x53, 0x5b, 0x28, 0xbd,
-  0x9b, 0x14, 0xdc, 0x3d, 0x8b, 0xfc, 0x47, 0xbc, 0xac, 0x36, 0x00, 0x3e,
-  0x61, 0xa6, 0x8f, 0x3d, 0x69, 0x52, 0xaa, 0xbc, 0xc5, 0xb9, 0xf0, 0x3d,
-  0xf2, 0x7c, 0x89, 0x3d, 0x9e, 0xe2, 0x3c, 0xbe, 0xea, 0x16, 0x30, 0x3c,
-  0xb4, 0x64, 0x15, 0x3e, 0xe4, 0x6f, 0x1c, 0x39, 0x21, 0x37, 0xd6, 0xbb,
-  0xd2, 0x67, 0x8d, 0xbd, 0xb1, 0x9b, 0xcc, 0x3c, 0x05, 0xa6, 0xa8, 0xbd,
-  0x2d, 0x63, 0xfe, 0xbd, 0xf6, 0xe4, 0xa2, 0xbb, 0x3a, 0xe1, 0x53, 0xbd,
-  0x40, 0x38, 0xa7, 0x3d, 0x15, 0x3a, 0xac, 0x3d, 0x69, 0x2d, 0xef, 0x3c,
-  0xe3, 0xc2, 0x43, 0xbd, 0x73, 0x83, 0x6e, 0x3d, 0xef, 0xf4, 0x65, 0xbe,
-  0x31, 0x1d, 0x1d, 0x3e, 0x26, 0x23, 0x68, 0xbd, 0x3a, 0x53, 0xbd, 0x3d,
-  0xf2, 0xc3, 0x11, 0xbd, 0x16, 0x4f, 0x11, 0xbd, 0x65, 0xad, 0xcc, 0xbd,
-  0x15, 0x03, 0xc4, 0x3d, 0x75, 0x7b, 0x7a, 0xbc, 0x3f, 0x24, 0x8f, 0xbd,
-  0x94, 0xd5, 0x50, 0xbc, 0xb6, 0x3e, 0x48, 0xbd, 0x97, 0x4e, 0xbf, 0x3d,
-  0x1b, 0xc7, 0x89, 0xbc, 0x65, 0xda, 0xab, 0x3d, 0x54, 0xd8, 0x8c, 0xbc,
-  0xc8, 0x71, 0x26, 0xbe, 0x14, 0xbb, 0xc6, 0xbc, 0xcc, 0x8b, 0xcb, 0x3c,
-  0x8b, 0xa9, 0x8e, 0x3d, 0xd1, 0x23, 0xd8, 0xbc, 0x66, 0x82, 0x92, 0xbd,
-  0x31, 0xac, 0xf8, 0x38, 0xf4, 0x44, 0x2d, 0xbc, 0x29, 0x73, 0x04, 0xbe,
-  0xf2, 0xbb, 0x0a, 0x3d, 0x83, 0x1d, 0xb4, 0x3c, 0xee, 0x02, 0x11, 0x3d,
-  0xd3, 0x62, 0xb0, 0x3c, 0x76, 0x5d, 0x12, 0x3e, 0x83, 0xf1, 0x92, 0x3d,
-  0x7c, 0xf3, 0xdf, 0xbc, 0xca, 0xc2, 0x12, 0xbe, 0xea, 0x12, 0xa4, 0x3d,
-  0xd1, 0xf0, 0xad, 0x3c, 0x82, 0x28, 0xc8, 0x3c, 0x88, 0x0a, 0xee, 0xbc,
-  0xaf, 0xb4, 0xcb, 0xbd, 0xa7, 0xad, 0x11, 0x3d, 0x87, 0xb2, 0x0e, 0xbe,
-  0xf5, 0x1b, 0xc6, 0xbd, 0x54, 0x66, 0x6a, 0x3d, 0xed, 0x81, 0xa9, 0xbc,
-  0x4f, 0xda, 0xe1, 0x3c, 0x93, 0x13, 0x2e, 0xbd, 0x3d, 0x8c, 0x7e, 0x3d,
-  0xd6, 0x1d, 0x8c, 0x3d, 0x49, 0x90, 0x0b, 0xbe, 0x1c, 0x60, 0x81, 0x3c,
-  0x1b, 0x4e, 0x51, 0x3d, 0x90, 0xc8, 0x3d, 0xbd, 0x49, 0x9f, 0xa0, 0x3d,
-  0xd6, 0x9c, 0x3a, 0xbd, 0x46, 0x30, 0xa6, 0xbd, 0x7a, 0xd8, 0x0f, 0x3c,
-  0xfa, 0x89, 0xcb, 0xbd, 0xd5, 0x66, 0xeb, 0xbd, 0x26, 0x73, 0x63, 0xbd,
-  0x38, 0xab, 0xc1, 0x3c, 0x07, 0xe3, 0x8e, 0xbb, 0x8c, 0xf4, 0x57, 0xbc,
-  0xe5, 0xf2, 0x41, 0x3d, 0x0d, 0x0f, 0x22, 0x3d, 0xe7, 0xaf, 0x56, 0xbd,
-  0xb5, 0x78, 0xe5, 0xbc, 0x3d, 0x54, 0xae, 0xbc, 0x74, 0xf6, 0x45, 0xbd,
-  0x61, 0xab, 0xad, 0x3d, 0x99, 0xa1, 0x57, 0xbb, 0x97, 0x8a, 0xc0, 0xbd,
-  0xff, 0xad, 0x16, 0xbd, 0xfe, 0x8d, 0x04, 0xbd, 0x8f, 0xe4, 0x09, 0xbd,
-  0xd1, 0xcc, 0xea, 0xbd, 0x4a, 0xac, 0x7e, 0xbd, 0x46, 0x3b, 0xdf, 0xbc,
-  0x32, 0x8a, 0x81, 0x3c, 0xbd, 0x0e, 0xc8, 0x3d, 0x86, 0x8c, 0x73, 0xbd,
-  0x95, 0x0a, 0xd2, 0x3c, 0xd1, 0x5a, 0x09, 0xbd, 0x54, 0x18, 0x00, 0xbd,
-  0x81, 0x4f, 0xe8, 0x3d, 0xe6, 0x4c, 0x1b, 0x3e, 0xd3, 0x69, 0x88, 0xbd,
-  0x2d, 0x3c, 0x19, 0xbd, 0x2a, 0x0e, 0xe4, 0x3c, 0xe3, 0xc7, 0x9d, 0xbc,
-  0x9e, 0xd2, 0x4d, 0xbd, 0x47, 0x62, 0x6e, 0xbd, 0xb0, 0xab, 0x8c, 0xbc,
-  0xdf, 0xc7, 0xc1, 0x3d, 0xb0, 0xcb, 0x88, 0xb9, 0xd9, 0x84, 0x03, 0x3e,
-  0xc1, 0xf9, 0x59, 0x3d, 0xed, 0x97, 0x8d, 0xbb, 0x68, 0x1d, 0x21, 0xbb,
-  0xb9, 0x11, 0x01, 0xbd, 0xa4, 0x6f, 0x0f, 0xbc, 0xc6, 0x65, 0x5a, 0x3d,
-  0x09, 0x02, 0x72, 0x3d, 0x88, 0xc1, 0xbb, 0xbd, 0x53, 0x6e, 0xf7, 0x3c,
-  0x91, 0x1b, 0x4b, 0x3d, 0x05, 0x6a, 0xb6, 0xbd, 0xc1, 0x9a, 0x4f, 0xbc,
-  0x25, 0x86, 0xb2, 0x3c, 0xb9, 0x0a, 0xc3, 0x3d, 0xe3, 0xe4, 0x7e, 0xba,
-  0x44, 0x07, 0x84, 0x3d, 0x6f, 0x77, 0xf1, 0xbc, 0x17, 0x90, 0xdd, 0xba,
-  0xee, 0xa8, 0xa3, 0xbc, 0xdc, 0xf8, 0x00, 0xbc, 0xa0, 0x63, 0x6c, 0xbd,
-  0xc4, 0x4a, 0x93, 0x3d, 0x5b, 0x5d, 0x35, 0xbc, 0x7c, 0x5e, 0x3d, 0xbd,
-  0xf0, 0x37, 0x43, 0xbd, 0xfd, 0x1e, 0x71, 0x3d, 0xa5, 0x6f, 0xf7, 0xbc,
-  0x13, 0xef, 0x81, 0x3d, 0xfe, 0xc0, 0xe1, 0xbd, 0x37, 0xc3, 0x53, 0xbd,
-  0x8a, 0x4a, 0x6c, 0xbd, 0xc4, 0x21, 0x9d, 0x3b, 0x50, 0x9d, 0x71, 0x3c,
-  0xbb, 0xb1, 0x55, 0xbd, 0x4f, 0xee, 0x1a, 0xbd, 0xe1, 0x7a, 0x3c, 0x3d,
-  0xe4, 0x80, 0x16, 0xbc, 0x60, 0x71, 0x12, 0x3d, 0xc0, 0x2a, 0x29, 0xbe,
-  0x00, 0x62, 0x12, 0xbe, 0x08, 0x06, 0x7b, 0xbb, 0xf3, 0x4a, 0x7d, 0x3b,
-  0x9b, 0xa5, 0x0f, 0xbd, 0xec, 0x23, 0x18, 0xbc, 0x10, 0x6e, 0x12, 0x3d,
-  0xd0, 0x83, 0x4d, 0x3d, 0x5c, 0x5b, 0x38, 0x3d, 0x7d, 0xec, 0xcf, 0x3d,
-  0x69, 0x92, 0xbe, 0xbd, 0x22, 0x87, 0x28, 0xbd, 0x35, 0x3c, 0x17, 0xbe,
-  0x8f, 0xe1, 0x09, 0xbd, 0x8b, 0x6b, 0x95, 0x3d, 0x26, 0x20, 0xb0, 0x3d,
-  0x4c, 0x39, 0x72, 0xbc, 0x3c, 0xc0, 0x2b, 0xbe, 0x98, 0xc8, 0xe7, 0x3c,
-  0xa2, 0x92, 0xac, 0xbd, 0x70, 0xad, 0xe2, 0xbc, 0xb3, 0x5f, 0x24, 0xbd,
-  0x62, 0xe4, 0xd4, 0xbd, 0x27, 0x6d, 0xa1, 0x3c, 0x7e, 0xb0, 0x21, 0xbd,
-  0xf7, 0x78, 0xc5, 0x3d, 0x53, 0xa8, 0x7f, 0xbd, 0x94, 0xdc, 0x62, 0xbb,
-  0xfb, 0x82, 0x41, 0xbe, 0xeb, 0x1c, 0xdd, 0xbc, 0xb1, 0x99, 0x97, 0xbd,
-  0xb5, 0x06, 0xf0, 0x3d, 0xaf, 0xf4, 0xef, 0xbb, 0x8b, 0xba, 0x4d, 0x3d,
-  0xee, 0xdc, 0x60, 0x3d, 0x17, 0x3c, 0x49, 0x3d, 0x22, 0x48, 0xe5, 0xbb,
-  0xb2, 0x7d, 0xc5, 0x3b, 0x66, 0x8e, 0x14, 0xbc, 0x66, 0x4b, 0x63, 0xbb,
-  0x10, 0x1b, 0x60, 0x3d, 0x07, 0x6d, 0xc8, 0x3d, 0x63, 0x59, 0x41, 0xbd,
-  0x94, 0x67, 0x18, 0x3d, 0x4f, 0x15, 0x27, 0xbe, 0x29, 0x61, 0x1d, 0x3d,
-  0xab, 0x25, 0x2d, 0x3d, 0x6d, 0xa1, 0x9c, 0x3d, 0x63, 0xc4, 0x03, 0xbd,
-  0xe8, 0x75, 0x06, 0xbe, 0xb6, 0x95, 0x37, 0xbd, 0x73, 0x01, 0x0c, 0x3d,
-  0x11, 0xfd, 0x64, 0xbd, 0x94, 0x32, 0x5b, 0x3d, 0xd1, 0xac, 0x97, 0xbd,
-  0xc4, 0x17, 0x97, 0x3d, 0xd8, 0x8d, 0xf5, 0xbb, 0xa4, 0x82, 0x4e, 0x3d,
-  0xc0, 0x49, 0xcb, 0x3c, 0xf7, 0x0d, 0xaa, 0xbd, 0x45, 0x42, 0x89, 0xbe,
-  0x97, 0x33, 0x8b, 0x3d, 0x4b, 0x88, 0x88, 0x3c, 0x44, 0x9c, 0xd7, 0x3d,
-  0x40, 0xbf, 0x3e, 0xbc, 0xaf, 0x8d, 0x08, 0xbe, 0xc3, 0xd3, 0x90, 0xbc,
-  0xc3, 0xd7, 0x75, 0x3c, 0x34, 0xac, 0xb0, 0xbd, 0x5c, 0xbe, 0x85, 0xbd,
-  0x74, 0x92, 0x28, 0xbd, 0x30, 0x85, 0x05, 0xbc, 0xf5, 0x55, 0x6f, 0xbc,
-  0xc6, 0xf1, 0x02, 0x3e, 0xba, 0xb3, 0x7f, 0xbd, 0x30, 0x60, 0x50, 0xbd,
-  0x30, 0x02, 0x42, 0xbd, 0x6d, 0xcd, 0x9d, 0x3c, 0x85, 0xec, 0x97, 0x3d,
-  0x74, 0x29, 0xfc, 0x3d, 0xea, 0x50, 0xaf, 0xbc, 0x97, 0x86, 0x7a, 0x3d,
-  0x03, 0xd3, 0x9d, 0x3d, 0xb9, 0x36, 0xc3, 0xbd, 0x16, 0x39, 0xf6, 0xbd,
-  0xdc, 0x31, 0x53, 0x3c, 0x1b, 0xa6, 0xb8, 0xbd, 0x38, 0x77, 0xd2, 0x3d,
-  0xf5, 0x47, 0xe8, 0x3c, 0x79, 0x61, 0x9b, 0x3d, 0x97, 0x30, 0xaa, 0x3d,
-  0x99, 0x73, 0xe4, 0xbd, 0xb9, 0x84, 0x4b, 0xbd, 0xf1, 0x44, 0x18, 0x3d,
-  0xb1, 0x85, 0x44, 0xbd, 0x0a, 0x6c, 0xee, 0x3d, 0x5b, 0xed, 0xb7, 0xbd,
-  0x67, 0xcf, 0xb2, 0x3b, 0xee, 0x75, 0x1e, 0x3d, 0x95, 0xd6, 0x2f, 0x3c,
-  0x2c, 0xc4, 0x84, 0xbd, 0xd0, 0xc8, 0xb1, 0x3d, 0x88, 0xd2, 0x2e, 0x3d,
-  0x9b, 0x5b, 0x9a, 0x3d, 0xb4, 0x99, 0x34, 0x3d, 0x5e, 0xcd, 0xe0, 0xbb,
-  0xce, 0x5a, 0x1b, 0xbd, 0x25, 0x99, 0xbb, 0xbd, 0x8f, 0xc8, 0xb5, 0xbc,
-  0xb4, 0x53, 0x9c, 0x3d, 0x69, 0x78, 0x79, 0x3c, 0xa0, 0x81, 0x83, 0x3d,
-  0xc9, 0x74, 0x94, 0x3d, 0xaa, 0x60, 0x55, 0xbb, 0xba, 0x38, 0x21, 0xbd,
-  0x97, 0xc5, 0x56, 0xbd, 0x32, 0x66, 0xd8, 0xbd, 0x33, 0x11, 0xde, 0xbd,
-  0x15, 0x11, 0x7e, 0xbd, 0xb1, 0x3d, 0x9d, 0x3d, 0x66, 0xfc, 0xa5, 0x3c,
-  0x0c, 0x42, 0x87, 0x3d, 0x28, 0x68, 0x7c, 0xbd, 0x36, 0xec, 0x1a, 0xbd,
-  0xaa, 0xf7, 0x5e, 0x3d, 0x69, 0x13, 0xa6, 0x3b, 0xd5, 0xf6, 0x6b, 0x3d,
-  0x54, 0xb0, 0x1b, 0x3e, 0xfc, 0x7a, 0xd7, 0xbd, 0x61, 0x0c, 0x9c, 0xbd,
-  0x5e, 0x8d, 0xdf, 0x3c, 0xbd, 0xf7, 0x61, 0x3b, 0x99, 0xa6, 0x4f, 0xbd,
-  0x34, 0x21, 0xb5, 0xbd, 0xed, 0x78, 0xe8, 0xbb, 0xe2, 0x0b, 0x6b, 0x3d,
-  0x86, 0xdf, 0x08, 0xbd, 0x07, 0xe3, 0xaf, 0x3c, 0xc5, 0x95, 0xc1, 0x3d,
-  0x31, 0x0b, 0x02, 0xbc, 0x4b, 0x37, 0xc6, 0x3a, 0xea, 0xfb, 0xc5, 0x3c,
-  0xd3, 0x8a, 0x6d, 0x3c, 0xf5, 0x81, 0x87, 0x3d, 0xa7, 0x84, 0x17, 0x3d,
-  0x4e, 0x5b, 0x4c, 0xbd, 0x02, 0x93, 0x2e, 0x3c, 0x44, 0x75, 0x33, 0xbd,
-  0x8e, 0x0e, 0x09, 0xbd, 0xbf, 0x70, 0x42, 0xbd, 0xc8, 0xe9, 0x66, 0xbd,
-  0x82, 0x8d, 0x4c, 0x3d, 0xc8, 0x73, 0x7a, 0x3c, 0xb4, 0x72, 0x4e, 0x3b,
-  0xc5, 0x5d, 0x70, 0xbc, 0x23, 0x0b, 0x98, 0xbd, 0xbe, 0xfd, 0x11, 0xbe,
-  0xce, 0x2f, 0x07, 0xbd, 0x38, 0xae, 0x87, 0x3d, 0x5c, 0x46, 0x0b, 0x3e,
-  0x15, 0xfc, 0x44, 0xbd, 0xd6, 0xe6, 0x1b, 0xbc, 0x2e, 0xc8, 0x85, 0xbd,
-  0x62, 0x66, 0x1b, 0x3d, 0x29, 0xe0, 0xb9, 0xbd, 0x4c, 0x9b, 0xa8, 0xbd,
-  0x80, 0x95, 0xb1, 0xbd, 0x82, 0x86, 0x78, 0x3d, 0x1e, 0x7e, 0xbb, 0xbb,
-  0xcd, 0x1b, 0xa8, 0x3d, 0xa1, 0x73, 0x84, 0xbd, 0x9e, 0x33, 0x90, 0xbd,
-  0xb2, 0x4c, 0x88, 0xbd, 0xe1, 0x68, 0x3e, 0x3d, 0x24, 0xb3, 0x34, 0x3d,
-  0x31, 0xb0, 0xa7, 0x3d, 0x40, 0xc5, 0xc1, 0x3d, 0x06, 0x3e, 0x44, 0xbd,
-  0xc3, 0xd0, 0x8f, 0xbd, 0x4c, 0x26, 0x8c, 0x3d, 0x18, 0xed, 0xc3, 0xbd,
-  0x34, 0x5d, 0x59, 0xbd, 0x33, 0xcf, 0x0d, 0x3d, 0xe9, 0x5f, 0xf1, 0xbc,
-  0x63, 0xe5, 0x96, 0x3d, 0xdb, 0x6b, 0xa2, 0xbc, 0xab, 0x31, 0x25, 0xbb,
-  0xd0, 0xa5, 0xde, 0x3c, 0xc6, 0xe7, 0xf9, 0xbd, 0x67, 0x3b, 0x38, 0x3d,
-  0x0f, 0x78, 0x2a, 0x3c, 0x34, 0xa4, 0xd0, 0x3d, 0xd4, 0xfb, 0x61, 0xbd,
-  0x14, 0xbb, 0xe7, 0x3d, 0xd7, 0x1c, 0x9a, 0x3d, 0x8b, 0x6c, 0x83, 0x3b,
-  0x47, 0xaf, 0xa9, 0x3c, 0x6b, 0x1c, 0x85, 0xbd, 0x74, 0x2f, 0x92, 0xbd,
-  0xa2, 0x85, 0xb5, 0x3a, 0xd6, 0x0f, 0xc0, 0xbd, 0x50, 0x1d, 0xdd, 0x3d,
-  0xbf, 0x7c, 0xa5, 0x3d, 0x6b, 0x26, 0x2f, 0xbc, 0x9b, 0x39, 0x70, 0xbd,
-  0x6c, 0x56, 0x2c, 0xbb, 0x68, 0xd2, 0x36, 0xbd, 0x6a, 0xd9, 0x3a, 0x3d,
-  0x97, 0x62, 0x25, 0xbe, 0xef, 0x0f, 0x0c, 0xbe, 0x9a, 0x85, 0xe6, 0xbd,
-  0xdf, 0xce, 0x95, 0x3d, 0x56, 0x27, 0x8a, 0xbc, 0x30, 0x1d, 0x4f, 0x38,
-  0xb2, 0x13, 0x03, 0xbe, 0x76, 0x3c, 0xb9, 0xbd, 0x32, 0x2a, 0xf7, 0x3c,
-  0x06, 0x9d, 0xa6, 0x3d, 0x40, 0xb3, 0x5a, 0xbc, 0xc0, 0x68, 0x31, 0xbd,
-  0x28, 0x2f, 0x37, 0xbe, 0x99, 0x13, 0x4e, 0x3d, 0x72, 0xde, 0xc8, 0x3c,
-  0xa1, 0xf9, 0xe1, 0x3d, 0xd5, 0xa7, 0xac, 0x39, 0x56, 0x08, 0x09, 0xbd,
-  0x79, 0x88, 0x51, 0xbd, 0xeb, 0x95, 0xa3, 0x3a, 0xa7, 0xfa, 0x15, 0xbe,
-  0xf8, 0x10, 0xd6, 0x3c, 0xe4, 0x08, 0x88, 0xbc, 0x41, 0x0a, 0x91, 0x3d,
-  0xde, 0xb9, 0xa0, 0xbb, 0x73, 0x68, 0x3c, 0x3d, 0x35, 0x3a, 0x01, 0x3d,
-  0x59, 0x69, 0x9a, 0xbb, 0x27, 0x5e, 0xb7, 0xbd, 0x8e, 0x84, 0xbf, 0x3d,
-  0x32, 0xb5, 0xf6, 0x3d, 0x49, 0x52, 0x94, 0x3d, 0x59, 0x39, 0x94, 0xbd,
-  0x61, 0x60, 0x04, 0xbd, 0xef, 0xe4, 0x3f, 0x3c, 0x3a, 0x3d, 0x13, 0xbc,
-  0x84, 0x06, 0xa4, 0xbd, 0x0d, 0x99, 0xbc, 0x3d, 0x0e, 0xff, 0x2f, 0x3d,
-  0xaf, 0x61, 0x60, 0x3d, 0x93, 0xe1, 0x6f, 0x3d, 0x11, 0x6f, 0x15, 0xbd,
-  0xfb, 0xc5, 0xfc, 0xbb, 0x6b, 0xfb, 0xcb, 0xbc, 0x08, 0xd5, 0x52, 0xbd,
-  0xbb, 0x86, 0x38, 0x3d, 0xc9, 0x6a, 0x01, 0x3d, 0xfd, 0xf1, 0x0b, 0x3c,
-  0xd9, 0xda, 0x23, 0xbd, 0xa8, 0xf8, 0xa1, 0xbd, 0x31, 0xeb, 0x6a, 0xbd,
-  0x1c, 0xe0, 0x9f, 0xbd, 0xbb, 0x0f, 0xc5, 0xbd, 0x81, 0x4d, 0xd3, 0xbd,
-  0xe9, 0x44, 0xf8, 0xbc, 0xdb, 0xdd, 0xfb, 0x3d, 0xbc, 0x1d, 0x52, 0x3d,
-  0x9b, 0x37, 0xc7, 0x3d, 0xfe, 0x1d, 0x3c, 0x3c, 0x50, 0x25, 0xe1, 0xbc,
-  0xe4, 0x88, 0xee, 0xbd, 0x92, 0xd9, 0x46, 0xbd, 0xfb, 0xff, 0x10, 0x3e,
-  0x6d, 0x25, 0xf4, 0x3d, 0xd1, 0x2f, 0xf2, 0xbb, 0x90, 0xc4, 0x93, 0xbd,
-  0x55, 0xd7, 0x6f, 0x3d, 0x1e, 0xe4, 0x15, 0x3d, 0x93, 0xb2, 0x81, 0xbd,
-  0xf3, 0x2a, 0xc7, 0xbd, 0x67, 0x01, 0xb5, 0xbd, 0xd8, 0x11, 0x1e, 0xbc,
-  0x22, 0xbe, 0xfb, 0xbb, 0x16, 0xf2, 0x7d, 0x3d, 0x1e, 0x7e, 0x4f, 0x3c,
-  0x1f, 0x62, 0x8b, 0xbd, 0x49, 0x02, 0x4d, 0xbe, 0xd8, 0xd7, 0xc4, 0x3c,
-  0x4e, 0x26, 0xce, 0x3c, 0x46, 0x89, 0xe5, 0x3d, 0x49, 0x0e, 0x86, 0xbc,
-  0x9d, 0x33, 0x96, 0x3d, 0x48, 0x09, 0xef, 0x3d, 0xcb, 0x61, 0x78, 0x3d,
-  0x65, 0x5a, 0xd5, 0xbd, 0xa6, 0xac, 0x8c, 0xbd, 0x0e, 0xb6, 0x5e, 0x3d,
-  0xa2, 0x54, 0x3e, 0x3d, 0xd6, 0x76, 0xc5, 0x3d, 0x0c, 0xe8, 0x65, 0x3d,
-  0x13, 0xed, 0xa5, 0x3d, 0x55, 0x07, 0x73, 0xbc, 0xc3, 0xab, 0x15, 0xbc,
-  0x42, 0xc2, 0x74, 0x3a, 0xc6, 0xf7, 0x16, 0x3e, 0xd4, 0xc4, 0x0c, 0x3d,
-  0x42, 0x45, 0xf4, 0xbd, 0xd5, 0x4c, 0xe5, 0xbd, 0x44, 0x8e, 0xaa, 0x3d,
-  0xad, 0xb3, 0x53, 0x3c, 0x90, 0xbb, 0xd6, 0xbd, 0xa6, 0x85, 0x96, 0xbc,
-  0x59, 0x72, 0x16, 0x3e, 0xc4, 0xc9, 0x6f, 0x3c, 0x44, 0x9f, 0xa4, 0x3d,
-  0xc3, 0x30, 0xa7, 0x3c, 0xfc, 0x4a, 0xa9, 0x3c, 0x9e, 0x20, 0xc3, 0xbd,
-  0x6e, 0x94, 0x5e, 0x3c, 0x5a, 0x57, 0xe3, 0x3d, 0x19, 0x1b, 0xfc, 0x3c,
-  0x58, 0x26, 0x4b, 0x3c, 0x5f, 0x4d, 0x96, 0xbd, 0x8e, 0xc7, 0xb9, 0xbd,
-  0xda, 0x12, 0x9f, 0x3d, 0x06, 0x91, 0x68, 0xbd, 0x65, 0x0f, 0xd1, 0xbc,
-  0xf7, 0x4c, 0x96, 0xbd, 0x9d, 0x54, 0x47, 0x39, 0xfd, 0x6e, 0x19, 0x3d,
-  0x3e, 0x47, 0xcd, 0x3c, 0x51, 0x49, 0x87, 0x3d, 0x61, 0xd6, 0x5d, 0x3c,
-  0xed, 0xea, 0x6e, 0xbd, 0xf6, 0x42, 0x52, 0xbd, 0x3f, 0x45, 0xa1, 0x3b,
-  0x8e, 0x8b, 0xae, 0xbd, 0x49, 0x92, 0xc1, 0x3d, 0xe8, 0xe1, 0xd9, 0xbd,
-  0xaf, 0x86, 0xd0, 0xbd, 0x0e, 0xf1, 0x61, 0xbd, 0xdf, 0xeb, 0x2e, 0xbd,
-  0x69, 0x91, 0x8e, 0xbd, 0x69, 0xe1, 0x4a, 0xbc, 0x92, 0x2b, 0x02, 0x3d,
-  0xe3, 0x52, 0x99, 0x3d, 0x85, 0x53, 0x16, 0xbd, 0xa4, 0x09, 0xfa, 0x3b,
-  0xde, 0x9d, 0x83, 0x3d, 0x8f, 0xe4, 0x91, 0xbd, 0x61, 0x39, 0x77, 0xbe,
-  0x43, 0x25, 0x0d, 0x3d, 0x10, 0x81, 0xc7, 0x3d, 0xe4, 0x93, 0x1a, 0x3e,
-  0x5a, 0x5d, 0xaa, 0xbd, 0x4a, 0xc7, 0xc3, 0x3c, 0xf3, 0x0c, 0xba, 0x3d,
-  0x93, 0x6e, 0xba, 0xbc, 0x3c, 0x77, 0xf8, 0xbd, 0x64, 0x49, 0x89, 0xbd,
-  0x43, 0xd9, 0xa4, 0xbb, 0xe5, 0xe2, 0x47, 0x3d, 0xcc, 0xdc, 0x60, 0x3d,
-  0xc5, 0x85, 0x14, 0x3e, 0x39, 0x0c, 0x60, 0x3c, 0x91, 0x93, 0x7c, 0x3d,
-  0x0c, 0x7a, 0x52, 0x3d, 0x1c, 0x61, 0x03, 0xbb, 0xc6, 0x49, 0x68, 0x3d,
-  0x19, 0x87, 0x36, 0x3d, 0x60, 0x40, 0x34, 0x3d, 0x08, 0x52, 0x0b, 0xbe,
-  0xe7, 0x60, 0x0d, 0xbd, 0x87, 0xe3, 0x60, 0xbd, 0xb5, 0x03, 0x91, 0xbb,
-  0xe1, 0x1e, 0x5a, 0xbd, 0x3d, 0xba, 0x01, 0xbb, 0xcd, 0x66, 0x03, 0x3c,
-  0x50, 0x29, 0x3c, 0x3c, 0xa4, 0xd2, 0xaa, 0x3c, 0xbd, 0xe6, 0x89, 0x3d,
-  0x5b, 0x23, 0x35, 0xbd, 0x6b, 0x06, 0xab, 0xbc, 0xc8, 0x0e, 0x9a, 0x3c,
-  0x82, 0x72, 0x3a, 0x3d, 0x53, 0x41, 0x27, 0x3d, 0xb8, 0xa5, 0x13, 0x3d,
-  0x23, 0xaf, 0x0d, 0xbc, 0xd9, 0x7c, 0x46, 0xbb, 0x5d, 0x28, 0x0a, 0xbc,
-  0x0e, 0x58, 0xa9, 0xbd, 0xe7, 0xba, 0xe0, 0xbc, 0xc1, 0x5d, 0xd0, 0xbd,
-  0xd9, 0xd1, 0x8a, 0xbc, 0x16, 0xd9, 0x3f, 0xbd, 0x90, 0xa1, 0xa6, 0x3d,
-  0xde, 0xe5, 0x8b, 0x3d, 0x63, 0xcb, 0xd6, 0xbd, 0x78, 0x06, 0x3e, 0xbd,
-  0xaa, 0x48, 0x06, 0x3d, 0x9c, 0x65, 0xc2, 0xbd, 0x4b, 0x0b, 0xf2, 0x3d,
-  0x80, 0xb6, 0x85, 0xbd, 0x17, 0x3e, 0x14, 0xbe, 0x4c, 0x6b, 0x3c, 0xbd,
-  0xf4, 0x73, 0xe1, 0xbc, 0xbd, 0x0b, 0x0a, 0xbd, 0x88, 0xb3, 0x47, 0xba,
-  0xb2, 0xd2, 0x18, 0xbe, 0xda, 0x0b, 0x20, 0xbc, 0x62, 0x0e, 0xab, 0x3c,
-  0x5c, 0x79, 0x8e, 0x3d, 0x49, 0x4c, 0x84, 0x3c, 0x59, 0x53, 0x31, 0x3d,
-  0xf5, 0xda, 0x4d, 0xbe, 0x1c, 0x5e, 0x86, 0xbc, 0xad, 0x7b, 0xc2, 0xbc,
-  0x85, 0x00, 0xca, 0x3d, 0x41, 0x33, 0x00, 0x3d, 0x39, 0x1f, 0x26, 0xbe,
-  0x9d, 0x2f, 0xaa, 0xbd, 0x09, 0xfa, 0xeb, 0xbc, 0x13, 0xb8, 0xf4, 0xbd,
-  0xb9, 0xc6, 0x29, 0xbb, 0x11, 0xae, 0x09, 0xbe, 0xb3, 0xea, 0xf2, 0xbc,
-  0x87, 0x5f, 0x1e, 0xbc, 0x43, 0xa8, 0xf2, 0xbc, 0xf9, 0xf5, 0xb4, 0xbc,
-  0x2f, 0xd1, 0x2c, 0x3c, 0x97, 0x27, 0x8a, 0xbd, 0x47, 0x4b, 0xac, 0x3d,
-  0xe5, 0xf4, 0xc1, 0x3d, 0xe8, 0xe6, 0xb5, 0x3d, 0xaf, 0x92, 0x4e, 0x3d,
-  0xe0, 0xcd, 0x81, 0x3c, 0x0c, 0x7d, 0xa3, 0xbd, 0x10, 0xe1, 0x89, 0x3c,
-  0x7a, 0x0d, 0xd2, 0xbb, 0xb6, 0xd6, 0xa6, 0xbc, 0x8c, 0x4d, 0x90, 0xbd,
-  0x62, 0x33, 0x12, 0x3d, 0x79, 0xa4, 0x74, 0x3d, 0x15, 0x94, 0xba, 0x3d,
-  0xbd, 0x6e, 0xa1, 0x3c, 0x92, 0x4c, 0x97, 0x3c, 0x78, 0x7d, 0xb8, 0xbc,
-  0xe2, 0xd6, 0xad, 0x3b, 0x1c, 0x54, 0x03, 0xbc, 0x75, 0xae, 0x03, 0x3e,
-  0x3d, 0x9b, 0x01, 0xbc, 0x1e, 0xb0, 0x82, 0xbd, 0x54, 0x19, 0x41, 0x3d,
-  0x0c, 0x8d, 0xa7, 0xbc, 0x69, 0xf3, 0xef, 0xbd, 0x7b, 0xd2, 0xa3, 0xbd,
-  0xf4, 0x62, 0x92, 0xbd, 0x75, 0x6c, 0x64, 0x3d, 0xc5, 0xcd, 0xd6, 0x3c,
-  0x06, 0x3b, 0x93, 0xbb, 0x52, 0x17, 0xf1, 0x3c, 0x9f, 0x95, 0x39, 0xbd,
-  0x17, 0x73, 0xcb, 0xbd, 0x42, 0x6f, 0x01, 0x3e, 0xd2, 0x6a, 0x2f, 0x3e,
-  0x98, 0x96, 0x73, 0x3c, 0x05, 0x0f, 0x8e, 0xbc, 0x9c, 0xa6, 0x85, 0xbe,
-  0x71, 0xd4, 0x8a, 0xbd, 0x95, 0xaf, 0x91, 0xbc, 0x20, 0x17, 0xdf, 0xbc,
-  0x04, 0xe2, 0x4a, 0xbd, 0xa6, 0x62, 0x96, 0x3c, 0x66, 0x9b, 0xd8, 0xbb,
-  0x25, 0x92, 0xe7, 0x3d, 0x6d, 0xa7, 0x89, 0x3d, 0xff, 0x2a, 0xc1, 0x3d,
-  0xf7, 0xac, 0x77, 0xbb, 0xea, 0xd3, 0x13, 0xbe, 0x75, 0xc9, 0x9c, 0x3d,
-  0xfd, 0x2c, 0xa7, 0x3d, 0x09, 0x0f, 0x13, 0x3e, 0x7d, 0x2c, 0x30, 0x3d,
-  0x35, 0x3c, 0xbb, 0xbd, 0xfa, 0xb4, 0xe2, 0xbc, 0x8f, 0x4f, 0xb3, 0xbd,
-  0x0a, 0xf9, 0x73, 0xbd, 0x69, 0x27, 0xa3, 0x3c, 0x15, 0xc4, 0xcf, 0xbd,
-  0x80, 0x33, 0x3b, 0xbc, 0x68, 0xed, 0x86, 0x3d, 0x5a, 0xbf, 0x2a, 0x3e,
-  0x1c, 0xda, 0xe3, 0x3c, 0x8a, 0x27, 0xea, 0xbc, 0x48, 0x62, 0x07, 0xbe,
-  0x8a, 0xa0, 0x9f, 0x3d, 0xef, 0x36, 0x23, 0xbd, 0x2d, 0x03, 0x40, 0x3d,
-  0xd2, 0xa2, 0x05, 0xbe, 0x6d, 0xba, 0x86, 0xbd, 0xb8, 0x53, 0x77, 0x3d,
-  0x8d, 0x70, 0x73, 0xbc, 0xfb, 0x9c, 0x9a, 0x3c, 0xcb, 0xbc, 0x20, 0xbd,
-  0x80, 0xa4, 0x75, 0x3c, 0xbd, 0xf6, 0xa2, 0x3b, 0xe4, 0x39, 0xc0, 0xbc,
-  0x31, 0xb4, 0xc8, 0x3d, 0xd9, 0x1a, 0x47, 0xbd, 0xaf, 0x79, 0x9a, 0xbd,
-  0xf3, 0xb0, 0x30, 0xbd, 0x29, 0xca, 0x08, 0x3c, 0xbe, 0xbb, 0x18, 0x3e,
-  0xc8, 0xb6, 0x98, 0x3d, 0x39, 0x92, 0x85, 0xbd, 0x14, 0xae, 0x06, 0xbd,
-  0xa4, 0x57, 0x78, 0xbb, 0x0f, 0x81, 0x4a, 0xbd, 0x81, 0xb2, 0x86, 0xbd,
-  0x26, 0x92, 0x80, 0xbd, 0xd9, 0xbc, 0x01, 0x3c, 0xf9, 0x57, 0x86, 0x3d,
-  0xd9, 0xf7, 0x6b, 0x3d, 0xee, 0x3a, 0x94, 0x3d, 0xfb, 0xad, 0x16, 0x3d,
-  0x9b, 0x6b, 0x5a, 0xbd, 0xb8, 0x34, 0xdd, 0x3d, 0xc9, 0x04, 0xb0, 0x3c,
-  0xbb, 0xd1, 0x29, 0x3d, 0xad, 0x3e, 0x14, 0x3e, 0xe4, 0x39, 0x98, 0xbd,
-  0x18, 0x04, 0xdc, 0xbc, 0xd2, 0xe2, 0xc4, 0xbd, 0xf7, 0x84, 0x03, 0x3d,
-  0x01, 0x9a, 0x0b, 0xbd, 0xf5, 0xd1, 0xc2, 0xbc, 0x55, 0xa3, 0x70, 0x3d,
-  0x26, 0xec, 0x6c, 0xbd, 0xa8, 0x81, 0x63, 0xbd, 0xa5, 0x5f, 0xc5, 0x3c,
-  0x0a, 0xdf, 0x25, 0xbd, 0xa5, 0x86, 0x1d, 0x3c, 0x0f, 0x9b, 0x49, 0xbd,
-  0x08, 0x33, 0x49, 0xbd, 0xc0, 0x1c, 0xfe, 0x3d, 0xa6, 0x48, 0x17, 0x3d,
-  0xe5, 0xf8, 0x3c, 0xbd, 0x67, 0x19, 0x03, 0xbe, 0x4d, 0x1c, 0x74, 0xbd,
-  0x63, 0xe8, 0x30, 0xbd, 0xf1, 0x38, 0x4f, 0xbd, 0x87, 0x84, 0x7e, 0xbd,
-  0x0a, 0x3d, 0x94, 0xbd, 0x9b, 0x00, 0xb2, 0x3d, 0x2d, 0x9c, 0x21, 0xbd,
-  0x60, 0xab, 0xfc, 0x3d, 0x0b, 0xd8, 0x0f, 0xbd, 0xb8, 0x3b, 0xf8, 0xbc,
-  0x89, 0x1d, 0x0b, 0xbc, 0xf8, 0x0b, 0xce, 0xbd, 0x96, 0x9d, 0x5c, 0x3d,
-  0x8b, 0x09, 0x0e, 0x3e, 0x1b, 0x49, 0x6e, 0xbd, 0x8e, 0x8d, 0x1d, 0xbe,
-  0xf2, 0x64, 0x07, 0xbd, 0xcc, 0xab, 0xa6, 0x3d, 0x8f, 0x37, 0x60, 0xbd,
-  0x5d, 0x0f, 0x65, 0x3c, 0x56, 0x38, 0x03, 0x3e, 0xaa, 0x61, 0xd3, 0x3d,
-  0x6e, 0xa9, 0x2a, 0x3d, 0xc7, 0x09, 0xeb, 0x3c, 0x6d, 0x05, 0x7d, 0x3d,
-  0xf6, 0xea, 0x85, 0xbc, 0xb8, 0xd6, 0x17, 0xbd, 0xff, 0xdb, 0x99, 0xbd,
-  0x9f, 0x00, 0x91, 0xbd, 0xa1, 0x15, 0x86, 0x3d, 0xce, 0xea, 0x04, 0x3c,
-  0x4c, 0x73, 0x98, 0xbc, 0x02, 0x2c, 0xb1, 0x3b, 0xd9, 0xe7, 0x08, 0x3c,
-  0x30, 0xc4, 0xf1, 0xbc, 0x19, 0x9b, 0xf1, 0x3c, 0x73, 0xd5, 0x11, 0x3d,
-  0x19, 0x66, 0xff, 0xbc, 0x38, 0xd6, 0x5b, 0x3d, 0xf9, 0x49, 0xb5, 0x3d,
-  0xd9, 0x1d, 0x66, 0x3d, 0xa8, 0x82, 0x61, 0xbc, 0x92, 0x4e, 0xc4, 0x3d,
-  0x96, 0x09, 0x30, 0x3d, 0xae, 0x70, 0x22, 0xbb, 0xc8, 0xba, 0x92, 0x3d,
-  0x8f, 0xb5, 0x12, 0xbd, 0xa4, 0xec, 0x58, 0xbc, 0xbe, 0x22, 0x9c, 0xbb,
-  0x55, 0x8d, 0x54, 0x3c, 0xa1, 0x71, 0x54, 0x3c, 0x50, 0x97, 0xe0, 0x3c,
-  0xd9, 0xa2, 0x91, 0xbc, 0x4d, 0x81, 0x1e, 0x3b, 0xa8, 0xbd, 0x81, 0x3d,
-  0x75, 0xbc, 0xb2, 0x3d, 0x9b, 0x1f, 0x11, 0x3d, 0xbe, 0x21, 0x0a, 0xbc,
-  0x5e, 0x75, 0x36, 0x3d, 0x1a, 0xcf, 0xc1, 0x3c, 0xd0, 0x35, 0x1c, 0x3d,
-  0x7f, 0x12, 0x07, 0x3e, 0xbd, 0x2e, 0xfb, 0xbc, 0xeb, 0x74, 0xd8, 0x3b,
-  0x15, 0xc0, 0x9e, 0xbd, 0x71, 0xe4, 0x97, 0x3d, 0x95, 0x66, 0xbb, 0xbd,
-  0xa3, 0x15, 0xe1, 0xbb, 0x36, 0x13, 0x68, 0xbc, 0xce, 0x34, 0xeb, 0xbb,
-  0x7a, 0x60, 0x2a, 0xbd, 0x3d, 0x1a, 0xbc, 0x3d, 0x0f, 0xc8, 0x12, 0xbd,
-  0xbd, 0x64, 0x67, 0x3d, 0xf8, 0xa8, 0x2c, 0xbe, 0x3b, 0x63, 0xe9, 0xbc,
-  0xca, 0x20, 0x3b, 0x3d, 0xbb, 0xd0, 0x36, 0xbb, 0x6b, 0x75, 0x00, 0x3d,
-  0x78, 0xaf, 0x17, 0xbd, 0x63, 0xc2, 0xbf, 0x3b, 0x19, 0xa8, 0x48, 0x3d,
-  0x5e, 0xd5, 0x81, 0xbd, 0x4f, 0x9a, 0xf7, 0x3c, 0x31, 0x2a, 0x48, 0xbc,
-  0xa8, 0x33, 0x64, 0xbc, 0xd7, 0x7c, 0xbf, 0x3b, 0x2c, 0x71, 0xfb, 0x3d,
-  0x55, 0x3d, 0x81, 0x3d, 0x36, 0xfb, 0xaf, 0xbd, 0xef, 0xdf, 0xa1, 0xbd,
-  0x73, 0x3d, 0x1d, 0xbd, 0x4e, 0x6f, 0xaa, 0x3d, 0xaf, 0x22, 0x33, 0x3d,
-  0xbe, 0xad, 0x69, 0xbd, 0xf8, 0x68, 0x9f, 0xbd, 0x98, 0x38, 0x8b, 0xbc,
-  0xcb, 0xac, 0x91, 0xbd, 0x6b, 0x53, 0xb7, 0xbb, 0x44, 0x17, 0xfb, 0xbb,
-  0x94, 0xcd, 0x22, 0x3d, 0xa3, 0xe1, 0x97, 0x3d, 0x3b, 0xe4, 0x1c, 0x3d,
-  0x8a, 0x54, 0x91, 0xbb, 0x50, 0x88, 0xe1, 0x3c, 0x53, 0x67, 0x2a, 0x3c,
-  0xde, 0x95, 0x5b, 0xbe, 0x68, 0xe0, 0xf4, 0x3d, 0xbc, 0xd3, 0xde, 0x3d,
-  0x1d, 0x85, 0xeb, 0x3d, 0x67, 0x72, 0x2d, 0xbd, 0x77, 0x3f, 0xd1, 0xbd,
-  0xc4, 0x28, 0xe0, 0xbc, 0x75, 0x25, 0x81, 0xbc, 0xbc, 0xb3, 0x3d, 0xbe,
-  0x39, 0xb6, 0x8b, 0xbd, 0x04, 0xb6, 0xeb, 0xbb, 0xd7, 0xc2, 0xd9, 0x3d,
-  0x85, 0x01, 0xd5, 0x3d, 0xa5, 0xe2, 0xb6, 0x3d, 0x57, 0x6f, 0xbf, 0xba,
-  0x68, 0x45, 0x6d, 0xbd, 0xe6, 0x07, 0xa1, 0xbd, 0x0d, 0x62, 0xfc, 0x3d,
-  0x75, 0x76, 0xa7, 0x3d, 0xef, 0xc8, 0x90, 0x3d, 0x92, 0xe9, 0xa3, 0xbd,
-  0xfc, 0xe8, 0xff, 0xbc, 0x85, 0xdb, 0x89, 0xbc, 0xbe, 0xe1, 0x7f, 0x3c,
-  0xb6, 0xa6, 0xab, 0x3a, 0xba, 0xaa, 0x9f, 0x3c, 0xea, 0xed, 0x7f, 0x3d,
-  0x6c, 0xff, 0xe3, 0x3a, 0xc1, 0x88, 0xdf, 0x3b, 0x74, 0x43, 0x9a, 0x3d,
-  0xbe, 0x88, 0xc1, 0xbc, 0xec, 0xf7, 0x18, 0x3d, 0xfa, 0x39, 0xb4, 0xbd,
-  0x8b, 0x52, 0x47, 0x3c, 0xf8, 0xa9, 0x8d, 0x3d, 0x41, 0x4e, 0x85, 0x3d,
-  0x79, 0xea, 0x12, 0x3d, 0x7d, 0x61, 0x68, 0x3d, 0x8c, 0xf2, 0x4b, 0x3d,
-  0xc0, 0x38, 0x1f, 0xbd, 0xec, 0x46, 0xa9, 0x3c, 0x53, 0x20, 0x72, 0x3c,
-  0xfb, 0x65, 0xd1, 0x3d, 0x97, 0x65, 0x1c, 0x3d, 0xd2, 0x48, 0x53, 0xbd,
-  0x8f, 0xe8, 0x16, 0x3d, 0x74, 0x71, 0x91, 0x3d, 0x47, 0x1b, 0xfc, 0xbc,
-  0xc8, 0xf2, 0x85, 0x3c, 0x82, 0xbb, 0x0e, 0xbd, 0x02, 0x91, 0xfb, 0x3b,
-  0xae, 0xe3, 0x0a, 0xbe, 0xc5, 0x04, 0x17, 0xbe, 0xa5, 0x64, 0x27, 0x3e,
-  0x3c, 0x3c, 0x4d, 0xbc, 0x8e, 0x3b, 0x85, 0x3d, 0xb6, 0x3b, 0x8c, 0x3d,
-  0xc7, 0xe7, 0x9d, 0x3d, 0x69, 0xca, 0x01, 0xbe, 0xc4, 0x36, 0xa1, 0xbd,
-  0x93, 0x5a, 0xe8, 0xbd, 0x2f, 0xf4, 0x2e, 0x3d, 0x39, 0x82, 0x06, 0xbe,
-  0x92, 0x6b, 0xa6, 0xbd, 0xa2, 0xa3, 0x10, 0xbd, 0x92, 0x79, 0xdb, 0xbc,
-  0x10, 0x5c, 0xc5, 0xbd, 0xdc, 0xb0, 0x01, 0xbe, 0x54, 0x3b, 0x02, 0x3e,
-  0x38, 0xe0, 0x81, 0x3e, 0x89, 0x03, 0xc7, 0x3b, 0xda, 0xfb, 0xc9, 0x3d,
-  0x5c, 0x80, 0x18, 0x3d, 0xe3, 0xf3, 0xdc, 0xbc, 0x80, 0xff, 0xc1, 0xbc,
-  0xf3, 0x9e, 0xea, 0xbd, 0x9e, 0xf0, 0xbc, 0xbd, 0xeb, 0x21, 0xd4, 0xbc,
-  0x1e, 0xd9, 0x0f, 0x3d, 0x82, 0xa1, 0x6a, 0x3d, 0xa4, 0x65, 0xda, 0xbc,
-  0xde, 0x94, 0xb3, 0xbd, 0x95, 0xe1, 0x13, 0x3d, 0x1a, 0x4d, 0xb0, 0xbd,
-  0x8a, 0x7c, 0x36, 0xbc, 0x8f, 0x69, 0x17, 0x3e, 0x6c, 0x7e, 0x02, 0xbd,
-  0x9b, 0xf1, 0xcb, 0x3c, 0x41, 0xfa, 0xdd, 0x3d, 0x22, 0x21, 0x8c, 0x3d,
-  0x50, 0x82, 0x57, 0xbd, 0x58, 0x96, 0xa4, 0xbd, 0x00, 0x33, 0x83, 0xbd,
-  0x61, 0x4c, 0x73, 0xbb, 0x44, 0x6c, 0x45, 0x3d, 0x2e, 0xa6, 0xf0, 0xbc,
-  0x03, 0x63, 0x9a, 0x3d, 0x7f, 0x18, 0xb2, 0xbd, 0xf3, 0x56, 0xb7, 0x3d,
-  0xa4, 0xf3, 0xc4, 0xbd, 0x50, 0x67, 0x24, 0x3d, 0x57, 0xce, 0xe0, 0x3d,
-  0x0b, 0xe1, 0x81, 0xbb, 0x83, 0xda, 0x54, 0xbd, 0x7a, 0xa8, 0x46, 0x3d,
-  0x6e, 0x5e, 0x47, 0x3d, 0xba, 0x1a, 0xa6, 0xbc, 0xda, 0x50, 0xb6, 0xbc,
-  0x17, 0x74, 0x25, 0x3c, 0xf7, 0x16, 0x3c, 0x3d, 0x46, 0x8d, 0xab, 0xbc,
-  0x59, 0x2a, 0x11, 0xbb, 0xe0, 0x71, 0x48, 0xbd, 0x7d, 0x99, 0x30, 0xbe,
-  0xe4, 0x78, 0x5c, 0xbd, 0x6a, 0x2f, 0x52, 0x3d, 0x27, 0x7a, 0xf6, 0x3d,
-  0x28, 0x8a, 0x19, 0x3e, 0x93, 0xba, 0x66, 0x3d, 0x23, 0x47, 0x0c, 0x3c,
-  0xc2, 0x00, 0x9c, 0x3d, 0x88, 0xd6, 0x0e, 0xbd, 0xec, 0xc6, 0x7d, 0xbd,
-  0xbe, 0x0a, 0xde, 0xbc, 0xda, 0x37, 0x9b, 0xbd, 0x53, 0xf3, 0xec, 0x3d,
-  0x1b, 0x82, 0x14, 0xbb, 0xd9, 0xfa, 0x71, 0x3d, 0x5b, 0x0f, 0xab, 0xbd,
-  0x4a, 0x00, 0x25, 0xbe, 0x6f, 0xdd, 0xff, 0x3d, 0x12, 0xbf, 0xfc, 0xbd,
-  0xda, 0xfc, 0xd6, 0x3b, 0x0c, 0xf4, 0x25, 0x3e, 0x28, 0xd5, 0x16, 0xbd,
-  0xba, 0x22, 0xb3, 0x3d, 0x62, 0x64, 0x03, 0xbd, 0x67, 0xd6, 0x12, 0x3d,
-  0xf9, 0xcf, 0x7f, 0x3d, 0x9f, 0xa1, 0x85, 0x3d, 0x12, 0x68, 0xa9, 0xbd,
-  0x4f, 0x95, 0x34, 0x3e, 0x4c, 0xc1, 0x3a, 0x3d, 0x38, 0x0c, 0xce, 0x3d,
-  0x1e, 0x8b, 0x32, 0xbe, 0xfe, 0x1f, 0x01, 0xbd, 0xe0, 0x75, 0xb5, 0x3d,
-  0xa3, 0x79, 0x87, 0xbd, 0x6e, 0xbe, 0x84, 0x3d, 0xd5, 0x62, 0x2d, 0x3d,
-  0x89, 0xda, 0x8f, 0xbd, 0xc7, 0xf4, 0x10, 0x3e, 0x4e, 0xf7, 0x99, 0x3d,
-  0x4f, 0xa7, 0x34, 0xbd, 0x5a, 0xa4, 0x9d, 0xbc, 0xa4, 0x5c, 0xc0, 0x3c,
-  0xd4, 0x21, 0xbd, 0xbd, 0xf5, 0xdf, 0x9c, 0xbd, 0xd7, 0x75, 0xe6, 0x3d,
-  0xc3, 0x45, 0xed, 0x3d, 0x28, 0xf4, 0x09, 0xbe, 0xdf, 0x55, 0x83, 0xbe,
-  0x7d, 0x7d, 0x21, 0x3e, 0xf6, 0x8a, 0xc3, 0xbd, 0xee, 0xa4, 0x9d, 0x3d,
-  0xaa, 0x8a, 0xb1, 0x3d, 0x0d, 0xbc, 0x00, 0x3d, 0xfc, 0x4e, 0x0a, 0xbc,
-  0xa9, 0x7c, 0x09, 0x3e, 0x8f, 0x00, 0x31, 0xbc, 0x5f, 0xa6, 0x1b, 0x3d,
-  0x70, 0x49, 0xa3, 0x3c, 0xb2, 0x33, 0x4d, 0xbb, 0x22, 0x83, 0x86, 0xbc,
-  0x28, 0x08, 0x8e, 0x3d, 0xcf, 0x07, 0xb4, 0x3d, 0x32, 0x37, 0xbc, 0xbd,
-  0x0f, 0xa7, 0xe9, 0xbd, 0x67, 0x3b, 0x7a, 0x3d, 0xa0, 0xdd, 0xd8, 0xbd,
-  0xe5, 0x31, 0xa9, 0xbc, 0xb2, 0x5b, 0x98, 0x3d, 0xc0, 0x36, 0xab, 0xbd,
-  0xe5, 0xbe, 0x4c, 0x3c, 0x53, 0xb8, 0x5e, 0x3d, 0x7f, 0x46, 0xa4, 0xbd,
-  0x2a, 0x78, 0x4e, 0xbc, 0xbe, 0xc9, 0x0e, 0xbd, 0xd3, 0x02, 0x8a, 0xbd,
-  0x36, 0x80, 0xdf, 0x3d, 0x85, 0x10, 0x6a, 0x3d, 0x44, 0xca, 0xbc, 0x3d,
-  0x9f, 0x1d, 0x6e, 0xbe, 0xf7, 0xd0, 0x23, 0xbe, 0x43, 0x39, 0x73, 0xbb,
-  0x21, 0x18, 0x67, 0xbd, 0xc0, 0x30, 0xf5, 0xbc, 0x34, 0x9c, 0x02, 0x3d,
-  0xa4, 0x72, 0x07, 0xbe, 0x86, 0xcc, 0x92, 0x3d, 0xc7, 0x28, 0xd8, 0x3c,
-  0x98, 0x82, 0x3c, 0x3d, 0x31, 0x5c, 0x4a, 0x3d, 0xa2, 0xba, 0xcd, 0x3b,
-  0x6c, 0x15, 0x6c, 0xbd, 0xe7, 0xd3, 0x2a, 0x3d, 0x7b, 0x94, 0x5b, 0x3c,
-  0x6b, 0xaa, 0x01, 0x3b, 0xf9, 0x29, 0x05, 0xbd, 0x81, 0x8a, 0x1c, 0xbe,
-  0xbc, 0xd1, 0x4c, 0x3d, 0x2f, 0x53, 0x15, 0xbd, 0x2f, 0xac, 0xa9, 0x3d,
-  0x65, 0xa9, 0x0c, 0x3e, 0x05, 0x72, 0x76, 0xbc, 0x94, 0x5a, 0x34, 0xbc,
-  0x1a, 0xc3, 0x09, 0x3e, 0xe8, 0xfe, 0x51, 0x3d, 0x89, 0x35, 0xab, 0xbd,
-  0x0f, 0xfe, 0x0a, 0x3c, 0x1e, 0x30, 0xb2, 0xbd, 0x94, 0x2e, 0x55, 0x3d,
-  0x98, 0x13, 0xd3, 0x3d, 0x77, 0xc4, 0xa0, 0x3d, 0xba, 0x37, 0x72, 0xbc,
-  0xdb, 0xac, 0xa4, 0xbd, 0x7f, 0xf3, 0x69, 0x3d, 0x40, 0x8b, 0xe2, 0x3c,
-  0x2c, 0xff, 0x6d, 0xbd, 0x98, 0x67, 0x57, 0x3d, 0x2c, 0x39, 0x8b, 0x3c,
-  0xec, 0x74, 0x0b, 0xbd, 0xbe, 0x7b, 0x03, 0x3d, 0x0a, 0x94, 0x4b, 0xbd,
-  0x03, 0xa2, 0xbf, 0xbc, 0x20, 0x4a, 0xce, 0x3c, 0x91, 0x73, 0x8f, 0xbd,
-  0xd2, 0x50, 0x3a, 0xbc, 0xee, 0xa0, 0x8b, 0xbd, 0x52, 0xb6, 0x7b, 0x3d,
-  0xa1, 0x3c, 0x8f, 0xbc, 0x8d, 0x87, 0xe1, 0xbd, 0xaf, 0x29, 0x45, 0x3c,
-  0xe9, 0xbc, 0xf0, 0xbc, 0xa0, 0xd0, 0xc7, 0x3d, 0x5b, 0x2d, 0x25, 0x3d,
-  0xb0, 0x50, 0x8b, 0xbd, 0x5a, 0x18, 0x12, 0x3d, 0xc3, 0xbc, 0xa4, 0x3b,
-  0x72, 0x7b, 0x8d, 0x3c, 0x70, 0x92, 0xa3, 0x3b, 0xac, 0xf7, 0xb8, 0xbd,
-  0xe4, 0x91, 0x8f, 0xbd, 0x35, 0x31, 0xc6, 0xbd, 0xa1, 0x3f, 0x3d, 0xbc,
-  0x52, 0xed, 0x07, 0x3d, 0x4c, 0xe1, 0x01, 0xbe, 0x50, 0x6a, 0xcb, 0xbd,
-  0xc6, 0x90, 0x54, 0x3c, 0x66, 0x9f, 0x97, 0xbb, 0x8d, 0x8d, 0xb7, 0x3d,
-  0x6e, 0xd7, 0x1e, 0x3e, 0x85, 0x86, 0x8d, 0xbc, 0xd0, 0x80, 0x56, 0x3d,
-  0xf6, 0x71, 0xbf, 0xba, 0x27, 0x09, 0x60, 0x3c, 0x63, 0x36, 0xd1, 0xbd,
-  0x9c, 0x91, 0x83, 0xbd, 0xbe, 0xba, 0xc0, 0xbd, 0x4c, 0x4e, 0x0a, 0xba,
-  0x47, 0x28, 0x18, 0xbd, 0x25, 0xd2, 0x18, 0x3d, 0x20, 0x06, 0xe0, 0xbd,
-  0x79, 0x95, 0xc8, 0xbd, 0xd5, 0x35, 0x47, 0x3d, 0xba, 0x7a, 0xe8, 0xbc,
-  0x58, 0x33, 0x4d, 0x3c, 0xec, 0x0a, 0x99, 0x3d, 0x8e, 0x8c, 0x13, 0x3d,
-  0x14, 0x64, 0xbd, 0x3d, 0x52, 0xdb, 0xef, 0x3c, 0xb7, 0x29, 0xb2, 0x3d,
-  0x60, 0x79, 0xf2, 0x3d, 0x6c, 0xd8, 0x34, 0xbd, 0x93, 0xdc, 0x7b, 0xbd,
-  0x11, 0x57, 0xa4, 0x3c, 0x7e, 0x83, 0xeb, 0x3d, 0x63, 0xfe, 0x54, 0x3c,
-  0x23, 0x4c, 0x46, 0xbd, 0xfe, 0xdc, 0x35, 0xbd, 0x99, 0xa1, 0x8e, 0x3d,
-  0x8f, 0x2a, 0xb4, 0xbc, 0xf6, 0x2c, 0x5d, 0x3d, 0x53, 0xfa, 0x5b, 0x3d,
-  0x7f, 0x3d, 0x64, 0x3d, 0x74, 0x47, 0x99, 0x3d, 0x8f, 0x21, 0xc9, 0x3d,
-  0x24, 0xac, 0xb6, 0x3d, 0x76, 0x28, 0x3e, 0x3c, 0x70, 0xc1, 0x39, 0xbc,
-  0xa4, 0x38, 0xd7, 0xbc, 0x87, 0x37, 0x56, 0x3d, 0x4d, 0xcc, 0x36, 0xba,
-  0x4c, 0x07, 0x17, 0x3b, 0xae, 0x2a, 0x8f, 0x3b, 0xa7, 0xdb, 0x0b, 0xbc,
-  0xf7, 0xf8, 0xb3, 0x3c, 0xb7, 0xc2, 0x9d, 0xbd, 0xc1, 0x2e, 0xcb, 0x3d,
-  0xbb, 0x31, 0x75, 0x3e, 0xd0, 0xb6, 0x04, 0x3d, 0xbf, 0x8f, 0x79, 0xbd,
-  0x2c, 0x79, 0xe6, 0x3d, 0x36, 0x55, 0xe7, 0x3c, 0xc4, 0xae, 0x6a, 0x3d,
-  0x05, 0x1d, 0x3e, 0x3d, 0x49, 0x3d, 0x2f, 0xbd, 0xef, 0x8a, 0x94, 0x3d,
-  0x25, 0x59, 0x53, 0x3d, 0x3d, 0xf2, 0xca, 0x3d, 0x0c, 0xa6, 0x75, 0xbe,
-  0xaf, 0x19, 0x2d, 0xbe, 0x82, 0x8f, 0x30, 0x3d, 0x92, 0x8a, 0xc4, 0xbd,
-  0x57, 0x36, 0x71, 0x3c, 0x66, 0x38, 0x08, 0x3e, 0x87, 0xbb, 0x3a, 0x3d,
-  0x4e, 0x7e, 0x03, 0x3d, 0xc2, 0x52, 0x0a, 0xbc, 0xf1, 0xb1, 0x33, 0x39,
-  0x40, 0xe9, 0xfa, 0xbd, 0x23, 0x5a, 0x90, 0xbd, 0x57, 0x03, 0x8f, 0xbd,
-  0x7b, 0x67, 0xe4, 0x3c, 0x91, 0x4d, 0x22, 0xbc, 0x55, 0x6a, 0x02, 0x3d,
-  0x28, 0x11, 0x92, 0xbd, 0xf8, 0x53, 0x17, 0xbe, 0x36, 0x03, 0x73, 0x3d,
-  0x22, 0x67, 0x70, 0xbd, 0x02, 0x7b, 0xf6, 0xbc, 0x86, 0xc6, 0x18, 0x3e,
-  0xe6, 0x41, 0x4b, 0xbd, 0x30, 0x81, 0xd1, 0x3d, 0x65, 0xa7, 0xc1, 0xbc,
-  0x44, 0x14, 0x95, 0xbd, 0xd4, 0xb1, 0xbf, 0xbb, 0x57, 0x82, 0x5c, 0xbd,
-  0x8f, 0x5c, 0xd3, 0xbd, 0x17, 0x96, 0x74, 0xbc, 0xcf, 0x10, 0x58, 0x3c,
-  0xb4, 0x78, 0x8b, 0x3c, 0xd3, 0x75, 0xd4, 0xbd, 0x3c, 0x25, 0x0a, 0xbe,
-  0x30, 0x4e, 0xb1, 0x3d, 0xbc, 0x42, 0x98, 0xbd, 0xc3, 0x59, 0x36, 0x3d,
-  0xf9, 0x6d, 0x75, 0x3e, 0x0a, 0xc6, 0xa6, 0x3d, 0x06, 0x4f, 0xb3, 0x3d,
-  0xd6, 0x01, 0x5b, 0x3d, 0xad, 0x43, 0xac, 0x3c, 0x25, 0xa1, 0xa1, 0xbc,
-  0x37, 0x3f, 0x68, 0x3d, 0x47, 0xdd, 0x28, 0x3b, 0xea, 0x5b, 0x25, 0x3d,
-  0xc9, 0x7a, 0xd9, 0xbc, 0x1c, 0xa3, 0x2b, 0xbd, 0x01, 0x56, 0x2f, 0xbe,
-  0x51, 0x73, 0x1d, 0xbe, 0x6a, 0x16, 0xa0, 0x3d, 0x2e, 0xbd, 0xdf, 0x3c,
-  0xf1, 0x5f, 0x38, 0x3e, 0x17, 0x5b, 0x2f, 0x3d, 0x56, 0xcf, 0x8e, 0xbd,
-  0x87, 0x14, 0x07, 0x3d, 0x1d, 0x2a, 0x87, 0xbd, 0xe1, 0x91, 0x6b, 0xbd,
-  0x12, 0x87, 0xa5, 0xbc, 0x10, 0xd9, 0x8c, 0x3c, 0x52, 0x38, 0x99, 0xbd,
-  0x09, 0xa1, 0x70, 0xbd, 0x3f, 0x07, 0x47, 0xbd, 0x45, 0xbf, 0x03, 0x3c,
-  0xb6, 0xa2, 0x18, 0xbe, 0xb7, 0xc0, 0x4f, 0xbe, 0x01, 0xa4, 0xbf, 0x3c,
-  0x4c, 0xe1, 0xda, 0xbd, 0x9d, 0x82, 0xde, 0x3b, 0x23, 0x80, 0x89, 0x3d,
-  0x9c, 0x02, 0xa4, 0xbd, 0x3c, 0x8d, 0xca, 0xbb, 0x95, 0xbd, 0xb9, 0x3c,
-  0xbf, 0x76, 0xe9, 0x3c, 0x25, 0x38, 0x8a, 0xbc, 0x41, 0xb9, 0x35, 0xbd,
-  0x29, 0x89, 0x7e, 0xbd, 0x4e, 0xbb, 0xf4, 0x3a, 0xa6, 0xc6, 0xe2, 0x3c,
-  0x6f, 0x1c, 0x61, 0x3d, 0xa1, 0xdb, 0x9e, 0xbe, 0x29, 0xc1, 0xba, 0xbd,
-  0xd3, 0x34, 0xce, 0x3d, 0xf6, 0x84, 0x3e, 0xbd, 0xa8, 0x60, 0xb5, 0x3c,
-  0x04, 0xce, 0x11, 0x3e, 0xa8, 0x7c, 0x52, 0x3d, 0x33, 0x63, 0x56, 0x3d,
-  0xf5, 0xc3, 0xb0, 0x3d, 0xb7, 0x56, 0x72, 0x3d, 0xc4, 0x1c, 0x9c, 0xbd,
-  0x1d, 0xbe, 0x8d, 0xbd, 0xb4, 0x35, 0x3d, 0xbe, 0x75, 0x95, 0xab, 0x3d,
-  0x48, 0x21, 0xc5, 0x3d, 0xce, 0x9a, 0xf6, 0xbc, 0x3e, 0xf9, 0x4d, 0xbd,
-  0xe1, 0xc4, 0x16, 0xbe, 0x44, 0xde, 0x52, 0x3c, 0x2a, 0xb1, 0xe8, 0x3c,
-  0xcd, 0x3f, 0x21, 0x3e, 0x5a, 0x5a, 0x57, 0x3e, 0xd5, 0xe6, 0xd7, 0xbc,
-  0x58, 0x98, 0x63, 0xbb, 0x00, 0x14, 0x0f, 0x3c, 0x8a, 0xfb, 0x80, 0xbd,
-  0x85, 0x0a, 0x83, 0x3c, 0x23, 0x24, 0x16, 0xbd, 0x2e, 0x95, 0xc1, 0xbd,
-  0x52, 0xff, 0xc5, 0x3d, 0xd4, 0x3b, 0x01, 0x3e, 0x91, 0x80, 0xc6, 0x3d,
-  0xfd, 0x2c, 0x1f, 0xbd, 0xe2, 0xb1, 0x6b, 0xbd, 0x94, 0x7f, 0x7d, 0xbc,
-  0x1c, 0xa4, 0x29, 0xbd, 0x54, 0x13, 0xaf, 0x3d, 0x2e, 0xd7, 0xb1, 0x3d,
-  0x32, 0xd7, 0x55, 0x3d, 0xd3, 0x22, 0xa1, 0x3b, 0x4f, 0x69, 0x7a, 0x3d,
-  0x8c, 0x9a, 0x23, 0xbd, 0xbb, 0x1c, 0x94, 0xbd, 0x2f, 0x9d, 0xe5, 0xbd,
-  0x6c, 0x5b, 0xd5, 0xbd, 0x22, 0xc2, 0x6a, 0x3d, 0xd3, 0xab, 0xbd, 0x3c,
-  0xe4, 0x95, 0x64, 0x3d, 0x6c, 0x37, 0x12, 0xbc, 0x60, 0x26, 0x7f, 0xbd,
-  0x36, 0xab, 0xe5, 0x3d, 0x2d, 0x03, 0x43, 0x3d, 0xe1, 0xaf, 0xd3, 0x3d,
-  0x28, 0x36, 0x43, 0x3e, 0xde, 0xc9, 0x31, 0x3d, 0xeb, 0x66, 0xa4, 0xbc,
-  0x32, 0xad, 0x96, 0x3c, 0x70, 0x9b, 0x1a, 0x3d, 0xbe, 0x46, 0x0e, 0xbe,
-  0x84, 0x2e, 0xe8, 0xbd, 0x61, 0xcf, 0x15, 0xbe, 0xde, 0xb5, 0x79, 0xbd,
-  0xce, 0xd6, 0xa5, 0xbc, 0x22, 0xfe, 0xb7, 0x3d, 0xa1, 0xe7, 0x2d, 0xbe,
-  0x88, 0xea, 0x1e, 0xbe, 0x47, 0x4d, 0x13, 0xbd, 0x22, 0xca, 0xcf, 0xbd,
-  0xa4, 0xe0, 0x6b, 0x3d, 0x64, 0x30, 0x07, 0x3e, 0x6a, 0x7d, 0xc9, 0xbc,
-  0x30, 0x7a, 0x80, 0xbc, 0x26, 0x04, 0x8d, 0xbc, 0xcf, 0xde, 0xbc, 0x3d,
-  0x34, 0x97, 0xec, 0xbd, 0xb2, 0x8f, 0x0c, 0xbd, 0x8b, 0xf1, 0xf4, 0xbd,
-  0xc9, 0xde, 0x5a, 0xbd, 0x2a, 0x49, 0xc9, 0xbc, 0x46, 0xfa, 0x4b, 0x3d,
-  0x1b, 0xc8, 0xc7, 0xbd, 0xb9, 0x13, 0xb9, 0xbc, 0xf5, 0x47, 0x68, 0x3d,
-  0xb1, 0x45, 0x9c, 0xbd, 0xa0, 0xdb, 0xfe, 0x3c, 0x92, 0x66, 0xcd, 0x3d,
-  0x64, 0xed, 0xb1, 0x3d, 0x54, 0x74, 0x18, 0xbd, 0x61, 0x4c, 0x2f, 0x3d,
-  0x30, 0x35, 0x10, 0xbd, 0x47, 0x3c, 0x06, 0xbd, 0xd3, 0x71, 0x4e, 0xbd,
-  0xcb, 0x44, 0xca, 0xbd, 0x71, 0x1b, 0x54, 0x3d, 0x2d, 0xa6, 0x0e, 0x3c,
-  0x0a, 0xa1, 0x2f, 0x3d, 0x8c, 0xa9, 0xca, 0xbd, 0x92, 0x40, 0xd0, 0xbd,
-  0x5d, 0x5e, 0xb4, 0x3d, 0x80, 0x9c, 0x00, 0xbd, 0xb5, 0x88, 0x84, 0xbd,
-  0x97, 0x2f, 0x06, 0x3d, 0xbb, 0x03, 0x60, 0xbd, 0x2e, 0xe6, 0x3a, 0xbc,
-  0xa0, 0xfc, 0x87, 0x3d, 0x75, 0xd5, 0xe3, 0x3a, 0x5f, 0x3b, 0x66, 0x3d,
-  0x55, 0x07, 0x82, 0xbd, 0xa7, 0x3a, 0xe5, 0xbd, 0x61, 0x89, 0x07, 0x3d,
-  0x10, 0x3d, 0x69, 0xbc, 0x8a, 0x2b, 0x3c, 0x3d, 0xe0, 0x2c, 0x72, 0x3d,
-  0x29, 0x3a, 0x4e, 0xbe, 0x3f, 0x76, 0x0c, 0xbc, 0x03, 0xb7, 0xfd, 0xbc,
-  0x7e, 0x74, 0xf4, 0x3d, 0xe8, 0x29, 0x0e, 0x3e, 0x61, 0x9b, 0x71, 0xbd,
-  0x61, 0xc9, 0x57, 0xbd, 0x73, 0x4e, 0xfb, 0x3b, 0xed, 0x46, 0xb9, 0xbc,
-  0x6f, 0x46, 0xc1, 0xbc, 0x18, 0xf6, 0xc7, 0xbb, 0xce, 0x9b, 0xd6, 0xbc,
-  0x6b, 0xec, 0x23, 0x3d, 0x7b, 0xd7, 0xb9, 0x3b, 0x09, 0xfd, 0x97, 0x3d,
-  0xff, 0xb4, 0xff, 0xbd, 0x10, 0x28, 0x0d, 0xbe, 0xf9, 0xce, 0xb3, 0x3d,
-  0xed, 0x27, 0xbb, 0xbd, 0x4f, 0xb1, 0x66, 0x3c, 0x07, 0xea, 0xd1, 0x3d,
-  0xda, 0xa1, 0x56, 0xbd, 0x1f, 0x35, 0x03, 0xbd, 0x92, 0xd2, 0x86, 0xba,
-  0x50, 0x23, 0xb1, 0x3d, 0x37, 0xbf, 0x13, 0x3d, 0x7a, 0x15, 0xbf, 0x3c,
-  0x10, 0xfa, 0xb3, 0xbd, 0xe1, 0x6b, 0xb3, 0x3c, 0x13, 0xf6, 0x19, 0x3d,
-  0xfe, 0x0f, 0xef, 0x3d, 0x4e, 0xba, 0xbf, 0xbd, 0x3a, 0x6d, 0xd5, 0xbd,
-  0xd2, 0x49, 0x75, 0x3d, 0x36, 0x6c, 0xc4, 0xbd, 0x45, 0xa0, 0x66, 0x3d,
-  0x52, 0xde, 0x32, 0x3a, 0x8d, 0x55, 0x7c, 0x3c, 0xa9, 0xa0, 0x1a, 0xbc,
-  0x38, 0x2d, 0xe1, 0x3d, 0xea, 0xae, 0x46, 0x3d, 0xcd, 0xf4, 0x60, 0xbc,
-  0x10, 0x4e, 0x20, 0xbd, 0x8d, 0xff, 0x1d, 0x3d, 0xe7, 0xd0, 0x6e, 0x3c,
-  0xb0, 0xdc, 0xce, 0xbb, 0x6d, 0xff, 0x2d, 0x3a, 0x9b, 0x1a, 0x14, 0xbe,
-  0xec, 0x97, 0x42, 0xbe, 0x91, 0x76, 0xc3, 0x3d, 0x79, 0xdc, 0x7d, 0xbd,
-  0xc6, 0x8a, 0xf5, 0x3d, 0xcb, 0x5f, 0x80, 0x3e, 0x02, 0xf6, 0x8c, 0x3d,
-  0x39, 0xd5, 0xda, 0x3d, 0xd5, 0xbb, 0x74, 0x3d, 0x66, 0x7f, 0x1d, 0x3d,
-  0xff, 0x20, 0x12, 0x3c, 0x9c, 0xc1, 0x2b, 0x3d, 0x3d, 0x9c, 0xae, 0x3c,
-  0x10, 0x81, 0x44, 0xbd, 0x7b, 0x98, 0xef, 0x3b, 0xa8, 0x81, 0xd2, 0x3d,
-  0x07, 0x0a, 0xd2, 0xbd, 0xb1, 0x5e, 0x3c, 0xbe, 0x55, 0xda, 0x14, 0x3d,
-  0x87, 0xfc, 0x79, 0xbb, 0x7b, 0x54, 0xec, 0xbc, 0x85, 0x95, 0xbc, 0xbc,
-  0x74, 0x7d, 0x74, 0xbd, 0xd5, 0x3c, 0xa3, 0x3c, 0x6e, 0x62, 0xdf, 0x3d,
-  0x22, 0xb5, 0xe3, 0xbc, 0xd9, 0x61, 0x13, 0xbd, 0x52, 0x64, 0x2f, 0xbd,
-  0x17, 0xbc, 0x00, 0xbe, 0x84, 0x91, 0x8d, 0xbd, 0x01, 0x92, 0x6b, 0xbb,
-  0x19, 0x17, 0x8a, 0x3d, 0x01, 0x05, 0x3e, 0xbe, 0xfc, 0x80, 0x37, 0xbe,
-  0xdf, 0x22, 0x56, 0x3d, 0x1d, 0xa7, 0x0a, 0x3b, 0xc3, 0xb3, 0xc0, 0xba,
-  0x90, 0x40, 0x22, 0x3e, 0x14, 0x32, 0xa3, 0xbd, 0xb9, 0x57, 0x93, 0x3d,
-  0x58, 0x1f, 0x1a, 0xbd, 0xe1, 0xaf, 0x34, 0x3d, 0xd0, 0x59, 0x22, 0xbe,
-  0x10, 0x6a, 0xfe, 0xbc, 0xcc, 0xc5, 0xc7, 0xbb, 0xbe, 0xfb, 0xf3, 0x3c,
-  0xb7, 0x0e, 0xfd, 0x3b, 0xfb, 0xcc, 0x99, 0xba, 0x80, 0xdb, 0x11, 0xbe,
-  0xf9, 0x1e, 0x8f, 0xbd, 0x70, 0x62, 0x26, 0x3d, 0x67, 0xf7, 0xb9, 0xbd,
-  0x0c, 0xe9, 0x61, 0xbd, 0xc2, 0x67, 0x61, 0x3d, 0x80, 0xc8, 0x51, 0x3d,
-  0xed, 0x0a, 0x11, 0x3d, 0xb8, 0x7e, 0x00, 0x3d, 0x75, 0x98, 0x9f, 0x3c,
-  0xe2, 0x1f, 0xdd, 0xbd, 0x88, 0x86, 0x86, 0xbd, 0xa3, 0x38, 0x9e, 0xbb,
-  0xfa, 0x61, 0xb1, 0x3d, 0x64, 0x7d, 0xd6, 0x3b, 0xf5, 0x01, 0x2d, 0xbd,
-  0x92, 0x14, 0x32, 0xbd, 0x74, 0x86, 0x8c, 0xbd, 0x00, 0xf4, 0x30, 0x3d,
-  0x43, 0xbd, 0xf6, 0xbd, 0x40, 0x85, 0x19, 0x3a, 0xa7, 0x59, 0x07, 0x3e,
-  0xbd, 0xdf, 0x41, 0x3d, 0xbf, 0xd8, 0x1b, 0xbd, 0x07, 0xc2, 0x44, 0x3d,
-  0xcf, 0x00, 0xc9, 0x3c, 0x19, 0x9a, 0x3b, 0xbd, 0x75, 0xb3, 0x36, 0x3c,
-  0xd8, 0x47, 0x25, 0xbe, 0x6e, 0x63, 0x60, 0xbc, 0x4b, 0xc8, 0x2b, 0xbc,
-  0xe7, 0x42, 0x5d, 0xbc, 0x9a, 0xcc, 0x9d, 0xbd, 0x4c, 0x08, 0x0b, 0xbe,
-  0xae, 0xb0, 0x26, 0x3d, 0xc6, 0x98, 0xa9, 0xbd, 0x0c, 0x2d, 0x9f, 0x3c,
-  0xa9, 0x7b, 0x3f, 0xbd, 0x68, 0xc6, 0x9f, 0xbd, 0xc2, 0x6f, 0xf9, 0x3d,
-  0x37, 0x0c, 0x91, 0x3d, 0xe9, 0x48, 0x26, 0xbd, 0x16, 0x63, 0x98, 0xbd,
-  0xa5, 0x22, 0xc1, 0xbd, 0x9b, 0x1e, 0xae, 0xbd, 0xe6, 0x06, 0x6f, 0xbc,
-  0xa9, 0xc2, 0x89, 0xbb, 0xd2, 0xc1, 0xa5, 0x3c, 0x44, 0x46, 0x86, 0xbe,
-  0xd1, 0x6b, 0x36, 0xbe, 0x9a, 0xcc, 0xc9, 0xbc, 0x89, 0xe3, 0x59, 0xbd,
-  0x8f, 0x4e, 0xae, 0x3d, 0x2e, 0x3f, 0x29, 0x3e, 0xa2, 0x9d, 0x11, 0x3d,
-  0xf9, 0xf4, 0x08, 0x3d, 0x5d, 0x46, 0x23, 0xbd, 0x3d, 0xbc, 0x88, 0x3c,
-  0x87, 0x61, 0x1e, 0xbe, 0xb1, 0x8c, 0xa8, 0xbd, 0x56, 0x2d, 0xef, 0xbd,
-  0x66, 0xea, 0x6c, 0x3d, 0x78, 0x21, 0x0d, 0xbd, 0x05, 0x4f, 0x05, 0xbd,
-  0x9e, 0xd1, 0x12, 0xbe, 0xa6, 0x59, 0xee, 0xbd, 0xcf, 0x04, 0x1e, 0x3c,
-  0xdd, 0x1b, 0xb3, 0xbd, 0x38, 0x84, 0x7a, 0x3c, 0xfb, 0x8b, 0x18, 0x3e,
-  0xe9, 0xfa, 0x03, 0xbc, 0x80, 0x2c, 0x45, 0x3d, 0xf3, 0x66, 0xb2, 0x3d,
-  0x66, 0xea, 0xf9, 0x3d, 0xf3, 0x9e, 0x27, 0xbd, 0xe3, 0x13, 0xe8, 0xbb,
-  0xc0, 0x15, 0xd7, 0x3a, 0x9c, 0xf4, 0x6f, 0x3d, 0x19, 0xf8, 0xa1, 0x3c,
-  0xfa, 0x42, 0x85, 0x3c, 0x33, 0xa6, 0x70, 0xbd, 0xc7, 0x3b, 0xcf, 0xbd,
-  0x30, 0xe2, 0x34, 0x3d, 0xea, 0x65, 0x56, 0xbd, 0x48, 0x8e, 0x80, 0xbc,
-  0xc4, 0xd4, 0x1f, 0x3e, 0xc9, 0x51, 0x44, 0xbc, 0x98, 0x06, 0x63, 0x3d,
-  0xce, 0xa4, 0xc3, 0x3d, 0x93, 0xea, 0x31, 0x3d, 0x5e, 0xdb, 0x7e, 0x3d,
-  0xd4, 0xb4, 0x55, 0x3c, 0xec, 0x40, 0xb2, 0xbd, 0xa9, 0x0e, 0x24, 0x3c,
-  0xc1, 0x80, 0xba, 0xbc, 0xd9, 0xa7, 0x3d, 0x3d, 0x2f, 0x23, 0xcb, 0x3d,
-  0x43, 0x1c, 0x97, 0xbc, 0xbb, 0xb2, 0x85, 0x3c, 0x5b, 0xe4, 0xa0, 0xbd,
-  0x44, 0x4e, 0x8b, 0xbc, 0x1e, 0xe6, 0x2d, 0x3d, 0xdf, 0x6b, 0x9d, 0xbd,
-  0xa4, 0x58, 0x2c, 0x3d, 0xf0, 0xc2, 0x37, 0x3d, 0xe2, 0xe2, 0x23, 0x3d,
-  0xd3, 0x1c, 0xd6, 0x3c, 0x6f, 0xd3, 0x39, 0x3d, 0x70, 0xbe, 0x45, 0xbd,
-  0x6b, 0xfb, 0x35, 0x3d, 0x50, 0xb6, 0x09, 0x3d, 0xc6, 0x6f, 0xc5, 0x3d,
-  0xcd, 0x77, 0x43, 0xbe, 0x39, 0x94, 0x2e, 0xbe, 0xa3, 0x52, 0x74, 0xbd,
-  0xfc, 0x25, 0x18, 0x3c, 0x9b, 0x50, 0xfb, 0x3c, 0x93, 0x5d, 0xcf, 0x3d,
-  0x7f, 0xd0, 0x7e, 0xbd, 0x11, 0xa1, 0xca, 0x3c, 0x9f, 0x91, 0x2f, 0xbd,
-  0x91, 0x6b, 0x8a, 0x3d, 0x4c, 0xc5, 0x28, 0xbe, 0x56, 0x20, 0x72, 0xbd,
-  0x27, 0x38, 0xc2, 0xbc, 0x0b, 0x97, 0x9d, 0x3d, 0x9c, 0x1e, 0xbc, 0xbc,
-  0x2c, 0xa0, 0xb1, 0x3d, 0xc2, 0x4d, 0x34, 0xbe, 0x6d, 0xc1, 0xac, 0xbd,
-  0x47, 0xde, 0x16, 0x3e, 0x95, 0x72, 0xfe, 0xbd, 0x18, 0x83, 0xce, 0x3d,
-  0xdf, 0xe7, 0x97, 0x3d, 0x53, 0xec, 0x89, 0xbd, 0x10, 0xaf, 0x44, 0x3c,
-  0xf5, 0xa4, 0xc8, 0x3b, 0x24, 0x42, 0xb2, 0xbc, 0xf6, 0x46, 0x92, 0x3d,
-  0xc4, 0x81, 0x5f, 0x3d, 0x61, 0x0a, 0x1b, 0xbe, 0xc5, 0xbc, 0xc5, 0x3d,
-  0x0d, 0x9c, 0x5b, 0x3d, 0xf6, 0x23, 0xba, 0xbb, 0x71, 0xca, 0x6b, 0xbe,
-  0x1c, 0x4c, 0x7c, 0xbd, 0xae, 0x4d, 0x05, 0x3e, 0x7b, 0x67, 0x68, 0x3c,
-  0x24, 0x45, 0xeb, 0x3c, 0xf6, 0xe7, 0x41, 0x3e, 0x3e, 0xc0, 0xa1, 0x3c,
-  0x3d, 0x93, 0xc0, 0xbc, 0xd3, 0x66, 0x91, 0x3d, 0x67, 0x5c, 0xa5, 0xbc,
-  0x3b, 0xfb, 0x6f, 0xbd, 0x51, 0xc0, 0xd3, 0x3d, 0xf1, 0x1d, 0xe8, 0x3c,
-  0x87, 0x52, 0x9b, 0x3d, 0xa4, 0x2c, 0x90, 0xbc, 0xa4, 0x39, 0x66, 0x3c,
-  0x40, 0x20, 0xd0, 0xbd, 0x52, 0x4c, 0x15, 0xbd, 0xd8, 0x0e, 0xa8, 0x3c,
-  0x39, 0x70, 0x0f, 0xbd, 0x52, 0xe3, 0x87, 0xbd, 0xc9, 0xdc, 0x7d, 0x3d,
-  0xf1, 0x76, 0x72, 0xbd, 0x1c, 0x24, 0xd0, 0x3c, 0x37, 0x8b, 0x01, 0x3d,
-  0x49, 0xc6, 0x03, 0x3d, 0x30, 0x65, 0x8f, 0xbc, 0x10, 0x3e, 0x4b, 0xbd,
-  0xa0, 0x0b, 0x5d, 0x3d, 0x09, 0xdf, 0xaf, 0xbd, 0x91, 0xad, 0x46, 0xbd,
-  0xcd, 0xb3, 0x05, 0xbd, 0x14, 0xd4, 0x0b, 0xbe, 0xd4, 0x54, 0x53, 0xbd,
-  0xa0, 0xcb, 0x97, 0x3d, 0x63, 0xac, 0xb5, 0xbd, 0xa3, 0x17, 0x2c, 0x3d,
-  0xf7, 0xd8, 0x83, 0xbd, 0xf8, 0x1c, 0x19, 0x3d, 0xbc, 0xed, 0x8c, 0x3b,
-  0x80, 0x63, 0x98, 0xbc, 0xe2, 0x66, 0x31, 0x3d, 0xe5, 0x32, 0x9a, 0xbd,
-  0x07, 0xf0, 0xa7, 0xbd, 0xad, 0x27, 0xcf, 0xbc, 0xad, 0x58, 0x08, 0xbc,
-  0xc1, 0x9f, 0x9d, 0xbb, 0x22, 0x2c, 0xd6, 0xbb, 0xb5, 0xc7, 0x92, 0xbe,
-  0x22, 0xfb, 0x42, 0xbe, 0x02, 0x0a, 0x43, 0xbd, 0xfb, 0x3e, 0xf2, 0xbc,
-  0x82, 0xe6, 0x71, 0x3c, 0x07, 0xab, 0xd7, 0x3d, 0x0f, 0xc9, 0xd1, 0x3c,
-  0xeb, 0x44, 0x80, 0x3d, 0x47, 0x7c, 0x2e, 0xbd, 0x15, 0xe2, 0xa6, 0x3d,
-  0xcc, 0x71, 0x96, 0xbd, 0xfe, 0x77, 0x72, 0x3c, 0x6d, 0x34, 0xf4, 0xbd,
-  0x5b, 0xce, 0x6e, 0x3d, 0x50, 0xe5, 0xe6, 0xbc, 0x48, 0x6e, 0x2d, 0xbd,
-  0x6f, 0xbf, 0x59, 0x3d, 0x8e, 0x74, 0x00, 0xbe, 0x6f, 0x68, 0x6b, 0x3d,
-  0xeb, 0x23, 0x6f, 0xbd, 0xe1, 0xe6, 0x7a, 0x3c, 0x66, 0xa4, 0xf9, 0x3d,
-  0x86, 0xc7, 0x58, 0x3b, 0x8c, 0xb3, 0xff, 0x3c, 0xf5, 0x59, 0xaf, 0x3d,
-  0xe7, 0x94, 0xed, 0xbc, 0xc0, 0x42, 0x27, 0x3c, 0xc0, 0xcb, 0xef, 0xbd,
-  0xea, 0x01, 0x0b, 0xbe, 0xab, 0x23, 0xd4, 0x3c, 0xbd, 0x94, 0x88, 0x3d,
-  0x89, 0xd7, 0xbc, 0xbc, 0x6b, 0x1c, 0xcc, 0xbc, 0x5b, 0x34, 0x6b, 0xbd,
-  0x1d, 0xa1, 0x14, 0xbd, 0xef, 0x7c, 0x4b, 0xbd, 0x0a, 0x6b, 0xe8, 0x3d,
-  0xd2, 0xb2, 0x7f, 0x3d, 0x25, 0x19, 0x91, 0xbd, 0x68, 0x5c, 0xc7, 0x3c,
-  0x6c, 0xb5, 0x5e, 0x3c, 0x7e, 0xa1, 0x2f, 0x3d, 0x99, 0xf2, 0x95, 0xbd,
-  0x56, 0x05, 0xb8, 0xbd, 0x05, 0x49, 0x9d, 0xbd, 0x29, 0xf1, 0xe9, 0xbc,
-  0xdc, 0x04, 0x1d, 0xbc, 0xbd, 0x27, 0x3a, 0x3d, 0x85, 0xcb, 0xa6, 0xbd,
-  0xfe, 0xf3, 0x8f, 0xbd, 0x9e, 0xa7, 0xc2, 0x3c, 0xca, 0xfa, 0x3a, 0xbd,
-  0x1c, 0xbc, 0x56, 0x3d, 0xb2, 0xac, 0x08, 0x3e, 0x57, 0xb2, 0xbb, 0xbd,
-  0xe4, 0xa4, 0xee, 0x3c, 0x3d, 0x3c, 0x33, 0x3d, 0xae, 0x89, 0x8f, 0xbd,
-  0xba, 0x42, 0xb0, 0xbd, 0x88, 0x43, 0x80, 0xbb, 0x81, 0x83, 0x96, 0xbd,
-  0x06, 0x4e, 0x08, 0xbd, 0xea, 0xf4, 0x58, 0xbd, 0xb4, 0x4b, 0x8a, 0x3d,
-  0xff, 0x9e, 0x7d, 0xbe, 0xe9, 0x0a, 0x4a, 0xbe, 0x39, 0x69, 0x22, 0xbd,
-  0xa8, 0x9f, 0x11, 0xbd, 0x1c, 0x39, 0x60, 0x3d, 0xf8, 0x09, 0x5f, 0x3e,
-  0x1c, 0x0e, 0xb0, 0xbc, 0xdf, 0xf1, 0xc5, 0x3d, 0x0b, 0x21, 0x58, 0x3c,
-  0x8f, 0x53, 0x50, 0x3d, 0xc3, 0x89, 0xad, 0xbd, 0xc0, 0x37, 0xac, 0xbd,
-  0xfb, 0xdf, 0x30, 0xbc, 0x4c, 0xd2, 0x83, 0x3d, 0x8f, 0x5b, 0x66, 0xbd,
-  0x89, 0x35, 0xd2, 0x3d, 0xf8, 0x9a, 0x55, 0xbe, 0x88, 0x56, 0x84, 0xbd,
-  0x06, 0xca, 0x9d, 0x3d, 0xcf, 0x08, 0x12, 0x3c, 0x0e, 0x5f, 0xaa, 0xbc,
-  0x43, 0xc3, 0x95, 0x3d, 0xa9, 0xa0, 0x0e, 0x3d, 0xfa, 0xde, 0x8d, 0x3d,
-  0xfa, 0xce, 0x01, 0x3e, 0x2d, 0x5a, 0x1a, 0xbd, 0xfc, 0xa2, 0x2f, 0xbc,
-  0xfe, 0xbc, 0xf0, 0x3c, 0x37, 0x28, 0x1c, 0x3c, 0x2d, 0xbf, 0xc1, 0x3d,
-  0x1f, 0xb5, 0x08, 0x3d, 0x9d, 0xba, 0x2d, 0xbb, 0x29, 0xa4, 0xaa, 0x3c,
-  0x42, 0x63, 0xdb, 0xbd, 0x0b, 0x4a, 0xb1, 0x3d, 0x57, 0x20, 0xa2, 0xbc,
-  0x73, 0x9e, 0x01, 0xbb, 0x90, 0x12, 0x28, 0x3e, 0xc6, 0x96, 0x8d, 0x3d,
-  0x92, 0x8c, 0xe9, 0xbc, 0x63, 0x6b, 0x00, 0x3e, 0xe9, 0x4b, 0x52, 0x3d,
-  0xad, 0x14, 0x9b, 0x3d, 0xa7, 0x14, 0x05, 0xbd, 0xb0, 0x94, 0xda, 0xbd,
-  0x96, 0xa1, 0x47, 0xbb, 0x76, 0x36, 0x85, 0x3d, 0x6a, 0x50, 0x0f, 0x3d,
-  0xfc, 0xc6, 0xe4, 0xbc, 0x6a, 0xba, 0xd1, 0xbd, 0xb2, 0x85, 0xa3, 0xbc,
-  0x69, 0x45, 0xa5, 0xbc, 0x5b, 0xeb, 0x49, 0x3c, 0x6e, 0x06, 0x63, 0x3e,
-  0xd2, 0x60, 0x6e, 0xbd, 0x28, 0x9c, 0x8a, 0xbc, 0xb7, 0x0f, 0x85, 0x3b,
-  0x44, 0x8a, 0x8a, 0x3d, 0xff, 0x87, 0x84, 0xbd, 0xc0, 0x34, 0xf1, 0xbd,
-  0xc7, 0xea, 0x9b, 0xbd, 0xdf, 0x5b, 0x96, 0x3c, 0xda, 0x17, 0x8b, 0xbc,
-  0xda, 0x50, 0xd8, 0x3d, 0x24, 0x85, 0xe6, 0xbd, 0x12, 0xac, 0x94, 0xbd,
-  0xbd, 0x8c, 0x43, 0xbd, 0x79, 0xf2, 0xe4, 0xbd, 0x69, 0x0d, 0x6b, 0x3c,
-  0x87, 0xae, 0x0c, 0x3e, 0x4b, 0x5b, 0x64, 0x3b, 0x23, 0x3d, 0x9d, 0xbc,
-  0xce, 0x0d, 0xd9, 0xbc, 0xf3, 0x75, 0x3f, 0xbc, 0x7c, 0xc1, 0x20, 0x3c,
-  0x17, 0xcf, 0x3c, 0xbd, 0x6b, 0xa1, 0x2a, 0x3c, 0x63, 0xa8, 0x5c, 0x3d,
-  0x1a, 0xdf, 0xaf, 0x3d, 0xc5, 0x25, 0x95, 0x3b, 0xcf, 0x62, 0x71, 0xbe,
-  0x7b, 0x55, 0x83, 0xbd, 0xa6, 0x00, 0x07, 0x3e, 0x95, 0x3f, 0x89, 0x3d,
-  0xc7, 0x0f, 0x7c, 0x3d, 0x99, 0x85, 0x87, 0x3c, 0x67, 0x39, 0xd6, 0xbc,
-  0x3d, 0x90, 0xab, 0x3d, 0x0e, 0xd4, 0x08, 0xbd, 0xba, 0x5a, 0x9e, 0xbd,
-  0xd7, 0x85, 0xd4, 0x3c, 0xfd, 0x81, 0x16, 0xbd, 0xf3, 0xe3, 0x66, 0xbd,
-  0x77, 0xf3, 0xd6, 0x3b, 0xb3, 0x4d, 0x6d, 0x3d, 0x24, 0x67, 0x8a, 0x3d,
-  0x84, 0xfd, 0x39, 0xbe, 0x97, 0xd3, 0x7c, 0xbd, 0xd7, 0x4b, 0x05, 0x3d,
-  0x27, 0xad, 0x0b, 0xbd, 0xb1, 0x22, 0x14, 0x3d, 0xf0, 0xf4, 0xac, 0x3d,
-  0xa7, 0x7c, 0xd5, 0x3c, 0x9f, 0xec, 0x89, 0x3d, 0xab, 0x54, 0x50, 0x3d,
-  0x06, 0x99, 0x8c, 0xbd, 0xb9, 0x22, 0x53, 0xbd, 0x71, 0xdc, 0xa2, 0x3d,
-  0xb1, 0x29, 0x1d, 0x3d, 0xb2, 0xab, 0xa8, 0x3c, 0xc0, 0xf3, 0x76, 0x3d,
-  0xc1, 0x99, 0xff, 0x3c, 0xdf, 0x02, 0x48, 0xbe, 0x86, 0x56, 0x9d, 0xbc,
-  0x98, 0xce, 0xf1, 0x3d, 0x24, 0x73, 0x48, 0xbb, 0x96, 0x74, 0x61, 0x3d,
-  0xeb, 0x61, 0x32, 0x3d, 0x91, 0x09, 0x9a, 0xbd, 0xcf, 0x56, 0xba, 0x3c,
-  0x67, 0x00, 0x18, 0x3e, 0xb8, 0x2c, 0x38, 0x3d, 0xb2, 0x83, 0xf1, 0x3c,
-  0x1c, 0x21, 0x4b, 0xbd, 0x07, 0xe6, 0xa2, 0x3b, 0x37, 0x16, 0x3a, 0x3c,
-  0x65, 0xde, 0x39, 0xbd, 0x13, 0x2c, 0x1f, 0x3d, 0xc5, 0x51, 0x17, 0xbe,
-  0x2c, 0x48, 0xd8, 0xbd, 0xb8, 0xa5, 0xa5, 0x3c, 0x82, 0xba, 0x90, 0xbd,
-  0xa7, 0xb8, 0xd4, 0x3c, 0x7b, 0x9d, 0x21, 0x3e, 0x98, 0x6f, 0x5b, 0xbd,
-  0xbf, 0x23, 0x5d, 0xbc, 0x65, 0x69, 0x9c, 0x3d, 0xe0, 0xfc, 0x5c, 0x3d,
-  0xcc, 0xc6, 0xac, 0x3b, 0x65, 0x87, 0xcf, 0xbc, 0x8a, 0x5b, 0x25, 0xbd,
-  0x74, 0xa3, 0xec, 0x3c, 0x95, 0xd8, 0x00, 0xbd, 0x16, 0x90, 0x9b, 0x3d,
-  0x89, 0xc0, 0x9c, 0xbd, 0x30, 0xbb, 0xd2, 0xbd, 0x11, 0x50, 0x44, 0xbd,
-  0x63, 0x2c, 0x5e, 0xbd, 0xb6, 0xe9, 0x99, 0x3c, 0x9f, 0xbd, 0x1f, 0x3e,
-  0x0e, 0x49, 0x83, 0xbb, 0x69, 0x68, 0x92, 0x3d, 0xba, 0x80, 0x13, 0x3d,
-  0x65, 0x1c, 0xe7, 0x3c, 0xea, 0x76, 0x52, 0x3c, 0xa8, 0xb1, 0x9c, 0xbc,
-  0x09, 0x88, 0x03, 0xbe, 0xf7, 0x32, 0x53, 0xbd, 0x46, 0xf9, 0x1f, 0xbb,
-  0x35, 0xf5, 0x34, 0xbd, 0x64, 0x28, 0xc2, 0x3b, 0x60, 0xf8, 0xe6, 0xbd,
-  0xd2, 0xf1, 0x74, 0x3c, 0xfd, 0xe8, 0x8f, 0xbd, 0x79, 0x92, 0x7d, 0x3d,
-  0xb0, 0x4b, 0x4a, 0x3e, 0x85, 0x11, 0x86, 0xbd, 0xa9, 0x09, 0x12, 0x3b,
-  0xd4, 0x22, 0xe1, 0xbc, 0x11, 0xff, 0x14, 0xbc, 0x01, 0x9a, 0xe2, 0xbc,
-  0x40, 0x0f, 0xfe, 0xbb, 0x1a, 0xcd, 0x34, 0xbe, 0x7d, 0x56, 0x27, 0xbc,
-  0x43, 0x27, 0x35, 0xbd, 0x31, 0xc1, 0x95, 0x3d, 0xf6, 0xaf, 0xac, 0xbd,
-  0x21, 0xbe, 0x03, 0xbe, 0x3e, 0x4e, 0x16, 0x3d, 0xb5, 0xb3, 0x46, 0xbe,
-  0x36, 0xb9, 0x4e, 0xbd, 0xdc, 0xd1, 0x06, 0x3d, 0x4a, 0x8b, 0x51, 0x3d,
-  0x02, 0x6b, 0x19, 0xbd, 0xab, 0xcc, 0x8e, 0x3d, 0xe9, 0xca, 0xf3, 0xbd,
-  0x03, 0x64, 0x02, 0x3b, 0xfe, 0x42, 0x92, 0xbd, 0x36, 0x4b, 0x01, 0xbe,
-  0xf7, 0x70, 0xf5, 0x3c, 0xb5, 0xc5, 0x55, 0xbd, 0x74, 0x71, 0x3c, 0xbd,
-  0xdb, 0xad, 0xc9, 0xbd, 0x18, 0x14, 0x56, 0xbe, 0x2a, 0xd7, 0xf9, 0xbb,
-  0xba, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0x00, 0x00, 0xce, 0xfe, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x87, 0x43, 0x62, 0xbd,
-  0xc2, 0xd9, 0x6a, 0xbd, 0x81, 0xb4, 0x3c, 0xbe, 0x6c, 0x41, 0xcc, 0xbd,
-  0x41, 0xd5, 0xfc, 0xbd, 0x7c, 0xb1, 0x87, 0xbd, 0x89, 0xe3, 0x88, 0xbc,
-  0x34, 0x4d, 0x4f, 0xbe, 0xfa, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x64, 0x4e, 0xbc, 0x3d, 0x44, 0xed, 0x9e, 0xbd,
-  0xae, 0xd9, 0xad, 0xbd, 0x8f, 0xae, 0x38, 0xbd, 0x20, 0x00, 0xbf, 0xbd,
-  0x76, 0xbf, 0x08, 0xbd, 0x69, 0xd7, 0x80, 0xbd, 0x7e, 0x04, 0x3d, 0x3d,
-  0x14, 0x76, 0xfa, 0x3c, 0x45, 0x09, 0xea, 0xbc, 0x2a, 0xb0, 0xd0, 0xbc,
-  0xc7, 0x7f, 0x70, 0xbd, 0xda, 0xe2, 0xf0, 0xbd, 0x76, 0xf6, 0x5b, 0x3e,
-  0xa2, 0xe1, 0x60, 0x3d, 0x67, 0x2d, 0xce, 0xbd, 0x46, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x66, 0x0a, 0x4b, 0x3d,
-  0xed, 0xdd, 0x40, 0x3c, 0x83, 0xd6, 0x6c, 0xbd, 0x64, 0xf5, 0xff, 0xff,
-  0x68, 0xf5, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
-  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x84, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00,
-  0xb8, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x4a, 0xfe, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x82, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3c, 0xf6, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x5a, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd6, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00,
-  0x34, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00,
-  0x60, 0x06, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00,
-  0x70, 0x05, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00,
-  0x78, 0x04, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x70, 0x03, 0x00, 0x00,
-  0x14, 0x03, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00,
-  0xa8, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xba, 0xf8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xac, 0xf8, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
-  0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
-  0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x79,
-  0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c,
-  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
-  0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x5a, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x4c, 0xf9, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74,
-  0x65, 0x6e, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
-  0x9e, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x90, 0xf9, 0xff, 0xff,
-  0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
-  0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f,
-  0x6f, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xf2, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xe4, 0xf9, 0xff, 0xff,
-  0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
-  0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e,
-  0x64, 0x44, 0x69, 0x6d, 0x73, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x4a, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-  0x3c, 0xfa, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
-  0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71,
-  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x31, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x31, 0x44, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b,
-  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x62, 0x69, 0x61,
-  0x73, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x31, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xfe, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0xf0, 0xfa, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
-  0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45,
-  0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x31, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x7d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x56, 0xfb, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x48, 0xfb, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d,
-  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
-  0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xaa, 0xfb, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x9c, 0xfb, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d,
-  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
-  0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x31,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x02, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xf4, 0xfb, 0xff, 0xff,
-  0x76, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
-  0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a,
-  0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x62, 0x69, 0x61,
-  0x73, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x31, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xaa, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x9c, 0xfc, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44,
-  0x69, 0x6d, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0xea, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x34, 0x00, 0x00, 0x00, 0xf8, 0xfc, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d,
-  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
-  0x5f, 0x31, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d,
-  0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x3a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
-  0x48, 0xfd, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
-  0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45,
-  0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x98, 0xfd, 0xff, 0xff,
-  0x23, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
-  0x6e, 0x67, 0x31, 0x64, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44,
-  0x69, 0x6d, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xd6, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
-  0xe4, 0xfd, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
-  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45, 0x78, 0x70,
-  0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x2c, 0xfe, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
-  0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x86, 0xfe, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x78, 0xfe, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0xd2, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc4, 0xfe, 0xff, 0xff,
-  0x18, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x2f, 0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x4d, 0x61,
-  0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x00, 0x00,
-  0x1c, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74,
-  0x65, 0x6e, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00,
-  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
-  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x62, 0x69, 0x61,
-  0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xce, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
-  0x0b, 0x00, 0x00, 0x00, 0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x62,
-  0x69, 0x61, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
-  0x75, 0x6c, 0x74, 0x5f, 0x78, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa5, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xdc, 0xff, 0xff, 0xff,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe8, 0xff, 0xff, 0xff,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf4, 0xff, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
-};
-unsigned int ds_cnn_s_model_len = 18452;
+const unsigned char ds_cnn_s_model[] = {
+  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
+  0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xc8, 0x3c, 0x00, 0x00,
+  0xd8, 0x3c, 0x00, 0x00, 0x80, 0x47, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x12, 0xc3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
+  0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x08, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0xe4, 0x3b, 0x00, 0x00, 0x94, 0x3b, 0x00, 0x00, 0x64, 0x3b, 0x00, 0x00,
+  0x4c, 0x3b, 0x00, 0x00, 0xfc, 0x0b, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbe, 0xc3, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x35, 0x2e,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0xb9, 0xff, 0xff, 0xe4, 0xb9, 0xff, 0xff, 0xe8, 0xb9, 0xff, 0xff,
+  0xec, 0xb9, 0xff, 0xff, 0xf0, 0xb9, 0xff, 0xff, 0xf4, 0xb9, 0xff, 0xff,
+  0xf8, 0xb9, 0xff, 0xff, 0xfc, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff,
+  0x04, 0xba, 0xff, 0xff, 0x08, 0xba, 0xff, 0xff, 0x06, 0xc4, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x22, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x3e, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5a, 0xc4, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x76, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x09, 0xda, 0xce, 0xbd, 0x64, 0x86, 0x92, 0xbe, 0x95, 0xa4, 0x73, 0xbe,
+  0x95, 0xff, 0x40, 0x3e, 0x73, 0x7d, 0x8e, 0xbe, 0x89, 0x26, 0xdd, 0xbe,
+  0xd6, 0x25, 0xd3, 0x3e, 0xef, 0xf7, 0xf8, 0xbd, 0x2a, 0x01, 0x6a, 0x3e,
+  0xb2, 0x0e, 0x56, 0xbe, 0x66, 0x2d, 0xa2, 0xbe, 0xc6, 0x5d, 0xca, 0xbd,
+  0x2d, 0x14, 0x8b, 0xbe, 0xc0, 0x9d, 0xd2, 0xbe, 0x4f, 0x03, 0x0b, 0x3e,
+  0x43, 0x93, 0x0d, 0xbe, 0xac, 0x1a, 0x16, 0x3e, 0xc3, 0x91, 0x07, 0xbe,
+  0x69, 0x5b, 0x8a, 0x3e, 0xce, 0x1f, 0x1b, 0x3e, 0x1c, 0xf6, 0x12, 0xbe,
+  0x03, 0x3e, 0x36, 0x3e, 0x0d, 0x91, 0xae, 0x3e, 0x26, 0x36, 0x53, 0x3c,
+  0x4f, 0x82, 0x40, 0xbe, 0x78, 0xc2, 0x86, 0x3e, 0x34, 0xd1, 0x89, 0xbe,
+  0xbb, 0x55, 0x8b, 0xbe, 0x08, 0x69, 0x7a, 0x3c, 0xa8, 0x1b, 0xc0, 0xbd,
+  0x21, 0xc2, 0x97, 0x3d, 0x34, 0x33, 0x86, 0x3e, 0xc1, 0x70, 0x33, 0xbe,
+  0x94, 0x2c, 0x1f, 0xbe, 0xa8, 0x2f, 0x0a, 0xbe, 0x0f, 0xe5, 0x54, 0x3d,
+  0x1b, 0xb7, 0xd2, 0xbd, 0xd6, 0x28, 0xf8, 0x3d, 0x0b, 0x3c, 0x00, 0xbe,
+  0x49, 0x3e, 0x07, 0x3e, 0xd3, 0x45, 0x72, 0x3e, 0x9f, 0xaa, 0x8a, 0x3e,
+  0x20, 0xd8, 0x0d, 0x3d, 0x12, 0x2e, 0x87, 0x3e, 0x3f, 0xdf, 0x87, 0x3e,
+  0x4d, 0xe2, 0x6d, 0xbd, 0x5f, 0xd5, 0xe9, 0xbd, 0xcb, 0xe0, 0xa8, 0x3d,
+  0x19, 0xda, 0x8e, 0xbe, 0xb7, 0x98, 0x21, 0x3e, 0xec, 0xe9, 0x8e, 0xbe,
+  0xcd, 0x57, 0x81, 0xbe, 0x57, 0x24, 0x91, 0x3d, 0x02, 0x06, 0x70, 0x3e,
+  0x6d, 0x91, 0x33, 0xbe, 0x93, 0xa9, 0x96, 0xbd, 0x84, 0x00, 0xbd, 0x3e,
+  0x12, 0xf8, 0x78, 0xbd, 0x08, 0x6a, 0xee, 0xbd, 0x89, 0x64, 0xba, 0x3e,
+  0xab, 0x63, 0x88, 0x3e, 0xc5, 0xf7, 0x9f, 0x3c, 0x7a, 0x61, 0x28, 0xbe,
+  0x16, 0x8e, 0xc3, 0x3e, 0x48, 0x3d, 0xcc, 0x3c, 0x95, 0x29, 0xcb, 0xbd,
+  0x6c, 0x84, 0xb1, 0xbd, 0x75, 0xd4, 0x09, 0xbe, 0x31, 0xf2, 0xc8, 0x3d,
+  0x20, 0xd3, 0x1d, 0x3e, 0xf8, 0x12, 0x1d, 0x3d, 0x7c, 0xf4, 0x6c, 0x3e,
+  0x8f, 0x72, 0x82, 0xbe, 0x99, 0xa2, 0x87, 0x3d, 0xd1, 0x8c, 0x12, 0xbc,
+  0x06, 0x37, 0xb1, 0xbc, 0xe5, 0x0b, 0xb8, 0xbd, 0xf7, 0x59, 0x47, 0x3e,
+  0x77, 0x22, 0x19, 0xbe, 0x24, 0x6e, 0x04, 0x3e, 0xee, 0x43, 0x2c, 0xbe,
+  0x8e, 0xfa, 0xc4, 0xbd, 0xcb, 0x41, 0xc5, 0xbc, 0x23, 0x70, 0x86, 0x3e,
+  0xda, 0x02, 0x37, 0x3e, 0x71, 0x39, 0x65, 0x3e, 0x59, 0x2c, 0x15, 0x3e,
+  0x18, 0xcf, 0x1d, 0xbe, 0x67, 0xd6, 0xab, 0xbd, 0x1e, 0x4e, 0xa0, 0xbe,
+  0xcc, 0x07, 0xd0, 0x3d, 0x4d, 0x83, 0x12, 0x3c, 0x3f, 0xe7, 0xcc, 0xbd,
+  0x60, 0x82, 0x06, 0x3e, 0xcb, 0x0b, 0x1d, 0x3e, 0x80, 0xef, 0x5a, 0xbe,
+  0x4b, 0xfd, 0x20, 0x3d, 0x82, 0x2f, 0x40, 0xbc, 0x63, 0xc7, 0x01, 0x3e,
+  0xb7, 0x77, 0x27, 0xbd, 0xd4, 0x06, 0xfc, 0x3d, 0x85, 0xb7, 0x28, 0xbe,
+  0x6b, 0x87, 0x27, 0xbe, 0x47, 0xa6, 0x39, 0x3e, 0xad, 0x49, 0x9f, 0xbe,
+  0x9b, 0x89, 0xd9, 0xbd, 0xf7, 0xd8, 0x82, 0xbd, 0xdd, 0x79, 0x95, 0xbd,
+  0x96, 0x85, 0xae, 0xbd, 0x84, 0xba, 0x4e, 0xbe, 0xd8, 0x92, 0xeb, 0x3c,
+  0xb2, 0xf0, 0x97, 0x3e, 0xf3, 0x7d, 0x91, 0x3e, 0xc6, 0xb4, 0x9b, 0xbe,
+  0xd2, 0x10, 0xf4, 0x3d, 0x3a, 0xd3, 0x87, 0x3e, 0x2c, 0x86, 0x0e, 0xbe,
+  0xe8, 0x1c, 0x83, 0x3e, 0x1d, 0xfb, 0x54, 0xbe, 0xa2, 0x04, 0x75, 0x3e,
+  0x3a, 0x4c, 0x0d, 0x3e, 0xc7, 0x99, 0x32, 0xbe, 0xb0, 0x42, 0x6a, 0xbe,
+  0xc3, 0xe0, 0x44, 0x3d, 0x79, 0x74, 0xc7, 0x3e, 0xa1, 0xa5, 0xa1, 0x3e,
+  0xc1, 0xa4, 0x5d, 0xbd, 0x5f, 0xe9, 0xa5, 0x3e, 0xff, 0xe8, 0x5f, 0xbe,
+  0x18, 0x48, 0x4b, 0xbe, 0x74, 0x4e, 0x50, 0xbe, 0xe4, 0x07, 0xc4, 0x3d,
+  0xda, 0x7f, 0x78, 0x3e, 0x26, 0x78, 0xa5, 0x3e, 0x26, 0xc8, 0x12, 0xbe,
+  0x5e, 0xdf, 0x61, 0xbd, 0xe4, 0x64, 0x03, 0xbd, 0xc7, 0x4f, 0xe2, 0x3c,
+  0x81, 0x69, 0x36, 0xba, 0x12, 0x32, 0xb3, 0xbd, 0xc8, 0xcd, 0xcc, 0x3e,
+  0x79, 0xe6, 0x74, 0xbd, 0x70, 0x80, 0x35, 0xbe, 0x6a, 0x5b, 0x1b, 0x3e,
+  0x99, 0x97, 0x42, 0x3e, 0xf6, 0x1e, 0x11, 0xbc, 0x79, 0x85, 0xd5, 0x3d,
+  0x33, 0x74, 0x83, 0x3e, 0x69, 0x57, 0xfc, 0x3d, 0xd4, 0x00, 0xbc, 0x3d,
+  0x67, 0xb5, 0x4b, 0xbe, 0x83, 0xca, 0x3d, 0x3e, 0x33, 0x46, 0x5c, 0x3d,
+  0x9e, 0x60, 0xa6, 0xbd, 0x54, 0x33, 0x90, 0x3d, 0x7e, 0x1f, 0x65, 0xbe,
+  0x95, 0xcf, 0x30, 0x3c, 0x24, 0xac, 0x87, 0x3e, 0xa6, 0xc5, 0x05, 0xbe,
+  0x2a, 0xb7, 0x63, 0xbe, 0xdc, 0x10, 0xf6, 0xbd, 0x29, 0x42, 0xdb, 0x3d,
+  0x39, 0x1e, 0x05, 0xbe, 0x20, 0xff, 0x18, 0xbd, 0xa1, 0x80, 0x8a, 0x3e,
+  0xe6, 0x3a, 0x67, 0xbe, 0xb2, 0x3a, 0xc9, 0xbd, 0x19, 0x6c, 0x0e, 0xbd,
+  0x7c, 0xbb, 0x69, 0xbe, 0x3d, 0x66, 0x76, 0xbe, 0x95, 0x1b, 0x52, 0x3e,
+  0xb2, 0xca, 0xad, 0x3b, 0xa6, 0x03, 0x6d, 0xbb, 0xdc, 0x70, 0x77, 0x3e,
+  0x10, 0x77, 0x25, 0x3e, 0x42, 0xe9, 0x46, 0x3c, 0x52, 0xfe, 0x2b, 0xbd,
+  0x0d, 0x60, 0xb4, 0xbe, 0xbc, 0xe9, 0x38, 0xbe, 0xe8, 0x86, 0x95, 0x3d,
+  0x27, 0xfa, 0xba, 0x3e, 0x40, 0x15, 0xfe, 0x3d, 0xf6, 0xc3, 0x40, 0x3e,
+  0x6a, 0x59, 0xb6, 0xbe, 0x5d, 0x50, 0xb9, 0xbe, 0x36, 0xef, 0xac, 0xbe,
+  0xc2, 0x7d, 0x3d, 0xbe, 0x29, 0xbf, 0x6c, 0x3c, 0xa1, 0x2d, 0x89, 0x3e,
+  0xdc, 0x75, 0x82, 0x3d, 0x62, 0x43, 0x05, 0xbe, 0xc8, 0xf0, 0xfd, 0x3d,
+  0x96, 0x09, 0x35, 0xbe, 0xcb, 0xde, 0x55, 0xbe, 0x52, 0x52, 0xa0, 0x3e,
+  0x1e, 0xca, 0x0d, 0xbe, 0xe6, 0xf6, 0x28, 0xbe, 0x41, 0x9d, 0xec, 0xbd,
+  0x30, 0xe4, 0x41, 0x3d, 0x36, 0xdd, 0x32, 0x3e, 0x3f, 0x4d, 0xac, 0xbd,
+  0x81, 0xae, 0x07, 0xbe, 0x33, 0xa3, 0x4e, 0xbe, 0x49, 0x0b, 0x24, 0x3e,
+  0xc7, 0x88, 0xb1, 0x3d, 0x3f, 0x6c, 0x57, 0xbd, 0x54, 0x39, 0x93, 0x3e,
+  0xc4, 0xdf, 0x1c, 0x3e, 0x99, 0xb0, 0xab, 0xbc, 0xaa, 0x0d, 0xaf, 0xbe,
+  0x2b, 0x31, 0x07, 0x3e, 0x49, 0xb7, 0x8f, 0xbe, 0x81, 0x67, 0xfe, 0xbd,
+  0xf1, 0x75, 0x90, 0xbe, 0x18, 0xc9, 0xb2, 0x3e, 0xb2, 0x57, 0x67, 0x3d,
+  0x34, 0x46, 0x82, 0xbe, 0xf1, 0x94, 0x26, 0xbe, 0xa4, 0x34, 0x30, 0x3e,
+  0xff, 0x4d, 0xb4, 0xbd, 0xf9, 0xbb, 0x0d, 0x3e, 0xa5, 0xfc, 0x24, 0x3e,
+  0x96, 0x32, 0xb9, 0xbe, 0xe1, 0x3c, 0x45, 0xbe, 0xd4, 0x18, 0x1b, 0xbe,
+  0xcb, 0x00, 0x8d, 0x3e, 0x86, 0x9d, 0xc8, 0x3e, 0x6c, 0x6a, 0x84, 0xbe,
+  0xd1, 0xdb, 0x71, 0x3d, 0x68, 0xbe, 0x71, 0x3d, 0x8f, 0x67, 0x81, 0x3d,
+  0xa8, 0x53, 0x7b, 0xbe, 0x39, 0x3e, 0x83, 0xbe, 0x3e, 0xf0, 0x6d, 0x3d,
+  0x4e, 0x7c, 0x9e, 0x3e, 0xea, 0xe8, 0x64, 0x3c, 0x82, 0x39, 0xcc, 0xbc,
+  0x73, 0x0d, 0x29, 0xbd, 0x38, 0x1f, 0xe5, 0xbb, 0xab, 0x34, 0xd0, 0xbd,
+  0x90, 0x5b, 0xd3, 0x3c, 0x40, 0x94, 0x2e, 0xbc, 0x55, 0x5c, 0x86, 0x3d,
+  0x89, 0xb1, 0x86, 0xbd, 0xf8, 0xe1, 0x27, 0xbe, 0xd5, 0xc3, 0xa8, 0xbe,
+  0xd6, 0x8a, 0x52, 0xbd, 0x5d, 0x0c, 0x9d, 0x3c, 0x9f, 0xe8, 0xff, 0x3e,
+  0xe8, 0x28, 0xc2, 0xbc, 0xf5, 0x1e, 0x53, 0x3c, 0x8e, 0xb7, 0xdb, 0x3d,
+  0x6f, 0x28, 0x83, 0x3d, 0xa9, 0xe4, 0x0e, 0xbd, 0x80, 0xa1, 0xac, 0x3e,
+  0x9a, 0xa1, 0x4c, 0xbe, 0xa5, 0x19, 0x4b, 0x3d, 0xe2, 0x42, 0x09, 0xbe,
+  0x90, 0xcd, 0x02, 0xbe, 0xd9, 0x1e, 0x8a, 0xbe, 0xf3, 0x19, 0x5a, 0xbe,
+  0x08, 0x99, 0x31, 0xbe, 0xb0, 0xa6, 0xc1, 0x3e, 0x5a, 0x91, 0x7c, 0xbd,
+  0x34, 0x57, 0xb8, 0x3d, 0xde, 0xc5, 0x43, 0xbe, 0x84, 0xc9, 0x88, 0xbd,
+  0x3f, 0x4f, 0xa6, 0x3d, 0xd0, 0xa1, 0x16, 0xbe, 0x01, 0x48, 0x23, 0xbe,
+  0x02, 0x5c, 0x31, 0x3e, 0xae, 0x62, 0x1a, 0x3c, 0xb5, 0x36, 0xc0, 0xbd,
+  0x71, 0x3b, 0x31, 0x3e, 0x8e, 0x49, 0x2e, 0x3e, 0x89, 0x4f, 0xfa, 0xbd,
+  0xdf, 0x7e, 0x6a, 0xbe, 0x8c, 0xfb, 0xde, 0xbb, 0xba, 0xae, 0x98, 0x3d,
+  0x09, 0x18, 0x91, 0x3e, 0xa9, 0x0f, 0x2d, 0x3e, 0x96, 0x38, 0x8c, 0x3b,
+  0x68, 0xf8, 0x7d, 0xbe, 0xe0, 0xfc, 0x79, 0x3e, 0x94, 0x01, 0x29, 0x3e,
+  0x1e, 0x2d, 0x82, 0xbe, 0x35, 0x70, 0x5d, 0x3e, 0xd3, 0xf4, 0x71, 0x3d,
+  0x70, 0xf1, 0x58, 0x3e, 0x4e, 0x83, 0x8d, 0x3a, 0x16, 0x86, 0x99, 0xbe,
+  0x31, 0xe7, 0xba, 0xbd, 0xc3, 0x39, 0x98, 0x3d, 0x41, 0x10, 0x80, 0x3e,
+  0x6e, 0xef, 0x38, 0xbc, 0x3f, 0x9c, 0x37, 0xbe, 0x08, 0xad, 0x65, 0xbd,
+  0x5f, 0x40, 0xa7, 0xbd, 0x1e, 0x70, 0x2a, 0x3e, 0x13, 0xbf, 0xd1, 0xbc,
+  0x0d, 0x39, 0x2f, 0x3e, 0xe7, 0x2a, 0x8b, 0xbe, 0x17, 0xe7, 0xce, 0x3c,
+  0xee, 0xb2, 0x55, 0x3e, 0x32, 0xbd, 0x91, 0x3d, 0x00, 0x89, 0xd0, 0x3d,
+  0x88, 0xbe, 0x5f, 0xbe, 0x12, 0xa4, 0x36, 0xbe, 0x6a, 0x02, 0xcc, 0xbd,
+  0x8c, 0x13, 0x38, 0x3e, 0xf5, 0x98, 0xcd, 0xbd, 0xb5, 0x66, 0x7b, 0x3e,
+  0xa6, 0x77, 0x8b, 0xbe, 0xb0, 0x18, 0xa8, 0xbc, 0x9d, 0x04, 0x46, 0xbe,
+  0x32, 0x36, 0xb0, 0x3e, 0x10, 0xbb, 0x43, 0xbc, 0xba, 0xa9, 0xf6, 0xbd,
+  0x75, 0xb5, 0x3d, 0xbd, 0x53, 0x20, 0xdb, 0xbe, 0x2e, 0xd1, 0xad, 0xbe,
+  0x39, 0x35, 0x69, 0xbe, 0x42, 0xfa, 0x3a, 0x3d, 0x03, 0x4b, 0xb4, 0x3c,
+  0x09, 0xeb, 0xe5, 0x3e, 0xc9, 0x1d, 0xdc, 0x3d, 0x9b, 0xd1, 0x23, 0xbe,
+  0x62, 0x0a, 0x6c, 0xbe, 0x4e, 0x0d, 0xa9, 0xbe, 0xdf, 0xc3, 0x8a, 0xbe,
+  0x41, 0xfa, 0x81, 0xbd, 0x32, 0x57, 0x63, 0x3e, 0x75, 0xca, 0x8e, 0x3e,
+  0x6e, 0x9d, 0xff, 0x3d, 0x63, 0xda, 0x95, 0x3d, 0x30, 0x91, 0x29, 0xbe,
+  0xc1, 0xd4, 0xf0, 0xbd, 0xe4, 0x62, 0x8a, 0x3e, 0xd7, 0x74, 0xae, 0x3e,
+  0x6f, 0x04, 0x96, 0x3d, 0x8f, 0x83, 0x8e, 0xbe, 0xb2, 0xd4, 0x95, 0x3e,
+  0xa8, 0xf3, 0xd8, 0xbe, 0xc7, 0xe6, 0xd1, 0xbe, 0x4b, 0x91, 0xa9, 0xbd,
+  0x50, 0x92, 0x99, 0x3e, 0xe7, 0x39, 0xbd, 0x3c, 0xef, 0x10, 0x9c, 0xbc,
+  0xd9, 0xbc, 0xc1, 0x3d, 0x69, 0x0f, 0xb1, 0x3d, 0x14, 0x62, 0x71, 0xbe,
+  0xdd, 0x31, 0xaf, 0xbe, 0xc1, 0x1b, 0x22, 0xbe, 0x16, 0x19, 0xbe, 0x3e,
+  0xce, 0xa6, 0xa0, 0x3e, 0xca, 0x80, 0x2d, 0xbe, 0x7f, 0x88, 0x97, 0xbd,
+  0x50, 0x55, 0x29, 0x3e, 0xa6, 0x9a, 0x1f, 0xbe, 0x12, 0xe3, 0x8b, 0xbe,
+  0x46, 0x0e, 0xb5, 0x3e, 0x71, 0x01, 0x46, 0x3d, 0x6f, 0x24, 0x02, 0xbe,
+  0xc2, 0x65, 0x44, 0x3e, 0x63, 0x0e, 0x3d, 0xbe, 0x1e, 0x6d, 0x98, 0xbe,
+  0x69, 0xac, 0xeb, 0xbd, 0x82, 0xd1, 0x19, 0x3d, 0x8d, 0x8a, 0x18, 0xbd,
+  0xb1, 0x27, 0x48, 0x3d, 0x91, 0x0f, 0x80, 0xbd, 0x65, 0x85, 0x8d, 0xbe,
+  0xeb, 0xda, 0x90, 0x3d, 0x30, 0x76, 0xf8, 0x3d, 0xc1, 0x94, 0xe4, 0x3e,
+  0x4d, 0xe8, 0xcf, 0x3d, 0x7a, 0x21, 0x8a, 0x3e, 0x99, 0xc4, 0x5c, 0xbe,
+  0x58, 0x89, 0xc1, 0x3d, 0x84, 0x04, 0x6b, 0xbe, 0xcc, 0x9c, 0x0e, 0xbe,
+  0xb2, 0xb5, 0x10, 0x3e, 0x77, 0x3c, 0x97, 0xbd, 0x24, 0xf5, 0x7b, 0x3e,
+  0x82, 0xca, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00,
+  0x0f, 0xe0, 0xf2, 0xbe, 0x43, 0x4c, 0x87, 0x3e, 0x02, 0xda, 0xa3, 0xbe,
+  0x04, 0x52, 0xc6, 0x3d, 0xb7, 0xb7, 0x5f, 0x3e, 0xc1, 0x52, 0x79, 0xbe,
+  0xb5, 0x64, 0xeb, 0x3d, 0xd5, 0x35, 0xab, 0x3e, 0x20, 0x46, 0x76, 0x3c,
+  0x9b, 0x3a, 0xb9, 0xbe, 0x0e, 0x5b, 0xb9, 0xbd, 0x83, 0x60, 0x28, 0xbd,
+  0x1f, 0x5a, 0x78, 0xbc, 0xda, 0xfe, 0xfc, 0x3e, 0x41, 0x77, 0x11, 0xbe,
+  0xbc, 0x48, 0xa7, 0xbe, 0xc1, 0xa1, 0x6f, 0x3b, 0x17, 0xe7, 0xc9, 0xbd,
+  0xdc, 0x31, 0x06, 0x3c, 0x1b, 0x8b, 0x8a, 0xbd, 0x37, 0xc3, 0x82, 0xbe,
+  0x63, 0x3a, 0xee, 0x3b, 0x90, 0xc3, 0xd8, 0xbc, 0x98, 0x75, 0xb2, 0x3e,
+  0x77, 0x44, 0xb2, 0x3e, 0xf3, 0x93, 0x86, 0x3e, 0x59, 0x77, 0xc3, 0xbe,
+  0x1d, 0x14, 0x59, 0xbe, 0x1e, 0xd8, 0xb1, 0x3e, 0xc5, 0x90, 0x53, 0xbe,
+  0xed, 0x71, 0xf8, 0xbd, 0x0c, 0x7c, 0xa4, 0x3d, 0xa4, 0xc1, 0x61, 0x3b,
+  0x92, 0x26, 0xb1, 0xbd, 0xc7, 0xba, 0x1d, 0x3e, 0x3d, 0x3a, 0x47, 0x3e,
+  0x97, 0x1f, 0xcd, 0xbe, 0xbe, 0xb5, 0xaf, 0xbe, 0x39, 0x57, 0x0c, 0xbe,
+  0xee, 0xc4, 0xc1, 0x3d, 0x33, 0xc3, 0xe3, 0xbd, 0x7e, 0x2c, 0x98, 0xbe,
+  0xc4, 0x78, 0x0f, 0xbe, 0x09, 0x7c, 0xdb, 0x3d, 0x05, 0xec, 0x81, 0xbd,
+  0x1b, 0xd3, 0x8b, 0x3d, 0x7f, 0x9b, 0xc4, 0xbe, 0x9f, 0x01, 0xa9, 0x3d,
+  0xcc, 0xa3, 0x5e, 0x3e, 0x70, 0x7f, 0x44, 0x3e, 0x1b, 0xb2, 0x8f, 0xbe,
+  0xc9, 0xf3, 0xdd, 0x3e, 0x90, 0x34, 0x70, 0x3e, 0xd4, 0x27, 0x71, 0xbd,
+  0xee, 0x60, 0x9b, 0x3d, 0x25, 0x0f, 0x5c, 0x3d, 0x56, 0xa0, 0xd6, 0x3d,
+  0xd4, 0x5d, 0xd1, 0x3c, 0xcc, 0x63, 0x0e, 0xbd, 0xa7, 0xf3, 0xa7, 0xbe,
+  0x82, 0x1d, 0xb4, 0x3e, 0x86, 0xf8, 0x0b, 0xbe, 0x41, 0x7a, 0x29, 0xbe,
+  0xc3, 0x5a, 0x88, 0x3d, 0x4b, 0x8e, 0x3b, 0x3e, 0xb7, 0x11, 0x25, 0x3d,
+  0x9b, 0x2b, 0x8f, 0x38, 0x1a, 0xfa, 0xaa, 0xbe, 0x0b, 0xcb, 0xa1, 0x3e,
+  0xf6, 0xd1, 0x32, 0x3d, 0xc3, 0xe3, 0x28, 0xbe, 0x92, 0x9e, 0x88, 0x3d,
+  0x3a, 0x2f, 0x78, 0xbe, 0xd2, 0x3f, 0x9b, 0x3c, 0x77, 0xb0, 0x18, 0xbe,
+  0x00, 0x1b, 0xbb, 0x3d, 0x28, 0xb2, 0x9f, 0xbd, 0x4c, 0x9a, 0x84, 0x3e,
+  0xa0, 0x24, 0x99, 0x3e, 0x79, 0x0a, 0x15, 0xbe, 0xa0, 0xfe, 0x90, 0xbe,
+  0xfe, 0x81, 0xb0, 0x3e, 0x60, 0xcb, 0x38, 0xbe, 0x85, 0xb8, 0xe8, 0xbd,
+  0x77, 0x18, 0x34, 0xbe, 0x5a, 0x89, 0x90, 0x3d, 0x57, 0x8e, 0x11, 0xbd,
+  0x47, 0xbb, 0xce, 0xbd, 0x76, 0xb8, 0x6b, 0x3c, 0x94, 0x3a, 0x16, 0x3e,
+  0x1f, 0x50, 0x25, 0x3e, 0x05, 0x73, 0xc3, 0x3e, 0xb1, 0x21, 0x03, 0xbe,
+  0xef, 0x6b, 0xf2, 0xbe, 0x22, 0x69, 0x28, 0x3e, 0x6c, 0xcd, 0x15, 0xbd,
+  0x48, 0x0d, 0xa4, 0xbc, 0x55, 0xf2, 0x94, 0x3d, 0x27, 0x9a, 0x21, 0xbe,
+  0xd3, 0x15, 0xaa, 0x3d, 0x7e, 0xb4, 0xb2, 0xbc, 0x6b, 0xde, 0x83, 0x3d,
+  0xb8, 0x2e, 0xa9, 0xbd, 0xf0, 0xac, 0xfb, 0x3d, 0x17, 0x06, 0x88, 0x3e,
+  0x6c, 0xb3, 0x8b, 0xbe, 0x08, 0x59, 0xb9, 0xbe, 0x1a, 0x5f, 0x6e, 0x3d,
+  0x72, 0xff, 0x2f, 0xbe, 0x7a, 0x6a, 0xe2, 0x3c, 0x26, 0xef, 0x7f, 0x3c,
+  0xb6, 0xee, 0x80, 0xbe, 0x89, 0x0e, 0xc9, 0xbd, 0x6d, 0x0d, 0x8f, 0x3d,
+  0x51, 0x72, 0xaa, 0xbd, 0x88, 0x19, 0xae, 0xbd, 0x35, 0x63, 0x04, 0x3e,
+  0xbd, 0xf5, 0xcd, 0xbe, 0x38, 0x57, 0xad, 0x3e, 0x87, 0x1c, 0x5f, 0xbc,
+  0x62, 0x05, 0x84, 0x3e, 0xd7, 0x40, 0xef, 0x3d, 0xbb, 0x66, 0x5a, 0xbe,
+  0xa3, 0xa3, 0xb4, 0xbc, 0xbf, 0x33, 0x4c, 0x3e, 0xd2, 0xea, 0x13, 0xbe,
+  0x96, 0x71, 0x55, 0xbb, 0x68, 0x7b, 0x1e, 0x3d, 0x2c, 0x5b, 0xa3, 0x3d,
+  0x26, 0x16, 0xaa, 0x3b, 0x9e, 0xfe, 0x70, 0x3e, 0x54, 0x2f, 0xb0, 0x3e,
+  0x53, 0x27, 0xf6, 0xbd, 0xa5, 0x00, 0x87, 0x3d, 0xec, 0x65, 0x0f, 0xbe,
+  0xd1, 0x95, 0x38, 0xbe, 0xf4, 0xb2, 0xa7, 0xbe, 0x8a, 0x99, 0x95, 0x3d,
+  0xcc, 0xd8, 0x8f, 0x3d, 0x5e, 0xd8, 0x18, 0x3e, 0xb7, 0xaf, 0x57, 0xbe,
+  0x69, 0xd4, 0x7f, 0x3e, 0x4c, 0x8a, 0xb3, 0xbd, 0x78, 0x1a, 0x46, 0xbe,
+  0xf5, 0x80, 0x29, 0xbe, 0x29, 0x4b, 0x06, 0xbc, 0x4c, 0x89, 0x65, 0x3e,
+  0xfa, 0xf7, 0xe9, 0xbd, 0xd2, 0x6f, 0xbb, 0x3d, 0xab, 0x2b, 0x9c, 0xbd,
+  0xff, 0xe5, 0x50, 0xbd, 0x72, 0x9d, 0x22, 0xbe, 0x52, 0x3c, 0xf5, 0x3d,
+  0x39, 0x33, 0xbe, 0xbd, 0xa9, 0xd0, 0x9a, 0x3e, 0x62, 0xbc, 0x9d, 0xbd,
+  0xf5, 0x29, 0x23, 0xbe, 0x6e, 0x57, 0x17, 0x3e, 0x09, 0x29, 0x02, 0xbe,
+  0x46, 0xb0, 0x45, 0x3e, 0xcb, 0x07, 0x57, 0x3b, 0x95, 0x46, 0x91, 0x3c,
+  0x41, 0x9c, 0x44, 0xbe, 0xd1, 0x69, 0xd6, 0x3d, 0xc7, 0x87, 0xc4, 0xbe,
+  0xf4, 0xb4, 0x06, 0x3e, 0x65, 0x67, 0xf3, 0xbd, 0x49, 0xb0, 0x1a, 0x3e,
+  0x43, 0x96, 0xa9, 0xbd, 0x60, 0x66, 0x4e, 0xbc, 0xc9, 0xe0, 0xb1, 0xbc,
+  0x78, 0xfe, 0x40, 0xbe, 0x18, 0xd6, 0x90, 0x3e, 0xd1, 0x4a, 0xc7, 0xbe,
+  0x17, 0xb2, 0xbd, 0x3e, 0xd0, 0x61, 0x0b, 0xbf, 0x81, 0xef, 0xca, 0x3e,
+  0x05, 0xf2, 0xd1, 0xbe, 0x03, 0x2a, 0xb9, 0x3e, 0x24, 0x61, 0xd6, 0xbe,
+  0x19, 0xa1, 0x82, 0x3e, 0xb6, 0x29, 0x1f, 0xbe, 0xa8, 0xec, 0x39, 0xbe,
+  0xd3, 0x14, 0x8a, 0xbe, 0xe8, 0x07, 0xb9, 0x3e, 0xa6, 0xfe, 0x90, 0xbe,
+  0x63, 0xe0, 0xcd, 0x3d, 0x8f, 0xb7, 0x69, 0xbe, 0xd2, 0x2c, 0xac, 0x3e,
+  0x4e, 0x3e, 0x44, 0xbe, 0x91, 0x94, 0x96, 0xbd, 0x23, 0x10, 0xb1, 0xbe,
+  0xfe, 0xb7, 0x90, 0x3e, 0xd0, 0x00, 0x33, 0xbb, 0xc6, 0xd9, 0xfc, 0xbd,
+  0x0c, 0xd6, 0xa9, 0x3e, 0xb1, 0x90, 0x7d, 0xbd, 0xba, 0x3b, 0x5f, 0x3d,
+  0xf5, 0x30, 0x56, 0xbe, 0xf0, 0x2f, 0xd2, 0x3d, 0xe9, 0x33, 0x5a, 0xbe,
+  0x44, 0x48, 0x86, 0x3e, 0xa8, 0x3a, 0x46, 0xbe, 0x5d, 0xac, 0x6d, 0x3e,
+  0xe9, 0x03, 0x1c, 0xbe, 0xbb, 0xb7, 0x95, 0x3d, 0xd7, 0x12, 0x22, 0xbe,
+  0xa7, 0x35, 0x42, 0x3e, 0x55, 0xef, 0x81, 0x3d, 0x36, 0xd5, 0x24, 0x3d,
+  0xda, 0x4c, 0x78, 0xbd, 0x58, 0x29, 0x1b, 0x3e, 0xf5, 0x9e, 0x8a, 0x3d,
+  0x0b, 0x16, 0xcf, 0xbd, 0x6a, 0x2c, 0x41, 0x3e, 0xac, 0xf0, 0xe0, 0x3d,
+  0x2d, 0x9d, 0x81, 0x3d, 0xdf, 0x21, 0x2b, 0x3e, 0x57, 0x37, 0x87, 0xbd,
+  0x67, 0x99, 0x9f, 0xbd, 0x7d, 0x82, 0x1e, 0xbd, 0x42, 0xe1, 0xbf, 0x3e,
+  0xa3, 0x88, 0x63, 0xbd, 0x7c, 0xcc, 0xef, 0xbd, 0xf1, 0xd0, 0x88, 0x3d,
+  0xc6, 0x90, 0x86, 0x3b, 0x9a, 0x6f, 0x50, 0x3e, 0x05, 0x04, 0x91, 0xbe,
+  0x91, 0x53, 0x21, 0x3e, 0x62, 0xff, 0x81, 0xbe, 0xf2, 0xf5, 0xa4, 0x3e,
+  0xaf, 0x4e, 0x02, 0xbe, 0x2d, 0x21, 0x45, 0x3c, 0xe3, 0xb2, 0xd4, 0xbd,
+  0x83, 0xa0, 0x9d, 0xbe, 0x06, 0x7f, 0xb4, 0xbe, 0x16, 0x25, 0xee, 0x3c,
+  0x42, 0x54, 0x97, 0xbe, 0x21, 0x01, 0x5b, 0x3e, 0x10, 0x6c, 0x60, 0xbd,
+  0xcb, 0x08, 0x8f, 0x3e, 0x54, 0xd7, 0x71, 0x3d, 0x77, 0x71, 0x30, 0xbe,
+  0x17, 0xff, 0xc2, 0x3e, 0xdc, 0xf5, 0x12, 0xbe, 0x2e, 0xb5, 0x2c, 0x3e,
+  0x2c, 0x6c, 0x54, 0xbc, 0x25, 0x0a, 0x91, 0xbd, 0x12, 0x9a, 0x30, 0x3e,
+  0x25, 0x3c, 0x9c, 0x3d, 0x9b, 0x14, 0xcf, 0x3e, 0x02, 0x9f, 0x54, 0xbe,
+  0x34, 0x04, 0x19, 0xbd, 0xba, 0x6f, 0x1a, 0xbe, 0x11, 0x19, 0xaf, 0xbe,
+  0x00, 0xeb, 0x78, 0x3e, 0x38, 0x50, 0x8b, 0xbd, 0x4e, 0x74, 0x43, 0x3e,
+  0xf5, 0x72, 0xc0, 0xbe, 0x5f, 0x57, 0xa7, 0xbe, 0x85, 0xab, 0x7f, 0xbe,
+  0x88, 0xb3, 0x82, 0xbe, 0x5b, 0xe0, 0xd8, 0x3e, 0xec, 0x46, 0xb5, 0xbd,
+  0xc4, 0x6a, 0xa3, 0xbe, 0x3c, 0xa8, 0x82, 0xbe, 0x59, 0x8d, 0x6c, 0xbd,
+  0xd3, 0xfa, 0x48, 0x3e, 0x84, 0xb2, 0xdc, 0x3d, 0xd0, 0x8a, 0x92, 0x3e,
+  0xe6, 0xd1, 0xa3, 0x3c, 0xfe, 0xfd, 0xc3, 0xbe, 0x5e, 0x8a, 0x8d, 0xbe,
+  0x73, 0xa8, 0xf8, 0xbc, 0xe1, 0xa7, 0x89, 0x3c, 0x69, 0x63, 0xe5, 0x3c,
+  0x39, 0x10, 0x43, 0x3e, 0x82, 0x5b, 0x29, 0x3e, 0x19, 0xb7, 0x88, 0xbd,
+  0xa9, 0x2f, 0x54, 0x3e, 0x3a, 0x9d, 0x95, 0x3d, 0x5d, 0x2f, 0xfb, 0x3d,
+  0xb3, 0x10, 0x1a, 0x3e, 0x18, 0x1d, 0xa2, 0xbe, 0x5e, 0xf4, 0x26, 0x3d,
+  0x46, 0x7a, 0x30, 0x3d, 0x1f, 0x29, 0x2b, 0x3f, 0xf1, 0x13, 0xec, 0xbd,
+  0x6b, 0x68, 0x93, 0x3e, 0x2b, 0xeb, 0x83, 0xbe, 0xa2, 0xca, 0x20, 0x3e,
+  0x7f, 0x96, 0x87, 0x3e, 0x7b, 0x26, 0x9f, 0xbe, 0xe3, 0xff, 0x55, 0x3e,
+  0x18, 0x8d, 0x2e, 0x3d, 0x2f, 0x75, 0x7f, 0x3e, 0x85, 0xd3, 0x4a, 0x3e,
+  0x26, 0xfd, 0x24, 0x3e, 0x8b, 0x58, 0xa2, 0xbc, 0xd1, 0xea, 0x74, 0xbe,
+  0x0a, 0xc5, 0x18, 0xbe, 0x49, 0xc1, 0xb5, 0x3e, 0xe0, 0x8c, 0x8d, 0x3e,
+  0x14, 0xc6, 0xbc, 0xbd, 0xc1, 0x77, 0xbc, 0x3c, 0x38, 0x58, 0x95, 0x3e,
+  0x21, 0x3b, 0x27, 0xbe, 0x59, 0x50, 0x64, 0x3d, 0xe6, 0xc4, 0xfc, 0xbd,
+  0xbe, 0x3c, 0x47, 0x3e, 0xc1, 0x80, 0x8e, 0xbd, 0x2b, 0xf6, 0xde, 0x3d,
+  0x6e, 0xcf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x2f, 0x00, 0x00,
+  0x88, 0x82, 0xbd, 0xbc, 0x8e, 0xd6, 0xfa, 0xbd, 0xcb, 0xe1, 0x7c, 0xbd,
+  0x45, 0x10, 0xa1, 0x3d, 0x42, 0xa6, 0x84, 0xbc, 0x5b, 0xe3, 0x64, 0xbd,
+  0xd3, 0x2f, 0x87, 0xbc, 0xdb, 0xf0, 0xe7, 0x3d, 0x3b, 0x4c, 0x5a, 0xbd,
+  0xf9, 0xed, 0x90, 0x3d, 0x1a, 0xd6, 0xc0, 0x3c, 0x4f, 0xb1, 0x2b, 0x3d,
+  0xa9, 0x70, 0x8d, 0x3d, 0xf6, 0x7e, 0x82, 0x3e, 0xac, 0x74, 0x95, 0x3d,
+  0x8a, 0x40, 0x97, 0xbc, 0xed, 0xad, 0x07, 0xbd, 0x65, 0x1e, 0x6f, 0x3c,
+  0xa7, 0x71, 0x21, 0xbe, 0x78, 0x11, 0x5c, 0x3b, 0x35, 0x4d, 0x9b, 0xbc,
+  0x8a, 0x28, 0x8c, 0x3d, 0xf9, 0xaa, 0x84, 0x3d, 0x95, 0xdb, 0x19, 0x3e,
+  0x8b, 0x5d, 0x81, 0x3d, 0xf5, 0xdd, 0x0b, 0xbb, 0xe2, 0x52, 0xd3, 0x3b,
+  0xfd, 0x55, 0x83, 0xbc, 0x4c, 0xbc, 0x86, 0xbd, 0x67, 0x03, 0x90, 0x3e,
+  0x1b, 0x8a, 0x30, 0xbb, 0x66, 0x23, 0x43, 0xbd, 0xa8, 0xdf, 0x33, 0x3c,
+  0xb9, 0x61, 0xd7, 0x3d, 0x55, 0x09, 0x58, 0xbd, 0x3f, 0x1f, 0x18, 0xbd,
+  0x93, 0xd8, 0x61, 0xbd, 0x7c, 0xf7, 0x2b, 0x3d, 0xce, 0xa5, 0xdb, 0xbd,
+  0xd5, 0x27, 0x75, 0x3d, 0x4e, 0x5f, 0xdd, 0xbc, 0x22, 0xe6, 0x36, 0x3c,
+  0xeb, 0xaa, 0x0f, 0xbd, 0xb5, 0x6c, 0x3f, 0xbd, 0xbe, 0x65, 0x5b, 0xbc,
+  0xcc, 0xcc, 0x43, 0x3a, 0xe2, 0xed, 0x57, 0x3d, 0xc0, 0xbf, 0x43, 0xbd,
+  0x3b, 0xcd, 0xda, 0xbd, 0xe7, 0xb2, 0x96, 0xbd, 0x40, 0x0e, 0xb5, 0xbc,
+  0x21, 0x8a, 0x95, 0xbc, 0x3b, 0x7d, 0xef, 0xbc, 0x52, 0x05, 0xdb, 0x3c,
+  0x69, 0x52, 0x8a, 0x3d, 0x8f, 0x73, 0xe0, 0x3d, 0x62, 0xe1, 0xbf, 0xbd,
+  0x59, 0x7a, 0x0d, 0x3d, 0xfe, 0x25, 0x39, 0xbe, 0x6f, 0x4b, 0xf5, 0xbd,
+  0xa3, 0xb2, 0xa5, 0xbd, 0x1d, 0x31, 0x07, 0x3e, 0x63, 0x80, 0x54, 0x3e,
+  0xa4, 0xba, 0x5a, 0xbd, 0xf3, 0xa2, 0xfd, 0xbd, 0xd2, 0x11, 0x89, 0xb8,
+  0x58, 0xb3, 0x1b, 0x3c, 0x03, 0xaa, 0x61, 0xbc, 0x18, 0x30, 0xb0, 0x3b,
+  0x4a, 0x09, 0xeb, 0x3d, 0x09, 0x9a, 0x88, 0x3d, 0x83, 0x10, 0x14, 0x3d,
+  0x85, 0xd1, 0x99, 0xbd, 0x1d, 0x31, 0x2e, 0x3d, 0x27, 0x65, 0xf6, 0xbd,
+  0x00, 0x91, 0x9c, 0xbd, 0xd5, 0x4e, 0x3c, 0xbd, 0xfa, 0x7a, 0x90, 0x3d,
+  0x3b, 0x2f, 0x8b, 0x3d, 0x23, 0x64, 0x43, 0xbd, 0x98, 0xed, 0xb6, 0xbc,
+  0x9c, 0x55, 0x11, 0x3d, 0x92, 0xca, 0x09, 0x3d, 0xf4, 0x17, 0xc2, 0xbd,
+  0xae, 0x00, 0x31, 0x3d, 0xb7, 0x2f, 0x16, 0xbd, 0xfb, 0x1a, 0x99, 0xbd,
+  0x07, 0xc2, 0x03, 0xbc, 0xb4, 0x01, 0xbb, 0xbc, 0x66, 0x55, 0x00, 0xbd,
+  0x61, 0x7d, 0xfd, 0xbc, 0x44, 0x8d, 0xd9, 0xbc, 0x28, 0xfc, 0x18, 0x3d,
+  0x41, 0x0e, 0x99, 0x3d, 0x76, 0xe5, 0x8e, 0x3d, 0x7f, 0x25, 0x45, 0xbd,
+  0xab, 0x79, 0x2c, 0xbe, 0x5e, 0x4c, 0x14, 0xbd, 0x00, 0xe2, 0xdc, 0xbc,
+  0x1b, 0xfa, 0x34, 0x3c, 0x46, 0xb8, 0xc8, 0xbd, 0x10, 0xda, 0x14, 0xbd,
+  0x7f, 0x32, 0x2b, 0xbd, 0x3e, 0x4f, 0x84, 0x3d, 0x33, 0x3a, 0x8a, 0xbd,
+  0x37, 0xd3, 0x7b, 0x3c, 0x55, 0xbf, 0x0c, 0xbe, 0xaf, 0x96, 0x76, 0xbd,
+  0x96, 0x44, 0x78, 0xbc, 0xf7, 0x51, 0x45, 0x3e, 0x2f, 0xb1, 0xea, 0x3b,
+  0x3f, 0x0d, 0x03, 0xbd, 0x12, 0xd2, 0x3c, 0xbe, 0x63, 0x57, 0xcb, 0xbb,
+  0x72, 0xff, 0xdd, 0x3b, 0x68, 0xb8, 0xd9, 0xbc, 0x7f, 0x98, 0x5b, 0x3d,
+  0x58, 0x96, 0x84, 0x3d, 0x8e, 0x55, 0x4b, 0x3c, 0x69, 0xc7, 0xf0, 0x3d,
+  0x1c, 0xfa, 0xa6, 0xbc, 0x13, 0x35, 0x89, 0x3d, 0x80, 0xda, 0xe0, 0xbd,
+  0x15, 0xa4, 0xdb, 0xbd, 0x31, 0x2a, 0x63, 0xbd, 0x80, 0x20, 0x6c, 0x3e,
+  0x76, 0xe2, 0x1d, 0x3d, 0x4a, 0x4b, 0x21, 0xbe, 0xf9, 0x3f, 0x20, 0xbe,
+  0xb0, 0xcd, 0x33, 0x3c, 0x6f, 0x59, 0xf6, 0xbb, 0xe9, 0x8a, 0x5a, 0x3d,
+  0x74, 0x1f, 0x87, 0x3c, 0xe5, 0x8e, 0x9f, 0x3d, 0xa9, 0x70, 0x41, 0x3c,
+  0x93, 0xf3, 0x0d, 0x3e, 0x4f, 0x67, 0x0b, 0xbb, 0x6b, 0xbd, 0xbe, 0x3d,
+  0xa1, 0x87, 0xae, 0xbd, 0x6b, 0x1a, 0xa2, 0xbb, 0x84, 0x36, 0x8d, 0x3c,
+  0x4c, 0xc7, 0x4c, 0x3e, 0xc0, 0xa3, 0x59, 0x3d, 0xbb, 0xb0, 0x36, 0xbe,
+  0xa0, 0x83, 0x9d, 0xbd, 0x52, 0x99, 0x8d, 0x3d, 0x47, 0xbd, 0x88, 0xbd,
+  0xe2, 0xff, 0x4d, 0x3d, 0x0e, 0xdc, 0x0f, 0x3d, 0x70, 0xe3, 0xd0, 0xbb,
+  0x51, 0xc2, 0xde, 0xbd, 0xdf, 0x6c, 0x16, 0x3d, 0x1f, 0xf9, 0x17, 0x3d,
+  0xe3, 0x69, 0x4f, 0x3d, 0xff, 0xee, 0x5f, 0xbd, 0x61, 0xb2, 0x35, 0xbd,
+  0xa7, 0xa3, 0xd5, 0xbd, 0xd1, 0x1d, 0x4f, 0x3e, 0x42, 0x16, 0x73, 0x3c,
+  0xeb, 0x7f, 0xef, 0xbd, 0x6a, 0x24, 0x72, 0xbd, 0xa7, 0xa1, 0xcc, 0x3b,
+  0xd2, 0x3d, 0x34, 0xbc, 0x47, 0xbc, 0x8b, 0xbd, 0xee, 0x4f, 0x69, 0xbd,
+  0xd3, 0x90, 0xd0, 0x3c, 0x2e, 0x5b, 0x6f, 0x3d, 0x65, 0x43, 0xb8, 0x3d,
+  0x33, 0xe2, 0x7d, 0xbd, 0xba, 0x07, 0x91, 0x3b, 0xad, 0xf8, 0x92, 0xbd,
+  0x00, 0x83, 0xa3, 0x3c, 0x5c, 0x9a, 0x93, 0x3c, 0xe6, 0x91, 0x36, 0x3e,
+  0x75, 0x1f, 0xcb, 0x3d, 0x3d, 0x61, 0x25, 0x3c, 0x90, 0xb4, 0x0e, 0xbe,
+  0x6c, 0xa0, 0x83, 0xbd, 0xa7, 0x2f, 0xc3, 0xbd, 0x5c, 0xc4, 0x99, 0x3d,
+  0x3c, 0x4b, 0x4c, 0x3b, 0x02, 0x9a, 0x66, 0x3c, 0x29, 0x75, 0x76, 0x3d,
+  0x03, 0x76, 0x8d, 0xbc, 0x27, 0x32, 0x15, 0xbd, 0xaa, 0x00, 0xbd, 0xbb,
+  0x36, 0xc5, 0x12, 0xbd, 0x67, 0x01, 0x99, 0xbd, 0x5c, 0xa2, 0x52, 0xbc,
+  0x5b, 0x6e, 0x05, 0x3e, 0xdb, 0xab, 0xb5, 0x3d, 0xfb, 0x20, 0x5e, 0xbd,
+  0xdd, 0x93, 0x05, 0xbc, 0x86, 0xd6, 0x04, 0xbd, 0xa8, 0x33, 0xe8, 0xbc,
+  0x31, 0xa9, 0x5b, 0x39, 0xfb, 0xe1, 0xd8, 0xbd, 0x4e, 0x6d, 0xee, 0x3d,
+  0x89, 0x1d, 0x28, 0x3d, 0x91, 0x0c, 0xbe, 0x3d, 0xcf, 0xd2, 0xec, 0xbc,
+  0xf3, 0xb9, 0x81, 0xbc, 0xd9, 0x9b, 0x65, 0xbb, 0xe7, 0x4b, 0xbd, 0xbd,
+  0xaa, 0xa3, 0x84, 0xbd, 0x28, 0xbe, 0x42, 0x3e, 0x23, 0x1a, 0x7c, 0x3d,
+  0x59, 0x19, 0x23, 0xbd, 0x26, 0xe2, 0x9c, 0xbd, 0x4a, 0x86, 0x88, 0xbd,
+  0xe0, 0xa8, 0x9b, 0x3c, 0x0d, 0xa1, 0xb9, 0x3d, 0xd2, 0xaa, 0x58, 0xbd,
+  0x56, 0x5f, 0x97, 0x3d, 0x30, 0x24, 0x66, 0x3d, 0x75, 0xa2, 0x82, 0x3d,
+  0x42, 0x4c, 0xfc, 0x3b, 0x52, 0xd2, 0xea, 0x3d, 0x38, 0x2f, 0xe9, 0xbb,
+  0xbb, 0x6c, 0x1d, 0xbe, 0x82, 0x92, 0xa4, 0x3d, 0xa6, 0x64, 0x87, 0x3c,
+  0x70, 0xec, 0xa1, 0x3d, 0xc6, 0x61, 0x63, 0xbd, 0x4b, 0x39, 0xa0, 0xbd,
+  0x36, 0xba, 0x22, 0xbd, 0xda, 0x0b, 0x88, 0xbb, 0x0b, 0xb7, 0xd4, 0x39,
+  0xd5, 0x93, 0x10, 0x3d, 0xdf, 0x2d, 0xa5, 0x3d, 0xfc, 0x98, 0x8a, 0xbd,
+  0x85, 0x32, 0x1b, 0x3d, 0x61, 0x54, 0x8d, 0xbc, 0x8a, 0xba, 0x3d, 0xbd,
+  0xb9, 0x57, 0xb7, 0xbd, 0x0d, 0x88, 0x2a, 0x3d, 0xb2, 0xc2, 0x3c, 0x3d,
+  0xb2, 0x6c, 0x23, 0xbc, 0x98, 0x65, 0x08, 0x3c, 0xd7, 0x03, 0x48, 0x3c,
+  0x14, 0x0f, 0xa7, 0xbd, 0x06, 0xb8, 0x01, 0xbc, 0xc1, 0x0b, 0x3a, 0x3d,
+  0xcb, 0x56, 0x2d, 0xbc, 0x07, 0xdd, 0x86, 0x3d, 0x71, 0x44, 0xc4, 0x3b,
+  0xa4, 0x8b, 0x26, 0xbd, 0xdc, 0x6a, 0x90, 0xbd, 0x28, 0x49, 0xc4, 0xbb,
+  0xb8, 0xbc, 0xd3, 0x3c, 0x8c, 0x46, 0x03, 0xbe, 0xd5, 0x32, 0x31, 0xbc,
+  0x13, 0x36, 0x3f, 0xbd, 0x20, 0xf7, 0x9c, 0x3d, 0xf4, 0x45, 0x0c, 0x3c,
+  0x8b, 0x64, 0x6c, 0xbd, 0xf4, 0x7b, 0xd1, 0xbd, 0xeb, 0x48, 0xcc, 0x3c,
+  0x27, 0x13, 0xf7, 0xbd, 0xe3, 0x88, 0x4e, 0x3c, 0x29, 0x9f, 0xd4, 0x3a,
+  0x62, 0x0a, 0xaf, 0x3d, 0xab, 0x78, 0x71, 0x3d, 0xf2, 0xc5, 0x12, 0x3c,
+  0xe0, 0xc6, 0xfa, 0x3c, 0xe0, 0x71, 0x0d, 0x3d, 0x28, 0x7b, 0x16, 0xbd,
+  0x30, 0xea, 0x0a, 0x3d, 0xc6, 0xcd, 0xe4, 0x3b, 0x12, 0xc2, 0x2d, 0x3e,
+  0x1e, 0xa2, 0xaf, 0x3d, 0x19, 0xda, 0x4f, 0xbd, 0x10, 0x6b, 0x26, 0x3d,
+  0x94, 0xad, 0xa4, 0xbc, 0x71, 0x79, 0xe0, 0xbd, 0xd2, 0x12, 0xa7, 0xbd,
+  0x5f, 0xdf, 0xa9, 0x3b, 0xa7, 0xc7, 0x4c, 0xbc, 0x1f, 0xe8, 0x74, 0x3b,
+  0x72, 0xbb, 0x87, 0x3d, 0xd3, 0x54, 0x0c, 0xbd, 0xa9, 0xf6, 0x76, 0x3a,
+  0xb4, 0x82, 0xad, 0x3c, 0xd5, 0xd8, 0xe3, 0xbd, 0x66, 0x3a, 0x00, 0x3d,
+  0xf4, 0x46, 0xb0, 0x3d, 0xdc, 0x8f, 0x1a, 0x3e, 0x75, 0xba, 0xcf, 0xbd,
+  0xb6, 0x21, 0x1a, 0x3d, 0x70, 0xa3, 0x82, 0xbb, 0x1d, 0xfc, 0x2d, 0xbd,
+  0xc5, 0x30, 0x1d, 0xbc, 0xe1, 0x8d, 0xf5, 0xbd, 0x29, 0xb8, 0x95, 0x3d,
+  0x81, 0x44, 0xcf, 0xbc, 0xf1, 0x1c, 0xc7, 0x3c, 0xc9, 0x36, 0x14, 0xbd,
+  0x9a, 0xe3, 0xb9, 0x3c, 0x78, 0x7a, 0xf1, 0xb8, 0x14, 0x24, 0x20, 0xbc,
+  0xe6, 0xf5, 0x12, 0xbd, 0x61, 0x11, 0x57, 0xba, 0x1a, 0xd9, 0x18, 0x3e,
+  0x9a, 0x76, 0x8b, 0xbd, 0x81, 0xce, 0x5b, 0xbd, 0x1e, 0x25, 0x24, 0x3e,
+  0xef, 0x51, 0xce, 0xbd, 0xdb, 0xb7, 0x73, 0x3d, 0x84, 0x8c, 0xdc, 0x3c,
+  0xeb, 0x7f, 0x19, 0xba, 0xac, 0xb4, 0x71, 0x3d, 0xb2, 0x65, 0x5f, 0x3d,
+  0xd8, 0x70, 0xe3, 0xbd, 0xfd, 0x40, 0x92, 0x3d, 0x74, 0xc8, 0xfd, 0xbd,
+  0x8e, 0x74, 0x9e, 0xba, 0xea, 0xb9, 0xba, 0x3c, 0xa7, 0x47, 0x5b, 0x3e,
+  0x86, 0x62, 0x2c, 0x3e, 0xc9, 0x8d, 0xe3, 0xbd, 0xc3, 0x90, 0x61, 0xbe,
+  0xbb, 0x33, 0x04, 0x3d, 0x0f, 0xb7, 0x65, 0xbc, 0x70, 0x16, 0x8d, 0x3c,
+  0xfe, 0xf8, 0x91, 0xbd, 0x54, 0x9b, 0xd0, 0x3d, 0x8d, 0x73, 0xe3, 0x3d,
+  0xa3, 0xe9, 0x0a, 0x3c, 0x49, 0x40, 0x43, 0x3d, 0xce, 0xcc, 0x8b, 0x3d,
+  0xd1, 0xe1, 0xc9, 0xbc, 0x36, 0x20, 0x2b, 0xbd, 0x5f, 0x8f, 0x72, 0x3c,
+  0x70, 0x53, 0x6e, 0x3e, 0xb4, 0x43, 0x33, 0x3e, 0xe8, 0xd7, 0xef, 0xbc,
+  0xe1, 0x78, 0xd4, 0xbd, 0x5c, 0x37, 0x3c, 0xbd, 0x9b, 0x48, 0x2f, 0xbd,
+  0x37, 0xb1, 0x90, 0x3d, 0x87, 0xa0, 0x86, 0xbc, 0x9c, 0xe0, 0x1f, 0x3d,
+  0x89, 0xb5, 0x47, 0x3d, 0x69, 0x91, 0xf6, 0x3d, 0x1f, 0xd6, 0x00, 0xbd,
+  0x2e, 0xec, 0x7e, 0x3d, 0xa5, 0x5a, 0x63, 0xbd, 0xed, 0x79, 0x21, 0xbb,
+  0x53, 0x27, 0x0e, 0xbd, 0x4c, 0x65, 0x90, 0x3e, 0xfd, 0x9e, 0x0b, 0x3d,
+  0x0a, 0xd8, 0x4a, 0xbd, 0xf2, 0x15, 0x0d, 0xbd, 0xdb, 0x3c, 0xf9, 0x3c,
+  0x36, 0x9c, 0x46, 0xbc, 0x9f, 0xb2, 0x11, 0x3d, 0x80, 0xa2, 0x59, 0xbd,
+  0xcc, 0xee, 0x6c, 0x3d, 0x6f, 0x25, 0xf1, 0xbc, 0xb7, 0x1d, 0xab, 0xbc,
+  0x67, 0x77, 0x83, 0xbc, 0x51, 0x2f, 0xa2, 0x3d, 0xf5, 0xd8, 0xe0, 0xbc,
+  0xf2, 0x03, 0x41, 0xbc, 0xd7, 0x5b, 0xcf, 0xbd, 0x07, 0xae, 0x73, 0x3e,
+  0xba, 0x82, 0xb9, 0x3c, 0x16, 0x7b, 0x41, 0xbd, 0x53, 0x4e, 0x81, 0xbd,
+  0x1d, 0x16, 0x76, 0x3c, 0x0c, 0x18, 0x2a, 0xbd, 0x12, 0x57, 0x84, 0x3c,
+  0xbd, 0x8f, 0xe0, 0xbc, 0xe3, 0x95, 0xf4, 0x3c, 0xa2, 0xbf, 0x32, 0x3d,
+  0x2f, 0xda, 0xd9, 0xbc, 0x19, 0x06, 0x4d, 0xbc, 0x5f, 0x99, 0xc8, 0x3c,
+  0x34, 0x1e, 0xc3, 0xbd, 0xaf, 0x43, 0xdb, 0xbd, 0x9c, 0x2f, 0x36, 0xbc,
+  0xc3, 0x5d, 0x45, 0x3e, 0xff, 0x7f, 0xfb, 0x3d, 0xe9, 0x21, 0x10, 0xbd,
+  0x43, 0x5f, 0xe5, 0xbd, 0xcf, 0x7b, 0x13, 0xbd, 0x2a, 0x07, 0x96, 0xbd,
+  0xae, 0xd2, 0x8d, 0x3d, 0x2b, 0x71, 0x64, 0xbd, 0x2a, 0x69, 0xb5, 0x3c,
+  0x1d, 0x09, 0xae, 0x3d, 0xa4, 0xa8, 0x9a, 0x3d, 0xf6, 0xf0, 0x94, 0x3d,
+  0x76, 0x27, 0x9b, 0x3d, 0x31, 0x66, 0x1d, 0xbd, 0xce, 0xe2, 0x86, 0x3c,
+  0xa7, 0x54, 0xca, 0xbc, 0x71, 0xd0, 0xa6, 0x3d, 0x7a, 0xae, 0x60, 0x3d,
+  0xea, 0xfc, 0xbf, 0xbd, 0xb1, 0xa4, 0x15, 0x3d, 0x7e, 0x45, 0x6d, 0xbc,
+  0x6f, 0xe6, 0xa9, 0xbc, 0x3a, 0x65, 0xe9, 0x3c, 0xd8, 0x3b, 0x15, 0x3c,
+  0xf2, 0x08, 0x12, 0x3d, 0x5a, 0x04, 0x53, 0x3d, 0x88, 0x81, 0x9a, 0x3d,
+  0xcf, 0x3c, 0x16, 0x3d, 0x4b, 0xa6, 0xaf, 0x3d, 0xbe, 0x1c, 0xe7, 0x3c,
+  0xb8, 0x92, 0x18, 0xbd, 0x9a, 0x62, 0x7c, 0xbc, 0x26, 0xce, 0x27, 0x3e,
+  0x09, 0x4e, 0x92, 0x3d, 0xe2, 0xa2, 0x16, 0xbd, 0x2d, 0xc3, 0x49, 0xbd,
+  0x78, 0xc4, 0xe1, 0x3c, 0xc2, 0x3a, 0x1c, 0xbd, 0xc4, 0xfb, 0xf5, 0xbc,
+  0xb9, 0xcf, 0xa1, 0xbd, 0xbf, 0x9e, 0x16, 0x3d, 0x31, 0x4a, 0x1c, 0xbc,
+  0x48, 0x01, 0x89, 0x3d, 0xb8, 0x61, 0x7f, 0x3b, 0x66, 0xe0, 0x04, 0x3b,
+  0x9a, 0x5d, 0x87, 0xbd, 0xaa, 0x97, 0x27, 0xbd, 0x43, 0x6f, 0xb5, 0x3b,
+  0xd3, 0x45, 0xda, 0x3d, 0x1e, 0xdb, 0x52, 0xbd, 0xbc, 0x3f, 0x96, 0xbd,
+  0x6c, 0x18, 0x25, 0xbd, 0x03, 0x75, 0x51, 0x3c, 0x97, 0xc9, 0x85, 0xbd,
+  0xf4, 0x0a, 0xa4, 0xbb, 0x87, 0x41, 0xcc, 0x3c, 0x41, 0x10, 0x85, 0x3d,
+  0x89, 0x3a, 0x91, 0x3c, 0x6e, 0xd0, 0x92, 0xbd, 0xae, 0x9f, 0xa5, 0xbc,
+  0x92, 0x2d, 0x88, 0x3d, 0x0d, 0xc5, 0xe8, 0xbd, 0x6a, 0xf3, 0x6a, 0xbd,
+  0x5e, 0x5a, 0xb0, 0x3c, 0xff, 0x6c, 0x9e, 0x3d, 0x0e, 0x76, 0xc8, 0x3d,
+  0x6b, 0x56, 0xb9, 0xbd, 0x3a, 0x23, 0x34, 0xbd, 0xb3, 0x1e, 0x15, 0x3d,
+  0x76, 0x9b, 0x41, 0xbd, 0x82, 0x0f, 0x0c, 0xbd, 0x9b, 0x71, 0x8b, 0x3d,
+  0x30, 0x62, 0x2c, 0xbc, 0x9f, 0x2f, 0xb6, 0x3d, 0xe5, 0xf0, 0x60, 0xbd,
+  0x23, 0x9f, 0xbc, 0x3d, 0x93, 0x36, 0x15, 0x3e, 0x8e, 0x65, 0xf0, 0xbd,
+  0xcc, 0x65, 0x85, 0x3d, 0x47, 0xb6, 0x36, 0x3d, 0x72, 0x12, 0xa6, 0x3d,
+  0x2e, 0x48, 0x50, 0x3d, 0x00, 0x44, 0x12, 0xbe, 0xfa, 0x73, 0xfb, 0xbc,
+  0x20, 0xb4, 0x67, 0xbd, 0xe1, 0x90, 0x06, 0xbe, 0x8f, 0xf1, 0xc1, 0x3c,
+  0x1d, 0x64, 0x63, 0xbd, 0x2d, 0x3e, 0x4f, 0x3d, 0xf2, 0x6a, 0xb0, 0x3d,
+  0xba, 0x49, 0x33, 0x3e, 0xc9, 0x74, 0xf0, 0x3b, 0xd5, 0x12, 0x7e, 0x3d,
+  0xe0, 0x5b, 0xfa, 0xbd, 0xea, 0x94, 0x1c, 0xbb, 0x15, 0xe7, 0x92, 0x3b,
+  0x41, 0xc1, 0x72, 0x3e, 0x08, 0x3a, 0x6a, 0xbb, 0xb2, 0x37, 0x01, 0xbe,
+  0x5e, 0x4d, 0xab, 0xbc, 0x00, 0x6b, 0x43, 0xbd, 0xe7, 0x3a, 0x6b, 0xbd,
+  0xc9, 0xd5, 0xee, 0xbb, 0x10, 0x39, 0x79, 0xbd, 0x49, 0x96, 0xd2, 0x3d,
+  0x84, 0xc8, 0x19, 0x3d, 0x28, 0x4c, 0xe9, 0xbc, 0x0c, 0xc6, 0x37, 0xbd,
+  0x36, 0x77, 0x8b, 0x3d, 0xdf, 0xf3, 0xda, 0xbd, 0xa7, 0x78, 0xb8, 0xbd,
+  0x7f, 0x5a, 0x85, 0xbd, 0x5d, 0xf7, 0xe7, 0x3d, 0x89, 0x34, 0xf4, 0x3d,
+  0x72, 0xed, 0x16, 0xbe, 0xe8, 0x9e, 0xb1, 0xbd, 0x80, 0x4d, 0x4d, 0x3d,
+  0x13, 0x10, 0x3c, 0xbe, 0xbb, 0x3a, 0x5e, 0xbc, 0x53, 0x3f, 0x9d, 0x3b,
+  0x7f, 0x15, 0x15, 0xbb, 0x71, 0xca, 0x00, 0xbd, 0x70, 0x05, 0xf0, 0xba,
+  0xb2, 0x95, 0x30, 0xbd, 0x0d, 0x0b, 0x06, 0x3e, 0xd4, 0xab, 0x83, 0xbd,
+  0x53, 0x45, 0x9d, 0xbd, 0x98, 0xe1, 0xf8, 0xbc, 0x65, 0xe4, 0x4a, 0x3e,
+  0xde, 0xcd, 0xb4, 0x3d, 0xb9, 0x0c, 0x01, 0xbe, 0x9e, 0x4c, 0x95, 0xbd,
+  0xf7, 0xaa, 0xec, 0x3c, 0xc9, 0xba, 0x81, 0x3c, 0x43, 0xba, 0xb1, 0x3d,
+  0x7e, 0xae, 0x29, 0x3d, 0x21, 0x1d, 0x36, 0xbc, 0x8e, 0x01, 0xa0, 0xbd,
+  0xbe, 0xd2, 0xcd, 0x3d, 0xeb, 0x22, 0xf3, 0x3d, 0x23, 0x24, 0xf2, 0x3d,
+  0xb9, 0x97, 0xf3, 0xbc, 0xc0, 0x5d, 0x3c, 0xbc, 0x4b, 0x0d, 0xc2, 0xbd,
+  0x17, 0xa5, 0x7d, 0x3e, 0x5e, 0x15, 0x89, 0x3d, 0x37, 0xa5, 0x10, 0xbe,
+  0xf6, 0x8e, 0xf3, 0x3a, 0xa8, 0x4e, 0xd8, 0xbd, 0x8e, 0x41, 0xf2, 0x3c,
+  0xcb, 0x9b, 0x90, 0xbc, 0x1a, 0xd6, 0x05, 0xbd, 0x78, 0xfe, 0x8a, 0x3d,
+  0x1c, 0x0a, 0x21, 0x3d, 0x54, 0x79, 0xc5, 0x3d, 0xc9, 0x3f, 0x6a, 0xbc,
+  0x0c, 0x59, 0xcf, 0x3d, 0xa7, 0xfe, 0x24, 0xbe, 0xbd, 0xbd, 0x40, 0xbd,
+  0x62, 0x14, 0x8a, 0xbd, 0xe5, 0x8e, 0x4d, 0x3e, 0xf7, 0x87, 0x6a, 0x3d,
+  0x56, 0x68, 0x2a, 0xbe, 0xa7, 0xd1, 0x12, 0x3d, 0xda, 0xc5, 0xdf, 0xb9,
+  0x3f, 0x26, 0x7f, 0x3b, 0xbc, 0xd7, 0x63, 0x3d, 0x73, 0x6f, 0xcb, 0xbd,
+  0xff, 0x2c, 0x12, 0xbd, 0x7e, 0x90, 0x92, 0x3c, 0x05, 0xee, 0xfc, 0x3c,
+  0x64, 0xfe, 0x95, 0xbd, 0xd0, 0x30, 0xe7, 0x3c, 0x4c, 0x0b, 0xf9, 0xbd,
+  0xeb, 0xa5, 0xe7, 0xbc, 0x6c, 0x4f, 0x58, 0xbd, 0xac, 0x96, 0x36, 0x3e,
+  0x5b, 0xb2, 0x9d, 0x3d, 0xaf, 0x49, 0x18, 0xbd, 0x61, 0x86, 0x05, 0xbe,
+  0x79, 0xb1, 0x43, 0x3d, 0xa5, 0x66, 0x18, 0xbe, 0xd7, 0xdf, 0x92, 0x3d,
+  0x0e, 0xaa, 0xee, 0xbb, 0x9e, 0x70, 0x4b, 0xbb, 0x2b, 0x49, 0x45, 0x3d,
+  0x5d, 0x0b, 0x90, 0x3d, 0x38, 0x0a, 0xa0, 0xbd, 0xe8, 0xd7, 0x0f, 0x3d,
+  0xca, 0xf2, 0x93, 0xbd, 0x5c, 0xd1, 0xbd, 0xbd, 0xc4, 0x9b, 0xb6, 0xbd,
+  0x07, 0x7d, 0x27, 0x3e, 0x32, 0x96, 0xa4, 0x3d, 0x67, 0x8b, 0x6c, 0xbd,
+  0x11, 0xb6, 0xdd, 0xbd, 0x04, 0xa6, 0x9d, 0xbd, 0x42, 0xa0, 0xf5, 0xbc,
+  0x5d, 0xe3, 0x00, 0xbc, 0x8a, 0x49, 0x1a, 0x3c, 0xb6, 0xd1, 0xd9, 0x3d,
+  0x8f, 0xb0, 0x54, 0x3d, 0x97, 0x4c, 0xb3, 0x3d, 0x3b, 0xe5, 0x3e, 0xbd,
+  0xff, 0x12, 0x95, 0x3c, 0x44, 0xa9, 0xed, 0xbc, 0x86, 0x10, 0x6c, 0xbd,
+  0x58, 0x7f, 0x00, 0xbd, 0xd3, 0x40, 0x61, 0x3e, 0x7c, 0xa9, 0x2d, 0x3e,
+  0xbd, 0x9e, 0xd6, 0xbc, 0x18, 0x27, 0x13, 0xbe, 0xf9, 0x0d, 0x5f, 0x3c,
+  0x0a, 0xdc, 0xcd, 0xbd, 0x23, 0x6f, 0x16, 0xbd, 0x7a, 0xc9, 0x4f, 0xbc,
+  0xba, 0x00, 0xe5, 0x3c, 0x30, 0x54, 0x4b, 0x3c, 0xab, 0x2d, 0x87, 0x3d,
+  0x24, 0x07, 0x9c, 0xbc, 0x9a, 0x5a, 0x1c, 0x3c, 0x66, 0x1a, 0x91, 0x39,
+  0xc5, 0xe5, 0xdc, 0xbc, 0xe6, 0xa8, 0xe3, 0x3c, 0x78, 0x90, 0xb8, 0x3d,
+  0x60, 0x56, 0xef, 0x3d, 0xfc, 0x1f, 0xf3, 0xbc, 0xb2, 0x0d, 0x20, 0x3c,
+  0xf6, 0x2d, 0x51, 0xbd, 0xcb, 0x2c, 0x98, 0xbd, 0xd2, 0x59, 0xa6, 0xbd,
+  0x0e, 0x28, 0x71, 0x3d, 0x78, 0x7e, 0x29, 0xbd, 0x7b, 0x7e, 0x8b, 0xbd,
+  0xfd, 0x05, 0xd4, 0x3c, 0x28, 0x13, 0xd6, 0xbd, 0x3a, 0x09, 0x11, 0x3d,
+  0x65, 0xd5, 0x91, 0x3d, 0xc6, 0xa1, 0xe1, 0x3c, 0x64, 0x2a, 0x82, 0x3d,
+  0x1b, 0x53, 0x51, 0xbd, 0x54, 0xdc, 0xea, 0x3d, 0x79, 0xd3, 0x24, 0xbe,
+  0x09, 0x1d, 0x4c, 0x3c, 0x61, 0xea, 0xb0, 0x3d, 0xd8, 0x22, 0x6c, 0xbc,
+  0x85, 0xf6, 0xd5, 0x3c, 0x3d, 0xd0, 0x96, 0x3c, 0x8b, 0xff, 0x9c, 0x3c,
+  0x47, 0x42, 0xca, 0xbc, 0x98, 0x3a, 0xce, 0xbc, 0x54, 0x98, 0x06, 0x3d,
+  0x96, 0x92, 0x5c, 0xbd, 0xb2, 0xa1, 0x9c, 0xbd, 0x8d, 0x4b, 0x02, 0xbb,
+  0x0c, 0xb1, 0x5e, 0x3c, 0xa5, 0x7a, 0x9e, 0x3d, 0x83, 0x81, 0x81, 0x3d,
+  0x66, 0x00, 0xef, 0x3c, 0x46, 0x68, 0x55, 0xbd, 0xd1, 0x2f, 0x82, 0xbc,
+  0x5d, 0x21, 0xcc, 0x3c, 0x9a, 0xdd, 0x3c, 0xbd, 0x8a, 0xcf, 0x4d, 0xbc,
+  0x8d, 0x26, 0x78, 0xbb, 0xe5, 0xf1, 0x51, 0x3d, 0x88, 0x8d, 0xa6, 0xbd,
+  0x0e, 0xa7, 0xda, 0xbd, 0x5a, 0x25, 0xc8, 0xbc, 0x90, 0xca, 0x95, 0xbd,
+  0xf2, 0x36, 0xa6, 0xbd, 0x59, 0x5f, 0xb4, 0x3c, 0xfe, 0x00, 0x18, 0x3e,
+  0xa5, 0x19, 0x6b, 0x3d, 0xe8, 0xdb, 0x0d, 0xbe, 0x5e, 0xb5, 0xb8, 0xbd,
+  0x7a, 0xac, 0xa7, 0xbd, 0x18, 0xc7, 0x89, 0xbd, 0x45, 0x8d, 0x54, 0x3c,
+  0x6e, 0x63, 0x80, 0x3d, 0x0e, 0x27, 0x4d, 0x3d, 0xb9, 0xe6, 0x4b, 0x3d,
+  0x87, 0x1d, 0xca, 0xbd, 0xdf, 0x85, 0x5f, 0xbd, 0x66, 0xed, 0x95, 0x3d,
+  0x00, 0xe4, 0x2e, 0xbd, 0xa4, 0x16, 0x4f, 0xbd, 0xa1, 0x4c, 0xc7, 0xbd,
+  0x7d, 0x10, 0xd0, 0x3d, 0x1a, 0x1a, 0xa1, 0x3d, 0x56, 0x60, 0xdf, 0xbd,
+  0x55, 0xd6, 0xb6, 0xbc, 0x29, 0x25, 0x59, 0xbc, 0x98, 0x1a, 0xef, 0x3c,
+  0x95, 0x18, 0x9d, 0x3c, 0xb6, 0xac, 0x0c, 0x3b, 0xa7, 0xb0, 0xa0, 0xbd,
+  0x2b, 0xcd, 0x9f, 0xbb, 0xa8, 0x9c, 0xa5, 0xbc, 0xa8, 0x36, 0x86, 0xbd,
+  0xf7, 0xa1, 0xda, 0x3c, 0xb4, 0xc6, 0xbc, 0xbd, 0x84, 0x34, 0x28, 0x3a,
+  0xbb, 0x45, 0xa0, 0x3b, 0xaf, 0x13, 0x1e, 0x3e, 0xf2, 0xc3, 0xe5, 0x3d,
+  0xc9, 0xec, 0x4f, 0xbc, 0xb6, 0x9d, 0xb1, 0xbc, 0xfa, 0x64, 0xa5, 0xbc,
+  0xc4, 0x2e, 0xd9, 0xbd, 0x79, 0x12, 0x89, 0x3c, 0xc2, 0x18, 0x43, 0xbd,
+  0xdb, 0x61, 0xd7, 0xbc, 0x18, 0x29, 0x5f, 0x3d, 0xe2, 0xc3, 0x73, 0xbc,
+  0x1a, 0x85, 0x64, 0xbd, 0x5a, 0x35, 0x89, 0x3c, 0x5c, 0x23, 0xba, 0x3c,
+  0x6c, 0x33, 0x29, 0xbc, 0x29, 0x3b, 0x1f, 0xbd, 0x32, 0x4e, 0xe1, 0x3d,
+  0x20, 0xa4, 0x07, 0x3e, 0xea, 0x14, 0x04, 0xbd, 0xe3, 0xbb, 0x76, 0xbd,
+  0xa5, 0x53, 0x5d, 0x3d, 0x96, 0xe5, 0x01, 0x3d, 0xb6, 0xbd, 0xc9, 0x3c,
+  0x54, 0x1e, 0x03, 0x3d, 0x53, 0xfe, 0x17, 0xbb, 0xf3, 0x65, 0xd2, 0x3c,
+  0xd2, 0x19, 0xc8, 0x3d, 0x77, 0x9c, 0xb9, 0x3d, 0xf0, 0x8d, 0x8f, 0x3d,
+  0x39, 0x0a, 0x85, 0xbd, 0x45, 0x12, 0x10, 0x3c, 0xbb, 0x8b, 0x15, 0x3d,
+  0xdc, 0xcc, 0x55, 0x3e, 0x42, 0x06, 0x24, 0x3e, 0x3c, 0xb4, 0x3e, 0xbe,
+  0x14, 0xdf, 0x12, 0xbc, 0x48, 0xc2, 0x90, 0x3d, 0x3b, 0xea, 0x9b, 0x3c,
+  0x83, 0x9e, 0x8f, 0x3d, 0x97, 0x62, 0x34, 0xbc, 0xa0, 0xcc, 0xf0, 0x3d,
+  0xa1, 0x64, 0x2c, 0x3d, 0xbc, 0x55, 0xb5, 0x3d, 0x15, 0x23, 0xaf, 0x3d,
+  0x56, 0x1a, 0xd4, 0x3d, 0xf9, 0x6b, 0xf1, 0xbc, 0x29, 0x69, 0x45, 0xbc,
+  0x36, 0x3a, 0x0d, 0xbc, 0x23, 0xb2, 0x6f, 0x3e, 0xed, 0xbb, 0xb0, 0x3d,
+  0xcf, 0x20, 0xfb, 0xbd, 0xfc, 0x11, 0xc5, 0x3c, 0xda, 0x3e, 0xb6, 0xbd,
+  0x74, 0x2c, 0x2f, 0x3d, 0xf5, 0xaa, 0x97, 0x3d, 0x4b, 0x9c, 0xd4, 0x3d,
+  0x3c, 0x8d, 0xa5, 0x3b, 0x9c, 0x1d, 0xf3, 0x3c, 0x86, 0xa5, 0xaa, 0x3c,
+  0xf1, 0xbc, 0xe8, 0xbc, 0x26, 0x9f, 0x24, 0x3d, 0xc1, 0xb9, 0x9c, 0xbd,
+  0x4a, 0x27, 0x31, 0xbc, 0x5d, 0x6a, 0x76, 0x3c, 0x39, 0xa4, 0x5a, 0x3e,
+  0x5c, 0x26, 0x0b, 0xbd, 0xb5, 0xaa, 0xb2, 0xbd, 0xea, 0xcc, 0x5f, 0xbc,
+  0x8b, 0x0c, 0x9e, 0xbd, 0x9d, 0x87, 0x25, 0xbd, 0x39, 0x4a, 0x15, 0x3d,
+  0x58, 0x19, 0x27, 0x3d, 0xd3, 0x20, 0x14, 0x3e, 0x81, 0xe5, 0x56, 0xbd,
+  0x20, 0x70, 0x4f, 0x3d, 0x05, 0xce, 0x48, 0x3a, 0xd5, 0x24, 0x01, 0x3d,
+  0x02, 0x4d, 0x8d, 0xbd, 0x4d, 0x07, 0x81, 0xbd, 0xed, 0x6a, 0x35, 0x3d,
+  0xc9, 0xf7, 0xb4, 0x3d, 0xee, 0xfe, 0xa7, 0x3d, 0x06, 0x35, 0x73, 0xbd,
+  0x81, 0xdc, 0xb5, 0xbd, 0x91, 0x07, 0xe6, 0xbd, 0x53, 0x55, 0x71, 0xbd,
+  0x0a, 0x6a, 0x74, 0x3d, 0x58, 0xc6, 0x0a, 0xbd, 0x8c, 0xa9, 0xba, 0x3c,
+  0x39, 0x37, 0xae, 0xbc, 0xc9, 0x1b, 0xe2, 0x3b, 0x64, 0x20, 0x07, 0xbd,
+  0xeb, 0xfa, 0xb3, 0x3d, 0x3f, 0xe3, 0xa7, 0xbd, 0xd9, 0x0f, 0x52, 0xbd,
+  0x4b, 0xde, 0xb3, 0xbd, 0x7c, 0x70, 0x38, 0x3e, 0xa8, 0x67, 0x45, 0x3d,
+  0xac, 0x91, 0x1c, 0xbe, 0xd5, 0xdf, 0xf9, 0xbd, 0x4e, 0x4f, 0x03, 0xbe,
+  0x02, 0x62, 0x26, 0xbe, 0x1c, 0x59, 0x39, 0x3b, 0x89, 0x60, 0x90, 0xbd,
+  0xdd, 0xc1, 0x5e, 0x3d, 0x33, 0xa3, 0xb9, 0x3d, 0x45, 0x4f, 0x7b, 0x3c,
+  0x46, 0x1f, 0xc0, 0xbd, 0x02, 0x47, 0x0c, 0x3e, 0x67, 0x1a, 0xde, 0xbd,
+  0xdf, 0x7e, 0x25, 0x3c, 0xdc, 0x94, 0xcf, 0x3c, 0xbd, 0x4d, 0x11, 0x3e,
+  0xaa, 0xcf, 0xfe, 0x3c, 0xd8, 0xee, 0xe8, 0x3b, 0x75, 0xd2, 0x9b, 0xbd,
+  0xc7, 0x3e, 0x34, 0x3b, 0xc4, 0x5d, 0x1a, 0xbe, 0xed, 0x42, 0x9e, 0x3d,
+  0x6f, 0xae, 0x0d, 0xbd, 0xac, 0xf0, 0x5e, 0x3d, 0xbf, 0x5c, 0x7a, 0xbc,
+  0x4a, 0x8b, 0xd1, 0x3c, 0x41, 0x14, 0x7a, 0xbd, 0xe2, 0x02, 0x02, 0x3d,
+  0xcd, 0xb4, 0xb4, 0xbc, 0x62, 0x36, 0x8e, 0x3c, 0xd6, 0x60, 0xb7, 0xbd,
+  0xd2, 0x08, 0x5f, 0x3e, 0x21, 0xf8, 0xda, 0x3b, 0x9a, 0x7b, 0xab, 0xbd,
+  0x86, 0xa1, 0x62, 0xbd, 0x58, 0xfd, 0xb6, 0xbd, 0x1f, 0xf2, 0x9c, 0xbd,
+  0x7a, 0x13, 0xae, 0xbd, 0x5c, 0x17, 0x20, 0x3d, 0x56, 0x8c, 0x80, 0x3d,
+  0x06, 0x2f, 0xaf, 0x3d, 0xae, 0x3e, 0xac, 0x3b, 0xae, 0xf8, 0xbb, 0xbd,
+  0x1f, 0xc4, 0xb9, 0x3d, 0x24, 0x31, 0x10, 0xbd, 0x68, 0x97, 0xc9, 0xbc,
+  0xf4, 0x85, 0x19, 0xbb, 0x7a, 0xfa, 0x00, 0xbb, 0xb3, 0x21, 0xc3, 0x3d,
+  0xfd, 0x73, 0x98, 0xbd, 0x18, 0xf8, 0x2d, 0xbe, 0x47, 0x9a, 0x9b, 0xbd,
+  0x8c, 0xa8, 0x76, 0xbd, 0xbb, 0x96, 0xdb, 0xbb, 0xf4, 0x10, 0x9f, 0xbc,
+  0xe6, 0x9f, 0x8b, 0x3d, 0xca, 0x6d, 0xc1, 0x3b, 0x2f, 0x68, 0x80, 0x3c,
+  0x78, 0x56, 0x88, 0xbd, 0x7a, 0x61, 0x49, 0x3d, 0x82, 0x01, 0x9b, 0xbd,
+  0xb6, 0x61, 0x6b, 0xbd, 0x47, 0xb6, 0x0a, 0xbc, 0xd0, 0xb0, 0x61, 0x3d,
+  0x29, 0xe6, 0xb4, 0x3d, 0xba, 0x9e, 0x08, 0xbe, 0x49, 0x03, 0xb7, 0xbc,
+  0x31, 0xd6, 0x03, 0xbe, 0x34, 0x9d, 0x22, 0x3c, 0x1b, 0x88, 0x43, 0x3d,
+  0xf3, 0x24, 0xb3, 0x3c, 0xcd, 0xa1, 0xfb, 0xbb, 0x45, 0x57, 0x9b, 0xbc,
+  0x18, 0x34, 0x90, 0x3b, 0x39, 0x36, 0x8e, 0x3c, 0x7e, 0xd6, 0x97, 0x3c,
+  0x42, 0x0d, 0x37, 0xbe, 0x28, 0x56, 0x15, 0xbe, 0x8e, 0xfa, 0x1f, 0x3d,
+  0xfe, 0xc3, 0x97, 0x3b, 0x39, 0xfc, 0x06, 0x3e, 0x51, 0x26, 0x0c, 0xbe,
+  0xc2, 0x1d, 0x20, 0xbd, 0xe1, 0xa2, 0xf4, 0xbd, 0x54, 0xb9, 0xef, 0xbb,
+  0xbc, 0x14, 0xaf, 0x3c, 0x65, 0x57, 0x08, 0xbe, 0xde, 0xde, 0x23, 0xbd,
+  0xe6, 0x8f, 0x5d, 0x3d, 0xfc, 0x64, 0xda, 0x3c, 0x19, 0x3c, 0x08, 0xbd,
+  0xf1, 0xbb, 0x65, 0x3d, 0x07, 0xf4, 0x16, 0xbd, 0x2b, 0x6f, 0xed, 0xbb,
+  0xf5, 0xe8, 0x0f, 0xbc, 0x37, 0x63, 0x94, 0x3d, 0x23, 0x78, 0x5a, 0x3e,
+  0xc4, 0x03, 0xb8, 0xbc, 0x0b, 0x4b, 0x45, 0xbd, 0xef, 0xe4, 0x3b, 0x3c,
+  0xd6, 0x3e, 0x63, 0x3c, 0x31, 0x0d, 0x23, 0x3d, 0xb8, 0x0d, 0x5d, 0x3d,
+  0x42, 0xb2, 0x68, 0x3c, 0x07, 0x1b, 0x04, 0xbd, 0xe9, 0x18, 0xb4, 0x3c,
+  0x5d, 0x30, 0x54, 0xbc, 0x8b, 0x1d, 0x15, 0x3a, 0x69, 0xd0, 0x94, 0xbd,
+  0x53, 0x70, 0x71, 0xbd, 0x2e, 0xc3, 0x95, 0x3c, 0xce, 0x76, 0x70, 0x3d,
+  0x90, 0x99, 0xf3, 0x3d, 0xbd, 0xb2, 0x01, 0xbe, 0x8d, 0xe0, 0x1a, 0xbe,
+  0x67, 0x9e, 0x65, 0xbd, 0xcf, 0x4c, 0x0e, 0xbe, 0x12, 0x12, 0x90, 0xbc,
+  0xca, 0xb5, 0x28, 0x3b, 0xb6, 0xfb, 0xc2, 0xbb, 0x7a, 0x55, 0x25, 0x3b,
+  0x61, 0x9c, 0xfd, 0x3c, 0x8e, 0x5b, 0x4d, 0xbd, 0x2e, 0xe4, 0xc5, 0x3d,
+  0x75, 0xb3, 0x85, 0xbd, 0x3a, 0x86, 0x9c, 0xbd, 0xdf, 0xc9, 0x9e, 0xbd,
+  0x86, 0x59, 0x21, 0x3d, 0x92, 0xaa, 0x17, 0x3d, 0x1c, 0x03, 0x09, 0xbe,
+  0xf9, 0x1c, 0x17, 0xbe, 0x4a, 0x35, 0xc2, 0x3d, 0x67, 0x54, 0x12, 0x3d,
+  0xcd, 0x2d, 0xb5, 0xbc, 0xf6, 0x1c, 0x88, 0xbd, 0xa1, 0x24, 0xba, 0x3d,
+  0x7c, 0x15, 0x41, 0xbd, 0x5e, 0xca, 0x2a, 0x3e, 0x84, 0x4a, 0x45, 0x3c,
+  0x8f, 0x46, 0x86, 0x3d, 0x12, 0x53, 0x15, 0xbd, 0x59, 0x10, 0x20, 0xbc,
+  0xf2, 0x7a, 0x1d, 0x3d, 0x54, 0x07, 0x2f, 0x3e, 0x71, 0x60, 0x94, 0x3d,
+  0x62, 0xff, 0x13, 0xbe, 0x74, 0x6f, 0x24, 0x3c, 0x6a, 0x87, 0xb0, 0xbd,
+  0xc9, 0xb0, 0x60, 0x3d, 0x64, 0x41, 0x26, 0x3d, 0x10, 0x2d, 0x16, 0xbc,
+  0x5e, 0xe2, 0xd5, 0x3b, 0x85, 0x87, 0x6a, 0xbd, 0x5f, 0x73, 0xae, 0x3d,
+  0x43, 0xfe, 0x15, 0xbc, 0x21, 0x5b, 0xa5, 0x3d, 0xd0, 0x0b, 0x51, 0xbd,
+  0x55, 0x1d, 0x03, 0xbd, 0x98, 0x0e, 0x96, 0x3c, 0x25, 0x43, 0x53, 0x3e,
+  0x51, 0x02, 0x5e, 0x3e, 0x73, 0xf4, 0x97, 0xbd, 0x3a, 0x59, 0x60, 0xbd,
+  0x85, 0x8f, 0x8e, 0xbd, 0xa6, 0xaa, 0x01, 0xbd, 0x54, 0xc2, 0x3d, 0xbc,
+  0x0c, 0x38, 0x2f, 0xbd, 0x99, 0xfb, 0x7f, 0x3d, 0x5b, 0xc8, 0x11, 0xbd,
+  0x35, 0xf1, 0xf6, 0x3d, 0x0d, 0x42, 0xf2, 0xba, 0xb0, 0x87, 0x04, 0xbc,
+  0xfe, 0xa5, 0xcd, 0xbc, 0x06, 0x80, 0xb2, 0x3c, 0xe8, 0x4d, 0x89, 0xbc,
+  0x00, 0xf5, 0x4e, 0x3e, 0x10, 0xd0, 0x7f, 0x3d, 0x6c, 0x01, 0x90, 0xbc,
+  0x58, 0x80, 0xe5, 0xbc, 0x1d, 0x1c, 0x57, 0x3d, 0xe0, 0x4b, 0x7c, 0xbd,
+  0x11, 0x52, 0xde, 0xbc, 0x70, 0x55, 0x6b, 0xbd, 0x11, 0x0b, 0x8f, 0x3b,
+  0xb9, 0xda, 0x71, 0x3d, 0x1a, 0xbf, 0x91, 0xbc, 0x96, 0x58, 0xa6, 0xbd,
+  0xdb, 0x9e, 0x88, 0x3d, 0xf2, 0xa5, 0x66, 0x39, 0xfb, 0x2f, 0x70, 0xbb,
+  0x12, 0x54, 0x28, 0xbd, 0x6c, 0x96, 0xeb, 0x3d, 0xed, 0x1a, 0xd2, 0x3d,
+  0xf1, 0xe8, 0x27, 0xbe, 0x06, 0x34, 0x83, 0xbc, 0x5a, 0x93, 0x5b, 0x3b,
+  0xf3, 0x20, 0xba, 0xbb, 0x47, 0x80, 0x6e, 0xbd, 0x92, 0x5a, 0x9d, 0xbc,
+  0x14, 0xbb, 0x90, 0x3d, 0xfd, 0x74, 0xfd, 0x3d, 0x60, 0x16, 0xf8, 0x3c,
+  0x0d, 0xf2, 0x12, 0xbc, 0x77, 0x64, 0x09, 0xbd, 0xa9, 0x1b, 0xd6, 0xbc,
+  0x7f, 0x12, 0xd3, 0xbd, 0xac, 0x07, 0x4b, 0x3d, 0x10, 0x96, 0x58, 0x3d,
+  0xd0, 0x48, 0xab, 0x3d, 0x4f, 0x01, 0xe2, 0xbc, 0x2c, 0xba, 0x8b, 0xbc,
+  0x08, 0x2d, 0x08, 0x3d, 0x42, 0x9f, 0xb4, 0xbd, 0x83, 0x1b, 0x2e, 0x3d,
+  0xbf, 0x38, 0x6a, 0x3d, 0xb9, 0x9f, 0x1d, 0xbd, 0xc1, 0xea, 0x2d, 0x3d,
+  0xb0, 0xdb, 0x66, 0xbd, 0x4c, 0xfd, 0xc9, 0x3d, 0x2f, 0x4a, 0x0a, 0x3d,
+  0x2f, 0xcb, 0x9d, 0xbd, 0x52, 0xf0, 0x1e, 0xbc, 0x1c, 0x4a, 0xf7, 0xbb,
+  0x20, 0x24, 0xaa, 0xbd, 0xb0, 0x5a, 0xa3, 0x3d, 0xef, 0x44, 0x54, 0xbd,
+  0x49, 0xde, 0xb5, 0x3d, 0x9e, 0x35, 0x20, 0x3e, 0x91, 0x3d, 0xbc, 0xbd,
+  0x6d, 0x1c, 0xe5, 0xbc, 0xc5, 0x74, 0xba, 0x3d, 0x23, 0xfa, 0xcd, 0x3c,
+  0x50, 0xca, 0x86, 0xbd, 0x1e, 0xc2, 0x1d, 0x3d, 0x22, 0xd6, 0x02, 0x3e,
+  0x62, 0x45, 0x57, 0x3c, 0x75, 0x7f, 0x08, 0xbe, 0x9d, 0x61, 0x84, 0x3d,
+  0xe8, 0xa7, 0x5d, 0x3d, 0x8b, 0x59, 0x29, 0xbe, 0x37, 0xe3, 0x19, 0xbd,
+  0xee, 0x01, 0x74, 0x3d, 0x22, 0x53, 0xd3, 0xbc, 0x54, 0x80, 0x12, 0x3d,
+  0xbb, 0x54, 0xad, 0xbd, 0x17, 0xa8, 0xe2, 0xbc, 0xbf, 0x2a, 0x61, 0x3c,
+  0x65, 0x8a, 0xba, 0xbd, 0x18, 0x9e, 0x69, 0xbd, 0xb1, 0x63, 0x0c, 0xbe,
+  0x80, 0xc2, 0x1e, 0xbc, 0x93, 0xa5, 0xe5, 0x3d, 0x87, 0xd5, 0x64, 0xbd,
+  0x50, 0x47, 0xb2, 0x3c, 0x40, 0xb0, 0x50, 0x3d, 0xcb, 0x84, 0x8c, 0xbe,
+  0xe7, 0xe9, 0x8c, 0x3d, 0x33, 0xc1, 0xa1, 0x3c, 0x8d, 0xd0, 0x68, 0x3d,
+  0xe8, 0xfc, 0x02, 0x3d, 0x2b, 0x86, 0x42, 0x3b, 0x5b, 0x63, 0x19, 0x3c,
+  0x33, 0xd4, 0x33, 0x3c, 0xef, 0xcd, 0x3a, 0xbd, 0x41, 0x31, 0xc3, 0xbc,
+  0xed, 0x0e, 0xb3, 0x3c, 0xcb, 0x44, 0x96, 0x3d, 0x42, 0x02, 0x98, 0xbb,
+  0x27, 0xb0, 0x7a, 0x3d, 0x49, 0x66, 0xbb, 0xba, 0x55, 0x0d, 0x50, 0xbd,
+  0xd6, 0xf3, 0x12, 0xbe, 0x46, 0x7d, 0x8a, 0xbd, 0x3e, 0x59, 0x47, 0x3d,
+  0x1e, 0x4d, 0xf9, 0x3d, 0x23, 0x69, 0x97, 0xbd, 0x53, 0x07, 0xd4, 0xbd,
+  0xd7, 0xa5, 0x02, 0x3d, 0x99, 0x59, 0x28, 0xbd, 0x8a, 0x0f, 0xdb, 0xbd,
+  0xc5, 0x5c, 0x74, 0xbd, 0xaa, 0xc1, 0x89, 0xbd, 0xb4, 0x64, 0x22, 0x3d,
+  0x1c, 0xc4, 0x8f, 0x3c, 0x9b, 0x0e, 0xea, 0x3d, 0x44, 0xbb, 0x14, 0xbd,
+  0x15, 0x16, 0x3e, 0x3d, 0x91, 0xa5, 0x29, 0xbe, 0x60, 0x1b, 0x34, 0xbd,
+  0x60, 0xcb, 0x0a, 0x3e, 0x3f, 0x22, 0x23, 0x3e, 0x4f, 0x70, 0x6e, 0x3d,
+  0xf5, 0x10, 0xff, 0xbd, 0x4d, 0xa7, 0x58, 0xbd, 0x29, 0x9a, 0x32, 0x3d,
+  0xe6, 0xf9, 0x9f, 0xbd, 0x1f, 0xac, 0x53, 0xbb, 0x4d, 0x3d, 0xc6, 0x3c,
+  0x89, 0x60, 0xef, 0x3c, 0xf0, 0x95, 0x3d, 0x3c, 0xbe, 0x7d, 0x87, 0x3d,
+  0x85, 0x87, 0xbb, 0x3c, 0xb1, 0xb6, 0x02, 0x3d, 0xf4, 0x9c, 0xa3, 0xbd,
+  0xdf, 0xfd, 0xaa, 0xbd, 0xe0, 0xbd, 0x7b, 0xbc, 0x3e, 0x1d, 0x1c, 0x3e,
+  0x3b, 0x0a, 0x10, 0x3d, 0x49, 0xaf, 0x09, 0xbe, 0x5b, 0x29, 0x78, 0x3d,
+  0x58, 0x9f, 0x45, 0xbd, 0x5a, 0xc3, 0xc5, 0x3b, 0x9f, 0xb2, 0x36, 0x3d,
+  0xb1, 0x29, 0x2a, 0x3d, 0x78, 0x5b, 0x12, 0xbb, 0xe7, 0x35, 0x94, 0x3d,
+  0x16, 0x09, 0x9c, 0xbc, 0x07, 0xf3, 0x2b, 0x3d, 0x67, 0xa8, 0xeb, 0xbc,
+  0xc0, 0x2c, 0xa3, 0x3d, 0xdb, 0xd6, 0x61, 0x3d, 0x98, 0x05, 0x5b, 0xbd,
+  0xdb, 0xcb, 0x37, 0x3e, 0xb7, 0xf8, 0xda, 0x3c, 0x93, 0xf9, 0xed, 0x3d,
+  0x7e, 0x49, 0xaf, 0x3d, 0x19, 0x03, 0xa1, 0xbc, 0xae, 0x78, 0x25, 0xbc,
+  0x10, 0xb1, 0xec, 0x3d, 0xf6, 0x56, 0x3e, 0x3d, 0xa1, 0xe2, 0xba, 0x3d,
+  0x68, 0x66, 0xaa, 0x3d, 0xc5, 0xc0, 0x33, 0x3d, 0x81, 0x18, 0x89, 0x3c,
+  0x91, 0x11, 0x78, 0x3c, 0xec, 0xa9, 0x9e, 0xbd, 0x81, 0xbd, 0xbe, 0x3d,
+  0x97, 0xe5, 0x06, 0x3d, 0xef, 0x34, 0x90, 0x3d, 0x56, 0xcc, 0x2e, 0xbd,
+  0x1d, 0x05, 0x23, 0xbe, 0xfb, 0xf3, 0xd0, 0xbb, 0x2b, 0xe5, 0x05, 0x3d,
+  0x74, 0x06, 0x13, 0xbe, 0x48, 0x32, 0x2d, 0x3d, 0x55, 0x38, 0x27, 0xbd,
+  0x7a, 0xa6, 0xee, 0xbd, 0x6a, 0x86, 0x81, 0x3b, 0x5f, 0xe3, 0x81, 0x3d,
+  0xcd, 0xa4, 0x82, 0x3d, 0x91, 0xd8, 0x6f, 0xbb, 0x26, 0x13, 0x28, 0xbe,
+  0x3a, 0x3f, 0x8c, 0x3d, 0x9f, 0x7d, 0xf5, 0x3c, 0x85, 0x65, 0x4b, 0x3e,
+  0xca, 0x94, 0xd7, 0xbb, 0x14, 0x83, 0xac, 0xbd, 0x05, 0xc9, 0x36, 0x3d,
+  0xcc, 0xed, 0x10, 0xbc, 0x9b, 0xe1, 0x2b, 0xbd, 0x1c, 0x61, 0x11, 0xbd,
+  0x09, 0xab, 0xc2, 0xbc, 0xbe, 0x6f, 0xa2, 0x3d, 0x12, 0xca, 0x20, 0xbc,
+  0xf0, 0x1f, 0xcd, 0x3d, 0x40, 0x25, 0x85, 0xbd, 0x5f, 0x6e, 0x76, 0xbb,
+  0x5b, 0xbb, 0x0e, 0xbe, 0xb7, 0xc6, 0x8e, 0x3b, 0x2e, 0x86, 0x3c, 0x3e,
+  0x9f, 0xad, 0xe9, 0x3b, 0x58, 0x09, 0xf1, 0xbc, 0xa5, 0x36, 0x0b, 0xbd,
+  0x40, 0xde, 0xf7, 0x3d, 0x11, 0x1f, 0xaa, 0xbd, 0x53, 0x5b, 0x28, 0xbd,
+  0x9b, 0x14, 0xdc, 0x3d, 0x8b, 0xfc, 0x47, 0xbc, 0xac, 0x36, 0x00, 0x3e,
+  0x61, 0xa6, 0x8f, 0x3d, 0x69, 0x52, 0xaa, 0xbc, 0xc5, 0xb9, 0xf0, 0x3d,
+  0xf2, 0x7c, 0x89, 0x3d, 0x9e, 0xe2, 0x3c, 0xbe, 0xea, 0x16, 0x30, 0x3c,
+  0xb4, 0x64, 0x15, 0x3e, 0xe4, 0x6f, 0x1c, 0x39, 0x21, 0x37, 0xd6, 0xbb,
+  0xd2, 0x67, 0x8d, 0xbd, 0xb1, 0x9b, 0xcc, 0x3c, 0x05, 0xa6, 0xa8, 0xbd,
+  0x2d, 0x63, 0xfe, 0xbd, 0xf6, 0xe4, 0xa2, 0xbb, 0x3a, 0xe1, 0x53, 0xbd,
+  0x40, 0x38, 0xa7, 0x3d, 0x15, 0x3a, 0xac, 0x3d, 0x69, 0x2d, 0xef, 0x3c,
+  0xe3, 0xc2, 0x43, 0xbd, 0x73, 0x83, 0x6e, 0x3d, 0xef, 0xf4, 0x65, 0xbe,
+  0x31, 0x1d, 0x1d, 0x3e, 0x26, 0x23, 0x68, 0xbd, 0x3a, 0x53, 0xbd, 0x3d,
+  0xf2, 0xc3, 0x11, 0xbd, 0x16, 0x4f, 0x11, 0xbd, 0x65, 0xad, 0xcc, 0xbd,
+  0x15, 0x03, 0xc4, 0x3d, 0x75, 0x7b, 0x7a, 0xbc, 0x3f, 0x24, 0x8f, 0xbd,
+  0x94, 0xd5, 0x50, 0xbc, 0xb6, 0x3e, 0x48, 0xbd, 0x97, 0x4e, 0xbf, 0x3d,
+  0x1b, 0xc7, 0x89, 0xbc, 0x65, 0xda, 0xab, 0x3d, 0x54, 0xd8, 0x8c, 0xbc,
+  0xc8, 0x71, 0x26, 0xbe, 0x14, 0xbb, 0xc6, 0xbc, 0xcc, 0x8b, 0xcb, 0x3c,
+  0x8b, 0xa9, 0x8e, 0x3d, 0xd1, 0x23, 0xd8, 0xbc, 0x66, 0x82, 0x92, 0xbd,
+  0x31, 0xac, 0xf8, 0x38, 0xf4, 0x44, 0x2d, 0xbc, 0x29, 0x73, 0x04, 0xbe,
+  0xf2, 0xbb, 0x0a, 0x3d, 0x83, 0x1d, 0xb4, 0x3c, 0xee, 0x02, 0x11, 0x3d,
+  0xd3, 0x62, 0xb0, 0x3c, 0x76, 0x5d, 0x12, 0x3e, 0x83, 0xf1, 0x92, 0x3d,
+  0x7c, 0xf3, 0xdf, 0xbc, 0xca, 0xc2, 0x12, 0xbe, 0xea, 0x12, 0xa4, 0x3d,
+  0xd1, 0xf0, 0xad, 0x3c, 0x82, 0x28, 0xc8, 0x3c, 0x88, 0x0a, 0xee, 0xbc,
+  0xaf, 0xb4, 0xcb, 0xbd, 0xa7, 0xad, 0x11, 0x3d, 0x87, 0xb2, 0x0e, 0xbe,
+  0xf5, 0x1b, 0xc6, 0xbd, 0x54, 0x66, 0x6a, 0x3d, 0xed, 0x81, 0xa9, 0xbc,
+  0x4f, 0xda, 0xe1, 0x3c, 0x93, 0x13, 0x2e, 0xbd, 0x3d, 0x8c, 0x7e, 0x3d,
+  0xd6, 0x1d, 0x8c, 0x3d, 0x49, 0x90, 0x0b, 0xbe, 0x1c, 0x60, 0x81, 0x3c,
+  0x1b, 0x4e, 0x51, 0x3d, 0x90, 0xc8, 0x3d, 0xbd, 0x49, 0x9f, 0xa0, 0x3d,
+  0xd6, 0x9c, 0x3a, 0xbd, 0x46, 0x30, 0xa6, 0xbd, 0x7a, 0xd8, 0x0f, 0x3c,
+  0xfa, 0x89, 0xcb, 0xbd, 0xd5, 0x66, 0xeb, 0xbd, 0x26, 0x73, 0x63, 0xbd,
+  0x38, 0xab, 0xc1, 0x3c, 0x07, 0xe3, 0x8e, 0xbb, 0x8c, 0xf4, 0x57, 0xbc,
+  0xe5, 0xf2, 0x41, 0x3d, 0x0d, 0x0f, 0x22, 0x3d, 0xe7, 0xaf, 0x56, 0xbd,
+  0xb5, 0x78, 0xe5, 0xbc, 0x3d, 0x54, 0xae, 0xbc, 0x74, 0xf6, 0x45, 0xbd,
+  0x61, 0xab, 0xad, 0x3d, 0x99, 0xa1, 0x57, 0xbb, 0x97, 0x8a, 0xc0, 0xbd,
+  0xff, 0xad, 0x16, 0xbd, 0xfe, 0x8d, 0x04, 0xbd, 0x8f, 0xe4, 0x09, 0xbd,
+  0xd1, 0xcc, 0xea, 0xbd, 0x4a, 0xac, 0x7e, 0xbd, 0x46, 0x3b, 0xdf, 0xbc,
+  0x32, 0x8a, 0x81, 0x3c, 0xbd, 0x0e, 0xc8, 0x3d, 0x86, 0x8c, 0x73, 0xbd,
+  0x95, 0x0a, 0xd2, 0x3c, 0xd1, 0x5a, 0x09, 0xbd, 0x54, 0x18, 0x00, 0xbd,
+  0x81, 0x4f, 0xe8, 0x3d, 0xe6, 0x4c, 0x1b, 0x3e, 0xd3, 0x69, 0x88, 0xbd,
+  0x2d, 0x3c, 0x19, 0xbd, 0x2a, 0x0e, 0xe4, 0x3c, 0xe3, 0xc7, 0x9d, 0xbc,
+  0x9e, 0xd2, 0x4d, 0xbd, 0x47, 0x62, 0x6e, 0xbd, 0xb0, 0xab, 0x8c, 0xbc,
+  0xdf, 0xc7, 0xc1, 0x3d, 0xb0, 0xcb, 0x88, 0xb9, 0xd9, 0x84, 0x03, 0x3e,
+  0xc1, 0xf9, 0x59, 0x3d, 0xed, 0x97, 0x8d, 0xbb, 0x68, 0x1d, 0x21, 0xbb,
+  0xb9, 0x11, 0x01, 0xbd, 0xa4, 0x6f, 0x0f, 0xbc, 0xc6, 0x65, 0x5a, 0x3d,
+  0x09, 0x02, 0x72, 0x3d, 0x88, 0xc1, 0xbb, 0xbd, 0x53, 0x6e, 0xf7, 0x3c,
+  0x91, 0x1b, 0x4b, 0x3d, 0x05, 0x6a, 0xb6, 0xbd, 0xc1, 0x9a, 0x4f, 0xbc,
+  0x25, 0x86, 0xb2, 0x3c, 0xb9, 0x0a, 0xc3, 0x3d, 0xe3, 0xe4, 0x7e, 0xba,
+  0x44, 0x07, 0x84, 0x3d, 0x6f, 0x77, 0xf1, 0xbc, 0x17, 0x90, 0xdd, 0xba,
+  0xee, 0xa8, 0xa3, 0xbc, 0xdc, 0xf8, 0x00, 0xbc, 0xa0, 0x63, 0x6c, 0xbd,
+  0xc4, 0x4a, 0x93, 0x3d, 0x5b, 0x5d, 0x35, 0xbc, 0x7c, 0x5e, 0x3d, 0xbd,
+  0xf0, 0x37, 0x43, 0xbd, 0xfd, 0x1e, 0x71, 0x3d, 0xa5, 0x6f, 0xf7, 0xbc,
+  0x13, 0xef, 0x81, 0x3d, 0xfe, 0xc0, 0xe1, 0xbd, 0x37, 0xc3, 0x53, 0xbd,
+  0x8a, 0x4a, 0x6c, 0xbd, 0xc4, 0x21, 0x9d, 0x3b, 0x50, 0x9d, 0x71, 0x3c,
+  0xbb, 0xb1, 0x55, 0xbd, 0x4f, 0xee, 0x1a, 0xbd, 0xe1, 0x7a, 0x3c, 0x3d,
+  0xe4, 0x80, 0x16, 0xbc, 0x60, 0x71, 0x12, 0x3d, 0xc0, 0x2a, 0x29, 0xbe,
+  0x00, 0x62, 0x12, 0xbe, 0x08, 0x06, 0x7b, 0xbb, 0xf3, 0x4a, 0x7d, 0x3b,
+  0x9b, 0xa5, 0x0f, 0xbd, 0xec, 0x23, 0x18, 0xbc, 0x10, 0x6e, 0x12, 0x3d,
+  0xd0, 0x83, 0x4d, 0x3d, 0x5c, 0x5b, 0x38, 0x3d, 0x7d, 0xec, 0xcf, 0x3d,
+  0x69, 0x92, 0xbe, 0xbd, 0x22, 0x87, 0x28, 0xbd, 0x35, 0x3c, 0x17, 0xbe,
+  0x8f, 0xe1, 0x09, 0xbd, 0x8b, 0x6b, 0x95, 0x3d, 0x26, 0x20, 0xb0, 0x3d,
+  0x4c, 0x39, 0x72, 0xbc, 0x3c, 0xc0, 0x2b, 0xbe, 0x98, 0xc8, 0xe7, 0x3c,
+  0xa2, 0x92, 0xac, 0xbd, 0x70, 0xad, 0xe2, 0xbc, 0xb3, 0x5f, 0x24, 0xbd,
+  0x62, 0xe4, 0xd4, 0xbd, 0x27, 0x6d, 0xa1, 0x3c, 0x7e, 0xb0, 0x21, 0xbd,
+  0xf7, 0x78, 0xc5, 0x3d, 0x53, 0xa8, 0x7f, 0xbd, 0x94, 0xdc, 0x62, 0xbb,
+  0xfb, 0x82, 0x41, 0xbe, 0xeb, 0x1c, 0xdd, 0xbc, 0xb1, 0x99, 0x97, 0xbd,
+  0xb5, 0x06, 0xf0, 0x3d, 0xaf, 0xf4, 0xef, 0xbb, 0x8b, 0xba, 0x4d, 0x3d,
+  0xee, 0xdc, 0x60, 0x3d, 0x17, 0x3c, 0x49, 0x3d, 0x22, 0x48, 0xe5, 0xbb,
+  0xb2, 0x7d, 0xc5, 0x3b, 0x66, 0x8e, 0x14, 0xbc, 0x66, 0x4b, 0x63, 0xbb,
+  0x10, 0x1b, 0x60, 0x3d, 0x07, 0x6d, 0xc8, 0x3d, 0x63, 0x59, 0x41, 0xbd,
+  0x94, 0x67, 0x18, 0x3d, 0x4f, 0x15, 0x27, 0xbe, 0x29, 0x61, 0x1d, 0x3d,
+  0xab, 0x25, 0x2d, 0x3d, 0x6d, 0xa1, 0x9c, 0x3d, 0x63, 0xc4, 0x03, 0xbd,
+  0xe8, 0x75, 0x06, 0xbe, 0xb6, 0x95, 0x37, 0xbd, 0x73, 0x01, 0x0c, 0x3d,
+  0x11, 0xfd, 0x64, 0xbd, 0x94, 0x32, 0x5b, 0x3d, 0xd1, 0xac, 0x97, 0xbd,
+  0xc4, 0x17, 0x97, 0x3d, 0xd8, 0x8d, 0xf5, 0xbb, 0xa4, 0x82, 0x4e, 0x3d,
+  0xc0, 0x49, 0xcb, 0x3c, 0xf7, 0x0d, 0xaa, 0xbd, 0x45, 0x42, 0x89, 0xbe,
+  0x97, 0x33, 0x8b, 0x3d, 0x4b, 0x88, 0x88, 0x3c, 0x44, 0x9c, 0xd7, 0x3d,
+  0x40, 0xbf, 0x3e, 0xbc, 0xaf, 0x8d, 0x08, 0xbe, 0xc3, 0xd3, 0x90, 0xbc,
+  0xc3, 0xd7, 0x75, 0x3c, 0x34, 0xac, 0xb0, 0xbd, 0x5c, 0xbe, 0x85, 0xbd,
+  0x74, 0x92, 0x28, 0xbd, 0x30, 0x85, 0x05, 0xbc, 0xf5, 0x55, 0x6f, 0xbc,
+  0xc6, 0xf1, 0x02, 0x3e, 0xba, 0xb3, 0x7f, 0xbd, 0x30, 0x60, 0x50, 0xbd,
+  0x30, 0x02, 0x42, 0xbd, 0x6d, 0xcd, 0x9d, 0x3c, 0x85, 0xec, 0x97, 0x3d,
+  0x74, 0x29, 0xfc, 0x3d, 0xea, 0x50, 0xaf, 0xbc, 0x97, 0x86, 0x7a, 0x3d,
+  0x03, 0xd3, 0x9d, 0x3d, 0xb9, 0x36, 0xc3, 0xbd, 0x16, 0x39, 0xf6, 0xbd,
+  0xdc, 0x31, 0x53, 0x3c, 0x1b, 0xa6, 0xb8, 0xbd, 0x38, 0x77, 0xd2, 0x3d,
+  0xf5, 0x47, 0xe8, 0x3c, 0x79, 0x61, 0x9b, 0x3d, 0x97, 0x30, 0xaa, 0x3d,
+  0x99, 0x73, 0xe4, 0xbd, 0xb9, 0x84, 0x4b, 0xbd, 0xf1, 0x44, 0x18, 0x3d,
+  0xb1, 0x85, 0x44, 0xbd, 0x0a, 0x6c, 0xee, 0x3d, 0x5b, 0xed, 0xb7, 0xbd,
+  0x67, 0xcf, 0xb2, 0x3b, 0xee, 0x75, 0x1e, 0x3d, 0x95, 0xd6, 0x2f, 0x3c,
+  0x2c, 0xc4, 0x84, 0xbd, 0xd0, 0xc8, 0xb1, 0x3d, 0x88, 0xd2, 0x2e, 0x3d,
+  0x9b, 0x5b, 0x9a, 0x3d, 0xb4, 0x99, 0x34, 0x3d, 0x5e, 0xcd, 0xe0, 0xbb,
+  0xce, 0x5a, 0x1b, 0xbd, 0x25, 0x99, 0xbb, 0xbd, 0x8f, 0xc8, 0xb5, 0xbc,
+  0xb4, 0x53, 0x9c, 0x3d, 0x69, 0x78, 0x79, 0x3c, 0xa0, 0x81, 0x83, 0x3d,
+  0xc9, 0x74, 0x94, 0x3d, 0xaa, 0x60, 0x55, 0xbb, 0xba, 0x38, 0x21, 0xbd,
+  0x97, 0xc5, 0x56, 0xbd, 0x32, 0x66, 0xd8, 0xbd, 0x33, 0x11, 0xde, 0xbd,
+  0x15, 0x11, 0x7e, 0xbd, 0xb1, 0x3d, 0x9d, 0x3d, 0x66, 0xfc, 0xa5, 0x3c,
+  0x0c, 0x42, 0x87, 0x3d, 0x28, 0x68, 0x7c, 0xbd, 0x36, 0xec, 0x1a, 0xbd,
+  0xaa, 0xf7, 0x5e, 0x3d, 0x69, 0x13, 0xa6, 0x3b, 0xd5, 0xf6, 0x6b, 0x3d,
+  0x54, 0xb0, 0x1b, 0x3e, 0xfc, 0x7a, 0xd7, 0xbd, 0x61, 0x0c, 0x9c, 0xbd,
+  0x5e, 0x8d, 0xdf, 0x3c, 0xbd, 0xf7, 0x61, 0x3b, 0x99, 0xa6, 0x4f, 0xbd,
+  0x34, 0x21, 0xb5, 0xbd, 0xed, 0x78, 0xe8, 0xbb, 0xe2, 0x0b, 0x6b, 0x3d,
+  0x86, 0xdf, 0x08, 0xbd, 0x07, 0xe3, 0xaf, 0x3c, 0xc5, 0x95, 0xc1, 0x3d,
+  0x31, 0x0b, 0x02, 0xbc, 0x4b, 0x37, 0xc6, 0x3a, 0xea, 0xfb, 0xc5, 0x3c,
+  0xd3, 0x8a, 0x6d, 0x3c, 0xf5, 0x81, 0x87, 0x3d, 0xa7, 0x84, 0x17, 0x3d,
+  0x4e, 0x5b, 0x4c, 0xbd, 0x02, 0x93, 0x2e, 0x3c, 0x44, 0x75, 0x33, 0xbd,
+  0x8e, 0x0e, 0x09, 0xbd, 0xbf, 0x70, 0x42, 0xbd, 0xc8, 0xe9, 0x66, 0xbd,
+  0x82, 0x8d, 0x4c, 0x3d, 0xc8, 0x73, 0x7a, 0x3c, 0xb4, 0x72, 0x4e, 0x3b,
+  0xc5, 0x5d, 0x70, 0xbc, 0x23, 0x0b, 0x98, 0xbd, 0xbe, 0xfd, 0x11, 0xbe,
+  0xce, 0x2f, 0x07, 0xbd, 0x38, 0xae, 0x87, 0x3d, 0x5c, 0x46, 0x0b, 0x3e,
+  0x15, 0xfc, 0x44, 0xbd, 0xd6, 0xe6, 0x1b, 0xbc, 0x2e, 0xc8, 0x85, 0xbd,
+  0x62, 0x66, 0x1b, 0x3d, 0x29, 0xe0, 0xb9, 0xbd, 0x4c, 0x9b, 0xa8, 0xbd,
+  0x80, 0x95, 0xb1, 0xbd, 0x82, 0x86, 0x78, 0x3d, 0x1e, 0x7e, 0xbb, 0xbb,
+  0xcd, 0x1b, 0xa8, 0x3d, 0xa1, 0x73, 0x84, 0xbd, 0x9e, 0x33, 0x90, 0xbd,
+  0xb2, 0x4c, 0x88, 0xbd, 0xe1, 0x68, 0x3e, 0x3d, 0x24, 0xb3, 0x34, 0x3d,
+  0x31, 0xb0, 0xa7, 0x3d, 0x40, 0xc5, 0xc1, 0x3d, 0x06, 0x3e, 0x44, 0xbd,
+  0xc3, 0xd0, 0x8f, 0xbd, 0x4c, 0x26, 0x8c, 0x3d, 0x18, 0xed, 0xc3, 0xbd,
+  0x34, 0x5d, 0x59, 0xbd, 0x33, 0xcf, 0x0d, 0x3d, 0xe9, 0x5f, 0xf1, 0xbc,
+  0x63, 0xe5, 0x96, 0x3d, 0xdb, 0x6b, 0xa2, 0xbc, 0xab, 0x31, 0x25, 0xbb,
+  0xd0, 0xa5, 0xde, 0x3c, 0xc6, 0xe7, 0xf9, 0xbd, 0x67, 0x3b, 0x38, 0x3d,
+  0x0f, 0x78, 0x2a, 0x3c, 0x34, 0xa4, 0xd0, 0x3d, 0xd4, 0xfb, 0x61, 0xbd,
+  0x14, 0xbb, 0xe7, 0x3d, 0xd7, 0x1c, 0x9a, 0x3d, 0x8b, 0x6c, 0x83, 0x3b,
+  0x47, 0xaf, 0xa9, 0x3c, 0x6b, 0x1c, 0x85, 0xbd, 0x74, 0x2f, 0x92, 0xbd,
+  0xa2, 0x85, 0xb5, 0x3a, 0xd6, 0x0f, 0xc0, 0xbd, 0x50, 0x1d, 0xdd, 0x3d,
+  0xbf, 0x7c, 0xa5, 0x3d, 0x6b, 0x26, 0x2f, 0xbc, 0x9b, 0x39, 0x70, 0xbd,
+  0x6c, 0x56, 0x2c, 0xbb, 0x68, 0xd2, 0x36, 0xbd, 0x6a, 0xd9, 0x3a, 0x3d,
+  0x97, 0x62, 0x25, 0xbe, 0xef, 0x0f, 0x0c, 0xbe, 0x9a, 0x85, 0xe6, 0xbd,
+  0xdf, 0xce, 0x95, 0x3d, 0x56, 0x27, 0x8a, 0xbc, 0x30, 0x1d, 0x4f, 0x38,
+  0xb2, 0x13, 0x03, 0xbe, 0x76, 0x3c, 0xb9, 0xbd, 0x32, 0x2a, 0xf7, 0x3c,
+  0x06, 0x9d, 0xa6, 0x3d, 0x40, 0xb3, 0x5a, 0xbc, 0xc0, 0x68, 0x31, 0xbd,
+  0x28, 0x2f, 0x37, 0xbe, 0x99, 0x13, 0x4e, 0x3d, 0x72, 0xde, 0xc8, 0x3c,
+  0xa1, 0xf9, 0xe1, 0x3d, 0xd5, 0xa7, 0xac, 0x39, 0x56, 0x08, 0x09, 0xbd,
+  0x79, 0x88, 0x51, 0xbd, 0xeb, 0x95, 0xa3, 0x3a, 0xa7, 0xfa, 0x15, 0xbe,
+  0xf8, 0x10, 0xd6, 0x3c, 0xe4, 0x08, 0x88, 0xbc, 0x41, 0x0a, 0x91, 0x3d,
+  0xde, 0xb9, 0xa0, 0xbb, 0x73, 0x68, 0x3c, 0x3d, 0x35, 0x3a, 0x01, 0x3d,
+  0x59, 0x69, 0x9a, 0xbb, 0x27, 0x5e, 0xb7, 0xbd, 0x8e, 0x84, 0xbf, 0x3d,
+  0x32, 0xb5, 0xf6, 0x3d, 0x49, 0x52, 0x94, 0x3d, 0x59, 0x39, 0x94, 0xbd,
+  0x61, 0x60, 0x04, 0xbd, 0xef, 0xe4, 0x3f, 0x3c, 0x3a, 0x3d, 0x13, 0xbc,
+  0x84, 0x06, 0xa4, 0xbd, 0x0d, 0x99, 0xbc, 0x3d, 0x0e, 0xff, 0x2f, 0x3d,
+  0xaf, 0x61, 0x60, 0x3d, 0x93, 0xe1, 0x6f, 0x3d, 0x11, 0x6f, 0x15, 0xbd,
+  0xfb, 0xc5, 0xfc, 0xbb, 0x6b, 0xfb, 0xcb, 0xbc, 0x08, 0xd5, 0x52, 0xbd,
+  0xbb, 0x86, 0x38, 0x3d, 0xc9, 0x6a, 0x01, 0x3d, 0xfd, 0xf1, 0x0b, 0x3c,
+  0xd9, 0xda, 0x23, 0xbd, 0xa8, 0xf8, 0xa1, 0xbd, 0x31, 0xeb, 0x6a, 0xbd,
+  0x1c, 0xe0, 0x9f, 0xbd, 0xbb, 0x0f, 0xc5, 0xbd, 0x81, 0x4d, 0xd3, 0xbd,
+  0xe9, 0x44, 0xf8, 0xbc, 0xdb, 0xdd, 0xfb, 0x3d, 0xbc, 0x1d, 0x52, 0x3d,
+  0x9b, 0x37, 0xc7, 0x3d, 0xfe, 0x1d, 0x3c, 0x3c, 0x50, 0x25, 0xe1, 0xbc,
+  0xe4, 0x88, 0xee, 0xbd, 0x92, 0xd9, 0x46, 0xbd, 0xfb, 0xff, 0x10, 0x3e,
+  0x6d, 0x25, 0xf4, 0x3d, 0xd1, 0x2f, 0xf2, 0xbb, 0x90, 0xc4, 0x93, 0xbd,
+  0x55, 0xd7, 0x6f, 0x3d, 0x1e, 0xe4, 0x15, 0x3d, 0x93, 0xb2, 0x81, 0xbd,
+  0xf3, 0x2a, 0xc7, 0xbd, 0x67, 0x01, 0xb5, 0xbd, 0xd8, 0x11, 0x1e, 0xbc,
+  0x22, 0xbe, 0xfb, 0xbb, 0x16, 0xf2, 0x7d, 0x3d, 0x1e, 0x7e, 0x4f, 0x3c,
+  0x1f, 0x62, 0x8b, 0xbd, 0x49, 0x02, 0x4d, 0xbe, 0xd8, 0xd7, 0xc4, 0x3c,
+  0x4e, 0x26, 0xce, 0x3c, 0x46, 0x89, 0xe5, 0x3d, 0x49, 0x0e, 0x86, 0xbc,
+  0x9d, 0x33, 0x96, 0x3d, 0x48, 0x09, 0xef, 0x3d, 0xcb, 0x61, 0x78, 0x3d,
+  0x65, 0x5a, 0xd5, 0xbd, 0xa6, 0xac, 0x8c, 0xbd, 0x0e, 0xb6, 0x5e, 0x3d,
+  0xa2, 0x54, 0x3e, 0x3d, 0xd6, 0x76, 0xc5, 0x3d, 0x0c, 0xe8, 0x65, 0x3d,
+  0x13, 0xed, 0xa5, 0x3d, 0x55, 0x07, 0x73, 0xbc, 0xc3, 0xab, 0x15, 0xbc,
+  0x42, 0xc2, 0x74, 0x3a, 0xc6, 0xf7, 0x16, 0x3e, 0xd4, 0xc4, 0x0c, 0x3d,
+  0x42, 0x45, 0xf4, 0xbd, 0xd5, 0x4c, 0xe5, 0xbd, 0x44, 0x8e, 0xaa, 0x3d,
+  0xad, 0xb3, 0x53, 0x3c, 0x90, 0xbb, 0xd6, 0xbd, 0xa6, 0x85, 0x96, 0xbc,
+  0x59, 0x72, 0x16, 0x3e, 0xc4, 0xc9, 0x6f, 0x3c, 0x44, 0x9f, 0xa4, 0x3d,
+  0xc3, 0x30, 0xa7, 0x3c, 0xfc, 0x4a, 0xa9, 0x3c, 0x9e, 0x20, 0xc3, 0xbd,
+  0x6e, 0x94, 0x5e, 0x3c, 0x5a, 0x57, 0xe3, 0x3d, 0x19, 0x1b, 0xfc, 0x3c,
+  0x58, 0x26, 0x4b, 0x3c, 0x5f, 0x4d, 0x96, 0xbd, 0x8e, 0xc7, 0xb9, 0xbd,
+  0xda, 0x12, 0x9f, 0x3d, 0x06, 0x91, 0x68, 0xbd, 0x65, 0x0f, 0xd1, 0xbc,
+  0xf7, 0x4c, 0x96, 0xbd, 0x9d, 0x54, 0x47, 0x39, 0xfd, 0x6e, 0x19, 0x3d,
+  0x3e, 0x47, 0xcd, 0x3c, 0x51, 0x49, 0x87, 0x3d, 0x61, 0xd6, 0x5d, 0x3c,
+  0xed, 0xea, 0x6e, 0xbd, 0xf6, 0x42, 0x52, 0xbd, 0x3f, 0x45, 0xa1, 0x3b,
+  0x8e, 0x8b, 0xae, 0xbd, 0x49, 0x92, 0xc1, 0x3d, 0xe8, 0xe1, 0xd9, 0xbd,
+  0xaf, 0x86, 0xd0, 0xbd, 0x0e, 0xf1, 0x61, 0xbd, 0xdf, 0xeb, 0x2e, 0xbd,
+  0x69, 0x91, 0x8e, 0xbd, 0x69, 0xe1, 0x4a, 0xbc, 0x92, 0x2b, 0x02, 0x3d,
+  0xe3, 0x52, 0x99, 0x3d, 0x85, 0x53, 0x16, 0xbd, 0xa4, 0x09, 0xfa, 0x3b,
+  0xde, 0x9d, 0x83, 0x3d, 0x8f, 0xe4, 0x91, 0xbd, 0x61, 0x39, 0x77, 0xbe,
+  0x43, 0x25, 0x0d, 0x3d, 0x10, 0x81, 0xc7, 0x3d, 0xe4, 0x93, 0x1a, 0x3e,
+  0x5a, 0x5d, 0xaa, 0xbd, 0x4a, 0xc7, 0xc3, 0x3c, 0xf3, 0x0c, 0xba, 0x3d,
+  0x93, 0x6e, 0xba, 0xbc, 0x3c, 0x77, 0xf8, 0xbd, 0x64, 0x49, 0x89, 0xbd,
+  0x43, 0xd9, 0xa4, 0xbb, 0xe5, 0xe2, 0x47, 0x3d, 0xcc, 0xdc, 0x60, 0x3d,
+  0xc5, 0x85, 0x14, 0x3e, 0x39, 0x0c, 0x60, 0x3c, 0x91, 0x93, 0x7c, 0x3d,
+  0x0c, 0x7a, 0x52, 0x3d, 0x1c, 0x61, 0x03, 0xbb, 0xc6, 0x49, 0x68, 0x3d,
+  0x19, 0x87, 0x36, 0x3d, 0x60, 0x40, 0x34, 0x3d, 0x08, 0x52, 0x0b, 0xbe,
+  0xe7, 0x60, 0x0d, 0xbd, 0x87, 0xe3, 0x60, 0xbd, 0xb5, 0x03, 0x91, 0xbb,
+  0xe1, 0x1e, 0x5a, 0xbd, 0x3d, 0xba, 0x01, 0xbb, 0xcd, 0x66, 0x03, 0x3c,
+  0x50, 0x29, 0x3c, 0x3c, 0xa4, 0xd2, 0xaa, 0x3c, 0xbd, 0xe6, 0x89, 0x3d,
+  0x5b, 0x23, 0x35, 0xbd, 0x6b, 0x06, 0xab, 0xbc, 0xc8, 0x0e, 0x9a, 0x3c,
+  0x82, 0x72, 0x3a, 0x3d, 0x53, 0x41, 0x27, 0x3d, 0xb8, 0xa5, 0x13, 0x3d,
+  0x23, 0xaf, 0x0d, 0xbc, 0xd9, 0x7c, 0x46, 0xbb, 0x5d, 0x28, 0x0a, 0xbc,
+  0x0e, 0x58, 0xa9, 0xbd, 0xe7, 0xba, 0xe0, 0xbc, 0xc1, 0x5d, 0xd0, 0xbd,
+  0xd9, 0xd1, 0x8a, 0xbc, 0x16, 0xd9, 0x3f, 0xbd, 0x90, 0xa1, 0xa6, 0x3d,
+  0xde, 0xe5, 0x8b, 0x3d, 0x63, 0xcb, 0xd6, 0xbd, 0x78, 0x06, 0x3e, 0xbd,
+  0xaa, 0x48, 0x06, 0x3d, 0x9c, 0x65, 0xc2, 0xbd, 0x4b, 0x0b, 0xf2, 0x3d,
+  0x80, 0xb6, 0x85, 0xbd, 0x17, 0x3e, 0x14, 0xbe, 0x4c, 0x6b, 0x3c, 0xbd,
+  0xf4, 0x73, 0xe1, 0xbc, 0xbd, 0x0b, 0x0a, 0xbd, 0x88, 0xb3, 0x47, 0xba,
+  0xb2, 0xd2, 0x18, 0xbe, 0xda, 0x0b, 0x20, 0xbc, 0x62, 0x0e, 0xab, 0x3c,
+  0x5c, 0x79, 0x8e, 0x3d, 0x49, 0x4c, 0x84, 0x3c, 0x59, 0x53, 0x31, 0x3d,
+  0xf5, 0xda, 0x4d, 0xbe, 0x1c, 0x5e, 0x86, 0xbc, 0xad, 0x7b, 0xc2, 0xbc,
+  0x85, 0x00, 0xca, 0x3d, 0x41, 0x33, 0x00, 0x3d, 0x39, 0x1f, 0x26, 0xbe,
+  0x9d, 0x2f, 0xaa, 0xbd, 0x09, 0xfa, 0xeb, 0xbc, 0x13, 0xb8, 0xf4, 0xbd,
+  0xb9, 0xc6, 0x29, 0xbb, 0x11, 0xae, 0x09, 0xbe, 0xb3, 0xea, 0xf2, 0xbc,
+  0x87, 0x5f, 0x1e, 0xbc, 0x43, 0xa8, 0xf2, 0xbc, 0xf9, 0xf5, 0xb4, 0xbc,
+  0x2f, 0xd1, 0x2c, 0x3c, 0x97, 0x27, 0x8a, 0xbd, 0x47, 0x4b, 0xac, 0x3d,
+  0xe5, 0xf4, 0xc1, 0x3d, 0xe8, 0xe6, 0xb5, 0x3d, 0xaf, 0x92, 0x4e, 0x3d,
+  0xe0, 0xcd, 0x81, 0x3c, 0x0c, 0x7d, 0xa3, 0xbd, 0x10, 0xe1, 0x89, 0x3c,
+  0x7a, 0x0d, 0xd2, 0xbb, 0xb6, 0xd6, 0xa6, 0xbc, 0x8c, 0x4d, 0x90, 0xbd,
+  0x62, 0x33, 0x12, 0x3d, 0x79, 0xa4, 0x74, 0x3d, 0x15, 0x94, 0xba, 0x3d,
+  0xbd, 0x6e, 0xa1, 0x3c, 0x92, 0x4c, 0x97, 0x3c, 0x78, 0x7d, 0xb8, 0xbc,
+  0xe2, 0xd6, 0xad, 0x3b, 0x1c, 0x54, 0x03, 0xbc, 0x75, 0xae, 0x03, 0x3e,
+  0x3d, 0x9b, 0x01, 0xbc, 0x1e, 0xb0, 0x82, 0xbd, 0x54, 0x19, 0x41, 0x3d,
+  0x0c, 0x8d, 0xa7, 0xbc, 0x69, 0xf3, 0xef, 0xbd, 0x7b, 0xd2, 0xa3, 0xbd,
+  0xf4, 0x62, 0x92, 0xbd, 0x75, 0x6c, 0x64, 0x3d, 0xc5, 0xcd, 0xd6, 0x3c,
+  0x06, 0x3b, 0x93, 0xbb, 0x52, 0x17, 0xf1, 0x3c, 0x9f, 0x95, 0x39, 0xbd,
+  0x17, 0x73, 0xcb, 0xbd, 0x42, 0x6f, 0x01, 0x3e, 0xd2, 0x6a, 0x2f, 0x3e,
+  0x98, 0x96, 0x73, 0x3c, 0x05, 0x0f, 0x8e, 0xbc, 0x9c, 0xa6, 0x85, 0xbe,
+  0x71, 0xd4, 0x8a, 0xbd, 0x95, 0xaf, 0x91, 0xbc, 0x20, 0x17, 0xdf, 0xbc,
+  0x04, 0xe2, 0x4a, 0xbd, 0xa6, 0x62, 0x96, 0x3c, 0x66, 0x9b, 0xd8, 0xbb,
+  0x25, 0x92, 0xe7, 0x3d, 0x6d, 0xa7, 0x89, 0x3d, 0xff, 0x2a, 0xc1, 0x3d,
+  0xf7, 0xac, 0x77, 0xbb, 0xea, 0xd3, 0x13, 0xbe, 0x75, 0xc9, 0x9c, 0x3d,
+  0xfd, 0x2c, 0xa7, 0x3d, 0x09, 0x0f, 0x13, 0x3e, 0x7d, 0x2c, 0x30, 0x3d,
+  0x35, 0x3c, 0xbb, 0xbd, 0xfa, 0xb4, 0xe2, 0xbc, 0x8f, 0x4f, 0xb3, 0xbd,
+  0x0a, 0xf9, 0x73, 0xbd, 0x69, 0x27, 0xa3, 0x3c, 0x15, 0xc4, 0xcf, 0xbd,
+  0x80, 0x33, 0x3b, 0xbc, 0x68, 0xed, 0x86, 0x3d, 0x5a, 0xbf, 0x2a, 0x3e,
+  0x1c, 0xda, 0xe3, 0x3c, 0x8a, 0x27, 0xea, 0xbc, 0x48, 0x62, 0x07, 0xbe,
+  0x8a, 0xa0, 0x9f, 0x3d, 0xef, 0x36, 0x23, 0xbd, 0x2d, 0x03, 0x40, 0x3d,
+  0xd2, 0xa2, 0x05, 0xbe, 0x6d, 0xba, 0x86, 0xbd, 0xb8, 0x53, 0x77, 0x3d,
+  0x8d, 0x70, 0x73, 0xbc, 0xfb, 0x9c, 0x9a, 0x3c, 0xcb, 0xbc, 0x20, 0xbd,
+  0x80, 0xa4, 0x75, 0x3c, 0xbd, 0xf6, 0xa2, 0x3b, 0xe4, 0x39, 0xc0, 0xbc,
+  0x31, 0xb4, 0xc8, 0x3d, 0xd9, 0x1a, 0x47, 0xbd, 0xaf, 0x79, 0x9a, 0xbd,
+  0xf3, 0xb0, 0x30, 0xbd, 0x29, 0xca, 0x08, 0x3c, 0xbe, 0xbb, 0x18, 0x3e,
+  0xc8, 0xb6, 0x98, 0x3d, 0x39, 0x92, 0x85, 0xbd, 0x14, 0xae, 0x06, 0xbd,
+  0xa4, 0x57, 0x78, 0xbb, 0x0f, 0x81, 0x4a, 0xbd, 0x81, 0xb2, 0x86, 0xbd,
+  0x26, 0x92, 0x80, 0xbd, 0xd9, 0xbc, 0x01, 0x3c, 0xf9, 0x57, 0x86, 0x3d,
+  0xd9, 0xf7, 0x6b, 0x3d, 0xee, 0x3a, 0x94, 0x3d, 0xfb, 0xad, 0x16, 0x3d,
+  0x9b, 0x6b, 0x5a, 0xbd, 0xb8, 0x34, 0xdd, 0x3d, 0xc9, 0x04, 0xb0, 0x3c,
+  0xbb, 0xd1, 0x29, 0x3d, 0xad, 0x3e, 0x14, 0x3e, 0xe4, 0x39, 0x98, 0xbd,
+  0x18, 0x04, 0xdc, 0xbc, 0xd2, 0xe2, 0xc4, 0xbd, 0xf7, 0x84, 0x03, 0x3d,
+  0x01, 0x9a, 0x0b, 0xbd, 0xf5, 0xd1, 0xc2, 0xbc, 0x55, 0xa3, 0x70, 0x3d,
+  0x26, 0xec, 0x6c, 0xbd, 0xa8, 0x81, 0x63, 0xbd, 0xa5, 0x5f, 0xc5, 0x3c,
+  0x0a, 0xdf, 0x25, 0xbd, 0xa5, 0x86, 0x1d, 0x3c, 0x0f, 0x9b, 0x49, 0xbd,
+  0x08, 0x33, 0x49, 0xbd, 0xc0, 0x1c, 0xfe, 0x3d, 0xa6, 0x48, 0x17, 0x3d,
+  0xe5, 0xf8, 0x3c, 0xbd, 0x67, 0x19, 0x03, 0xbe, 0x4d, 0x1c, 0x74, 0xbd,
+  0x63, 0xe8, 0x30, 0xbd, 0xf1, 0x38, 0x4f, 0xbd, 0x87, 0x84, 0x7e, 0xbd,
+  0x0a, 0x3d, 0x94, 0xbd, 0x9b, 0x00, 0xb2, 0x3d, 0x2d, 0x9c, 0x21, 0xbd,
+  0x60, 0xab, 0xfc, 0x3d, 0x0b, 0xd8, 0x0f, 0xbd, 0xb8, 0x3b, 0xf8, 0xbc,
+  0x89, 0x1d, 0x0b, 0xbc, 0xf8, 0x0b, 0xce, 0xbd, 0x96, 0x9d, 0x5c, 0x3d,
+  0x8b, 0x09, 0x0e, 0x3e, 0x1b, 0x49, 0x6e, 0xbd, 0x8e, 0x8d, 0x1d, 0xbe,
+  0xf2, 0x64, 0x07, 0xbd, 0xcc, 0xab, 0xa6, 0x3d, 0x8f, 0x37, 0x60, 0xbd,
+  0x5d, 0x0f, 0x65, 0x3c, 0x56, 0x38, 0x03, 0x3e, 0xaa, 0x61, 0xd3, 0x3d,
+  0x6e, 0xa9, 0x2a, 0x3d, 0xc7, 0x09, 0xeb, 0x3c, 0x6d, 0x05, 0x7d, 0x3d,
+  0xf6, 0xea, 0x85, 0xbc, 0xb8, 0xd6, 0x17, 0xbd, 0xff, 0xdb, 0x99, 0xbd,
+  0x9f, 0x00, 0x91, 0xbd, 0xa1, 0x15, 0x86, 0x3d, 0xce, 0xea, 0x04, 0x3c,
+  0x4c, 0x73, 0x98, 0xbc, 0x02, 0x2c, 0xb1, 0x3b, 0xd9, 0xe7, 0x08, 0x3c,
+  0x30, 0xc4, 0xf1, 0xbc, 0x19, 0x9b, 0xf1, 0x3c, 0x73, 0xd5, 0x11, 0x3d,
+  0x19, 0x66, 0xff, 0xbc, 0x38, 0xd6, 0x5b, 0x3d, 0xf9, 0x49, 0xb5, 0x3d,
+  0xd9, 0x1d, 0x66, 0x3d, 0xa8, 0x82, 0x61, 0xbc, 0x92, 0x4e, 0xc4, 0x3d,
+  0x96, 0x09, 0x30, 0x3d, 0xae, 0x70, 0x22, 0xbb, 0xc8, 0xba, 0x92, 0x3d,
+  0x8f, 0xb5, 0x12, 0xbd, 0xa4, 0xec, 0x58, 0xbc, 0xbe, 0x22, 0x9c, 0xbb,
+  0x55, 0x8d, 0x54, 0x3c, 0xa1, 0x71, 0x54, 0x3c, 0x50, 0x97, 0xe0, 0x3c,
+  0xd9, 0xa2, 0x91, 0xbc, 0x4d, 0x81, 0x1e, 0x3b, 0xa8, 0xbd, 0x81, 0x3d,
+  0x75, 0xbc, 0xb2, 0x3d, 0x9b, 0x1f, 0x11, 0x3d, 0xbe, 0x21, 0x0a, 0xbc,
+  0x5e, 0x75, 0x36, 0x3d, 0x1a, 0xcf, 0xc1, 0x3c, 0xd0, 0x35, 0x1c, 0x3d,
+  0x7f, 0x12, 0x07, 0x3e, 0xbd, 0x2e, 0xfb, 0xbc, 0xeb, 0x74, 0xd8, 0x3b,
+  0x15, 0xc0, 0x9e, 0xbd, 0x71, 0xe4, 0x97, 0x3d, 0x95, 0x66, 0xbb, 0xbd,
+  0xa3, 0x15, 0xe1, 0xbb, 0x36, 0x13, 0x68, 0xbc, 0xce, 0x34, 0xeb, 0xbb,
+  0x7a, 0x60, 0x2a, 0xbd, 0x3d, 0x1a, 0xbc, 0x3d, 0x0f, 0xc8, 0x12, 0xbd,
+  0xbd, 0x64, 0x67, 0x3d, 0xf8, 0xa8, 0x2c, 0xbe, 0x3b, 0x63, 0xe9, 0xbc,
+  0xca, 0x20, 0x3b, 0x3d, 0xbb, 0xd0, 0x36, 0xbb, 0x6b, 0x75, 0x00, 0x3d,
+  0x78, 0xaf, 0x17, 0xbd, 0x63, 0xc2, 0xbf, 0x3b, 0x19, 0xa8, 0x48, 0x3d,
+  0x5e, 0xd5, 0x81, 0xbd, 0x4f, 0x9a, 0xf7, 0x3c, 0x31, 0x2a, 0x48, 0xbc,
+  0xa8, 0x33, 0x64, 0xbc, 0xd7, 0x7c, 0xbf, 0x3b, 0x2c, 0x71, 0xfb, 0x3d,
+  0x55, 0x3d, 0x81, 0x3d, 0x36, 0xfb, 0xaf, 0xbd, 0xef, 0xdf, 0xa1, 0xbd,
+  0x73, 0x3d, 0x1d, 0xbd, 0x4e, 0x6f, 0xaa, 0x3d, 0xaf, 0x22, 0x33, 0x3d,
+  0xbe, 0xad, 0x69, 0xbd, 0xf8, 0x68, 0x9f, 0xbd, 0x98, 0x38, 0x8b, 0xbc,
+  0xcb, 0xac, 0x91, 0xbd, 0x6b, 0x53, 0xb7, 0xbb, 0x44, 0x17, 0xfb, 0xbb,
+  0x94, 0xcd, 0x22, 0x3d, 0xa3, 0xe1, 0x97, 0x3d, 0x3b, 0xe4, 0x1c, 0x3d,
+  0x8a, 0x54, 0x91, 0xbb, 0x50, 0x88, 0xe1, 0x3c, 0x53, 0x67, 0x2a, 0x3c,
+  0xde, 0x95, 0x5b, 0xbe, 0x68, 0xe0, 0xf4, 0x3d, 0xbc, 0xd3, 0xde, 0x3d,
+  0x1d, 0x85, 0xeb, 0x3d, 0x67, 0x72, 0x2d, 0xbd, 0x77, 0x3f, 0xd1, 0xbd,
+  0xc4, 0x28, 0xe0, 0xbc, 0x75, 0x25, 0x81, 0xbc, 0xbc, 0xb3, 0x3d, 0xbe,
+  0x39, 0xb6, 0x8b, 0xbd, 0x04, 0xb6, 0xeb, 0xbb, 0xd7, 0xc2, 0xd9, 0x3d,
+  0x85, 0x01, 0xd5, 0x3d, 0xa5, 0xe2, 0xb6, 0x3d, 0x57, 0x6f, 0xbf, 0xba,
+  0x68, 0x45, 0x6d, 0xbd, 0xe6, 0x07, 0xa1, 0xbd, 0x0d, 0x62, 0xfc, 0x3d,
+  0x75, 0x76, 0xa7, 0x3d, 0xef, 0xc8, 0x90, 0x3d, 0x92, 0xe9, 0xa3, 0xbd,
+  0xfc, 0xe8, 0xff, 0xbc, 0x85, 0xdb, 0x89, 0xbc, 0xbe, 0xe1, 0x7f, 0x3c,
+  0xb6, 0xa6, 0xab, 0x3a, 0xba, 0xaa, 0x9f, 0x3c, 0xea, 0xed, 0x7f, 0x3d,
+  0x6c, 0xff, 0xe3, 0x3a, 0xc1, 0x88, 0xdf, 0x3b, 0x74, 0x43, 0x9a, 0x3d,
+  0xbe, 0x88, 0xc1, 0xbc, 0xec, 0xf7, 0x18, 0x3d, 0xfa, 0x39, 0xb4, 0xbd,
+  0x8b, 0x52, 0x47, 0x3c, 0xf8, 0xa9, 0x8d, 0x3d, 0x41, 0x4e, 0x85, 0x3d,
+  0x79, 0xea, 0x12, 0x3d, 0x7d, 0x61, 0x68, 0x3d, 0x8c, 0xf2, 0x4b, 0x3d,
+  0xc0, 0x38, 0x1f, 0xbd, 0xec, 0x46, 0xa9, 0x3c, 0x53, 0x20, 0x72, 0x3c,
+  0xfb, 0x65, 0xd1, 0x3d, 0x97, 0x65, 0x1c, 0x3d, 0xd2, 0x48, 0x53, 0xbd,
+  0x8f, 0xe8, 0x16, 0x3d, 0x74, 0x71, 0x91, 0x3d, 0x47, 0x1b, 0xfc, 0xbc,
+  0xc8, 0xf2, 0x85, 0x3c, 0x82, 0xbb, 0x0e, 0xbd, 0x02, 0x91, 0xfb, 0x3b,
+  0xae, 0xe3, 0x0a, 0xbe, 0xc5, 0x04, 0x17, 0xbe, 0xa5, 0x64, 0x27, 0x3e,
+  0x3c, 0x3c, 0x4d, 0xbc, 0x8e, 0x3b, 0x85, 0x3d, 0xb6, 0x3b, 0x8c, 0x3d,
+  0xc7, 0xe7, 0x9d, 0x3d, 0x69, 0xca, 0x01, 0xbe, 0xc4, 0x36, 0xa1, 0xbd,
+  0x93, 0x5a, 0xe8, 0xbd, 0x2f, 0xf4, 0x2e, 0x3d, 0x39, 0x82, 0x06, 0xbe,
+  0x92, 0x6b, 0xa6, 0xbd, 0xa2, 0xa3, 0x10, 0xbd, 0x92, 0x79, 0xdb, 0xbc,
+  0x10, 0x5c, 0xc5, 0xbd, 0xdc, 0xb0, 0x01, 0xbe, 0x54, 0x3b, 0x02, 0x3e,
+  0x38, 0xe0, 0x81, 0x3e, 0x89, 0x03, 0xc7, 0x3b, 0xda, 0xfb, 0xc9, 0x3d,
+  0x5c, 0x80, 0x18, 0x3d, 0xe3, 0xf3, 0xdc, 0xbc, 0x80, 0xff, 0xc1, 0xbc,
+  0xf3, 0x9e, 0xea, 0xbd, 0x9e, 0xf0, 0xbc, 0xbd, 0xeb, 0x21, 0xd4, 0xbc,
+  0x1e, 0xd9, 0x0f, 0x3d, 0x82, 0xa1, 0x6a, 0x3d, 0xa4, 0x65, 0xda, 0xbc,
+  0xde, 0x94, 0xb3, 0xbd, 0x95, 0xe1, 0x13, 0x3d, 0x1a, 0x4d, 0xb0, 0xbd,
+  0x8a, 0x7c, 0x36, 0xbc, 0x8f, 0x69, 0x17, 0x3e, 0x6c, 0x7e, 0x02, 0xbd,
+  0x9b, 0xf1, 0xcb, 0x3c, 0x41, 0xfa, 0xdd, 0x3d, 0x22, 0x21, 0x8c, 0x3d,
+  0x50, 0x82, 0x57, 0xbd, 0x58, 0x96, 0xa4, 0xbd, 0x00, 0x33, 0x83, 0xbd,
+  0x61, 0x4c, 0x73, 0xbb, 0x44, 0x6c, 0x45, 0x3d, 0x2e, 0xa6, 0xf0, 0xbc,
+  0x03, 0x63, 0x9a, 0x3d, 0x7f, 0x18, 0xb2, 0xbd, 0xf3, 0x56, 0xb7, 0x3d,
+  0xa4, 0xf3, 0xc4, 0xbd, 0x50, 0x67, 0x24, 0x3d, 0x57, 0xce, 0xe0, 0x3d,
+  0x0b, 0xe1, 0x81, 0xbb, 0x83, 0xda, 0x54, 0xbd, 0x7a, 0xa8, 0x46, 0x3d,
+  0x6e, 0x5e, 0x47, 0x3d, 0xba, 0x1a, 0xa6, 0xbc, 0xda, 0x50, 0xb6, 0xbc,
+  0x17, 0x74, 0x25, 0x3c, 0xf7, 0x16, 0x3c, 0x3d, 0x46, 0x8d, 0xab, 0xbc,
+  0x59, 0x2a, 0x11, 0xbb, 0xe0, 0x71, 0x48, 0xbd, 0x7d, 0x99, 0x30, 0xbe,
+  0xe4, 0x78, 0x5c, 0xbd, 0x6a, 0x2f, 0x52, 0x3d, 0x27, 0x7a, 0xf6, 0x3d,
+  0x28, 0x8a, 0x19, 0x3e, 0x93, 0xba, 0x66, 0x3d, 0x23, 0x47, 0x0c, 0x3c,
+  0xc2, 0x00, 0x9c, 0x3d, 0x88, 0xd6, 0x0e, 0xbd, 0xec, 0xc6, 0x7d, 0xbd,
+  0xbe, 0x0a, 0xde, 0xbc, 0xda, 0x37, 0x9b, 0xbd, 0x53, 0xf3, 0xec, 0x3d,
+  0x1b, 0x82, 0x14, 0xbb, 0xd9, 0xfa, 0x71, 0x3d, 0x5b, 0x0f, 0xab, 0xbd,
+  0x4a, 0x00, 0x25, 0xbe, 0x6f, 0xdd, 0xff, 0x3d, 0x12, 0xbf, 0xfc, 0xbd,
+  0xda, 0xfc, 0xd6, 0x3b, 0x0c, 0xf4, 0x25, 0x3e, 0x28, 0xd5, 0x16, 0xbd,
+  0xba, 0x22, 0xb3, 0x3d, 0x62, 0x64, 0x03, 0xbd, 0x67, 0xd6, 0x12, 0x3d,
+  0xf9, 0xcf, 0x7f, 0x3d, 0x9f, 0xa1, 0x85, 0x3d, 0x12, 0x68, 0xa9, 0xbd,
+  0x4f, 0x95, 0x34, 0x3e, 0x4c, 0xc1, 0x3a, 0x3d, 0x38, 0x0c, 0xce, 0x3d,
+  0x1e, 0x8b, 0x32, 0xbe, 0xfe, 0x1f, 0x01, 0xbd, 0xe0, 0x75, 0xb5, 0x3d,
+  0xa3, 0x79, 0x87, 0xbd, 0x6e, 0xbe, 0x84, 0x3d, 0xd5, 0x62, 0x2d, 0x3d,
+  0x89, 0xda, 0x8f, 0xbd, 0xc7, 0xf4, 0x10, 0x3e, 0x4e, 0xf7, 0x99, 0x3d,
+  0x4f, 0xa7, 0x34, 0xbd, 0x5a, 0xa4, 0x9d, 0xbc, 0xa4, 0x5c, 0xc0, 0x3c,
+  0xd4, 0x21, 0xbd, 0xbd, 0xf5, 0xdf, 0x9c, 0xbd, 0xd7, 0x75, 0xe6, 0x3d,
+  0xc3, 0x45, 0xed, 0x3d, 0x28, 0xf4, 0x09, 0xbe, 0xdf, 0x55, 0x83, 0xbe,
+  0x7d, 0x7d, 0x21, 0x3e, 0xf6, 0x8a, 0xc3, 0xbd, 0xee, 0xa4, 0x9d, 0x3d,
+  0xaa, 0x8a, 0xb1, 0x3d, 0x0d, 0xbc, 0x00, 0x3d, 0xfc, 0x4e, 0x0a, 0xbc,
+  0xa9, 0x7c, 0x09, 0x3e, 0x8f, 0x00, 0x31, 0xbc, 0x5f, 0xa6, 0x1b, 0x3d,
+  0x70, 0x49, 0xa3, 0x3c, 0xb2, 0x33, 0x4d, 0xbb, 0x22, 0x83, 0x86, 0xbc,
+  0x28, 0x08, 0x8e, 0x3d, 0xcf, 0x07, 0xb4, 0x3d, 0x32, 0x37, 0xbc, 0xbd,
+  0x0f, 0xa7, 0xe9, 0xbd, 0x67, 0x3b, 0x7a, 0x3d, 0xa0, 0xdd, 0xd8, 0xbd,
+  0xe5, 0x31, 0xa9, 0xbc, 0xb2, 0x5b, 0x98, 0x3d, 0xc0, 0x36, 0xab, 0xbd,
+  0xe5, 0xbe, 0x4c, 0x3c, 0x53, 0xb8, 0x5e, 0x3d, 0x7f, 0x46, 0xa4, 0xbd,
+  0x2a, 0x78, 0x4e, 0xbc, 0xbe, 0xc9, 0x0e, 0xbd, 0xd3, 0x02, 0x8a, 0xbd,
+  0x36, 0x80, 0xdf, 0x3d, 0x85, 0x10, 0x6a, 0x3d, 0x44, 0xca, 0xbc, 0x3d,
+  0x9f, 0x1d, 0x6e, 0xbe, 0xf7, 0xd0, 0x23, 0xbe, 0x43, 0x39, 0x73, 0xbb,
+  0x21, 0x18, 0x67, 0xbd, 0xc0, 0x30, 0xf5, 0xbc, 0x34, 0x9c, 0x02, 0x3d,
+  0xa4, 0x72, 0x07, 0xbe, 0x86, 0xcc, 0x92, 0x3d, 0xc7, 0x28, 0xd8, 0x3c,
+  0x98, 0x82, 0x3c, 0x3d, 0x31, 0x5c, 0x4a, 0x3d, 0xa2, 0xba, 0xcd, 0x3b,
+  0x6c, 0x15, 0x6c, 0xbd, 0xe7, 0xd3, 0x2a, 0x3d, 0x7b, 0x94, 0x5b, 0x3c,
+  0x6b, 0xaa, 0x01, 0x3b, 0xf9, 0x29, 0x05, 0xbd, 0x81, 0x8a, 0x1c, 0xbe,
+  0xbc, 0xd1, 0x4c, 0x3d, 0x2f, 0x53, 0x15, 0xbd, 0x2f, 0xac, 0xa9, 0x3d,
+  0x65, 0xa9, 0x0c, 0x3e, 0x05, 0x72, 0x76, 0xbc, 0x94, 0x5a, 0x34, 0xbc,
+  0x1a, 0xc3, 0x09, 0x3e, 0xe8, 0xfe, 0x51, 0x3d, 0x89, 0x35, 0xab, 0xbd,
+  0x0f, 0xfe, 0x0a, 0x3c, 0x1e, 0x30, 0xb2, 0xbd, 0x94, 0x2e, 0x55, 0x3d,
+  0x98, 0x13, 0xd3, 0x3d, 0x77, 0xc4, 0xa0, 0x3d, 0xba, 0x37, 0x72, 0xbc,
+  0xdb, 0xac, 0xa4, 0xbd, 0x7f, 0xf3, 0x69, 0x3d, 0x40, 0x8b, 0xe2, 0x3c,
+  0x2c, 0xff, 0x6d, 0xbd, 0x98, 0x67, 0x57, 0x3d, 0x2c, 0x39, 0x8b, 0x3c,
+  0xec, 0x74, 0x0b, 0xbd, 0xbe, 0x7b, 0x03, 0x3d, 0x0a, 0x94, 0x4b, 0xbd,
+  0x03, 0xa2, 0xbf, 0xbc, 0x20, 0x4a, 0xce, 0x3c, 0x91, 0x73, 0x8f, 0xbd,
+  0xd2, 0x50, 0x3a, 0xbc, 0xee, 0xa0, 0x8b, 0xbd, 0x52, 0xb6, 0x7b, 0x3d,
+  0xa1, 0x3c, 0x8f, 0xbc, 0x8d, 0x87, 0xe1, 0xbd, 0xaf, 0x29, 0x45, 0x3c,
+  0xe9, 0xbc, 0xf0, 0xbc, 0xa0, 0xd0, 0xc7, 0x3d, 0x5b, 0x2d, 0x25, 0x3d,
+  0xb0, 0x50, 0x8b, 0xbd, 0x5a, 0x18, 0x12, 0x3d, 0xc3, 0xbc, 0xa4, 0x3b,
+  0x72, 0x7b, 0x8d, 0x3c, 0x70, 0x92, 0xa3, 0x3b, 0xac, 0xf7, 0xb8, 0xbd,
+  0xe4, 0x91, 0x8f, 0xbd, 0x35, 0x31, 0xc6, 0xbd, 0xa1, 0x3f, 0x3d, 0xbc,
+  0x52, 0xed, 0x07, 0x3d, 0x4c, 0xe1, 0x01, 0xbe, 0x50, 0x6a, 0xcb, 0xbd,
+  0xc6, 0x90, 0x54, 0x3c, 0x66, 0x9f, 0x97, 0xbb, 0x8d, 0x8d, 0xb7, 0x3d,
+  0x6e, 0xd7, 0x1e, 0x3e, 0x85, 0x86, 0x8d, 0xbc, 0xd0, 0x80, 0x56, 0x3d,
+  0xf6, 0x71, 0xbf, 0xba, 0x27, 0x09, 0x60, 0x3c, 0x63, 0x36, 0xd1, 0xbd,
+  0x9c, 0x91, 0x83, 0xbd, 0xbe, 0xba, 0xc0, 0xbd, 0x4c, 0x4e, 0x0a, 0xba,
+  0x47, 0x28, 0x18, 0xbd, 0x25, 0xd2, 0x18, 0x3d, 0x20, 0x06, 0xe0, 0xbd,
+  0x79, 0x95, 0xc8, 0xbd, 0xd5, 0x35, 0x47, 0x3d, 0xba, 0x7a, 0xe8, 0xbc,
+  0x58, 0x33, 0x4d, 0x3c, 0xec, 0x0a, 0x99, 0x3d, 0x8e, 0x8c, 0x13, 0x3d,
+  0x14, 0x64, 0xbd, 0x3d, 0x52, 0xdb, 0xef, 0x3c, 0xb7, 0x29, 0xb2, 0x3d,
+  0x60, 0x79, 0xf2, 0x3d, 0x6c, 0xd8, 0x34, 0xbd, 0x93, 0xdc, 0x7b, 0xbd,
+  0x11, 0x57, 0xa4, 0x3c, 0x7e, 0x83, 0xeb, 0x3d, 0x63, 0xfe, 0x54, 0x3c,
+  0x23, 0x4c, 0x46, 0xbd, 0xfe, 0xdc, 0x35, 0xbd, 0x99, 0xa1, 0x8e, 0x3d,
+  0x8f, 0x2a, 0xb4, 0xbc, 0xf6, 0x2c, 0x5d, 0x3d, 0x53, 0xfa, 0x5b, 0x3d,
+  0x7f, 0x3d, 0x64, 0x3d, 0x74, 0x47, 0x99, 0x3d, 0x8f, 0x21, 0xc9, 0x3d,
+  0x24, 0xac, 0xb6, 0x3d, 0x76, 0x28, 0x3e, 0x3c, 0x70, 0xc1, 0x39, 0xbc,
+  0xa4, 0x38, 0xd7, 0xbc, 0x87, 0x37, 0x56, 0x3d, 0x4d, 0xcc, 0x36, 0xba,
+  0x4c, 0x07, 0x17, 0x3b, 0xae, 0x2a, 0x8f, 0x3b, 0xa7, 0xdb, 0x0b, 0xbc,
+  0xf7, 0xf8, 0xb3, 0x3c, 0xb7, 0xc2, 0x9d, 0xbd, 0xc1, 0x2e, 0xcb, 0x3d,
+  0xbb, 0x31, 0x75, 0x3e, 0xd0, 0xb6, 0x04, 0x3d, 0xbf, 0x8f, 0x79, 0xbd,
+  0x2c, 0x79, 0xe6, 0x3d, 0x36, 0x55, 0xe7, 0x3c, 0xc4, 0xae, 0x6a, 0x3d,
+  0x05, 0x1d, 0x3e, 0x3d, 0x49, 0x3d, 0x2f, 0xbd, 0xef, 0x8a, 0x94, 0x3d,
+  0x25, 0x59, 0x53, 0x3d, 0x3d, 0xf2, 0xca, 0x3d, 0x0c, 0xa6, 0x75, 0xbe,
+  0xaf, 0x19, 0x2d, 0xbe, 0x82, 0x8f, 0x30, 0x3d, 0x92, 0x8a, 0xc4, 0xbd,
+  0x57, 0x36, 0x71, 0x3c, 0x66, 0x38, 0x08, 0x3e, 0x87, 0xbb, 0x3a, 0x3d,
+  0x4e, 0x7e, 0x03, 0x3d, 0xc2, 0x52, 0x0a, 0xbc, 0xf1, 0xb1, 0x33, 0x39,
+  0x40, 0xe9, 0xfa, 0xbd, 0x23, 0x5a, 0x90, 0xbd, 0x57, 0x03, 0x8f, 0xbd,
+  0x7b, 0x67, 0xe4, 0x3c, 0x91, 0x4d, 0x22, 0xbc, 0x55, 0x6a, 0x02, 0x3d,
+  0x28, 0x11, 0x92, 0xbd, 0xf8, 0x53, 0x17, 0xbe, 0x36, 0x03, 0x73, 0x3d,
+  0x22, 0x67, 0x70, 0xbd, 0x02, 0x7b, 0xf6, 0xbc, 0x86, 0xc6, 0x18, 0x3e,
+  0xe6, 0x41, 0x4b, 0xbd, 0x30, 0x81, 0xd1, 0x3d, 0x65, 0xa7, 0xc1, 0xbc,
+  0x44, 0x14, 0x95, 0xbd, 0xd4, 0xb1, 0xbf, 0xbb, 0x57, 0x82, 0x5c, 0xbd,
+  0x8f, 0x5c, 0xd3, 0xbd, 0x17, 0x96, 0x74, 0xbc, 0xcf, 0x10, 0x58, 0x3c,
+  0xb4, 0x78, 0x8b, 0x3c, 0xd3, 0x75, 0xd4, 0xbd, 0x3c, 0x25, 0x0a, 0xbe,
+  0x30, 0x4e, 0xb1, 0x3d, 0xbc, 0x42, 0x98, 0xbd, 0xc3, 0x59, 0x36, 0x3d,
+  0xf9, 0x6d, 0x75, 0x3e, 0x0a, 0xc6, 0xa6, 0x3d, 0x06, 0x4f, 0xb3, 0x3d,
+  0xd6, 0x01, 0x5b, 0x3d, 0xad, 0x43, 0xac, 0x3c, 0x25, 0xa1, 0xa1, 0xbc,
+  0x37, 0x3f, 0x68, 0x3d, 0x47, 0xdd, 0x28, 0x3b, 0xea, 0x5b, 0x25, 0x3d,
+  0xc9, 0x7a, 0xd9, 0xbc, 0x1c, 0xa3, 0x2b, 0xbd, 0x01, 0x56, 0x2f, 0xbe,
+  0x51, 0x73, 0x1d, 0xbe, 0x6a, 0x16, 0xa0, 0x3d, 0x2e, 0xbd, 0xdf, 0x3c,
+  0xf1, 0x5f, 0x38, 0x3e, 0x17, 0x5b, 0x2f, 0x3d, 0x56, 0xcf, 0x8e, 0xbd,
+  0x87, 0x14, 0x07, 0x3d, 0x1d, 0x2a, 0x87, 0xbd, 0xe1, 0x91, 0x6b, 0xbd,
+  0x12, 0x87, 0xa5, 0xbc, 0x10, 0xd9, 0x8c, 0x3c, 0x52, 0x38, 0x99, 0xbd,
+  0x09, 0xa1, 0x70, 0xbd, 0x3f, 0x07, 0x47, 0xbd, 0x45, 0xbf, 0x03, 0x3c,
+  0xb6, 0xa2, 0x18, 0xbe, 0xb7, 0xc0, 0x4f, 0xbe, 0x01, 0xa4, 0xbf, 0x3c,
+  0x4c, 0xe1, 0xda, 0xbd, 0x9d, 0x82, 0xde, 0x3b, 0x23, 0x80, 0x89, 0x3d,
+  0x9c, 0x02, 0xa4, 0xbd, 0x3c, 0x8d, 0xca, 0xbb, 0x95, 0xbd, 0xb9, 0x3c,
+  0xbf, 0x76, 0xe9, 0x3c, 0x25, 0x38, 0x8a, 0xbc, 0x41, 0xb9, 0x35, 0xbd,
+  0x29, 0x89, 0x7e, 0xbd, 0x4e, 0xbb, 0xf4, 0x3a, 0xa6, 0xc6, 0xe2, 0x3c,
+  0x6f, 0x1c, 0x61, 0x3d, 0xa1, 0xdb, 0x9e, 0xbe, 0x29, 0xc1, 0xba, 0xbd,
+  0xd3, 0x34, 0xce, 0x3d, 0xf6, 0x84, 0x3e, 0xbd, 0xa8, 0x60, 0xb5, 0x3c,
+  0x04, 0xce, 0x11, 0x3e, 0xa8, 0x7c, 0x52, 0x3d, 0x33, 0x63, 0x56, 0x3d,
+  0xf5, 0xc3, 0xb0, 0x3d, 0xb7, 0x56, 0x72, 0x3d, 0xc4, 0x1c, 0x9c, 0xbd,
+  0x1d, 0xbe, 0x8d, 0xbd, 0xb4, 0x35, 0x3d, 0xbe, 0x75, 0x95, 0xab, 0x3d,
+  0x48, 0x21, 0xc5, 0x3d, 0xce, 0x9a, 0xf6, 0xbc, 0x3e, 0xf9, 0x4d, 0xbd,
+  0xe1, 0xc4, 0x16, 0xbe, 0x44, 0xde, 0x52, 0x3c, 0x2a, 0xb1, 0xe8, 0x3c,
+  0xcd, 0x3f, 0x21, 0x3e, 0x5a, 0x5a, 0x57, 0x3e, 0xd5, 0xe6, 0xd7, 0xbc,
+  0x58, 0x98, 0x63, 0xbb, 0x00, 0x14, 0x0f, 0x3c, 0x8a, 0xfb, 0x80, 0xbd,
+  0x85, 0x0a, 0x83, 0x3c, 0x23, 0x24, 0x16, 0xbd, 0x2e, 0x95, 0xc1, 0xbd,
+  0x52, 0xff, 0xc5, 0x3d, 0xd4, 0x3b, 0x01, 0x3e, 0x91, 0x80, 0xc6, 0x3d,
+  0xfd, 0x2c, 0x1f, 0xbd, 0xe2, 0xb1, 0x6b, 0xbd, 0x94, 0x7f, 0x7d, 0xbc,
+  0x1c, 0xa4, 0x29, 0xbd, 0x54, 0x13, 0xaf, 0x3d, 0x2e, 0xd7, 0xb1, 0x3d,
+  0x32, 0xd7, 0x55, 0x3d, 0xd3, 0x22, 0xa1, 0x3b, 0x4f, 0x69, 0x7a, 0x3d,
+  0x8c, 0x9a, 0x23, 0xbd, 0xbb, 0x1c, 0x94, 0xbd, 0x2f, 0x9d, 0xe5, 0xbd,
+  0x6c, 0x5b, 0xd5, 0xbd, 0x22, 0xc2, 0x6a, 0x3d, 0xd3, 0xab, 0xbd, 0x3c,
+  0xe4, 0x95, 0x64, 0x3d, 0x6c, 0x37, 0x12, 0xbc, 0x60, 0x26, 0x7f, 0xbd,
+  0x36, 0xab, 0xe5, 0x3d, 0x2d, 0x03, 0x43, 0x3d, 0xe1, 0xaf, 0xd3, 0x3d,
+  0x28, 0x36, 0x43, 0x3e, 0xde, 0xc9, 0x31, 0x3d, 0xeb, 0x66, 0xa4, 0xbc,
+  0x32, 0xad, 0x96, 0x3c, 0x70, 0x9b, 0x1a, 0x3d, 0xbe, 0x46, 0x0e, 0xbe,
+  0x84, 0x2e, 0xe8, 0xbd, 0x61, 0xcf, 0x15, 0xbe, 0xde, 0xb5, 0x79, 0xbd,
+  0xce, 0xd6, 0xa5, 0xbc, 0x22, 0xfe, 0xb7, 0x3d, 0xa1, 0xe7, 0x2d, 0xbe,
+  0x88, 0xea, 0x1e, 0xbe, 0x47, 0x4d, 0x13, 0xbd, 0x22, 0xca, 0xcf, 0xbd,
+  0xa4, 0xe0, 0x6b, 0x3d, 0x64, 0x30, 0x07, 0x3e, 0x6a, 0x7d, 0xc9, 0xbc,
+  0x30, 0x7a, 0x80, 0xbc, 0x26, 0x04, 0x8d, 0xbc, 0xcf, 0xde, 0xbc, 0x3d,
+  0x34, 0x97, 0xec, 0xbd, 0xb2, 0x8f, 0x0c, 0xbd, 0x8b, 0xf1, 0xf4, 0xbd,
+  0xc9, 0xde, 0x5a, 0xbd, 0x2a, 0x49, 0xc9, 0xbc, 0x46, 0xfa, 0x4b, 0x3d,
+  0x1b, 0xc8, 0xc7, 0xbd, 0xb9, 0x13, 0xb9, 0xbc, 0xf5, 0x47, 0x68, 0x3d,
+  0xb1, 0x45, 0x9c, 0xbd, 0xa0, 0xdb, 0xfe, 0x3c, 0x92, 0x66, 0xcd, 0x3d,
+  0x64, 0xed, 0xb1, 0x3d, 0x54, 0x74, 0x18, 0xbd, 0x61, 0x4c, 0x2f, 0x3d,
+  0x30, 0x35, 0x10, 0xbd, 0x47, 0x3c, 0x06, 0xbd, 0xd3, 0x71, 0x4e, 0xbd,
+  0xcb, 0x44, 0xca, 0xbd, 0x71, 0x1b, 0x54, 0x3d, 0x2d, 0xa6, 0x0e, 0x3c,
+  0x0a, 0xa1, 0x2f, 0x3d, 0x8c, 0xa9, 0xca, 0xbd, 0x92, 0x40, 0xd0, 0xbd,
+  0x5d, 0x5e, 0xb4, 0x3d, 0x80, 0x9c, 0x00, 0xbd, 0xb5, 0x88, 0x84, 0xbd,
+  0x97, 0x2f, 0x06, 0x3d, 0xbb, 0x03, 0x60, 0xbd, 0x2e, 0xe6, 0x3a, 0xbc,
+  0xa0, 0xfc, 0x87, 0x3d, 0x75, 0xd5, 0xe3, 0x3a, 0x5f, 0x3b, 0x66, 0x3d,
+  0x55, 0x07, 0x82, 0xbd, 0xa7, 0x3a, 0xe5, 0xbd, 0x61, 0x89, 0x07, 0x3d,
+  0x10, 0x3d, 0x69, 0xbc, 0x8a, 0x2b, 0x3c, 0x3d, 0xe0, 0x2c, 0x72, 0x3d,
+  0x29, 0x3a, 0x4e, 0xbe, 0x3f, 0x76, 0x0c, 0xbc, 0x03, 0xb7, 0xfd, 0xbc,
+  0x7e, 0x74, 0xf4, 0x3d, 0xe8, 0x29, 0x0e, 0x3e, 0x61, 0x9b, 0x71, 0xbd,
+  0x61, 0xc9, 0x57, 0xbd, 0x73, 0x4e, 0xfb, 0x3b, 0xed, 0x46, 0xb9, 0xbc,
+  0x6f, 0x46, 0xc1, 0xbc, 0x18, 0xf6, 0xc7, 0xbb, 0xce, 0x9b, 0xd6, 0xbc,
+  0x6b, 0xec, 0x23, 0x3d, 0x7b, 0xd7, 0xb9, 0x3b, 0x09, 0xfd, 0x97, 0x3d,
+  0xff, 0xb4, 0xff, 0xbd, 0x10, 0x28, 0x0d, 0xbe, 0xf9, 0xce, 0xb3, 0x3d,
+  0xed, 0x27, 0xbb, 0xbd, 0x4f, 0xb1, 0x66, 0x3c, 0x07, 0xea, 0xd1, 0x3d,
+  0xda, 0xa1, 0x56, 0xbd, 0x1f, 0x35, 0x03, 0xbd, 0x92, 0xd2, 0x86, 0xba,
+  0x50, 0x23, 0xb1, 0x3d, 0x37, 0xbf, 0x13, 0x3d, 0x7a, 0x15, 0xbf, 0x3c,
+  0x10, 0xfa, 0xb3, 0xbd, 0xe1, 0x6b, 0xb3, 0x3c, 0x13, 0xf6, 0x19, 0x3d,
+  0xfe, 0x0f, 0xef, 0x3d, 0x4e, 0xba, 0xbf, 0xbd, 0x3a, 0x6d, 0xd5, 0xbd,
+  0xd2, 0x49, 0x75, 0x3d, 0x36, 0x6c, 0xc4, 0xbd, 0x45, 0xa0, 0x66, 0x3d,
+  0x52, 0xde, 0x32, 0x3a, 0x8d, 0x55, 0x7c, 0x3c, 0xa9, 0xa0, 0x1a, 0xbc,
+  0x38, 0x2d, 0xe1, 0x3d, 0xea, 0xae, 0x46, 0x3d, 0xcd, 0xf4, 0x60, 0xbc,
+  0x10, 0x4e, 0x20, 0xbd, 0x8d, 0xff, 0x1d, 0x3d, 0xe7, 0xd0, 0x6e, 0x3c,
+  0xb0, 0xdc, 0xce, 0xbb, 0x6d, 0xff, 0x2d, 0x3a, 0x9b, 0x1a, 0x14, 0xbe,
+  0xec, 0x97, 0x42, 0xbe, 0x91, 0x76, 0xc3, 0x3d, 0x79, 0xdc, 0x7d, 0xbd,
+  0xc6, 0x8a, 0xf5, 0x3d, 0xcb, 0x5f, 0x80, 0x3e, 0x02, 0xf6, 0x8c, 0x3d,
+  0x39, 0xd5, 0xda, 0x3d, 0xd5, 0xbb, 0x74, 0x3d, 0x66, 0x7f, 0x1d, 0x3d,
+  0xff, 0x20, 0x12, 0x3c, 0x9c, 0xc1, 0x2b, 0x3d, 0x3d, 0x9c, 0xae, 0x3c,
+  0x10, 0x81, 0x44, 0xbd, 0x7b, 0x98, 0xef, 0x3b, 0xa8, 0x81, 0xd2, 0x3d,
+  0x07, 0x0a, 0xd2, 0xbd, 0xb1, 0x5e, 0x3c, 0xbe, 0x55, 0xda, 0x14, 0x3d,
+  0x87, 0xfc, 0x79, 0xbb, 0x7b, 0x54, 0xec, 0xbc, 0x85, 0x95, 0xbc, 0xbc,
+  0x74, 0x7d, 0x74, 0xbd, 0xd5, 0x3c, 0xa3, 0x3c, 0x6e, 0x62, 0xdf, 0x3d,
+  0x22, 0xb5, 0xe3, 0xbc, 0xd9, 0x61, 0x13, 0xbd, 0x52, 0x64, 0x2f, 0xbd,
+  0x17, 0xbc, 0x00, 0xbe, 0x84, 0x91, 0x8d, 0xbd, 0x01, 0x92, 0x6b, 0xbb,
+  0x19, 0x17, 0x8a, 0x3d, 0x01, 0x05, 0x3e, 0xbe, 0xfc, 0x80, 0x37, 0xbe,
+  0xdf, 0x22, 0x56, 0x3d, 0x1d, 0xa7, 0x0a, 0x3b, 0xc3, 0xb3, 0xc0, 0xba,
+  0x90, 0x40, 0x22, 0x3e, 0x14, 0x32, 0xa3, 0xbd, 0xb9, 0x57, 0x93, 0x3d,
+  0x58, 0x1f, 0x1a, 0xbd, 0xe1, 0xaf, 0x34, 0x3d, 0xd0, 0x59, 0x22, 0xbe,
+  0x10, 0x6a, 0xfe, 0xbc, 0xcc, 0xc5, 0xc7, 0xbb, 0xbe, 0xfb, 0xf3, 0x3c,
+  0xb7, 0x0e, 0xfd, 0x3b, 0xfb, 0xcc, 0x99, 0xba, 0x80, 0xdb, 0x11, 0xbe,
+  0xf9, 0x1e, 0x8f, 0xbd, 0x70, 0x62, 0x26, 0x3d, 0x67, 0xf7, 0xb9, 0xbd,
+  0x0c, 0xe9, 0x61, 0xbd, 0xc2, 0x67, 0x61, 0x3d, 0x80, 0xc8, 0x51, 0x3d,
+  0xed, 0x0a, 0x11, 0x3d, 0xb8, 0x7e, 0x00, 0x3d, 0x75, 0x98, 0x9f, 0x3c,
+  0xe2, 0x1f, 0xdd, 0xbd, 0x88, 0x86, 0x86, 0xbd, 0xa3, 0x38, 0x9e, 0xbb,
+  0xfa, 0x61, 0xb1, 0x3d, 0x64, 0x7d, 0xd6, 0x3b, 0xf5, 0x01, 0x2d, 0xbd,
+  0x92, 0x14, 0x32, 0xbd, 0x74, 0x86, 0x8c, 0xbd, 0x00, 0xf4, 0x30, 0x3d,
+  0x43, 0xbd, 0xf6, 0xbd, 0x40, 0x85, 0x19, 0x3a, 0xa7, 0x59, 0x07, 0x3e,
+  0xbd, 0xdf, 0x41, 0x3d, 0xbf, 0xd8, 0x1b, 0xbd, 0x07, 0xc2, 0x44, 0x3d,
+  0xcf, 0x00, 0xc9, 0x3c, 0x19, 0x9a, 0x3b, 0xbd, 0x75, 0xb3, 0x36, 0x3c,
+  0xd8, 0x47, 0x25, 0xbe, 0x6e, 0x63, 0x60, 0xbc, 0x4b, 0xc8, 0x2b, 0xbc,
+  0xe7, 0x42, 0x5d, 0xbc, 0x9a, 0xcc, 0x9d, 0xbd, 0x4c, 0x08, 0x0b, 0xbe,
+  0xae, 0xb0, 0x26, 0x3d, 0xc6, 0x98, 0xa9, 0xbd, 0x0c, 0x2d, 0x9f, 0x3c,
+  0xa9, 0x7b, 0x3f, 0xbd, 0x68, 0xc6, 0x9f, 0xbd, 0xc2, 0x6f, 0xf9, 0x3d,
+  0x37, 0x0c, 0x91, 0x3d, 0xe9, 0x48, 0x26, 0xbd, 0x16, 0x63, 0x98, 0xbd,
+  0xa5, 0x22, 0xc1, 0xbd, 0x9b, 0x1e, 0xae, 0xbd, 0xe6, 0x06, 0x6f, 0xbc,
+  0xa9, 0xc2, 0x89, 0xbb, 0xd2, 0xc1, 0xa5, 0x3c, 0x44, 0x46, 0x86, 0xbe,
+  0xd1, 0x6b, 0x36, 0xbe, 0x9a, 0xcc, 0xc9, 0xbc, 0x89, 0xe3, 0x59, 0xbd,
+  0x8f, 0x4e, 0xae, 0x3d, 0x2e, 0x3f, 0x29, 0x3e, 0xa2, 0x9d, 0x11, 0x3d,
+  0xf9, 0xf4, 0x08, 0x3d, 0x5d, 0x46, 0x23, 0xbd, 0x3d, 0xbc, 0x88, 0x3c,
+  0x87, 0x61, 0x1e, 0xbe, 0xb1, 0x8c, 0xa8, 0xbd, 0x56, 0x2d, 0xef, 0xbd,
+  0x66, 0xea, 0x6c, 0x3d, 0x78, 0x21, 0x0d, 0xbd, 0x05, 0x4f, 0x05, 0xbd,
+  0x9e, 0xd1, 0x12, 0xbe, 0xa6, 0x59, 0xee, 0xbd, 0xcf, 0x04, 0x1e, 0x3c,
+  0xdd, 0x1b, 0xb3, 0xbd, 0x38, 0x84, 0x7a, 0x3c, 0xfb, 0x8b, 0x18, 0x3e,
+  0xe9, 0xfa, 0x03, 0xbc, 0x80, 0x2c, 0x45, 0x3d, 0xf3, 0x66, 0xb2, 0x3d,
+  0x66, 0xea, 0xf9, 0x3d, 0xf3, 0x9e, 0x27, 0xbd, 0xe3, 0x13, 0xe8, 0xbb,
+  0xc0, 0x15, 0xd7, 0x3a, 0x9c, 0xf4, 0x6f, 0x3d, 0x19, 0xf8, 0xa1, 0x3c,
+  0xfa, 0x42, 0x85, 0x3c, 0x33, 0xa6, 0x70, 0xbd, 0xc7, 0x3b, 0xcf, 0xbd,
+  0x30, 0xe2, 0x34, 0x3d, 0xea, 0x65, 0x56, 0xbd, 0x48, 0x8e, 0x80, 0xbc,
+  0xc4, 0xd4, 0x1f, 0x3e, 0xc9, 0x51, 0x44, 0xbc, 0x98, 0x06, 0x63, 0x3d,
+  0xce, 0xa4, 0xc3, 0x3d, 0x93, 0xea, 0x31, 0x3d, 0x5e, 0xdb, 0x7e, 0x3d,
+  0xd4, 0xb4, 0x55, 0x3c, 0xec, 0x40, 0xb2, 0xbd, 0xa9, 0x0e, 0x24, 0x3c,
+  0xc1, 0x80, 0xba, 0xbc, 0xd9, 0xa7, 0x3d, 0x3d, 0x2f, 0x23, 0xcb, 0x3d,
+  0x43, 0x1c, 0x97, 0xbc, 0xbb, 0xb2, 0x85, 0x3c, 0x5b, 0xe4, 0xa0, 0xbd,
+  0x44, 0x4e, 0x8b, 0xbc, 0x1e, 0xe6, 0x2d, 0x3d, 0xdf, 0x6b, 0x9d, 0xbd,
+  0xa4, 0x58, 0x2c, 0x3d, 0xf0, 0xc2, 0x37, 0x3d, 0xe2, 0xe2, 0x23, 0x3d,
+  0xd3, 0x1c, 0xd6, 0x3c, 0x6f, 0xd3, 0x39, 0x3d, 0x70, 0xbe, 0x45, 0xbd,
+  0x6b, 0xfb, 0x35, 0x3d, 0x50, 0xb6, 0x09, 0x3d, 0xc6, 0x6f, 0xc5, 0x3d,
+  0xcd, 0x77, 0x43, 0xbe, 0x39, 0x94, 0x2e, 0xbe, 0xa3, 0x52, 0x74, 0xbd,
+  0xfc, 0x25, 0x18, 0x3c, 0x9b, 0x50, 0xfb, 0x3c, 0x93, 0x5d, 0xcf, 0x3d,
+  0x7f, 0xd0, 0x7e, 0xbd, 0x11, 0xa1, 0xca, 0x3c, 0x9f, 0x91, 0x2f, 0xbd,
+  0x91, 0x6b, 0x8a, 0x3d, 0x4c, 0xc5, 0x28, 0xbe, 0x56, 0x20, 0x72, 0xbd,
+  0x27, 0x38, 0xc2, 0xbc, 0x0b, 0x97, 0x9d, 0x3d, 0x9c, 0x1e, 0xbc, 0xbc,
+  0x2c, 0xa0, 0xb1, 0x3d, 0xc2, 0x4d, 0x34, 0xbe, 0x6d, 0xc1, 0xac, 0xbd,
+  0x47, 0xde, 0x16, 0x3e, 0x95, 0x72, 0xfe, 0xbd, 0x18, 0x83, 0xce, 0x3d,
+  0xdf, 0xe7, 0x97, 0x3d, 0x53, 0xec, 0x89, 0xbd, 0x10, 0xaf, 0x44, 0x3c,
+  0xf5, 0xa4, 0xc8, 0x3b, 0x24, 0x42, 0xb2, 0xbc, 0xf6, 0x46, 0x92, 0x3d,
+  0xc4, 0x81, 0x5f, 0x3d, 0x61, 0x0a, 0x1b, 0xbe, 0xc5, 0xbc, 0xc5, 0x3d,
+  0x0d, 0x9c, 0x5b, 0x3d, 0xf6, 0x23, 0xba, 0xbb, 0x71, 0xca, 0x6b, 0xbe,
+  0x1c, 0x4c, 0x7c, 0xbd, 0xae, 0x4d, 0x05, 0x3e, 0x7b, 0x67, 0x68, 0x3c,
+  0x24, 0x45, 0xeb, 0x3c, 0xf6, 0xe7, 0x41, 0x3e, 0x3e, 0xc0, 0xa1, 0x3c,
+  0x3d, 0x93, 0xc0, 0xbc, 0xd3, 0x66, 0x91, 0x3d, 0x67, 0x5c, 0xa5, 0xbc,
+  0x3b, 0xfb, 0x6f, 0xbd, 0x51, 0xc0, 0xd3, 0x3d, 0xf1, 0x1d, 0xe8, 0x3c,
+  0x87, 0x52, 0x9b, 0x3d, 0xa4, 0x2c, 0x90, 0xbc, 0xa4, 0x39, 0x66, 0x3c,
+  0x40, 0x20, 0xd0, 0xbd, 0x52, 0x4c, 0x15, 0xbd, 0xd8, 0x0e, 0xa8, 0x3c,
+  0x39, 0x70, 0x0f, 0xbd, 0x52, 0xe3, 0x87, 0xbd, 0xc9, 0xdc, 0x7d, 0x3d,
+  0xf1, 0x76, 0x72, 0xbd, 0x1c, 0x24, 0xd0, 0x3c, 0x37, 0x8b, 0x01, 0x3d,
+  0x49, 0xc6, 0x03, 0x3d, 0x30, 0x65, 0x8f, 0xbc, 0x10, 0x3e, 0x4b, 0xbd,
+  0xa0, 0x0b, 0x5d, 0x3d, 0x09, 0xdf, 0xaf, 0xbd, 0x91, 0xad, 0x46, 0xbd,
+  0xcd, 0xb3, 0x05, 0xbd, 0x14, 0xd4, 0x0b, 0xbe, 0xd4, 0x54, 0x53, 0xbd,
+  0xa0, 0xcb, 0x97, 0x3d, 0x63, 0xac, 0xb5, 0xbd, 0xa3, 0x17, 0x2c, 0x3d,
+  0xf7, 0xd8, 0x83, 0xbd, 0xf8, 0x1c, 0x19, 0x3d, 0xbc, 0xed, 0x8c, 0x3b,
+  0x80, 0x63, 0x98, 0xbc, 0xe2, 0x66, 0x31, 0x3d, 0xe5, 0x32, 0x9a, 0xbd,
+  0x07, 0xf0, 0xa7, 0xbd, 0xad, 0x27, 0xcf, 0xbc, 0xad, 0x58, 0x08, 0xbc,
+  0xc1, 0x9f, 0x9d, 0xbb, 0x22, 0x2c, 0xd6, 0xbb, 0xb5, 0xc7, 0x92, 0xbe,
+  0x22, 0xfb, 0x42, 0xbe, 0x02, 0x0a, 0x43, 0xbd, 0xfb, 0x3e, 0xf2, 0xbc,
+  0x82, 0xe6, 0x71, 0x3c, 0x07, 0xab, 0xd7, 0x3d, 0x0f, 0xc9, 0xd1, 0x3c,
+  0xeb, 0x44, 0x80, 0x3d, 0x47, 0x7c, 0x2e, 0xbd, 0x15, 0xe2, 0xa6, 0x3d,
+  0xcc, 0x71, 0x96, 0xbd, 0xfe, 0x77, 0x72, 0x3c, 0x6d, 0x34, 0xf4, 0xbd,
+  0x5b, 0xce, 0x6e, 0x3d, 0x50, 0xe5, 0xe6, 0xbc, 0x48, 0x6e, 0x2d, 0xbd,
+  0x6f, 0xbf, 0x59, 0x3d, 0x8e, 0x74, 0x00, 0xbe, 0x6f, 0x68, 0x6b, 0x3d,
+  0xeb, 0x23, 0x6f, 0xbd, 0xe1, 0xe6, 0x7a, 0x3c, 0x66, 0xa4, 0xf9, 0x3d,
+  0x86, 0xc7, 0x58, 0x3b, 0x8c, 0xb3, 0xff, 0x3c, 0xf5, 0x59, 0xaf, 0x3d,
+  0xe7, 0x94, 0xed, 0xbc, 0xc0, 0x42, 0x27, 0x3c, 0xc0, 0xcb, 0xef, 0xbd,
+  0xea, 0x01, 0x0b, 0xbe, 0xab, 0x23, 0xd4, 0x3c, 0xbd, 0x94, 0x88, 0x3d,
+  0x89, 0xd7, 0xbc, 0xbc, 0x6b, 0x1c, 0xcc, 0xbc, 0x5b, 0x34, 0x6b, 0xbd,
+  0x1d, 0xa1, 0x14, 0xbd, 0xef, 0x7c, 0x4b, 0xbd, 0x0a, 0x6b, 0xe8, 0x3d,
+  0xd2, 0xb2, 0x7f, 0x3d, 0x25, 0x19, 0x91, 0xbd, 0x68, 0x5c, 0xc7, 0x3c,
+  0x6c, 0xb5, 0x5e, 0x3c, 0x7e, 0xa1, 0x2f, 0x3d, 0x99, 0xf2, 0x95, 0xbd,
+  0x56, 0x05, 0xb8, 0xbd, 0x05, 0x49, 0x9d, 0xbd, 0x29, 0xf1, 0xe9, 0xbc,
+  0xdc, 0x04, 0x1d, 0xbc, 0xbd, 0x27, 0x3a, 0x3d, 0x85, 0xcb, 0xa6, 0xbd,
+  0xfe, 0xf3, 0x8f, 0xbd, 0x9e, 0xa7, 0xc2, 0x3c, 0xca, 0xfa, 0x3a, 0xbd,
+  0x1c, 0xbc, 0x56, 0x3d, 0xb2, 0xac, 0x08, 0x3e, 0x57, 0xb2, 0xbb, 0xbd,
+  0xe4, 0xa4, 0xee, 0x3c, 0x3d, 0x3c, 0x33, 0x3d, 0xae, 0x89, 0x8f, 0xbd,
+  0xba, 0x42, 0xb0, 0xbd, 0x88, 0x43, 0x80, 0xbb, 0x81, 0x83, 0x96, 0xbd,
+  0x06, 0x4e, 0x08, 0xbd, 0xea, 0xf4, 0x58, 0xbd, 0xb4, 0x4b, 0x8a, 0x3d,
+  0xff, 0x9e, 0x7d, 0xbe, 0xe9, 0x0a, 0x4a, 0xbe, 0x39, 0x69, 0x22, 0xbd,
+  0xa8, 0x9f, 0x11, 0xbd, 0x1c, 0x39, 0x60, 0x3d, 0xf8, 0x09, 0x5f, 0x3e,
+  0x1c, 0x0e, 0xb0, 0xbc, 0xdf, 0xf1, 0xc5, 0x3d, 0x0b, 0x21, 0x58, 0x3c,
+  0x8f, 0x53, 0x50, 0x3d, 0xc3, 0x89, 0xad, 0xbd, 0xc0, 0x37, 0xac, 0xbd,
+  0xfb, 0xdf, 0x30, 0xbc, 0x4c, 0xd2, 0x83, 0x3d, 0x8f, 0x5b, 0x66, 0xbd,
+  0x89, 0x35, 0xd2, 0x3d, 0xf8, 0x9a, 0x55, 0xbe, 0x88, 0x56, 0x84, 0xbd,
+  0x06, 0xca, 0x9d, 0x3d, 0xcf, 0x08, 0x12, 0x3c, 0x0e, 0x5f, 0xaa, 0xbc,
+  0x43, 0xc3, 0x95, 0x3d, 0xa9, 0xa0, 0x0e, 0x3d, 0xfa, 0xde, 0x8d, 0x3d,
+  0xfa, 0xce, 0x01, 0x3e, 0x2d, 0x5a, 0x1a, 0xbd, 0xfc, 0xa2, 0x2f, 0xbc,
+  0xfe, 0xbc, 0xf0, 0x3c, 0x37, 0x28, 0x1c, 0x3c, 0x2d, 0xbf, 0xc1, 0x3d,
+  0x1f, 0xb5, 0x08, 0x3d, 0x9d, 0xba, 0x2d, 0xbb, 0x29, 0xa4, 0xaa, 0x3c,
+  0x42, 0x63, 0xdb, 0xbd, 0x0b, 0x4a, 0xb1, 0x3d, 0x57, 0x20, 0xa2, 0xbc,
+  0x73, 0x9e, 0x01, 0xbb, 0x90, 0x12, 0x28, 0x3e, 0xc6, 0x96, 0x8d, 0x3d,
+  0x92, 0x8c, 0xe9, 0xbc, 0x63, 0x6b, 0x00, 0x3e, 0xe9, 0x4b, 0x52, 0x3d,
+  0xad, 0x14, 0x9b, 0x3d, 0xa7, 0x14, 0x05, 0xbd, 0xb0, 0x94, 0xda, 0xbd,
+  0x96, 0xa1, 0x47, 0xbb, 0x76, 0x36, 0x85, 0x3d, 0x6a, 0x50, 0x0f, 0x3d,
+  0xfc, 0xc6, 0xe4, 0xbc, 0x6a, 0xba, 0xd1, 0xbd, 0xb2, 0x85, 0xa3, 0xbc,
+  0x69, 0x45, 0xa5, 0xbc, 0x5b, 0xeb, 0x49, 0x3c, 0x6e, 0x06, 0x63, 0x3e,
+  0xd2, 0x60, 0x6e, 0xbd, 0x28, 0x9c, 0x8a, 0xbc, 0xb7, 0x0f, 0x85, 0x3b,
+  0x44, 0x8a, 0x8a, 0x3d, 0xff, 0x87, 0x84, 0xbd, 0xc0, 0x34, 0xf1, 0xbd,
+  0xc7, 0xea, 0x9b, 0xbd, 0xdf, 0x5b, 0x96, 0x3c, 0xda, 0x17, 0x8b, 0xbc,
+  0xda, 0x50, 0xd8, 0x3d, 0x24, 0x85, 0xe6, 0xbd, 0x12, 0xac, 0x94, 0xbd,
+  0xbd, 0x8c, 0x43, 0xbd, 0x79, 0xf2, 0xe4, 0xbd, 0x69, 0x0d, 0x6b, 0x3c,
+  0x87, 0xae, 0x0c, 0x3e, 0x4b, 0x5b, 0x64, 0x3b, 0x23, 0x3d, 0x9d, 0xbc,
+  0xce, 0x0d, 0xd9, 0xbc, 0xf3, 0x75, 0x3f, 0xbc, 0x7c, 0xc1, 0x20, 0x3c,
+  0x17, 0xcf, 0x3c, 0xbd, 0x6b, 0xa1, 0x2a, 0x3c, 0x63, 0xa8, 0x5c, 0x3d,
+  0x1a, 0xdf, 0xaf, 0x3d, 0xc5, 0x25, 0x95, 0x3b, 0xcf, 0x62, 0x71, 0xbe,
+  0x7b, 0x55, 0x83, 0xbd, 0xa6, 0x00, 0x07, 0x3e, 0x95, 0x3f, 0x89, 0x3d,
+  0xc7, 0x0f, 0x7c, 0x3d, 0x99, 0x85, 0x87, 0x3c, 0x67, 0x39, 0xd6, 0xbc,
+  0x3d, 0x90, 0xab, 0x3d, 0x0e, 0xd4, 0x08, 0xbd, 0xba, 0x5a, 0x9e, 0xbd,
+  0xd7, 0x85, 0xd4, 0x3c, 0xfd, 0x81, 0x16, 0xbd, 0xf3, 0xe3, 0x66, 0xbd,
+  0x77, 0xf3, 0xd6, 0x3b, 0xb3, 0x4d, 0x6d, 0x3d, 0x24, 0x67, 0x8a, 0x3d,
+  0x84, 0xfd, 0x39, 0xbe, 0x97, 0xd3, 0x7c, 0xbd, 0xd7, 0x4b, 0x05, 0x3d,
+  0x27, 0xad, 0x0b, 0xbd, 0xb1, 0x22, 0x14, 0x3d, 0xf0, 0xf4, 0xac, 0x3d,
+  0xa7, 0x7c, 0xd5, 0x3c, 0x9f, 0xec, 0x89, 0x3d, 0xab, 0x54, 0x50, 0x3d,
+  0x06, 0x99, 0x8c, 0xbd, 0xb9, 0x22, 0x53, 0xbd, 0x71, 0xdc, 0xa2, 0x3d,
+  0xb1, 0x29, 0x1d, 0x3d, 0xb2, 0xab, 0xa8, 0x3c, 0xc0, 0xf3, 0x76, 0x3d,
+  0xc1, 0x99, 0xff, 0x3c, 0xdf, 0x02, 0x48, 0xbe, 0x86, 0x56, 0x9d, 0xbc,
+  0x98, 0xce, 0xf1, 0x3d, 0x24, 0x73, 0x48, 0xbb, 0x96, 0x74, 0x61, 0x3d,
+  0xeb, 0x61, 0x32, 0x3d, 0x91, 0x09, 0x9a, 0xbd, 0xcf, 0x56, 0xba, 0x3c,
+  0x67, 0x00, 0x18, 0x3e, 0xb8, 0x2c, 0x38, 0x3d, 0xb2, 0x83, 0xf1, 0x3c,
+  0x1c, 0x21, 0x4b, 0xbd, 0x07, 0xe6, 0xa2, 0x3b, 0x37, 0x16, 0x3a, 0x3c,
+  0x65, 0xde, 0x39, 0xbd, 0x13, 0x2c, 0x1f, 0x3d, 0xc5, 0x51, 0x17, 0xbe,
+  0x2c, 0x48, 0xd8, 0xbd, 0xb8, 0xa5, 0xa5, 0x3c, 0x82, 0xba, 0x90, 0xbd,
+  0xa7, 0xb8, 0xd4, 0x3c, 0x7b, 0x9d, 0x21, 0x3e, 0x98, 0x6f, 0x5b, 0xbd,
+  0xbf, 0x23, 0x5d, 0xbc, 0x65, 0x69, 0x9c, 0x3d, 0xe0, 0xfc, 0x5c, 0x3d,
+  0xcc, 0xc6, 0xac, 0x3b, 0x65, 0x87, 0xcf, 0xbc, 0x8a, 0x5b, 0x25, 0xbd,
+  0x74, 0xa3, 0xec, 0x3c, 0x95, 0xd8, 0x00, 0xbd, 0x16, 0x90, 0x9b, 0x3d,
+  0x89, 0xc0, 0x9c, 0xbd, 0x30, 0xbb, 0xd2, 0xbd, 0x11, 0x50, 0x44, 0xbd,
+  0x63, 0x2c, 0x5e, 0xbd, 0xb6, 0xe9, 0x99, 0x3c, 0x9f, 0xbd, 0x1f, 0x3e,
+  0x0e, 0x49, 0x83, 0xbb, 0x69, 0x68, 0x92, 0x3d, 0xba, 0x80, 0x13, 0x3d,
+  0x65, 0x1c, 0xe7, 0x3c, 0xea, 0x76, 0x52, 0x3c, 0xa8, 0xb1, 0x9c, 0xbc,
+  0x09, 0x88, 0x03, 0xbe, 0xf7, 0x32, 0x53, 0xbd, 0x46, 0xf9, 0x1f, 0xbb,
+  0x35, 0xf5, 0x34, 0xbd, 0x64, 0x28, 0xc2, 0x3b, 0x60, 0xf8, 0xe6, 0xbd,
+  0xd2, 0xf1, 0x74, 0x3c, 0xfd, 0xe8, 0x8f, 0xbd, 0x79, 0x92, 0x7d, 0x3d,
+  0xb0, 0x4b, 0x4a, 0x3e, 0x85, 0x11, 0x86, 0xbd, 0xa9, 0x09, 0x12, 0x3b,
+  0xd4, 0x22, 0xe1, 0xbc, 0x11, 0xff, 0x14, 0xbc, 0x01, 0x9a, 0xe2, 0xbc,
+  0x40, 0x0f, 0xfe, 0xbb, 0x1a, 0xcd, 0x34, 0xbe, 0x7d, 0x56, 0x27, 0xbc,
+  0x43, 0x27, 0x35, 0xbd, 0x31, 0xc1, 0x95, 0x3d, 0xf6, 0xaf, 0xac, 0xbd,
+  0x21, 0xbe, 0x03, 0xbe, 0x3e, 0x4e, 0x16, 0x3d, 0xb5, 0xb3, 0x46, 0xbe,
+  0x36, 0xb9, 0x4e, 0xbd, 0xdc, 0xd1, 0x06, 0x3d, 0x4a, 0x8b, 0x51, 0x3d,
+  0x02, 0x6b, 0x19, 0xbd, 0xab, 0xcc, 0x8e, 0x3d, 0xe9, 0xca, 0xf3, 0xbd,
+  0x03, 0x64, 0x02, 0x3b, 0xfe, 0x42, 0x92, 0xbd, 0x36, 0x4b, 0x01, 0xbe,
+  0xf7, 0x70, 0xf5, 0x3c, 0xb5, 0xc5, 0x55, 0xbd, 0x74, 0x71, 0x3c, 0xbd,
+  0xdb, 0xad, 0xc9, 0xbd, 0x18, 0x14, 0x56, 0xbe, 0x2a, 0xd7, 0xf9, 0xbb,
+  0xba, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0x00, 0x00, 0xce, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x87, 0x43, 0x62, 0xbd,
+  0xc2, 0xd9, 0x6a, 0xbd, 0x81, 0xb4, 0x3c, 0xbe, 0x6c, 0x41, 0xcc, 0xbd,
+  0x41, 0xd5, 0xfc, 0xbd, 0x7c, 0xb1, 0x87, 0xbd, 0x89, 0xe3, 0x88, 0xbc,
+  0x34, 0x4d, 0x4f, 0xbe, 0xfa, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x64, 0x4e, 0xbc, 0x3d, 0x44, 0xed, 0x9e, 0xbd,
+  0xae, 0xd9, 0xad, 0xbd, 0x8f, 0xae, 0x38, 0xbd, 0x20, 0x00, 0xbf, 0xbd,
+  0x76, 0xbf, 0x08, 0xbd, 0x69, 0xd7, 0x80, 0xbd, 0x7e, 0x04, 0x3d, 0x3d,
+  0x14, 0x76, 0xfa, 0x3c, 0x45, 0x09, 0xea, 0xbc, 0x2a, 0xb0, 0xd0, 0xbc,
+  0xc7, 0x7f, 0x70, 0xbd, 0xda, 0xe2, 0xf0, 0xbd, 0x76, 0xf6, 0x5b, 0x3e,
+  0xa2, 0xe1, 0x60, 0x3d, 0x67, 0x2d, 0xce, 0xbd, 0x46, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x66, 0x0a, 0x4b, 0x3d,
+  0xed, 0xdd, 0x40, 0x3c, 0x83, 0xd6, 0x6c, 0xbd, 0x64, 0xf5, 0xff, 0xff,
+  0x68, 0xf5, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
+  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x84, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4a, 0xfe, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x82, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3c, 0xf6, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x5a, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd6, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00,
+  0x34, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00,
+  0x60, 0x06, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00,
+  0x70, 0x05, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00,
+  0x78, 0x04, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x70, 0x03, 0x00, 0x00,
+  0x14, 0x03, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xba, 0xf8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xac, 0xf8, 0xff, 0xff,
+  0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
+  0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
+  0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x79,
+  0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c,
+  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
+  0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
+  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x5a, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x4c, 0xf9, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74,
+  0x65, 0x6e, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
+  0x9e, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x90, 0xf9, 0xff, 0xff,
+  0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f,
+  0x6f, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xf2, 0xf9, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xe4, 0xf9, 0xff, 0xff,
+  0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e,
+  0x64, 0x44, 0x69, 0x6d, 0x73, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4a, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x3c, 0xfa, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+  0x31, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
+  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
+  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e,
+  0x76, 0x31, 0x44, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b,
+  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x62, 0x69, 0x61,
+  0x73, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x31, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xfe, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xf0, 0xfa, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x31, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x56, 0xfb, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x48, 0xfb, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d,
+  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
+  0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xaa, 0xfb, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x9c, 0xfb, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d,
+  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
+  0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x31,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xf4, 0xfb, 0xff, 0xff,
+  0x76, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x52, 0x65,
+  0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
+  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x42, 0x69, 0x61,
+  0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a,
+  0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x62, 0x69, 0x61,
+  0x73, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x31, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xaa, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x9c, 0xfc, 0xff, 0xff,
+  0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44,
+  0x69, 0x6d, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0xea, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x34, 0x00, 0x00, 0x00, 0xf8, 0xfc, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d,
+  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
+  0x5f, 0x31, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d,
+  0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
+  0x48, 0xfd, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x98, 0xfd, 0xff, 0xff,
+  0x23, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x31, 0x64, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44,
+  0x69, 0x6d, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd6, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
+  0xe4, 0xfd, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2c, 0xfe, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x86, 0xfe, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x78, 0xfe, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xd2, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc4, 0xfe, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x4d, 0x61,
+  0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x00, 0x00,
+  0x1c, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74,
+  0x65, 0x6e, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00,
+  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
+  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x62, 0x69, 0x61,
+  0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xce, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0x00, 0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x62,
+  0x69, 0x61, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x5f, 0x78, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa5, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xdc, 0xff, 0xff, 0xff,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe8, 0xff, 0xff, 0xff,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf4, 0xff, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
+};
+unsigned int ds_cnn_s_model_len = 18452;
@@ -0,0 +1,911 @@
+const unsigned char ds_cnn_s_model_fp16[] = {
+  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x24, 0x2a, 0x00, 0x00, 0x58, 0x1f, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
+  0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xf8, 0x1e, 0x00, 0x00, 0xf0, 0x1e, 0x00, 0x00,
+  0xd4, 0x1e, 0x00, 0x00, 0x84, 0x1e, 0x00, 0x00, 0x54, 0x1e, 0x00, 0x00,
+  0x3c, 0x1e, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xce, 0xe0, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x35, 0x2e,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd4, 0xd6, 0xff, 0xff, 0xd8, 0xd6, 0xff, 0xff, 0xdc, 0xd6, 0xff, 0xff,
+  0xe0, 0xd6, 0xff, 0xff, 0xe4, 0xd6, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff,
+  0xec, 0xd6, 0xff, 0xff, 0xf0, 0xd6, 0xff, 0xff, 0xf4, 0xd6, 0xff, 0xff,
+  0xf8, 0xd6, 0xff, 0xff, 0xfc, 0xd6, 0xff, 0xff, 0x16, 0xe1, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x32, 0xe1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4e, 0xe1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6a, 0xe1, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x86, 0xe1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x77, 0xae, 0x94, 0xb4, 0x9d, 0xb3, 0x08, 0x32, 0x74, 0xb4, 0xe9, 0xb6,
+  0x99, 0x36, 0xc8, 0xaf, 0x50, 0x33, 0xb0, 0xb2, 0x11, 0xb5, 0x53, 0xae,
+  0x59, 0xb4, 0x95, 0xb6, 0x58, 0x30, 0x6d, 0xb0, 0xb1, 0x30, 0x3d, 0xb0,
+  0x53, 0x34, 0xd9, 0x30, 0x98, 0xb0, 0xb2, 0x31, 0x75, 0x35, 0x9a, 0x22,
+  0x04, 0xb2, 0x36, 0x34, 0x4f, 0xb4, 0x5b, 0xb4, 0xd3, 0x23, 0x01, 0xae,
+  0xbe, 0x2c, 0x32, 0x34, 0x9c, 0xb1, 0xf9, 0xb0, 0x51, 0xb0, 0xa7, 0x2a,
+  0x96, 0xae, 0xc1, 0x2f, 0x02, 0xb0, 0x3a, 0x30, 0x92, 0x33, 0x55, 0x34,
+  0x6f, 0x28, 0x39, 0x34, 0x3f, 0x34, 0x6f, 0xab, 0x4f, 0xaf, 0x47, 0x2d,
+  0x77, 0xb4, 0x0d, 0x31, 0x77, 0xb4, 0x0b, 0xb4, 0x89, 0x2c, 0x80, 0x33,
+  0x9d, 0xb1, 0xb5, 0xac, 0xe8, 0x35, 0xc8, 0xab, 0x73, 0xaf, 0xd3, 0x35,
+  0x43, 0x34, 0x00, 0x25, 0x43, 0xb1, 0x1c, 0x36, 0x62, 0x26, 0x59, 0xae,
+  0x8c, 0xad, 0x4f, 0xb0, 0x48, 0x2e, 0xef, 0x30, 0xe9, 0x28, 0x68, 0x33,
+  0x14, 0xb4, 0x3d, 0x2c, 0x94, 0xa0, 0x8a, 0xa5, 0xc0, 0xad, 0x3b, 0x32,
+  0xc9, 0xb0, 0x23, 0x30, 0x62, 0xb1, 0x28, 0xae, 0x2a, 0xa6, 0x34, 0x34,
+  0xb8, 0x31, 0x2a, 0x33, 0xa9, 0x30, 0xee, 0xb0, 0x5f, 0xad, 0x02, 0xb5,
+  0x80, 0x2e, 0x94, 0x20, 0x67, 0xae, 0x34, 0x30, 0xe8, 0x30, 0xd7, 0xb2,
+  0x08, 0x29, 0x01, 0xa2, 0x0e, 0x30, 0x3c, 0xa9, 0xe0, 0x2f, 0x46, 0xb1,
+  0x3c, 0xb1, 0xcd, 0x31, 0xfa, 0xb4, 0xcc, 0xae, 0x17, 0xac, 0xac, 0xac,
+  0x74, 0xad, 0x76, 0xb2, 0x5d, 0x27, 0xc0, 0x34, 0x8c, 0x34, 0xde, 0xb4,
+  0xa1, 0x2f, 0x3f, 0x34, 0x74, 0xb0, 0x19, 0x34, 0xa8, 0xb2, 0xa8, 0x33,
+  0x6a, 0x30, 0x95, 0xb1, 0x52, 0xb3, 0x27, 0x2a, 0x3c, 0x36, 0x0d, 0x35,
+  0xed, 0xaa, 0x2f, 0x35, 0xff, 0xb2, 0x5a, 0xb2, 0x82, 0xb2, 0x20, 0x2e,
+  0xc4, 0x33, 0x2c, 0x35, 0x96, 0xb0, 0x0f, 0xab, 0x1b, 0xa8, 0x12, 0x27,
+  0xb3, 0x91, 0x9a, 0xad, 0x66, 0x36, 0xa7, 0xab, 0xac, 0xb1, 0xdb, 0x30,
+  0x15, 0x32, 0x89, 0xa0, 0xac, 0x2e, 0x1c, 0x34, 0xe3, 0x2f, 0xe0, 0x2d,
+  0x5e, 0xb2, 0xee, 0x31, 0xe2, 0x2a, 0x33, 0xad, 0x82, 0x2c, 0x29, 0xb3,
+  0x86, 0x21, 0x3d, 0x34, 0x2e, 0xb0, 0x1e, 0xb3, 0xb1, 0xaf, 0xda, 0x2e,
+  0x29, 0xb0, 0xc8, 0xa8, 0x54, 0x34, 0x3a, 0xb3, 0x4a, 0xae, 0x73, 0xa8,
+  0x4e, 0xb3, 0xb3, 0xb3, 0x91, 0x32, 0x6e, 0x1d, 0x68, 0x9b, 0xbc, 0x33,
+  0x2c, 0x31, 0x37, 0x22, 0x60, 0xa9, 0xa3, 0xb5, 0xc7, 0xb1, 0xac, 0x2c,
+  0xd8, 0x35, 0xf1, 0x2f, 0x06, 0x32, 0xb3, 0xb5, 0xcb, 0xb5, 0x67, 0xb5,
+  0xec, 0xb1, 0x66, 0x23, 0x49, 0x34, 0x14, 0x2c, 0x2a, 0xb0, 0xf0, 0x2f,
+  0xa8, 0xb1, 0xaf, 0xb2, 0x03, 0x35, 0x6e, 0xb0, 0x48, 0xb1, 0x65, 0xaf,
+  0x0f, 0x2a, 0x97, 0x31, 0x62, 0xad, 0x3d, 0xb0, 0x75, 0xb2, 0x20, 0x31,
+  0x8c, 0x2d, 0xbb, 0xaa, 0x9a, 0x34, 0xe7, 0x30, 0x5e, 0xa5, 0x78, 0xb5,
+  0x3a, 0x30, 0x7e, 0xb4, 0xf3, 0xaf, 0x84, 0xb4, 0x96, 0x35, 0x3b, 0x2b,
+  0x12, 0xb4, 0x35, 0xb1, 0x82, 0x31, 0xa2, 0xad, 0x6e, 0x30, 0x28, 0x31,
+  0xca, 0xb5, 0x2a, 0xb2, 0xd9, 0xb0, 0x68, 0x34, 0x45, 0x36, 0x23, 0xb4,
+  0x8f, 0x2b, 0x8e, 0x2b, 0x0b, 0x2c, 0xdb, 0xb3, 0x1a, 0xb4, 0x70, 0x2b,
+  0xf4, 0x34, 0x27, 0x23, 0x62, 0xa6, 0x48, 0xa9, 0x29, 0x9f, 0x82, 0xae,
+  0x9b, 0x26, 0x75, 0xa1, 0x33, 0x2c, 0x36, 0xac, 0x3f, 0xb1, 0x46, 0xb5,
+  0x94, 0xaa, 0xe8, 0x24, 0xff, 0x37, 0x11, 0xa6, 0x99, 0x22, 0xde, 0x2e,
+  0x19, 0x2c, 0x77, 0xa8, 0x65, 0x35, 0x65, 0xb2, 0x59, 0x2a, 0x4a, 0xb0,
+  0x16, 0xb0, 0x51, 0xb4, 0xd1, 0xb2, 0x8d, 0xb1, 0x0d, 0x36, 0xe5, 0xab,
+  0xc3, 0x2d, 0x1e, 0xb2, 0x46, 0xac, 0x32, 0x2d, 0xb5, 0xb0, 0x1a, 0xb1,
+  0x8b, 0x31, 0xd3, 0x20, 0x02, 0xae, 0x8a, 0x31, 0x72, 0x31, 0xd2, 0xaf,
+  0x54, 0xb3, 0xf8, 0x9e, 0xc5, 0x2c, 0x89, 0x34, 0x68, 0x31, 0x62, 0x1c,
+  0xf0, 0xb3, 0xd0, 0x33, 0x48, 0x31, 0x11, 0xb4, 0xec, 0x32, 0x90, 0x2b,
+  0xc8, 0x32, 0x6c, 0x14, 0xcc, 0xb4, 0xd7, 0xad, 0xc2, 0x2c, 0x01, 0x34,
+  0xc7, 0xa1, 0xbd, 0xb1, 0x2d, 0xab, 0x3a, 0xad, 0x54, 0x31, 0x8e, 0xa6,
+  0x7a, 0x31, 0x59, 0xb4, 0x77, 0x26, 0xae, 0x32, 0x8e, 0x2c, 0x84, 0x2e,
+  0xfe, 0xb2, 0xb5, 0xb1, 0x60, 0xae, 0xc1, 0x31, 0x6d, 0xae, 0xdb, 0x33,
+  0x5c, 0xb4, 0x41, 0xa5, 0x30, 0xb2, 0x82, 0x35, 0x1e, 0xa2, 0xb5, 0xaf,
+  0xee, 0xa9, 0xd9, 0xb6, 0x6f, 0xb5, 0x4a, 0xb3, 0xd8, 0x29, 0xa2, 0x25,
+  0x2f, 0x37, 0xe1, 0x2e, 0x1f, 0xb1, 0x60, 0xb3, 0x48, 0xb5, 0x56, 0xb4,
+  0x10, 0xac, 0x1b, 0x33, 0x76, 0x34, 0xfd, 0x2f, 0xaf, 0x2c, 0x4d, 0xb1,
+  0x87, 0xaf, 0x53, 0x34, 0x74, 0x35, 0xb0, 0x2c, 0x74, 0xb4, 0xaf, 0x34,
+  0xc8, 0xb6, 0x8f, 0xb6, 0x4d, 0xad, 0xcd, 0x34, 0xea, 0x25, 0xe1, 0xa4,
+  0x0e, 0x2e, 0x88, 0x2d, 0x8b, 0xb3, 0x7a, 0xb5, 0x11, 0xb1, 0xf1, 0x35,
+  0x05, 0x35, 0x6c, 0xb1, 0xbc, 0xac, 0x4b, 0x31, 0xfd, 0xb0, 0x5f, 0xb4,
+  0xa8, 0x35, 0x30, 0x2a, 0x11, 0xb0, 0x23, 0x32, 0xe8, 0xb1, 0xc3, 0xb4,
+  0x5d, 0xaf, 0xcf, 0x28, 0xc4, 0xa8, 0x41, 0x2a, 0x00, 0xac, 0x6c, 0xb4,
+  0x87, 0x2c, 0xc4, 0x2f, 0x25, 0x37, 0x7f, 0x2e, 0x51, 0x34, 0xe6, 0xb2,
+  0x0c, 0x2e, 0x58, 0xb3, 0x75, 0xb0, 0x86, 0x30, 0xba, 0xac, 0xe0, 0x33,
+  0x92, 0xe4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00,
+  0x97, 0xb7, 0x3a, 0x34, 0x1f, 0xb5, 0x33, 0x2e, 0xfe, 0x32, 0xcb, 0xb3,
+  0x5b, 0x2f, 0x5a, 0x35, 0xb2, 0x23, 0xca, 0xb5, 0xcb, 0xad, 0x43, 0xa9,
+  0xc3, 0xa3, 0xe8, 0x37, 0x8c, 0xb0, 0x3a, 0xb5, 0x7d, 0x1b, 0x4f, 0xae,
+  0x32, 0x20, 0x54, 0xac, 0x16, 0xb4, 0x72, 0x1f, 0xc6, 0xa6, 0x94, 0x35,
+  0x92, 0x35, 0x35, 0x34, 0x1c, 0xb6, 0xc9, 0xb2, 0x8f, 0x35, 0x9d, 0xb2,
+  0xc4, 0xaf, 0x24, 0x2d, 0x0e, 0x1b, 0x89, 0xad, 0xee, 0x30, 0x3a, 0x32,
+  0x69, 0xb6, 0x7e, 0xb5, 0x63, 0xb0, 0x0e, 0x2e, 0x1e, 0xaf, 0xc1, 0xb4,
+  0x7c, 0xb0, 0xdc, 0x2e, 0x0f, 0xac, 0x5f, 0x2c, 0x25, 0xb6, 0x48, 0x2d,
+  0xf5, 0x32, 0x24, 0x32, 0x7e, 0xb4, 0xf0, 0x36, 0x82, 0x33, 0x89, 0xab,
+  0xdb, 0x2c, 0xe0, 0x2a, 0xb5, 0x2e, 0x8b, 0x26, 0x73, 0xa8, 0x40, 0xb5,
+  0xa1, 0x35, 0x60, 0xb0, 0x4c, 0xb1, 0x43, 0x2c, 0xdc, 0x31, 0x29, 0x29,
+  0x79, 0x04, 0x58, 0xb5, 0x0e, 0x35, 0x97, 0x29, 0x47, 0xb1, 0x45, 0x2c,
+  0xc1, 0xb3, 0xda, 0x24, 0xc6, 0xb0, 0xd9, 0x2d, 0xfe, 0xac, 0x25, 0x34,
+  0xc9, 0x34, 0xa8, 0xb0, 0x88, 0xb4, 0x84, 0x35, 0xc6, 0xb1, 0x46, 0xaf,
+  0xa1, 0xb1, 0x84, 0x2c, 0x8c, 0xa8, 0x76, 0xae, 0x5e, 0x23, 0xb2, 0x30,
+  0x2b, 0x31, 0x1c, 0x36, 0x19, 0xb0, 0x93, 0xb7, 0x43, 0x31, 0xae, 0xa8,
+  0x20, 0xa5, 0xa8, 0x2c, 0x0d, 0xb1, 0x51, 0x2d, 0x96, 0xa5, 0x1f, 0x2c,
+  0x49, 0xad, 0xdd, 0x2f, 0x40, 0x34, 0x5e, 0xb4, 0xcb, 0xb5, 0x73, 0x2b,
+  0x80, 0xb1, 0x13, 0x27, 0xff, 0x23, 0x07, 0xb4, 0x48, 0xae, 0x78, 0x2c,
+  0x54, 0xad, 0x71, 0xad, 0x23, 0x30, 0x70, 0xb6, 0x6b, 0x35, 0xf9, 0xa2,
+  0x20, 0x34, 0x7a, 0x2f, 0xd3, 0xb2, 0xa5, 0xa5, 0x62, 0x32, 0x9f, 0xb0,
+  0xac, 0x9a, 0xf4, 0x28, 0x1b, 0x2d, 0x51, 0x1d, 0x88, 0x33, 0x81, 0x35,
+  0xb1, 0xaf, 0x38, 0x2c, 0x7b, 0xb0, 0xc5, 0xb1, 0x3e, 0xb5, 0xad, 0x2c,
+  0x7f, 0x2c, 0xc7, 0x30, 0xbd, 0xb2, 0xff, 0x33, 0x9c, 0xad, 0x31, 0xb2,
+  0x4c, 0xb1, 0x32, 0xa0, 0x2c, 0x33, 0x50, 0xaf, 0xdb, 0x2d, 0xe1, 0xac,
+  0x87, 0xaa, 0x15, 0xb1, 0xaa, 0x2f, 0xf2, 0xad, 0xd7, 0x34, 0xee, 0xac,
+  0x19, 0xb1, 0xbb, 0x30, 0x11, 0xb0, 0x2e, 0x32, 0xb8, 0x1a, 0x8a, 0x24,
+  0x25, 0xb2, 0xb3, 0x2e, 0x24, 0xb6, 0x36, 0x30, 0x9b, 0xaf, 0xd6, 0x30,
+  0x4d, 0xad, 0x73, 0xa2, 0x8f, 0xa5, 0x08, 0xb2, 0x87, 0x34, 0x3a, 0xb6,
+  0xee, 0x35, 0x5b, 0xb8, 0x57, 0x36, 0x90, 0xb6, 0xc9, 0x35, 0xb3, 0xb6,
+  0x15, 0x34, 0xf9, 0xb0, 0xcf, 0xb1, 0x51, 0xb4, 0xc8, 0x35, 0x88, 0xb4,
+  0x6f, 0x2e, 0x4e, 0xb3, 0x61, 0x35, 0x22, 0xb2, 0xb5, 0xac, 0x89, 0xb5,
+  0x86, 0x34, 0x98, 0x99, 0xe7, 0xaf, 0x4f, 0x35, 0xed, 0xab, 0xfa, 0x2a,
+  0xb2, 0xb2, 0x91, 0x2e, 0xd2, 0xb2, 0x32, 0x34, 0x32, 0xb2, 0x6d, 0x33,
+  0xe0, 0xb0, 0xae, 0x2c, 0x11, 0xb1, 0x12, 0x32, 0x0f, 0x2c, 0x27, 0x29,
+  0xc2, 0xab, 0xd9, 0x30, 0x55, 0x2c, 0x79, 0xae, 0x09, 0x32, 0x08, 0x2f,
+  0x0d, 0x2c, 0x59, 0x31, 0x3a, 0xac, 0xfd, 0xac, 0xf4, 0xa8, 0xff, 0x35,
+  0x1c, 0xab, 0x7e, 0xaf, 0x47, 0x2c, 0x35, 0x1c, 0x83, 0x32, 0x88, 0xb4,
+  0x0b, 0x31, 0x10, 0xb4, 0x28, 0x35, 0x12, 0xb0, 0x29, 0x22, 0xa6, 0xae,
+  0xed, 0xb4, 0xa4, 0xb5, 0x71, 0x27, 0xbb, 0xb4, 0xd8, 0x32, 0x03, 0xab,
+  0x78, 0x34, 0x8f, 0x2b, 0x84, 0xb1, 0x18, 0x36, 0x98, 0xb0, 0x66, 0x31,
+  0xa3, 0xa2, 0x88, 0xac, 0x85, 0x31, 0xe2, 0x2c, 0x79, 0x36, 0xa5, 0xb2,
+  0xc8, 0xa8, 0xd3, 0xb0, 0x79, 0xb5, 0xc7, 0x33, 0x5b, 0xac, 0x1c, 0x32,
+  0x04, 0xb6, 0x3b, 0xb5, 0xfd, 0xb3, 0x16, 0xb4, 0xc7, 0x36, 0xaa, 0xad,
+  0x1b, 0xb5, 0x15, 0xb4, 0x64, 0xab, 0x48, 0x32, 0xe6, 0x2e, 0x94, 0x34,
+  0x1f, 0x25, 0x20, 0xb6, 0x6c, 0xb4, 0xc5, 0xa7, 0x4d, 0x24, 0x2b, 0x27,
+  0x19, 0x32, 0x4b, 0x31, 0x46, 0xac, 0xa1, 0x32, 0xad, 0x2c, 0xd9, 0x2f,
+  0xd1, 0x30, 0x11, 0xb5, 0x38, 0x29, 0x84, 0x29, 0x59, 0x39, 0x61, 0xaf,
+  0x9b, 0x34, 0x1f, 0xb4, 0x06, 0x31, 0x3d, 0x34, 0xf9, 0xb4, 0xb0, 0x32,
+  0x74, 0x29, 0xfc, 0x33, 0x57, 0x32, 0x28, 0x31, 0x13, 0xa5, 0xa7, 0xb3,
+  0xc6, 0xb0, 0xae, 0x35, 0x6c, 0x34, 0xe6, 0xad, 0xe4, 0x25, 0xab, 0x34,
+  0x3a, 0xb1, 0x23, 0x2b, 0xe6, 0xaf, 0x3a, 0x32, 0x74, 0xac, 0xf8, 0x2e,
+  0x0e, 0xe7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xa0, 0x17, 0x00, 0x00,
+  0xec, 0xa5, 0xd7, 0xaf, 0xe7, 0xab, 0x09, 0x2d, 0x25, 0xa4, 0x27, 0xab,
+  0x39, 0xa4, 0x40, 0x2f, 0xd2, 0xaa, 0x87, 0x2c, 0x07, 0x26, 0x5e, 0x29,
+  0x6c, 0x2c, 0x14, 0x34, 0xac, 0x2c, 0xba, 0xa4, 0x3d, 0xa8, 0x79, 0x23,
+  0x0c, 0xb1, 0xe1, 0x1a, 0xda, 0xa4, 0x61, 0x2c, 0x25, 0x2c, 0xcf, 0x30,
+  0x0b, 0x2c, 0x5f, 0x98, 0x9b, 0x1e, 0x1b, 0xa4, 0x36, 0xac, 0x80, 0x34,
+  0x84, 0x99, 0x19, 0xaa, 0x9f, 0x21, 0xbb, 0x2e, 0xc0, 0xaa, 0xc1, 0xa8,
+  0x0f, 0xab, 0x60, 0x29, 0xdd, 0xae, 0xa9, 0x2b, 0xeb, 0xa6, 0xb7, 0x21,
+  0x7d, 0xa8, 0xfb, 0xa9, 0xdb, 0xa2, 0x1e, 0x12, 0xbf, 0x2a, 0x1e, 0xaa,
+  0xd6, 0xae, 0xb6, 0xac, 0xa8, 0xa5, 0xac, 0xa4, 0x7c, 0xa7, 0xd8, 0x26,
+  0x53, 0x2c, 0x04, 0x2f, 0xff, 0xad, 0x6c, 0x28, 0xc9, 0xb1, 0xaa, 0xaf,
+  0x2e, 0xad, 0x3a, 0x30, 0xa4, 0x32, 0xd6, 0xaa, 0xed, 0xaf, 0x49, 0x84,
+  0xde, 0x20, 0x0d, 0xa3, 0x82, 0x1d, 0x58, 0x2f, 0x45, 0x2c, 0xa1, 0x28,
+  0xcf, 0xac, 0x72, 0x29, 0xb3, 0xaf, 0xe5, 0xac, 0xe2, 0xa9, 0x84, 0x2c,
+  0x59, 0x2c, 0x1b, 0xaa, 0xb7, 0xa5, 0x8b, 0x28, 0x4e, 0x28, 0x11, 0xae,
+  0x88, 0x29, 0xb1, 0xa8, 0xc9, 0xac, 0x1e, 0xa0, 0xd8, 0xa5, 0x03, 0xa8,
+  0xec, 0xa7, 0xcc, 0xa6, 0xc8, 0x28, 0xc8, 0x2c, 0x77, 0x2c, 0x29, 0xaa,
+  0x64, 0xb1, 0xa2, 0xa8, 0xe7, 0xa6, 0xa8, 0x21, 0x46, 0xae, 0xa7, 0xa8,
+  0x5a, 0xa9, 0x22, 0x2c, 0x52, 0xac, 0xdf, 0x23, 0x66, 0xb0, 0xb5, 0xab,
+  0xc2, 0xa3, 0x2b, 0x32, 0x56, 0x1f, 0x18, 0xa8, 0xe7, 0xb1, 0x5b, 0x9e,
+  0xf0, 0x1e, 0xce, 0xa6, 0xdd, 0x2a, 0x25, 0x2c, 0x5b, 0x22, 0x86, 0x2f,
+  0x38, 0xa5, 0x4a, 0x2c, 0x07, 0xaf, 0xdd, 0xae, 0x19, 0xab, 0x61, 0x33,
+  0xef, 0x28, 0x0a, 0xb1, 0x02, 0xb1, 0x9e, 0x21, 0xb3, 0x9f, 0xd4, 0x2a,
+  0x39, 0x24, 0xfc, 0x2c, 0x0c, 0x22, 0x70, 0x30, 0x5b, 0x98, 0xf6, 0x2d,
+  0x74, 0xad, 0x11, 0x9d, 0x6a, 0x24, 0x66, 0x32, 0xcd, 0x2a, 0xb6, 0xb1,
+  0xec, 0xac, 0x6d, 0x2c, 0x46, 0xac, 0x70, 0x2a, 0x7f, 0x28, 0x87, 0x9e,
+  0xf6, 0xae, 0xb3, 0x28, 0xc0, 0x28, 0x7b, 0x2a, 0xff, 0xaa, 0xae, 0xa9,
+  0xad, 0xae, 0x79, 0x32, 0x99, 0x23, 0x7c, 0xaf, 0x91, 0xab, 0x65, 0x1e,
+  0xa2, 0xa1, 0x5e, 0xac, 0x4a, 0xab, 0x85, 0x26, 0x7b, 0x2b, 0xc2, 0x2d,
+  0xef, 0xab, 0x88, 0x1c, 0x98, 0xac, 0x1c, 0x25, 0x9d, 0x24, 0xb5, 0x31,
+  0x59, 0x2e, 0x2b, 0x21, 0x76, 0xb0, 0x1d, 0xac, 0x19, 0xae, 0xce, 0x2c,
+  0x62, 0x1a, 0x35, 0x23, 0xb4, 0x2b, 0x6c, 0xa4, 0xaa, 0xa8, 0xe8, 0x9d,
+  0x96, 0xa8, 0xc8, 0xac, 0x95, 0xa2, 0x2b, 0x30, 0xad, 0x2d, 0xf1, 0xaa,
+  0x2d, 0xa0, 0x27, 0xa8, 0x42, 0xa7, 0xdd, 0x0a, 0xc7, 0xae, 0x73, 0x2f,
+  0x41, 0x29, 0xf0, 0x2d, 0x67, 0xa7, 0x0e, 0xa4, 0x2d, 0x9b, 0xea, 0xad,
+  0x25, 0xac, 0x16, 0x32, 0xe1, 0x2b, 0x19, 0xa9, 0xe7, 0xac, 0x44, 0xac,
+  0xdd, 0x24, 0xcd, 0x2d, 0xc5, 0xaa, 0xbb, 0x2c, 0x31, 0x2b, 0x15, 0x2c,
+  0xe2, 0x1f, 0x57, 0x2f, 0x49, 0x9f, 0xeb, 0xb0, 0x25, 0x2d, 0x3b, 0x24,
+  0x0f, 0x2d, 0x1b, 0xab, 0x02, 0xad, 0x16, 0xa9, 0x40, 0x9c, 0xa6, 0x0e,
+  0x85, 0x28, 0x29, 0x2d, 0x55, 0xac, 0xda, 0x28, 0x6b, 0xa4, 0xee, 0xa9,
+  0xbb, 0xad, 0x54, 0x29, 0xe6, 0x29, 0x1b, 0xa1, 0x43, 0x20, 0x40, 0x22,
+  0x38, 0xad, 0x0e, 0xa0, 0xd0, 0x29, 0x6b, 0xa1, 0x37, 0x2c, 0x22, 0x1e,
+  0x34, 0xa9, 0x83, 0xac, 0x22, 0x9e, 0x9e, 0x26, 0x1a, 0xb0, 0x8a, 0xa1,
+  0xfa, 0xa9, 0xe8, 0x2c, 0x62, 0x20, 0x63, 0xab, 0x8c, 0xae, 0x62, 0x26,
+  0xb9, 0xaf, 0x74, 0x22, 0xa5, 0x16, 0x78, 0x2d, 0x8c, 0x2b, 0x96, 0x20,
+  0xd6, 0x27, 0x6c, 0x28, 0xb4, 0xa8, 0x57, 0x28, 0x26, 0x1f, 0x6e, 0x31,
+  0x7d, 0x2d, 0x7f, 0xaa, 0x33, 0x29, 0x25, 0xa5, 0x04, 0xaf, 0x39, 0xad,
+  0x4f, 0x1d, 0x66, 0xa2, 0xa7, 0x1b, 0x3e, 0x2c, 0x63, 0xa8, 0xb8, 0x13,
+  0x6c, 0x25, 0x1f, 0xaf, 0x02, 0x28, 0x82, 0x2d, 0xd4, 0x30, 0x7e, 0xae,
+  0xd1, 0x28, 0x15, 0x9c, 0x70, 0xa9, 0xea, 0xa0, 0xac, 0xaf, 0xae, 0x2c,
+  0x7a, 0xa6, 0x39, 0x26, 0xa2, 0xa8, 0xcf, 0x25, 0x8c, 0x87, 0x01, 0xa1,
+  0x98, 0xa8, 0xb9, 0x92, 0xc7, 0x30, 0x5c, 0xac, 0xde, 0xaa, 0x21, 0x31,
+  0x73, 0xae, 0x9e, 0x2b, 0xe4, 0x26, 0xcc, 0x90, 0x8e, 0x2b, 0xfb, 0x2a,
+  0x1c, 0xaf, 0x92, 0x2c, 0xee, 0xaf, 0xf4, 0x94, 0xd6, 0x25, 0xda, 0x32,
+  0x63, 0x31, 0x1c, 0xaf, 0x0d, 0xb3, 0x22, 0x28, 0x2e, 0xa3, 0x69, 0x24,
+  0x90, 0xac, 0x85, 0x2e, 0x1c, 0x2f, 0x57, 0x20, 0x1a, 0x2a, 0x5e, 0x2c,
+  0x4f, 0xa6, 0x59, 0xa9, 0x94, 0x23, 0x73, 0x33, 0x9a, 0x31, 0x7f, 0xa7,
+  0xa4, 0xae, 0xe2, 0xa9, 0x7a, 0xa9, 0x86, 0x2c, 0x35, 0xa4, 0xff, 0x28,
+  0x3e, 0x2a, 0xb5, 0x2f, 0x07, 0xa8, 0xf7, 0x2b, 0x1b, 0xab, 0x0c, 0x99,
+  0x71, 0xa8, 0x83, 0x34, 0x5d, 0x28, 0x57, 0xaa, 0x69, 0xa8, 0xca, 0x27,
+  0x35, 0xa2, 0x8e, 0x28, 0xcd, 0xaa, 0x67, 0x2b, 0x89, 0xa7, 0x59, 0xa5,
+  0x1c, 0xa4, 0x11, 0x2d, 0x07, 0xa7, 0x08, 0xa2, 0x7b, 0xae, 0x9d, 0x33,
+  0xcc, 0x25, 0x0c, 0xaa, 0x0a, 0xac, 0xb1, 0x23, 0x51, 0xa9, 0x23, 0x24,
+  0x04, 0xa7, 0xa5, 0x27, 0x96, 0x29, 0xcf, 0xa6, 0x68, 0xa2, 0x45, 0x26,
+  0x19, 0xae, 0xda, 0xae, 0xb1, 0xa1, 0x2b, 0x32, 0xdc, 0x2f, 0x81, 0xa8,
+  0x2b, 0xaf, 0x9c, 0xa8, 0xb0, 0xac, 0x6f, 0x2c, 0x24, 0xab, 0xab, 0x25,
+  0x70, 0x2d, 0xd5, 0x2c, 0xa8, 0x2c, 0xd9, 0x2c, 0xeb, 0xa8, 0x37, 0x24,
+  0x53, 0xa6, 0x37, 0x2d, 0x05, 0x2b, 0x00, 0xae, 0xad, 0x28, 0x6a, 0xa3,
+  0x4f, 0xa5, 0x4b, 0x27, 0xaa, 0x20, 0x90, 0x28, 0x98, 0x2a, 0xd4, 0x2c,
+  0xb2, 0x28, 0x7d, 0x2d, 0x39, 0x27, 0xc5, 0xa8, 0xe3, 0xa3, 0x3e, 0x31,
+  0x92, 0x2c, 0xb5, 0xa8, 0x4e, 0xaa, 0x0e, 0x27, 0xe2, 0xa8, 0xb0, 0xa7,
+  0x0e, 0xad, 0xb5, 0x28, 0xe2, 0xa0, 0x48, 0x2c, 0xfb, 0x1b, 0x27, 0x18,
+  0x3b, 0xac, 0x3d, 0xa9, 0xab, 0x1d, 0xd2, 0x2e, 0x97, 0xaa, 0xb2, 0xac,
+  0x29, 0xa9, 0x8c, 0x22, 0x2e, 0xac, 0x20, 0x9d, 0x62, 0x26, 0x29, 0x2c,
+  0x8a, 0x24, 0x97, 0xac, 0x2d, 0xa5, 0x41, 0x2c, 0x46, 0xaf, 0x58, 0xab,
+  0x83, 0x25, 0xf3, 0x2c, 0x44, 0x2e, 0xcb, 0xad, 0xa1, 0xa9, 0xa9, 0x28,
+  0x0d, 0xaa, 0x60, 0xa8, 0x5c, 0x2c, 0x63, 0xa1, 0xb1, 0x2d, 0x08, 0xab,
+  0xe5, 0x2d, 0xaa, 0x30, 0x83, 0xaf, 0x2b, 0x2c, 0xb6, 0x29, 0x31, 0x2d,
+  0x82, 0x2a, 0x92, 0xb0, 0xdc, 0xa7, 0x3e, 0xab, 0x35, 0xb0, 0x10, 0x26,
+  0x1b, 0xab, 0x7a, 0x2a, 0x83, 0x2d, 0x9a, 0x31, 0x84, 0x1f, 0xf1, 0x2b,
+  0xd3, 0xaf, 0xe5, 0x98, 0x97, 0x1c, 0x96, 0x33, 0x52, 0x9b, 0x0a, 0xb0,
+  0x5a, 0xa5, 0x1b, 0xaa, 0x5a, 0xab, 0x77, 0x9f, 0xca, 0xab, 0x95, 0x2e,
+  0xce, 0x28, 0x4a, 0xa7, 0xbe, 0xa9, 0x5c, 0x2c, 0xd8, 0xae, 0xc4, 0xad,
+  0x2b, 0xac, 0x40, 0x2f, 0xa2, 0x2f, 0xb7, 0xb0, 0x8d, 0xad, 0x6a, 0x2a,
+  0xe1, 0xb1, 0xf2, 0xa2, 0xea, 0x1c, 0xa9, 0x98, 0x06, 0xa8, 0x80, 0x97,
+  0x85, 0xa9, 0x30, 0x30, 0x1d, 0xac, 0xea, 0xac, 0xc7, 0xa7, 0x57, 0x32,
+  0xa6, 0x2d, 0x08, 0xb0, 0xaa, 0xac, 0x65, 0x27, 0x0e, 0x24, 0x8e, 0x2d,
+  0x4d, 0x29, 0xb1, 0xa1, 0x00, 0xad, 0x6f, 0x2e, 0x99, 0x2f, 0x91, 0x2f,
+  0x9d, 0xa7, 0xe3, 0xa1, 0x10, 0xae, 0xed, 0x33, 0x49, 0x2c, 0x85, 0xb0,
+  0x9c, 0x17, 0xc2, 0xae, 0x92, 0x27, 0x85, 0xa4, 0x2f, 0xa8, 0x58, 0x2c,
+  0x08, 0x29, 0x2c, 0x2e, 0x52, 0xa3, 0x7b, 0x2e, 0x28, 0xb1, 0x06, 0xaa,
+  0x51, 0xac, 0x6c, 0x32, 0x54, 0x2b, 0x53, 0xb1, 0x97, 0x28, 0xfe, 0x8e,
+  0xf9, 0x1b, 0x1f, 0x2b, 0x5b, 0xae, 0x91, 0xa8, 0x95, 0x24, 0xe7, 0x27,
+  0xb0, 0xac, 0x3a, 0x27, 0xc8, 0xaf, 0x3d, 0xa7, 0xc2, 0xaa, 0xb5, 0x31,
+  0xee, 0x2c, 0xc2, 0xa8, 0x2c, 0xb0, 0x1e, 0x2a, 0xc3, 0xb0, 0x97, 0x2c,
+  0x75, 0x9f, 0x5c, 0x9a, 0x2a, 0x2a, 0x80, 0x2c, 0x00, 0xad, 0x7f, 0x28,
+  0xa0, 0xac, 0xef, 0xad, 0xb5, 0xad, 0x3c, 0x31, 0x25, 0x2d, 0x64, 0xab,
+  0xee, 0xae, 0xed, 0xac, 0xad, 0xa7, 0x07, 0xa0, 0xd2, 0x20, 0xcf, 0x2e,
+  0xa6, 0x2a, 0x9a, 0x2d, 0xf7, 0xa9, 0xa9, 0x24, 0x6d, 0xa7, 0x61, 0xab,
+  0x04, 0xa8, 0x0a, 0x33, 0x6d, 0x31, 0xb5, 0xa6, 0x99, 0xb0, 0xf8, 0x22,
+  0x6f, 0xae, 0xb3, 0xa8, 0x7e, 0xa2, 0x28, 0x27, 0x5b, 0x22, 0x39, 0x2c,
+  0xe0, 0xa4, 0xe3, 0x20, 0x89, 0x0c, 0xe7, 0xa6, 0x1d, 0x27, 0xc5, 0x2d,
+  0x7b, 0x2f, 0x99, 0xa7, 0x00, 0x21, 0x89, 0xaa, 0xc1, 0xac, 0x33, 0xad,
+  0x89, 0x2b, 0x4c, 0xa9, 0x5c, 0xac, 0xa0, 0x26, 0xb1, 0xae, 0x88, 0x28,
+  0x8f, 0x2c, 0x0d, 0x27, 0x11, 0x2c, 0x8b, 0xaa, 0x57, 0x2f, 0x27, 0xb1,
+  0x61, 0x22, 0x87, 0x2d, 0x61, 0xa3, 0xb0, 0x26, 0xb7, 0x24, 0xe8, 0x24,
+  0x52, 0xa6, 0x72, 0xa6, 0x35, 0x28, 0xe5, 0xaa, 0xe5, 0xac, 0x12, 0x98,
+  0xf6, 0x22, 0xf4, 0x2c, 0x0c, 0x2c, 0x78, 0x27, 0xab, 0xaa, 0x11, 0xa4,
+  0x61, 0x26, 0xe7, 0xa9, 0x6e, 0xa2, 0xc1, 0x9b, 0x90, 0x2a, 0x34, 0xad,
+  0xd5, 0xae, 0x41, 0xa6, 0xae, 0xac, 0x32, 0xad, 0xa3, 0x25, 0xc0, 0x30,
+  0x59, 0x2b, 0x6f, 0xb0, 0xc6, 0xad, 0x3d, 0xad, 0x4e, 0xac, 0xa4, 0x22,
+  0x03, 0x2c, 0x69, 0x2a, 0x5f, 0x2a, 0x51, 0xae, 0xfc, 0xaa, 0xaf, 0x2c,
+  0x77, 0xa9, 0x79, 0xaa, 0x3a, 0xae, 0x81, 0x2e, 0x09, 0x2d, 0xfb, 0xae,
+  0xb7, 0xa5, 0xc9, 0xa2, 0x79, 0x27, 0xe9, 0x24, 0x65, 0x18, 0x06, 0xad,
+  0xfe, 0x9c, 0x2d, 0xa5, 0x32, 0xac, 0xd5, 0x26, 0xe6, 0xad, 0x42, 0x11,
+  0x02, 0x1d, 0xf1, 0x30, 0x2e, 0x2f, 0x7f, 0xa2, 0x8d, 0xa5, 0x2b, 0xa5,
+  0xc9, 0xae, 0x49, 0x24, 0x19, 0xaa, 0xbb, 0xa6, 0xf9, 0x2a, 0x9e, 0xa3,
+  0x24, 0xab, 0x4a, 0x24, 0xd1, 0x25, 0x4a, 0xa1, 0xfa, 0xa8, 0x0a, 0x2f,
+  0x3d, 0x30, 0x21, 0xa8, 0xb6, 0xab, 0xeb, 0x2a, 0x0f, 0x28, 0x4e, 0x26,
+  0x19, 0x28, 0xc0, 0x98, 0x93, 0x26, 0x41, 0x2e, 0xcd, 0x2d, 0x7c, 0x2c,
+  0x28, 0xac, 0x81, 0x20, 0xac, 0x28, 0xae, 0x32, 0x20, 0x31, 0xf6, 0xb1,
+  0x97, 0xa0, 0x86, 0x2c, 0xdf, 0x24, 0x7d, 0x2c, 0xa3, 0xa1, 0x86, 0x2f,
+  0x63, 0x29, 0xab, 0x2d, 0x79, 0x2d, 0xa1, 0x2e, 0x8b, 0xa7, 0x2b, 0xa2,
+  0x6a, 0xa0, 0x7e, 0x33, 0x86, 0x2d, 0xd9, 0xaf, 0x29, 0x26, 0xb2, 0xad,
+  0x79, 0x29, 0xbd, 0x2c, 0xa5, 0x2e, 0x2c, 0x1d, 0x99, 0x27, 0x55, 0x25,
+  0x46, 0xa7, 0x25, 0x29, 0xe6, 0xac, 0x89, 0xa1, 0xb3, 0x23, 0xd5, 0x32,
+  0x59, 0xa8, 0x95, 0xad, 0xfe, 0xa2, 0xf0, 0xac, 0x2c, 0xa9, 0xaa, 0x28,
+  0x39, 0x29, 0xa1, 0x30, 0xb7, 0xaa, 0x7c, 0x2a, 0x46, 0x12, 0x09, 0x28,
+  0x6a, 0xac, 0x08, 0xac, 0xab, 0x29, 0xa8, 0x2d, 0x40, 0x2d, 0x9a, 0xab,
+  0xaf, 0xad, 0x30, 0xaf, 0x8b, 0xab, 0xa3, 0x2b, 0x56, 0xa8, 0xd5, 0x25,
+  0x72, 0xa5, 0x11, 0x1f, 0x39, 0xa8, 0xa0, 0x2d, 0x3f, 0xad, 0x90, 0xaa,
+  0x9f, 0xad, 0xc4, 0x31, 0x2b, 0x2a, 0xe5, 0xb0, 0xcf, 0xaf, 0x1a, 0xb0,
+  0x33, 0xb1, 0xcb, 0x19, 0x83, 0xac, 0xf6, 0x2a, 0xcd, 0x2d, 0xda, 0x23,
+  0x01, 0xae, 0x62, 0x30, 0xf1, 0xae, 0x2c, 0x21, 0x7d, 0x26, 0x8a, 0x30,
+  0xf6, 0x27, 0x47, 0x1f, 0xdf, 0xac, 0xa2, 0x19, 0xd3, 0xb0, 0xf2, 0x2c,
+  0x6d, 0xa8, 0xf8, 0x2a, 0xd3, 0xa3, 0x8c, 0x26, 0xd1, 0xab, 0x10, 0x28,
+  0xa6, 0xa5, 0x72, 0x24, 0xbb, 0xad, 0xf8, 0x32, 0xd8, 0x1e, 0x5c, 0xad,
+  0x15, 0xab, 0xb8, 0xad, 0xe8, 0xac, 0x71, 0xad, 0x01, 0x29, 0x04, 0x2c,
+  0x79, 0x2d, 0x62, 0x1d, 0xe0, 0xad, 0xce, 0x2d, 0x82, 0xa8, 0x4d, 0xa6,
+  0xcc, 0x98, 0x08, 0x98, 0x19, 0x2e, 0xc4, 0xac, 0x70, 0xb1, 0xdd, 0xac,
+  0xb5, 0xab, 0xdd, 0x9e, 0xf9, 0xa4, 0x5d, 0x2c, 0x0b, 0x1e, 0x03, 0x24,
+  0x43, 0xac, 0x4b, 0x2a, 0xd8, 0xac, 0x5b, 0xab, 0x56, 0xa0, 0x0e, 0x2b,
+  0xa7, 0x2d, 0x45, 0xb0, 0xb8, 0xa5, 0x1f, 0xb0, 0x15, 0x21, 0x1c, 0x2a,
+  0x99, 0x25, 0xdd, 0x9f, 0xdb, 0xa4, 0x82, 0x1c, 0x72, 0x24, 0xbf, 0x24,
+  0xb8, 0xb1, 0xab, 0xb0, 0x00, 0x29, 0xbe, 0x1c, 0x38, 0x30, 0x61, 0xb0,
+  0x01, 0xa9, 0xa5, 0xaf, 0x7e, 0x9f, 0x79, 0x25, 0x43, 0xb0, 0x1f, 0xa9,
+  0xec, 0x2a, 0xd3, 0x26, 0x42, 0xa8, 0x2e, 0x2b, 0xb8, 0xa8, 0x6b, 0x9f,
+  0x7f, 0xa0, 0xa3, 0x2c, 0xd4, 0x32, 0xc0, 0xa5, 0x2a, 0xaa, 0xdf, 0x21,
+  0x1a, 0x23, 0x18, 0x29, 0xe8, 0x2a, 0x46, 0x23, 0x21, 0xa8, 0xa1, 0x25,
+  0xa2, 0xa2, 0xa9, 0x10, 0xa7, 0xac, 0x8c, 0xab, 0xae, 0x24, 0x84, 0x2b,
+  0x9d, 0x2f, 0x0e, 0xb0, 0xd7, 0xb0, 0x2d, 0xab, 0x72, 0xb0, 0x81, 0xa4,
+  0x46, 0x19, 0x18, 0x9e, 0x2b, 0x19, 0xed, 0x27, 0x6b, 0xaa, 0x2f, 0x2e,
+  0x2e, 0xac, 0xe4, 0xac, 0xf6, 0xac, 0x0b, 0x29, 0xbd, 0x28, 0x48, 0xb0,
+  0xb9, 0xb0, 0x12, 0x2e, 0x93, 0x28, 0xa9, 0xa5, 0x41, 0xac, 0xd1, 0x2d,
+  0x09, 0xaa, 0x56, 0x31, 0x2a, 0x22, 0x32, 0x2c, 0xab, 0xa8, 0x01, 0xa1,
+  0xec, 0x28, 0x78, 0x31, 0xa3, 0x2c, 0xa0, 0xb0, 0x23, 0x21, 0x84, 0xad,
+  0x06, 0x2b, 0x32, 0x29, 0xb1, 0xa0, 0xaf, 0x1e, 0x54, 0xab, 0x74, 0x2d,
+  0xb0, 0xa0, 0x2b, 0x2d, 0x88, 0xaa, 0x19, 0xa8, 0xb0, 0x24, 0x9a, 0x32,
+  0xf0, 0x32, 0xc0, 0xac, 0x03, 0xab, 0x74, 0xac, 0x0d, 0xa8, 0xee, 0xa1,
+  0x7a, 0xa9, 0x00, 0x2c, 0x8e, 0xa8, 0xb8, 0x2f, 0x92, 0x97, 0x24, 0xa0,
+  0x6d, 0xa6, 0x94, 0x25, 0x4a, 0xa4, 0x78, 0x32, 0xff, 0x2b, 0x80, 0xa4,
+  0x2c, 0xa7, 0xb9, 0x2a, 0xe2, 0xab, 0xf3, 0xa6, 0x5b, 0xab, 0x78, 0x1c,
+  0x8f, 0x2b, 0x8e, 0xa4, 0x33, 0xad, 0x45, 0x2c, 0x35, 0x0b, 0x81, 0x9b,
+  0x43, 0xa9, 0x5d, 0x2f, 0x91, 0x2e, 0x3f, 0xb1, 0x1a, 0xa4, 0xdd, 0x1a,
+  0xd1, 0x9d, 0x74, 0xab, 0xeb, 0xa4, 0x86, 0x2c, 0xec, 0x2f, 0xc1, 0x27,
+  0x98, 0xa0, 0x4b, 0xa8, 0xb1, 0xa6, 0x99, 0xae, 0x58, 0x2a, 0xc5, 0x2a,
+  0x5a, 0x2d, 0x10, 0xa7, 0x5e, 0xa4, 0x41, 0x28, 0xa5, 0xad, 0x71, 0x29,
+  0x52, 0x2b, 0xed, 0xa8, 0x6f, 0x29, 0x37, 0xab, 0x50, 0x2e, 0x52, 0x28,
+  0xee, 0xac, 0xf8, 0xa0, 0xba, 0x9f, 0x51, 0xad, 0x1b, 0x2d, 0xa2, 0xaa,
+  0xaf, 0x2d, 0x02, 0x31, 0xe2, 0xad, 0x29, 0xa7, 0xd4, 0x2d, 0x70, 0x26,
+  0x36, 0xac, 0xee, 0x28, 0x17, 0x30, 0xba, 0x22, 0x44, 0xb0, 0x23, 0x2c,
+  0xed, 0x2a, 0x4b, 0xb1, 0xcf, 0xa8, 0xa0, 0x2b, 0x9b, 0xa6, 0x94, 0x28,
+  0x6b, 0xad, 0x15, 0xa7, 0x09, 0x23, 0xd4, 0xad, 0x4d, 0xab, 0x63, 0xb0,
+  0xf6, 0xa0, 0x2d, 0x2f, 0x27, 0xab, 0x92, 0x25, 0x86, 0x2a, 0x64, 0xb4,
+  0x67, 0x2c, 0x0e, 0x25, 0x47, 0x2b, 0x18, 0x28, 0x14, 0x1a, 0xcb, 0x20,
+  0x9f, 0x21, 0xd6, 0xa9, 0x1a, 0xa6, 0x98, 0x25, 0xb2, 0x2c, 0xc0, 0x9c,
+  0xd6, 0x2b, 0xdb, 0x95, 0x80, 0xaa, 0x98, 0xb0, 0x54, 0xac, 0x3b, 0x2a,
+  0xca, 0x2f, 0xbb, 0xac, 0xa0, 0xae, 0x15, 0x28, 0x43, 0xa9, 0xd8, 0xae,
+  0xa3, 0xab, 0x4e, 0xac, 0x13, 0x29, 0x7e, 0x24, 0x50, 0x2f, 0xa6, 0xa8,
+  0xf1, 0x29, 0x4d, 0xb1, 0xa1, 0xa9, 0x56, 0x30, 0x19, 0x31, 0x74, 0x2b,
+  0xf9, 0xaf, 0xc5, 0xaa, 0x95, 0x29, 0x00, 0xad, 0x9d, 0x9a, 0x32, 0x26,
+  0x7b, 0x27, 0xed, 0x21, 0x3c, 0x2c, 0xdc, 0x25, 0x16, 0x28, 0x1d, 0xad,
+  0x58, 0xad, 0xde, 0xa3, 0xe1, 0x30, 0x80, 0x28, 0x4d, 0xb0, 0xc1, 0x2b,
+  0x2d, 0xaa, 0x2e, 0x1e, 0xb6, 0x29, 0x51, 0x29, 0x93, 0x98, 0xa2, 0x2c,
+  0xe0, 0xa4, 0x60, 0x29, 0x5d, 0xa7, 0x19, 0x2d, 0x0f, 0x2b, 0xd8, 0xaa,
+  0xbe, 0x31, 0xd8, 0x26, 0x70, 0x2f, 0x7a, 0x2d, 0x08, 0xa5, 0x2c, 0xa1,
+  0x66, 0x2f, 0xf3, 0x29, 0xd7, 0x2d, 0x53, 0x2d, 0x9e, 0x29, 0x49, 0x24,
+  0xc1, 0x23, 0xf5, 0xac, 0xf6, 0x2d, 0x37, 0x28, 0x82, 0x2c, 0x76, 0xa9,
+  0x18, 0xb1, 0x88, 0x9e, 0x2f, 0x28, 0x98, 0xb0, 0x6a, 0x29, 0x3a, 0xa9,
+  0x75, 0xaf, 0x0c, 0x1c, 0x0f, 0x2c, 0x15, 0x2c, 0x7f, 0x9b, 0x41, 0xb1,
+  0x62, 0x2c, 0xac, 0x27, 0x5b, 0x32, 0xbd, 0x9e, 0x64, 0xad, 0xb6, 0x29,
+  0x87, 0xa0, 0x5f, 0xa9, 0x8b, 0xa8, 0x15, 0xa6, 0x13, 0x2d, 0x06, 0xa1,
+  0x69, 0x2e, 0x29, 0xac, 0xb3, 0x9b, 0x76, 0xb0, 0x76, 0x1c, 0xe4, 0x31,
+  0x4d, 0x1f, 0x88, 0xa7, 0x5a, 0xa8, 0xbf, 0x2f, 0x51, 0xad, 0x43, 0xa9,
+  0xe1, 0x2e, 0x40, 0xa2, 0x02, 0x30, 0x7d, 0x2c, 0x53, 0xa5, 0x86, 0x2f,
+  0x4c, 0x2c, 0xe7, 0xb1, 0x81, 0x21, 0xab, 0x30, 0xe3, 0x08, 0xb2, 0x9e,
+  0x6b, 0xac, 0x65, 0x26, 0x45, 0xad, 0xf3, 0xaf, 0x17, 0x9d, 0x9f, 0xaa,
+  0x3a, 0x2d, 0x62, 0x2d, 0x79, 0x27, 0x1e, 0xaa, 0x74, 0x2b, 0x30, 0xb3,
+  0xe9, 0x30, 0x41, 0xab, 0xeb, 0x2d, 0x8e, 0xa8, 0x8a, 0xa8, 0x65, 0xae,
+  0x20, 0x2e, 0xd4, 0xa3, 0x79, 0xac, 0x87, 0xa2, 0x42, 0xaa, 0xfa, 0x2d,
+  0x4e, 0xa4, 0x5f, 0x2d, 0x67, 0xa4, 0x34, 0xb1, 0x36, 0xa6, 0x5c, 0x26,
+  0x75, 0x2c, 0xc1, 0xa6, 0x94, 0xac, 0xc5, 0x07, 0x6a, 0xa1, 0x24, 0xb0,
+  0x56, 0x28, 0xa1, 0x25, 0x88, 0x28, 0x83, 0x25, 0x93, 0x30, 0x98, 0x2c,
+  0x00, 0xa7, 0x96, 0xb0, 0x21, 0x2d, 0x70, 0x25, 0x41, 0x26, 0x70, 0xa7,
+  0x5e, 0xae, 0x8d, 0x28, 0x76, 0xb0, 0x31, 0xae, 0x53, 0x2b, 0x4c, 0xa5,
+  0x0f, 0x27, 0x71, 0xa9, 0xf4, 0x2b, 0x61, 0x2c, 0x5d, 0xb0, 0x0b, 0x24,
+  0x8a, 0x2a, 0xee, 0xa9, 0x05, 0x2d, 0xd5, 0xa9, 0x32, 0xad, 0x7f, 0x20,
+  0x5c, 0xae, 0x5b, 0xaf, 0x1c, 0xab, 0x0d, 0x26, 0x77, 0x9c, 0xc0, 0xa2,
+  0x10, 0x2a, 0x10, 0x29, 0xb5, 0xaa, 0x2c, 0xa7, 0x73, 0xa5, 0x30, 0xaa,
+  0x6d, 0x2d, 0xbd, 0x9a, 0x04, 0xae, 0xb5, 0xa8, 0x24, 0xa8, 0x4f, 0xa8,
+  0x56, 0xaf, 0xf5, 0xab, 0xfa, 0xa6, 0x0c, 0x24, 0x40, 0x2e, 0x9c, 0xab,
+  0x90, 0x26, 0x4b, 0xa8, 0x01, 0xa8, 0x42, 0x2f, 0xda, 0x30, 0x43, 0xac,
+  0xca, 0xa8, 0x20, 0x27, 0xee, 0xa4, 0x6f, 0xaa, 0x73, 0xab, 0x65, 0xa4,
+  0x0e, 0x2e, 0x46, 0x8c, 0x1c, 0x30, 0xd0, 0x2a, 0x6d, 0x9c, 0x09, 0x99,
+  0x09, 0xa8, 0x7b, 0xa0, 0xd3, 0x2a, 0x90, 0x2b, 0xde, 0xad, 0xbb, 0x27,
+  0x59, 0x2a, 0xb3, 0xad, 0x7d, 0xa2, 0x94, 0x25, 0x18, 0x2e, 0xf7, 0x93,
+  0x20, 0x2c, 0x8c, 0xa7, 0xed, 0x96, 0x1d, 0xa5, 0x08, 0xa0, 0x63, 0xab,
+  0x9a, 0x2c, 0xab, 0xa1, 0xeb, 0xa9, 0x1a, 0xaa, 0x89, 0x2b, 0xbb, 0xa7,
+  0x0f, 0x2c, 0x0e, 0xaf, 0x9e, 0xaa, 0x62, 0xab, 0xe9, 0x1c, 0x8d, 0x23,
+  0xae, 0xaa, 0xd7, 0xa8, 0xe4, 0x29, 0xb4, 0xa0, 0x94, 0x28, 0x49, 0xb1,
+  0x93, 0xb0, 0xd8, 0x9b, 0xea, 0x1b, 0x7d, 0xa8, 0xc1, 0xa0, 0x93, 0x28,
+  0x6c, 0x2a, 0xc3, 0x29, 0x7f, 0x2e, 0xf5, 0xad, 0x44, 0xa9, 0xba, 0xb0,
+  0x4f, 0xa8, 0xab, 0x2c, 0x81, 0x2d, 0x92, 0xa3, 0x5e, 0xb1, 0x3e, 0x27,
+  0x65, 0xad, 0x15, 0xa7, 0x23, 0xa9, 0xa7, 0xae, 0x0b, 0x25, 0x0e, 0xa9,
+  0x2c, 0x2e, 0xfd, 0xab, 0x17, 0x9b, 0x0c, 0xb2, 0xe9, 0xa6, 0xbd, 0xac,
+  0x80, 0x2f, 0x80, 0x9f, 0x6e, 0x2a, 0x07, 0x2b, 0x4a, 0x2a, 0x2a, 0x9f,
+  0x2c, 0x1e, 0xa4, 0xa0, 0x1a, 0x9b, 0x01, 0x2b, 0x43, 0x2e, 0x0b, 0xaa,
+  0xc3, 0x28, 0x39, 0xb1, 0xeb, 0x28, 0x69, 0x29, 0xe5, 0x2c, 0x1e, 0xa8,
+  0x34, 0xb0, 0xbd, 0xa9, 0x60, 0x28, 0x28, 0xab, 0xda, 0x2a, 0xbd, 0xac,
+  0xb9, 0x2c, 0xac, 0x9f, 0x74, 0x2a, 0x5a, 0x26, 0x50, 0xad, 0x4a, 0xb4,
+  0x5a, 0x2c, 0x44, 0x24, 0xbd, 0x2e, 0xf6, 0xa1, 0x44, 0xb0, 0x87, 0xa4,
+  0xaf, 0x23, 0x85, 0xad, 0x2e, 0xac, 0x45, 0xa9, 0x2c, 0xa0, 0x7b, 0xa3,
+  0x18, 0x30, 0xfe, 0xab, 0x83, 0xaa, 0x10, 0xaa, 0xee, 0x24, 0xbf, 0x2c,
+  0xe1, 0x2f, 0x7b, 0xa5, 0xd4, 0x2b, 0xef, 0x2c, 0x1a, 0xae, 0xb2, 0xaf,
+  0x9a, 0x22, 0xc5, 0xad, 0x94, 0x2e, 0x42, 0x27, 0xdb, 0x2c, 0x52, 0x2d,
+  0x24, 0xaf, 0x5c, 0xaa, 0xc2, 0x28, 0x24, 0xaa, 0x73, 0x2f, 0xbf, 0xad,
+  0x96, 0x1d, 0xf4, 0x28, 0x7f, 0x21, 0x26, 0xac, 0x8e, 0x2d, 0x77, 0x29,
+  0xd3, 0x2c, 0xa5, 0x29, 0x06, 0x9f, 0xdb, 0xa8, 0xdd, 0xad, 0xae, 0xa5,
+  0xe3, 0x2c, 0xcc, 0x23, 0x1c, 0x2c, 0xa4, 0x2c, 0xab, 0x9a, 0x0a, 0xa9,
+  0xb6, 0xaa, 0xc3, 0xae, 0xf1, 0xae, 0xf1, 0xab, 0xea, 0x2c, 0x30, 0x25,
+  0x3a, 0x2c, 0xe3, 0xab, 0xd7, 0xa8, 0xf8, 0x2a, 0x31, 0x1d, 0x60, 0x2b,
+  0xde, 0x30, 0xbc, 0xae, 0xe0, 0xac, 0xfc, 0x26, 0x10, 0x1b, 0x7d, 0xaa,
+  0xa9, 0xad, 0x44, 0x9f, 0x58, 0x2b, 0x47, 0xa8, 0x7f, 0x25, 0x0d, 0x2e,
+  0x10, 0xa0, 0x32, 0x16, 0x30, 0x26, 0x6c, 0x23, 0x3c, 0x2c, 0xbc, 0x28,
+  0x63, 0xaa, 0x75, 0x21, 0x9c, 0xa9, 0x48, 0xa8, 0x14, 0xaa, 0x37, 0xab,
+  0x64, 0x2a, 0xd4, 0x23, 0x74, 0x1a, 0x83, 0xa3, 0xc0, 0xac, 0x90, 0xb0,
+  0x39, 0xa8, 0x3d, 0x2c, 0x5a, 0x30, 0x28, 0xaa, 0xdf, 0xa0, 0x2e, 0xac,
+  0xdb, 0x28, 0xcf, 0xad, 0x45, 0xad, 0x8d, 0xad, 0xc4, 0x2b, 0xdc, 0x9d,
+  0x41, 0x2d, 0x24, 0xac, 0x82, 0xac, 0x42, 0xac, 0xf3, 0x29, 0xa6, 0x29,
+  0x3e, 0x2d, 0x0e, 0x2e, 0x22, 0xaa, 0x7f, 0xac, 0x61, 0x2c, 0x1f, 0xae,
+  0xcb, 0xaa, 0x6e, 0x28, 0x8b, 0xa7, 0xb7, 0x2c, 0x13, 0xa5, 0x2a, 0x99,
+  0xf5, 0x26, 0xcf, 0xaf, 0xc2, 0x29, 0x54, 0x21, 0x85, 0x2e, 0x10, 0xab,
+  0x3e, 0x2f, 0xd1, 0x2c, 0x1b, 0x1c, 0x4d, 0x25, 0x29, 0xac, 0x91, 0xac,
+  0xac, 0x15, 0x00, 0xae, 0xe9, 0x2e, 0x2c, 0x2d, 0x79, 0xa1, 0x82, 0xab,
+  0x63, 0x99, 0xb7, 0xa9, 0xd7, 0x29, 0x2b, 0xb1, 0x60, 0xb0, 0x34, 0xaf,
+  0xae, 0x2c, 0x51, 0xa4, 0x3c, 0x03, 0x19, 0xb0, 0xca, 0xad, 0xb9, 0x27,
+  0x35, 0x2d, 0xd6, 0xa2, 0x8b, 0xa9, 0xb9, 0xb1, 0x71, 0x2a, 0x47, 0x26,
+  0x10, 0x2f, 0x65, 0x0d, 0x48, 0xa8, 0x8c, 0xaa, 0x1d, 0x15, 0xb0, 0xb0,
+  0xb1, 0x26, 0x40, 0xa4, 0x88, 0x2c, 0x06, 0x9d, 0xe3, 0x29, 0x0a, 0x28,
+  0xd3, 0x9c, 0xbb, 0xad, 0xfc, 0x2d, 0xb6, 0x2f, 0xa3, 0x2c, 0xa2, 0xac,
+  0x23, 0xa8, 0xff, 0x21, 0x9a, 0xa0, 0x20, 0xad, 0xe5, 0x2d, 0x80, 0x29,
+  0x03, 0x2b, 0x7f, 0x2b, 0xab, 0xa8, 0xe6, 0x9f, 0x60, 0xa6, 0x97, 0xaa,
+  0xc4, 0x29, 0x0b, 0x28, 0x60, 0x20, 0x1f, 0xa9, 0x10, 0xad, 0x57, 0xab,
+  0xff, 0xac, 0x28, 0xae, 0x9a, 0xae, 0xc2, 0xa7, 0xdf, 0x2f, 0x91, 0x2a,
+  0x3a, 0x2e, 0xe1, 0x21, 0x09, 0xa7, 0x74, 0xaf, 0x37, 0xaa, 0x88, 0x30,
+  0xa1, 0x2f, 0x91, 0x9f, 0x9e, 0xac, 0x7f, 0x2b, 0xaf, 0x28, 0x0e, 0xac,
+  0x39, 0xae, 0xa8, 0xad, 0xf1, 0xa0, 0xde, 0x9f, 0xf0, 0x2b, 0x7c, 0x22,
+  0x5b, 0xac, 0x68, 0xb2, 0x27, 0x26, 0x71, 0x26, 0x2c, 0x2f, 0x30, 0xa4,
+  0xb2, 0x2c, 0x78, 0x2f, 0xc3, 0x2b, 0xab, 0xae, 0x65, 0xac, 0xf6, 0x2a,
+  0xf3, 0x29, 0x2c, 0x2e, 0x2f, 0x2b, 0x2f, 0x2d, 0x98, 0xa3, 0xad, 0xa0,
+  0xa6, 0x13, 0xb8, 0x30, 0x66, 0x28, 0xa2, 0xaf, 0x2a, 0xaf, 0x54, 0x2d,
+  0x9e, 0x22, 0xb6, 0xae, 0xb4, 0xa4, 0xb4, 0x30, 0x7e, 0x23, 0x25, 0x2d,
+  0x3a, 0x25, 0x4a, 0x25, 0x19, 0xae, 0xf5, 0x22, 0x1b, 0x2f, 0xe1, 0x27,
+  0x59, 0x22, 0xb2, 0xac, 0xce, 0xad, 0xf9, 0x2c, 0x45, 0xab, 0x88, 0xa6,
+  0xb2, 0xac, 0x3b, 0x0a, 0xcb, 0x28, 0x6a, 0x26, 0x3a, 0x2c, 0xef, 0x22,
+  0x77, 0xab, 0x92, 0xaa, 0x0a, 0x1d, 0x74, 0xad, 0x0d, 0x2e, 0xcf, 0xae,
+  0x84, 0xae, 0x10, 0xab, 0x77, 0xa9, 0x75, 0xac, 0x57, 0xa2, 0x11, 0x28,
+  0xcb, 0x2c, 0xb3, 0xa8, 0xd0, 0x1f, 0x1d, 0x2c, 0x8f, 0xac, 0xba, 0xb3,
+  0x69, 0x28, 0x3c, 0x2e, 0xd5, 0x30, 0x53, 0xad, 0x1e, 0x26, 0xd0, 0x2d,
+  0xd3, 0xa5, 0xc4, 0xaf, 0x4a, 0xac, 0x27, 0x9d, 0x3f, 0x2a, 0x07, 0x2b,
+  0xa4, 0x30, 0x00, 0x23, 0xe5, 0x2b, 0x94, 0x2a, 0x1b, 0x98, 0x42, 0x2b,
+  0xb4, 0x29, 0xa2, 0x29, 0x5b, 0xb0, 0x6b, 0xa8, 0x07, 0xab, 0x88, 0x9c,
+  0xd1, 0xaa, 0x0e, 0x98, 0x1b, 0x20, 0xe1, 0x21, 0x57, 0x25, 0x4f, 0x2c,
+  0xa9, 0xa9, 0x58, 0xa5, 0xd0, 0x24, 0xd4, 0x29, 0x3a, 0x29, 0x9d, 0x28,
+  0x6d, 0xa0, 0x34, 0x9a, 0x51, 0xa0, 0x4b, 0xad, 0x06, 0xa7, 0x83, 0xae,
+  0x57, 0xa4, 0xff, 0xa9, 0x35, 0x2d, 0x5f, 0x2c, 0xb6, 0xae, 0xf0, 0xa9,
+  0x32, 0x28, 0x13, 0xae, 0x90, 0x2f, 0x2e, 0xac, 0xa2, 0xb0, 0xe3, 0xa9,
+  0x0c, 0xa7, 0x50, 0xa8, 0x3e, 0x92, 0xc7, 0xb0, 0x00, 0xa1, 0x58, 0x25,
+  0x74, 0x2c, 0x22, 0x24, 0x8b, 0x29, 0x6f, 0xb2, 0x33, 0xa4, 0x14, 0xa6,
+  0x50, 0x2e, 0x02, 0x28, 0x31, 0xb1, 0x51, 0xad, 0x60, 0xa7, 0xa6, 0xaf,
+  0x4e, 0x99, 0x4d, 0xb0, 0x97, 0xa7, 0xf3, 0xa0, 0x95, 0xa7, 0xa8, 0xa5,
+  0x67, 0x21, 0x51, 0xac, 0x62, 0x2d, 0x10, 0x2e, 0xaf, 0x2d, 0x75, 0x2a,
+  0x0e, 0x24, 0x1c, 0xad, 0x4f, 0x24, 0x90, 0x9e, 0x37, 0xa5, 0x82, 0xac,
+  0x92, 0x28, 0xa5, 0x2b, 0xd5, 0x2d, 0x0b, 0x25, 0xba, 0x24, 0xc4, 0xa5,
+  0x6f, 0x1d, 0x1b, 0xa0, 0x1d, 0x30, 0x0d, 0xa0, 0x16, 0xac, 0x09, 0x2a,
+  0x3c, 0xa5, 0x80, 0xaf, 0x1f, 0xad, 0x93, 0xac, 0x23, 0x2b, 0xb6, 0x26,
+  0x9a, 0x9c, 0x89, 0x27, 0xcd, 0xa9, 0x5c, 0xae, 0x0b, 0x30, 0x7b, 0x31,
+  0x9d, 0x23, 0x70, 0xa4, 0x2d, 0xb4, 0x57, 0xac, 0x8d, 0xa4, 0xf9, 0xa6,
+  0x57, 0xaa, 0xb3, 0x24, 0xc5, 0x9e, 0x3d, 0x2f, 0x4d, 0x2c, 0x09, 0x2e,
+  0xbd, 0x9b, 0x9f, 0xb0, 0xe6, 0x2c, 0x39, 0x2d, 0x98, 0x30, 0x81, 0x29,
+  0xda, 0xad, 0x16, 0xa7, 0x9a, 0xad, 0xa0, 0xab, 0x19, 0x25, 0x7e, 0xae,
+  0xda, 0xa1, 0x37, 0x2c, 0x56, 0x31, 0x1f, 0x27, 0x51, 0xa7, 0x3b, 0xb0,
+  0xfd, 0x2c, 0x1a, 0xa9, 0x00, 0x2a, 0x2d, 0xb0, 0x36, 0xac, 0xbb, 0x2b,
+  0x9c, 0xa3, 0xd5, 0x24, 0x06, 0xa9, 0xad, 0x23, 0x18, 0x1d, 0x02, 0xa6,
+  0x46, 0x2e, 0x39, 0xaa, 0xd4, 0xac, 0x86, 0xa9, 0x46, 0x20, 0xc6, 0x30,
+  0xc6, 0x2c, 0x2d, 0xac, 0x35, 0xa8, 0xc3, 0x9b, 0x54, 0xaa, 0x36, 0xac,
+  0x05, 0xac, 0x0e, 0x20, 0x33, 0x2c, 0x60, 0x2b, 0xa2, 0x2c, 0xb5, 0x28,
+  0xd3, 0xaa, 0xea, 0x2e, 0x80, 0x25, 0x4f, 0x29, 0xa2, 0x30, 0xc2, 0xac,
+  0xe0, 0xa6, 0x27, 0xae, 0x1c, 0x28, 0x5d, 0xa8, 0x17, 0xa6, 0x85, 0x2b,
+  0x67, 0xab, 0x1c, 0xab, 0x2b, 0x26, 0x2f, 0xa9, 0xec, 0x20, 0x4d, 0xaa,
+  0x4a, 0xaa, 0xf1, 0x2f, 0xba, 0x28, 0xe8, 0xa9, 0x19, 0xb0, 0xa1, 0xab,
+  0x87, 0xa9, 0x7a, 0xaa, 0xf4, 0xab, 0xa2, 0xac, 0x90, 0x2d, 0x0d, 0xa9,
+  0xe5, 0x2f, 0x7f, 0xa8, 0xc2, 0xa7, 0x59, 0xa0, 0x70, 0xae, 0xe5, 0x2a,
+  0x70, 0x30, 0x72, 0xab, 0xec, 0xb0, 0x3b, 0xa8, 0x35, 0x2d, 0x02, 0xab,
+  0x28, 0x23, 0x1a, 0x30, 0x9b, 0x2e, 0x55, 0x29, 0x58, 0x27, 0xe8, 0x2b,
+  0x2f, 0xa4, 0xbf, 0xa8, 0xcf, 0xac, 0x88, 0xac, 0x31, 0x2c, 0x27, 0x20,
+  0xc4, 0xa4, 0x89, 0x1d, 0x47, 0x20, 0x8e, 0xa7, 0x8d, 0x27, 0x8f, 0x28,
+  0xfb, 0xa7, 0xdf, 0x2a, 0xaa, 0x2d, 0x31, 0x2b, 0x0c, 0xa3, 0x22, 0x2e,
+  0x80, 0x29, 0x14, 0x99, 0x96, 0x2c, 0x96, 0xa8, 0xc7, 0xa2, 0xe1, 0x9c,
+  0xa4, 0x22, 0xa4, 0x22, 0x05, 0x27, 0x8d, 0xa4, 0xf4, 0x18, 0x0e, 0x2c,
+  0x96, 0x2d, 0x89, 0x28, 0x51, 0xa0, 0xb4, 0x29, 0x0e, 0x26, 0xe2, 0x28,
+  0x39, 0x30, 0xd9, 0xa7, 0xc4, 0x1e, 0xf6, 0xac, 0xbf, 0x2c, 0xdb, 0xad,
+  0x09, 0x9f, 0x41, 0xa3, 0x5a, 0x9f, 0x53, 0xa9, 0xe1, 0x2d, 0x96, 0xa8,
+  0x3b, 0x2b, 0x65, 0xb1, 0x4b, 0xa7, 0xd9, 0x29, 0xb7, 0x99, 0x04, 0x28,
+  0xbd, 0xa8, 0xfe, 0x1d, 0x45, 0x2a, 0x0f, 0xac, 0xbd, 0x27, 0x41, 0xa2,
+  0x22, 0xa3, 0xfc, 0x1d, 0xdc, 0x2f, 0x0a, 0x2c, 0x80, 0xad, 0x0f, 0xad,
+  0xea, 0xa8, 0x53, 0x2d, 0x99, 0x29, 0x4d, 0xab, 0xfb, 0xac, 0x5a, 0xa4,
+  0x8d, 0xac, 0xbb, 0x9d, 0xd9, 0x9f, 0x16, 0x29, 0xbf, 0x2c, 0xe7, 0x28,
+  0x8b, 0x9c, 0x0c, 0x27, 0x53, 0x21, 0xdd, 0xb2, 0xa7, 0x2f, 0xf7, 0x2e,
+  0x5c, 0x2f, 0x6c, 0xa9, 0x8a, 0xae, 0x01, 0xa7, 0x09, 0xa4, 0xee, 0xb1,
+  0x5e, 0xac, 0x5e, 0x9f, 0xce, 0x2e, 0xa8, 0x2e, 0xb7, 0x2d, 0xfb, 0x95,
+  0x6a, 0xab, 0x08, 0xad, 0xe3, 0x2f, 0x3c, 0x2d, 0x86, 0x2c, 0x1f, 0xad,
+  0xff, 0xa7, 0x4f, 0xa4, 0xff, 0x23, 0x5d, 0x15, 0xfd, 0x24, 0xff, 0x2b,
+  0x20, 0x17, 0xfc, 0x1e, 0xd2, 0x2c, 0x0c, 0xa6, 0xc8, 0x28, 0xa2, 0xad,
+  0x3b, 0x22, 0x6d, 0x2c, 0x2a, 0x2c, 0x97, 0x28, 0x43, 0x2b, 0x60, 0x2a,
+  0xfa, 0xa8, 0x4a, 0x25, 0x91, 0x23, 0x8b, 0x2e, 0xe3, 0x28, 0x9a, 0xaa,
+  0xb7, 0x28, 0x8c, 0x2c, 0xe1, 0xa7, 0x30, 0x24, 0x76, 0xa8, 0xdd, 0x1f,
+  0x57, 0xb0, 0xb8, 0xb0, 0x3b, 0x31, 0x6a, 0xa2, 0x2a, 0x2c, 0x62, 0x2c,
+  0xef, 0x2c, 0x0e, 0xb0, 0x0a, 0xad, 0x43, 0xaf, 0x78, 0x29, 0x34, 0xb0,
+  0x33, 0xad, 0x85, 0xa8, 0xdc, 0xa6, 0x2b, 0xae, 0x0e, 0xb0, 0x12, 0x30,
+  0x0f, 0x34, 0x38, 0x1e, 0x50, 0x2e, 0xc4, 0x28, 0xe8, 0xa6, 0x10, 0xa6,
+  0x55, 0xaf, 0xe8, 0xad, 0xa1, 0xa6, 0x7f, 0x28, 0x55, 0x2b, 0xd3, 0xa6,
+  0x9d, 0xad, 0x9f, 0x28, 0x82, 0xad, 0xb4, 0xa1, 0xbb, 0x30, 0x14, 0xa8,
+  0x60, 0x26, 0xf0, 0x2e, 0x61, 0x2c, 0xbc, 0xaa, 0x25, 0xad, 0x1a, 0xac,
+  0x9a, 0x9b, 0x2b, 0x2a, 0x85, 0xa7, 0xd3, 0x2c, 0x91, 0xad, 0xbb, 0x2d,
+  0x28, 0xae, 0x23, 0x29, 0x06, 0x2f, 0x0f, 0x9c, 0xa7, 0xaa, 0x35, 0x2a,
+  0x3b, 0x2a, 0x31, 0xa5, 0xb3, 0xa5, 0x2c, 0x21, 0xe1, 0x29, 0x5c, 0xa5,
+  0x89, 0x98, 0x44, 0xaa, 0x85, 0xb1, 0xe4, 0xaa, 0x91, 0x2a, 0xb4, 0x2f,
+  0xcc, 0x30, 0x36, 0x2b, 0x62, 0x20, 0xe0, 0x2c, 0x77, 0xa8, 0xee, 0xab,
+  0xf0, 0xa6, 0xda, 0xac, 0x68, 0x2f, 0xa4, 0x98, 0x90, 0x2b, 0x58, 0xad,
+  0x28, 0xb1, 0xff, 0x2f, 0xe6, 0xaf, 0xb8, 0x1e, 0x30, 0x31, 0xb7, 0xa8,
+  0x99, 0x2d, 0x1b, 0xa8, 0x97, 0x28, 0xfe, 0x2b, 0x2d, 0x2c, 0x4b, 0xad,
+  0xa5, 0x31, 0xd6, 0x29, 0x70, 0x2e, 0x94, 0xb1, 0x09, 0xa8, 0xac, 0x2d,
+  0x3c, 0xac, 0x26, 0x2c, 0x6b, 0x29, 0x7f, 0xac, 0x88, 0x30, 0xd0, 0x2c,
+  0xa5, 0xa9, 0xed, 0xa4, 0x03, 0x26, 0xe9, 0xad, 0xe7, 0xac, 0x34, 0x2f,
+  0x6a, 0x2f, 0x50, 0xb0, 0x1b, 0xb4, 0x0c, 0x31, 0x1c, 0xae, 0xed, 0x2c,
+  0x8c, 0x2d, 0x06, 0x28, 0x52, 0xa0, 0x4c, 0x30, 0x88, 0xa1, 0xdd, 0x28,
+  0x1a, 0x25, 0x6a, 0x9a, 0x34, 0xa4, 0x70, 0x2c, 0xa0, 0x2d, 0xe2, 0xad,
+  0x4d, 0xaf, 0xd2, 0x2b, 0xc7, 0xae, 0x4a, 0xa5, 0xc3, 0x2c, 0x5a, 0xad,
+  0x66, 0x22, 0xf6, 0x2a, 0x22, 0xad, 0x74, 0xa2, 0x76, 0xa8, 0x50, 0xac,
+  0xfc, 0x2e, 0x51, 0x2b, 0xe6, 0x2d, 0x71, 0xb3, 0x1f, 0xb1, 0x9a, 0x9b,
+  0x39, 0xab, 0xaa, 0xa7, 0x15, 0x28, 0x3c, 0xb0, 0x96, 0x2c, 0xc1, 0x26,
+  0xe4, 0x29, 0x53, 0x2a, 0x6e, 0x1e, 0x61, 0xab, 0x57, 0x29, 0xdd, 0x22,
+  0x0d, 0x18, 0x29, 0xa8, 0xe4, 0xb0, 0x67, 0x2a, 0xab, 0xa8, 0x4d, 0x2d,
+  0x65, 0x30, 0xb4, 0xa3, 0xa3, 0xa1, 0x4e, 0x30, 0x90, 0x2a, 0x5a, 0xad,
+  0x58, 0x20, 0x92, 0xad, 0xa9, 0x2a, 0x99, 0x2e, 0x06, 0x2d, 0x92, 0xa3,
+  0x25, 0xad, 0x50, 0x2b, 0x14, 0x27, 0x70, 0xab, 0xbb, 0x2a, 0x5a, 0x24,
+  0x5c, 0xa8, 0x1c, 0x28, 0x5d, 0xaa, 0xfd, 0xa5, 0x72, 0x26, 0x7c, 0xac,
+  0xd3, 0xa1, 0x5d, 0xac, 0xde, 0x2b, 0x7a, 0xa4, 0x0c, 0xaf, 0x29, 0x22,
+  0x86, 0xa7, 0x3f, 0x2e, 0x29, 0x29, 0x5b, 0xac, 0x91, 0x28, 0x26, 0x1d,
+  0x6c, 0x24, 0x1d, 0x1d, 0xc8, 0xad, 0x7d, 0xac, 0x32, 0xae, 0xea, 0xa1,
+  0x3f, 0x28, 0x0f, 0xb0, 0x5b, 0xae, 0xa5, 0x22, 0xbd, 0x9c, 0xbc, 0x2d,
+  0xf7, 0x30, 0x6c, 0xa4, 0xb4, 0x2a, 0xfc, 0x95, 0x00, 0x23, 0x8a, 0xae,
+  0x1d, 0xac, 0x06, 0xae, 0x52, 0x90, 0xc1, 0xa8, 0xc7, 0x28, 0x00, 0xaf,
+  0x45, 0xae, 0x3a, 0x2a, 0x44, 0xa7, 0x6a, 0x22, 0xc8, 0x2c, 0x9c, 0x28,
+  0xeb, 0x2d, 0x7f, 0x27, 0x91, 0x2d, 0x94, 0x2f, 0xa7, 0xa9, 0xdf, 0xab,
+  0x23, 0x25, 0x5c, 0x2f, 0xa8, 0x22, 0x32, 0xaa, 0xaf, 0xa9, 0x75, 0x2c,
+  0xa1, 0xa5, 0xe9, 0x2a, 0xe0, 0x2a, 0x22, 0x2b, 0xca, 0x2c, 0x49, 0x2e,
+  0xb5, 0x2d, 0xf1, 0x21, 0xce, 0xa1, 0xba, 0xa6, 0xb2, 0x2a, 0xb6, 0x91,
+  0xb8, 0x18, 0x79, 0x1c, 0x5f, 0xa0, 0xa0, 0x25, 0xee, 0xac, 0x59, 0x2e,
+  0xaa, 0x33, 0x26, 0x28, 0xcc, 0xab, 0x34, 0x2f, 0x3b, 0x27, 0x55, 0x2b,
+  0xf1, 0x29, 0x7a, 0xa9, 0xa4, 0x2c, 0x9b, 0x2a, 0x58, 0x2e, 0xad, 0xb3,
+  0x69, 0xb1, 0x84, 0x29, 0x24, 0xae, 0x8a, 0x23, 0x42, 0x30, 0xd6, 0x29,
+  0x1c, 0x28, 0x53, 0xa0, 0x9e, 0x09, 0xd7, 0xaf, 0x83, 0xac, 0x78, 0xac,
+  0x23, 0x27, 0x12, 0xa1, 0x13, 0x28, 0x91, 0xac, 0xbb, 0xb0, 0x98, 0x2b,
+  0x83, 0xab, 0xb4, 0xa7, 0xc6, 0x30, 0x5a, 0xaa, 0x8c, 0x2e, 0x0d, 0xa6,
+  0xa9, 0xac, 0xfe, 0x9d, 0xe4, 0xaa, 0x9b, 0xae, 0xa5, 0xa3, 0xc1, 0x22,
+  0x5c, 0x24, 0xa4, 0xae, 0x51, 0xb0, 0x8a, 0x2d, 0xc2, 0xac, 0xb3, 0x29,
+  0xab, 0x33, 0x36, 0x2d, 0x9a, 0x2d, 0xd8, 0x2a, 0x62, 0x25, 0x0d, 0xa5,
+  0x42, 0x2b, 0x47, 0x19, 0x2b, 0x29, 0xcc, 0xa6, 0x5d, 0xa9, 0x7b, 0xb1,
+  0xec, 0xb0, 0x01, 0x2d, 0xfe, 0x26, 0xc3, 0x31, 0x7b, 0x29, 0x76, 0xac,
+  0x39, 0x28, 0x39, 0xac, 0x5d, 0xab, 0x2c, 0xa5, 0x67, 0x24, 0xca, 0xac,
+  0x85, 0xab, 0x38, 0xaa, 0x1e, 0x20, 0xc5, 0xb0, 0x7e, 0xb2, 0xfd, 0x25,
+  0xd7, 0xae, 0xf4, 0x1e, 0x4c, 0x2c, 0x20, 0xad, 0x54, 0x9e, 0xce, 0x25,
+  0x4c, 0x27, 0x52, 0xa4, 0xae, 0xa9, 0xf4, 0xab, 0xa6, 0x17, 0x16, 0x27,
+  0x09, 0x2b, 0xf7, 0xb4, 0xd6, 0xad, 0x72, 0x2e, 0xf4, 0xa9, 0xab, 0x25,
+  0x8e, 0x30, 0x94, 0x2a, 0xb3, 0x2a, 0x86, 0x2d, 0x93, 0x2b, 0xe1, 0xac,
+  0x6e, 0xac, 0xea, 0xb1, 0x5d, 0x2d, 0x29, 0x2e, 0xb5, 0xa7, 0x70, 0xaa,
+  0xb6, 0xb0, 0x97, 0x22, 0x46, 0x27, 0x0a, 0x31, 0xbb, 0x32, 0xbf, 0xa6,
+  0x1d, 0x9b, 0x79, 0x20, 0x08, 0xac, 0x18, 0x24, 0xb1, 0xa8, 0x0d, 0xae,
+  0x30, 0x2e, 0x0a, 0x30, 0x34, 0x2e, 0xf9, 0xa8, 0x5e, 0xab, 0xec, 0xa3,
+  0x4d, 0xa9, 0x79, 0x2d, 0x8f, 0x2d, 0xaf, 0x2a, 0x09, 0x1d, 0xd3, 0x2b,
+  0x1d, 0xa9, 0xa1, 0xac, 0x2d, 0xaf, 0xab, 0xae, 0x56, 0x2b, 0xed, 0x25,
+  0x25, 0x2b, 0x92, 0xa0, 0xf9, 0xab, 0x2d, 0x2f, 0x18, 0x2a, 0x9d, 0x2e,
+  0x1a, 0x32, 0x8e, 0x29, 0x23, 0xa5, 0xb5, 0x24, 0xd5, 0x28, 0x72, 0xb0,
+  0x41, 0xaf, 0xae, 0xb0, 0xce, 0xab, 0x2f, 0xa5, 0xc0, 0x2d, 0x6f, 0xb1,
+  0xf7, 0xb0, 0x9a, 0xa8, 0x7e, 0xae, 0x5f, 0x2b, 0x3a, 0x30, 0x4c, 0xa6,
+  0x04, 0xa4, 0x68, 0xa4, 0xe7, 0x2d, 0x65, 0xaf, 0x64, 0xa8, 0xa8, 0xaf,
+  0xd7, 0xaa, 0x4a, 0xa6, 0x60, 0x2a, 0x3e, 0xae, 0xc9, 0xa5, 0x42, 0x2b,
+  0xe2, 0xac, 0xf7, 0x27, 0x6b, 0x2e, 0x8f, 0x2d, 0xc4, 0xa8, 0x7a, 0x29,
+  0x82, 0xa8, 0x32, 0xa8, 0x74, 0xaa, 0x52, 0xae, 0xa1, 0x2a, 0x75, 0x20,
+  0x7d, 0x29, 0x55, 0xae, 0x82, 0xae, 0xa3, 0x2d, 0x05, 0xa8, 0x24, 0xac,
+  0x31, 0x28, 0x00, 0xab, 0xd7, 0xa1, 0x40, 0x2c, 0x1f, 0x17, 0x32, 0x2b,
+  0x10, 0xac, 0x2a, 0xaf, 0x3c, 0x28, 0x4a, 0xa3, 0xe1, 0x29, 0x91, 0x2b,
+  0x72, 0xb2, 0x64, 0xa0, 0xee, 0xa7, 0xa4, 0x2f, 0x71, 0x30, 0x8d, 0xab,
+  0xbe, 0xaa, 0xda, 0x1f, 0xca, 0xa5, 0x0a, 0xa6, 0x40, 0x9e, 0xb5, 0xa6,
+  0x1f, 0x29, 0xcf, 0x1d, 0xc0, 0x2c, 0xfe, 0xaf, 0x69, 0xb0, 0x9e, 0x2d,
+  0xd9, 0xad, 0x36, 0x23, 0x8f, 0x2e, 0xb5, 0xaa, 0x1a, 0xa8, 0x37, 0x94,
+  0x89, 0x2d, 0x9e, 0x28, 0xf9, 0x25, 0xa0, 0xad, 0x9b, 0x25, 0xd0, 0x28,
+  0x78, 0x2f, 0xfe, 0xad, 0xab, 0xae, 0xaa, 0x2b, 0x23, 0xae, 0x35, 0x2b,
+  0x97, 0x11, 0xe3, 0x23, 0xd5, 0xa0, 0x09, 0x2f, 0x35, 0x2a, 0x08, 0xa3,
+  0x02, 0xa9, 0xf0, 0x28, 0x77, 0x23, 0x77, 0x9e, 0x70, 0x11, 0xa1, 0xb0,
+  0x15, 0xb2, 0x1c, 0x2e, 0xef, 0xab, 0xac, 0x2f, 0x03, 0x34, 0x68, 0x2c,
+  0xd7, 0x2e, 0xa6, 0x2b, 0xec, 0x28, 0x91, 0x20, 0x5e, 0x29, 0x75, 0x25,
+  0x24, 0xaa, 0x7d, 0x1f, 0x94, 0x2e, 0x90, 0xae, 0xe3, 0xb1, 0xa7, 0x28,
+  0xd0, 0x9b, 0x63, 0xa7, 0xe5, 0xa5, 0xa4, 0xab, 0x1a, 0x25, 0xfb, 0x2e,
+  0x1e, 0xa7, 0x9b, 0xa8, 0x7b, 0xa9, 0x06, 0xb0, 0x6d, 0xac, 0x5d, 0x9b,
+  0x51, 0x2c, 0xf0, 0xb1, 0xbc, 0xb1, 0xb1, 0x2a, 0x55, 0x18, 0x06, 0x96,
+  0x12, 0x31, 0x1a, 0xad, 0x9b, 0x2c, 0xd1, 0xa8, 0xa5, 0x29, 0x13, 0xb1,
+  0xf3, 0xa7, 0x3e, 0x9e, 0xa0, 0x27, 0xe8, 0x1f, 0xce, 0x94, 0x8f, 0xb0,
+  0x79, 0xac, 0x33, 0x29, 0xd0, 0xad, 0x0f, 0xab, 0x0b, 0x2b, 0x8e, 0x2a,
+  0x88, 0x28, 0x04, 0x28, 0xfd, 0x24, 0xe9, 0xae, 0x34, 0xac, 0xf2, 0x9c,
+  0x8b, 0x2d, 0xb4, 0x1e, 0x68, 0xa9, 0x91, 0xa9, 0x64, 0xac, 0x88, 0x29,
+  0xb6, 0xaf, 0xcc, 0x10, 0x3b, 0x30, 0x0f, 0x2a, 0xdf, 0xa8, 0x26, 0x2a,
+  0x48, 0x26, 0xdd, 0xa9, 0xb6, 0x21, 0x2a, 0xb1, 0x03, 0xa3, 0x5e, 0xa1,
+  0xea, 0xa2, 0xee, 0xac, 0x58, 0xb0, 0x36, 0x29, 0x4d, 0xad, 0xf9, 0x24,
+  0xfc, 0xa9, 0xfe, 0xac, 0xcb, 0x2f, 0x88, 0x2c, 0x32, 0xa9, 0xc3, 0xac,
+  0x09, 0xae, 0x71, 0xad, 0x78, 0xa3, 0x4e, 0x9c, 0x2e, 0x25, 0x32, 0xb4,
+  0xb3, 0xb1, 0x4e, 0xa6, 0xcf, 0xaa, 0x72, 0x2d, 0x4a, 0x31, 0x8d, 0x28,
+  0x48, 0x28, 0x1a, 0xa9, 0x46, 0x24, 0xf3, 0xb0, 0x44, 0xad, 0x79, 0xaf,
+  0x67, 0x2b, 0x69, 0xa8, 0x2a, 0xa8, 0x97, 0xb0, 0x73, 0xaf, 0xf0, 0x20,
+  0x99, 0xad, 0xd4, 0x23, 0xc4, 0x30, 0x20, 0xa0, 0x29, 0x2a, 0x93, 0x2d,
+  0xcf, 0x2f, 0x3d, 0xa9, 0x41, 0x9f, 0xb9, 0x16, 0x80, 0x2b, 0x10, 0x25,
+  0x2a, 0x24, 0x85, 0xab, 0x7a, 0xae, 0xa7, 0x29, 0xb3, 0xaa, 0x04, 0xa4,
+  0xff, 0x30, 0x23, 0xa2, 0x18, 0x2b, 0x1d, 0x2e, 0x8f, 0x29, 0xf7, 0x2b,
+  0xae, 0x22, 0x92, 0xad, 0x20, 0x21, 0xd4, 0xa5, 0xed, 0x29, 0x59, 0x2e,
+  0xb9, 0xa4, 0x2e, 0x24, 0x07, 0xad, 0x5a, 0xa4, 0x6f, 0x29, 0xeb, 0xac,
+  0x63, 0x29, 0xbe, 0x29, 0x1f, 0x29, 0xb1, 0x26, 0xcf, 0x29, 0x2e, 0xaa,
+  0xb0, 0x29, 0x4e, 0x28, 0x2b, 0x2e, 0x1c, 0xb2, 0x75, 0xb1, 0xa3, 0xab,
+  0xc1, 0x20, 0xdb, 0x27, 0x7b, 0x2e, 0xf7, 0xab, 0x55, 0x26, 0x7d, 0xa9,
+  0x53, 0x2c, 0x46, 0xb1, 0x91, 0xab, 0x12, 0xa6, 0xed, 0x2c, 0xe1, 0xa5,
+  0x8d, 0x2d, 0xa2, 0xb1, 0x66, 0xad, 0xb7, 0x30, 0xf4, 0xaf, 0x74, 0x2e,
+  0xbf, 0x2c, 0x4f, 0xac, 0x25, 0x22, 0x45, 0x1e, 0x92, 0xa5, 0x92, 0x2c,
+  0xfc, 0x2a, 0xd8, 0xb0, 0x2e, 0x2e, 0xdd, 0x2a, 0xd1, 0x9d, 0x5e, 0xb3,
+  0xe2, 0xab, 0x2a, 0x30, 0x43, 0x23, 0x5a, 0x27, 0x0f, 0x32, 0x0e, 0x25,
+  0x05, 0xa6, 0x8b, 0x2c, 0x2b, 0xa5, 0x80, 0xab, 0x9e, 0x2e, 0x41, 0x27,
+  0xdb, 0x2c, 0x81, 0xa4, 0x32, 0x23, 0x81, 0xae, 0xaa, 0xa8, 0x40, 0x25,
+  0x7c, 0xa8, 0x3f, 0xac, 0xef, 0x2b, 0x94, 0xab, 0x81, 0x26, 0x0c, 0x28,
+  0x1e, 0x28, 0x7b, 0xa4, 0x5a, 0xaa, 0xe8, 0x2a, 0x7f, 0xad, 0x35, 0xaa,
+  0x2e, 0xa8, 0x5f, 0xb0, 0x9b, 0xaa, 0xbe, 0x2c, 0xad, 0xad, 0x61, 0x29,
+  0x1f, 0xac, 0xc9, 0x28, 0x67, 0x1c, 0xc3, 0xa4, 0x8b, 0x29, 0xd2, 0xac,
+  0x40, 0xad, 0x79, 0xa6, 0x43, 0xa0, 0xed, 0x9c, 0xb1, 0x9e, 0x96, 0xb4,
+  0x18, 0xb2, 0x18, 0xaa, 0x92, 0xa7, 0x8f, 0x23, 0xbd, 0x2e, 0x8e, 0x26,
+  0x02, 0x2c, 0x74, 0xa9, 0x37, 0x2d, 0xb4, 0xac, 0x94, 0x23, 0xa2, 0xaf,
+  0x76, 0x2b, 0x37, 0xa7, 0x6b, 0xa9, 0xce, 0x2a, 0x04, 0xb0, 0x5b, 0x2b,
+  0x79, 0xab, 0xd7, 0x23, 0xcd, 0x2f, 0xc6, 0x1a, 0xfe, 0x27, 0x7b, 0x2d,
+  0x6d, 0xa7, 0x3a, 0x21, 0x7e, 0xaf, 0x58, 0xb0, 0xa1, 0x26, 0x45, 0x2c,
+  0xe7, 0xa5, 0x61, 0xa6, 0x5a, 0xab, 0xa5, 0xa8, 0x5c, 0xaa, 0x43, 0x2f,
+  0xfe, 0x2b, 0x89, 0xac, 0x3b, 0x26, 0xf6, 0x22, 0x7d, 0x29, 0xb0, 0xac,
+  0xc0, 0xad, 0xea, 0xac, 0x50, 0xa7, 0xe8, 0xa0, 0xd1, 0x29, 0x36, 0xad,
+  0x80, 0xac, 0x15, 0x26, 0xd8, 0xa9, 0xb6, 0x2a, 0x45, 0x30, 0xde, 0xad,
+  0x75, 0x27, 0x9a, 0x29, 0x7c, 0xac, 0x82, 0xad, 0x02, 0x9c, 0xb4, 0xac,
+  0x42, 0xa8, 0xc8, 0xaa, 0x52, 0x2c, 0xed, 0xb3, 0x50, 0xb2, 0x13, 0xa9,
+  0x8d, 0xa8, 0x02, 0x2b, 0xf8, 0x32, 0x80, 0xa5, 0x30, 0x2e, 0xc1, 0x22,
+  0x83, 0x2a, 0x6c, 0xad, 0x62, 0xad, 0x87, 0xa1, 0x1f, 0x2c, 0x33, 0xab,
+  0x92, 0x2e, 0xad, 0xb2, 0x23, 0xac, 0xee, 0x2c, 0x90, 0x20, 0x53, 0xa5,
+  0xae, 0x2c, 0x75, 0x28, 0x6f, 0x2c, 0x0e, 0x30, 0xd3, 0xa8, 0x7d, 0xa1,
+  0x86, 0x27, 0xe1, 0x20, 0x0e, 0x2e, 0x46, 0x28, 0x6e, 0x99, 0x55, 0x25,
+  0xdb, 0xae, 0x8a, 0x2d, 0x11, 0xa5, 0x0d, 0x98, 0x41, 0x31, 0x6d, 0x2c,
+  0x4c, 0xa7, 0x03, 0x30, 0x92, 0x2a, 0xd9, 0x2c, 0x29, 0xa8, 0xd5, 0xae,
+  0x3d, 0x9a, 0x2a, 0x2c, 0x7b, 0x28, 0x26, 0xa7, 0x8e, 0xae, 0x1c, 0xa5,
+  0x2a, 0xa5, 0x4f, 0x22, 0x18, 0x33, 0x73, 0xab, 0x55, 0xa4, 0x28, 0x1c,
+  0x54, 0x2c, 0x24, 0xac, 0x8a, 0xaf, 0xdf, 0xac, 0xb3, 0x24, 0x59, 0xa4,
+  0xc3, 0x2e, 0x34, 0xaf, 0xa5, 0xac, 0x1c, 0xaa, 0x28, 0xaf, 0x58, 0x23,
+  0x65, 0x30, 0x23, 0x1b, 0xea, 0xa4, 0xc8, 0xa6, 0xfc, 0xa1, 0x06, 0x21,
+  0xe6, 0xa9, 0x55, 0x21, 0xe5, 0x2a, 0x7f, 0x2d, 0xa9, 0x1c, 0x8b, 0xb3,
+  0x1b, 0xac, 0x38, 0x30, 0x4a, 0x2c, 0xe0, 0x2b, 0x3c, 0x24, 0xb2, 0xa6,
+  0x5d, 0x2d, 0x47, 0xa8, 0xf3, 0xac, 0xa4, 0x26, 0xb4, 0xa8, 0x37, 0xab,
+  0xb8, 0x1e, 0x6a, 0x2b, 0x53, 0x2c, 0xd0, 0xb1, 0xe7, 0xab, 0x2a, 0x28,
+  0x5d, 0xa8, 0xa1, 0x28, 0x68, 0x2d, 0xac, 0x26, 0x4f, 0x2c, 0x83, 0x2a,
+  0x65, 0xac, 0x99, 0xaa, 0x17, 0x2d, 0xe9, 0x28, 0x45, 0x25, 0xb8, 0x2b,
+  0xfd, 0x27, 0x40, 0xb2, 0xeb, 0xa4, 0x8e, 0x2f, 0x44, 0x9a, 0x0c, 0x2b,
+  0x93, 0x29, 0xd0, 0xac, 0xd3, 0x25, 0xc0, 0x30, 0xc1, 0x29, 0x8c, 0x27,
+  0x59, 0xaa, 0x17, 0x1d, 0xd1, 0x21, 0xcf, 0xa9, 0xf9, 0x28, 0xbb, 0xb0,
+  0xc2, 0xae, 0x2d, 0x25, 0x86, 0xac, 0xa6, 0x26, 0x0d, 0x31, 0xdb, 0xaa,
+  0xe9, 0xa2, 0xe3, 0x2c, 0xe8, 0x2a, 0x66, 0x1d, 0x7c, 0xa6, 0x2b, 0xa9,
+  0x65, 0x27, 0x07, 0xa8, 0xdd, 0x2c, 0xe6, 0xac, 0x96, 0xae, 0x23, 0xaa,
+  0xf1, 0xaa, 0xcf, 0x24, 0xfe, 0x30, 0x1a, 0x9c, 0x93, 0x2c, 0x9c, 0x28,
+  0x39, 0x27, 0x94, 0x22, 0xe6, 0xa4, 0x1c, 0xb0, 0x9a, 0xaa, 0x00, 0x99,
+  0xa8, 0xa9, 0x11, 0x1e, 0x38, 0xaf, 0xa8, 0x23, 0x7f, 0xac, 0xed, 0x2b,
+  0x52, 0x32, 0x31, 0xac, 0x90, 0x18, 0x09, 0xa7, 0xa8, 0xa0, 0x15, 0xa7,
+  0xf0, 0x9f, 0xa6, 0xb1, 0x3b, 0xa1, 0xa9, 0xa9, 0xae, 0x2c, 0x65, 0xad,
+  0x1e, 0xb0, 0xb2, 0x28, 0x36, 0xb2, 0x76, 0xaa, 0x37, 0x28, 0x8c, 0x2a,
+  0xcb, 0xa8, 0x76, 0x2c, 0x9e, 0xaf, 0x13, 0x18, 0x92, 0xac, 0x0a, 0xb0,
+  0xac, 0x27, 0xae, 0xaa, 0xe4, 0xa9, 0x4d, 0xae, 0xb1, 0xb2, 0xcf, 0x9f,
+  0xba, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0x00, 0x00, 0xce, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x87, 0x43, 0x62, 0xbd,
+  0xc2, 0xd9, 0x6a, 0xbd, 0x81, 0xb4, 0x3c, 0xbe, 0x6c, 0x41, 0xcc, 0xbd,
+  0x41, 0xd5, 0xfc, 0xbd, 0x7c, 0xb1, 0x87, 0xbd, 0x89, 0xe3, 0x88, 0xbc,
+  0x34, 0x4d, 0x4f, 0xbe, 0xfa, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x64, 0x4e, 0xbc, 0x3d, 0x44, 0xed, 0x9e, 0xbd,
+  0xae, 0xd9, 0xad, 0xbd, 0x8f, 0xae, 0x38, 0xbd, 0x20, 0x00, 0xbf, 0xbd,
+  0x76, 0xbf, 0x08, 0xbd, 0x69, 0xd7, 0x80, 0xbd, 0x7e, 0x04, 0x3d, 0x3d,
+  0x14, 0x76, 0xfa, 0x3c, 0x45, 0x09, 0xea, 0xbc, 0x2a, 0xb0, 0xd0, 0xbc,
+  0xc7, 0x7f, 0x70, 0xbd, 0xda, 0xe2, 0xf0, 0xbd, 0x76, 0xf6, 0x5b, 0x3e,
+  0xa2, 0xe1, 0x60, 0x3d, 0x67, 0x2d, 0xce, 0xbd, 0x46, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x66, 0x0a, 0x4b, 0x3d,
+  0xed, 0xdd, 0x40, 0x3c, 0x83, 0xd6, 0x6c, 0xbd, 0x48, 0xf5, 0xff, 0xff,
+  0x4c, 0xf5, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
+  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0x94, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00,
+  0xc8, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xb6, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x72, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0xf6, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4a, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc6, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xa6, 0xfe, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x82, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xbc, 0x07, 0x00, 0x00,
+  0x78, 0x07, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00,
+  0xc4, 0x06, 0x00, 0x00, 0x68, 0x06, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00,
+  0xc0, 0x05, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00,
+  0xcc, 0x04, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00,
+  0x70, 0x03, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00,
+  0x60, 0x02, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xae, 0xf8, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xa0, 0xf8, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xf2, 0xf8, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe4, 0xf8, 0xff, 0xff,
+  0x32, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x4d, 0x61,
+  0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x69, 0x61, 0x6c, 0x2f, 0x79, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x2f, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4e, 0xf9, 0xff, 0xff,
+  0x34, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0xf9, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66,
+  0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
+  0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x03, 0x00, 0x00, 0x92, 0xf9, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x84, 0xf9, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
+  0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d,
+  0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xe6, 0xf9, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd8, 0xf9, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
+  0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x45,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x31, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3e, 0xfa, 0xff, 0xff,
+  0x9c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x30, 0xfa, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75,
+  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
+  0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
+  0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31,
+  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x53, 0x71, 0x75, 0x65,
+  0x65, 0x7a, 0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31,
+  0x2f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f,
+  0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0xff, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xe4, 0xfa, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x31, 0x44, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d,
+  0x73, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4a, 0xfb, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3c, 0xfb, 0xff, 0xff,
+  0x20, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x31, 0x64, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x9e, 0xfb, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x90, 0xfb, 0xff, 0xff,
+  0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x31, 0x64, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44,
+  0x69, 0x6d, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xf6, 0xfb, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xe8, 0xfb, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65,
+  0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64,
+  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+  0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x53, 0x71,
+  0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64,
+  0x2f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x9e, 0xfc, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x90, 0xfc, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31,
+  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x2f, 0x45, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xde, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xec, 0xfc, 0xff, 0xff,
+  0x25, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e,
+  0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x40, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3c, 0xfd, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x31, 0x44, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d,
+  0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x7e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x3c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x8c, 0xfd, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
+  0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x2f, 0x45, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xca, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x3c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xd8, 0xfd, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44,
+  0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0xfe, 0xff, 0xff,
+  0x1a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x34, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x74, 0xfe, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xb6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xc4, 0xfe, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x79, 0x5f, 0x70, 0x72, 0x65,
+  0x64, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x34, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66,
+  0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6a, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x2f, 0x62,
+  0x69, 0x61, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x9a, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff,
+  0x0d, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31,
+  0x2f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xc0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x79, 0x5f, 0x70, 0x72,
+  0x65, 0x64, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x78, 0x3a, 0x30, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x0c, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xde, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19, 0xe6, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0xfa, 0xff, 0xff, 0xff, 0x00, 0x11, 0x06, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00,
+  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
+};
+unsigned int ds_cnn_s_model_fp16_len = 10896;
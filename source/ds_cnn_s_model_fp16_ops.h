@@ -0,0 +1,26 @@
+/* Generated by tools/op_resolver_gen.cpp from ds_cnn_s_model_fp16, do not edit. */
+
+#ifndef __DS_CNN_S_MODEL_FP16_OPS_H__
+#define __DS_CNN_S_MODEL_FP16_OPS_H__
+
+#include "tensorflow/lite/kernels/builtin_op_kernels.h"
+#include "tensorflow/lite/mutable_op_resolver.h"
+
+/* Operators used by ds_cnn_s_model_fp16 */
+#define DS_CNN_S_MODEL_FP16_OPS_COUNT 5
+
+static inline void RegisterModelOps_ds_cnn_s_model_fp16(tflite::MutableOpResolver *resolver)
+{
+  resolver->AddBuiltin(tflite::BuiltinOperator_RESHAPE,
+                       tflite::ops::builtin::Register_RESHAPE(), 1, 1);
+  resolver->AddBuiltin(tflite::BuiltinOperator_CONV_2D,
+                       tflite::ops::builtin::Register_CONV_2D(), 1, 1);
+  resolver->AddBuiltin(tflite::BuiltinOperator_MAX_POOL_2D,
+                       tflite::ops::builtin::Register_MAX_POOL_2D(), 1, 1);
+  resolver->AddBuiltin(tflite::BuiltinOperator_FULLY_CONNECTED,
+                       tflite::ops::builtin::Register_FULLY_CONNECTED(), 1, 1);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SOFTMAX,
+                       tflite::ops::builtin::Register_SOFTMAX(), 1, 1);
+}
+
+#endif
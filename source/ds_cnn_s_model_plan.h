@@ -0,0 +1,31 @@
+/* Generated by tools/memory_plan_gen.cpp from ds_cnn_s_model, do not edit. */
+
+#ifndef __DS_CNN_S_MODEL_PLAN_H__
+#define __DS_CNN_S_MODEL_PLAN_H__
+
+#include "memory_plan.h"
+
+/* exhaustive placement of 5 intermediate tensors over 6 nodes. Interpreter
+   arena without the plan: 33984 bytes, lower bound: 12032 bytes. */
+#define DS_CNN_S_MODEL_PLAN_ARENA_SIZE 12032
+
+static const MemoryPlanEntry ds_cnn_s_model_plan_entries[] = {
+  {13, 0, 7968},      // sequential/conv1d/Relu
+  {14, 0, 7968},      // sequential/max_pooling1d/ExpandDims1
+  {15, 8000, 4000},   // sequential/max_pooling1d/MaxPool
+  {16, 8000, 4000},   // sequential/conv1d_1/Conv1D/ExpandDims1
+  {17, 0, 8000},      // sequential/conv1d_1/Relu
+  {18, 0, 8000},      // sequential/max_pooling1d_1/ExpandDims1
+  {19, 8000, 4032},   // sequential/max_pooling1d_1/MaxPool
+  {20, 8000, 4032},   // sequential/flatten/Reshape
+  {21, 0, 12},        // sequential/y_pred/MatMul
+};
+
+static const MemoryPlan ds_cnn_s_model_plan = {
+  18452u, 0x46e0419fu,
+  DS_CNN_S_MODEL_PLAN_ARENA_SIZE, 13056, 33984,
+  ds_cnn_s_model_plan_entries,
+  sizeof(ds_cnn_s_model_plan_entries) / sizeof(ds_cnn_s_model_plan_entries[0])
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FP16_H__
+#define __FP16_H__
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * IEEE 754 half precision conversion, shared by the firmware and the host
+ * tools so both round the same way. Float to half rounds to nearest even;
+ * out of range values become infinity and tiny ones denormals or zero.
+ */
+
+static inline float Fp16ToFloat(uint16_t h)
+{
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1f;
+  uint32_t mant = h & 0x3ff;
+  uint32_t bits;
+
+  if (exp == 0x1f) {
+    bits = sign | 0x7f800000 | (mant << 13);
+  } else if (exp != 0) {
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  } else if (mant != 0) {
+    /* denormal, normalize the mantissa */
+    exp = 113;
+    while (!(mant & 0x400)) {
+      mant <<= 1;
+      exp--;
+    }
+    bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+  } else {
+    bits = sign;
+  }
+
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+static inline uint16_t Fp16FromFloat(float f)
+{
+  uint32_t x;
+  memcpy(&x, &f, sizeof(x));
+  uint32_t sign = (x >> 16) & 0x8000;
+  int32_t exp = (int32_t)((x >> 23) & 0xff) - 127 + 15;
+  uint32_t mant = x & 0x7fffff;
+
+  if (((x >> 23) & 0xff) == 0xff)
+    return sign | 0x7c00 | (mant ? 0x200 : 0);
+  if (exp >= 0x1f)
+    return sign | 0x7c00;
+
+  uint32_t half, rem, mid;
+  if (exp <= 0) {
+    if (exp < -10)
+      return sign;
+    /* denormal result, shift the full mantissa down */
+    mant |= 0x800000;
+    int shift = 14 - exp;
+    half = mant >> shift;
+    rem = mant & ((1u << shift) - 1);
+    mid = 1u << (shift - 1);
+  } else {
+    half = ((uint32_t)exp << 10) | (mant >> 13);
+    rem = mant & 0x1fff;
+    mid = 0x1000;
+  }
+  /* a carry out of the mantissa correctly bumps the exponent */
+  if (rem > mid || (rem == mid && (half & 1)))
+    half++;
+  return sign | half;
+}
+
+#endif
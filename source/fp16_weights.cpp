@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Load-time expansion of fp16 weight storage to float32.
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "tensorflow/lite/interpreter.h"
+#include "fp16.h"
+#include "fp16_weights.h"
+#include "memory_tiers.h"
+
+#define LOG(x) std::cout
+
+int ExpandFp16Weights(tflite::Interpreter *interpreter)
+{
+  size_t total = 0;
+  for (size_t i = 0; i < interpreter->tensors_size(); i++)
+  {
+    const TfLiteTensor *t = interpreter->tensor(i);
+    if (t->type == kTfLiteFloat16 && t->allocation_type == kTfLiteMmapRo)
+      total += t->bytes / sizeof(uint16_t) * sizeof(float);
+  }
+  if (total == 0)
+    return 0;
+  if (!interpreter->GetAllowFp16PrecisionForFp32())
+  {
+    LOG(INFO) << "Model stores fp16 weights, enable SetAllowFp16PrecisionForFp32\r\n";
+    return -1;
+  }
+
+  /* one block for all weights, alignment of the tier pools */
+  float *expanded = (float *)MemoryTierAlloc(FP16_EXPANDED_TIER, total, "fp16 weights");
+  size_t used = 0;
+  for (size_t i = 0; i < interpreter->tensors_size(); i++)
+  {
+    const TfLiteTensor *t = interpreter->tensor(i);
+    if (t->type != kTfLiteFloat16 || t->allocation_type != kTfLiteMmapRo)
+      continue;
+
+    size_t count = t->bytes / sizeof(uint16_t);
+    const uint8_t *half = (const uint8_t *)t->data.raw;
+    float *out = expanded + used;
+    for (size_t k = 0; k < count; k++)
+    {
+      /* flatbuffer data is only 2-byte aligned in general */
+      uint16_t h;
+      memcpy(&h, half + k * sizeof(h), sizeof(h));
+      out[k] = Fp16ToFloat(h);
+    }
+
+    std::vector<int> dims(t->dims->data, t->dims->data + t->dims->size);
+    if (interpreter->SetTensorParametersReadOnly(i, kTfLiteFloat32, t->name, dims, t->params,
+                                                 (const char *)out, count * sizeof(float)) != kTfLiteOk)
+    {
+      LOG(INFO) << "Cannot expand fp16 tensor " << i << "\r\n";
+      return -1;
+    }
+    used += count;
+  }
+  return (int)total;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FP16_WEIGHTS_H__
+#define __FP16_WEIGHTS_H__
+
+namespace tflite {
+class Interpreter;
+}
+
+/* Tier of the float32 copies, see memory_tiers.h */
+#ifndef FP16_EXPANDED_TIER
+#define FP16_EXPANDED_TIER kMemoryTierOCRAM
+#endif
+
+/*
+ * Expands the FLOAT16 constant tensors written by tools/fp16_weights_gen.cpp
+ * into float32 once at load, so every kernel sees the float model it was
+ * exported from while flash only holds half the weight bytes. It runs
+ * between InterpreterBuilder and AllocateTensors, and the copies live as
+ * long as the application.
+ *
+ * fp16 storage is an opt-in to reduced weight precision, so expansion only
+ * happens with Interpreter::SetAllowFp16PrecisionForFp32(true); without it a
+ * model carrying fp16 weights is refused. Activations stay float32.
+ *
+ * Returns the number of float32 bytes created (0 for a model without fp16
+ * weights), or -1 on error.
+ */
+int ExpandFp16Weights(tflite::Interpreter *interpreter);
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FRONTEND_CONFIG_H__
+#define __FRONTEND_CONFIG_H__
+
+/* Fractional bits of the quantized features produced by MFCC_Q15 */
+#define MFCC_DEC_BITS 1
+
+typedef enum
+{
+  FRONTEND_OUTPUT_MFCC = 0,   /* DCT of the log mel energies */
+  FRONTEND_OUTPUT_LOG_MEL,    /* log mel energies, no DCT */
+} frontend_output_t;
+
+/*
+ * Audio front-end configuration shared by MFCC, MFCC_Q15 and KWS_MFCC.
+ * Frame sizes are given in milliseconds and converted to samples at the
+ * configured sample rate, so the same model geometry (num_frames x
+ * num_features) can be fed from different capture rates.
+ */
+struct FrontendConfig
+{
+  int samp_freq;
+  int frame_len_ms;
+  int frame_shift_ms;
+  int num_frames;
+  int num_fbank_bins;
+  int num_mfcc_coeffs;
+  int mel_low_freq;
+  int mel_high_freq;
+  frontend_output_t output;
+
+  int frame_len() const { return (int)(samp_freq * 0.001 * frame_len_ms); }
+  int frame_shift() const { return (int)(samp_freq * 0.001 * frame_shift_ms); }
+  /* features per frame handed to the model */
+  int num_features() const
+  {
+    return (output == FRONTEND_OUTPUT_LOG_MEL) ? num_fbank_bins : num_mfcc_coeffs;
+  }
+};
+
+/* 44.1 kHz, the configuration ds_cnn_s_model was trained with */
+static const FrontendConfig kFrontendConfig44k = {
+  44100, 25, 10, 249, 40, 13, 20, 4000, FRONTEND_OUTPUT_MFCC
+};
+
+/* 16 kHz, matching the SAI capture rate. 400 sample frames pad to a
+   512 point FFT instead of 2048. */
+static const FrontendConfig kFrontendConfig16k = {
+  16000, 25, 10, 249, 40, 13, 20, 4000, FRONTEND_OUTPUT_MFCC
+};
+
+#endif
@@ -1,64 +1,111 @@
-/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
-
-Licensed under the Apache License, Version 2.0 (the "License");
-you may not use this file except in compliance with the License.
-You may obtain a copy of the License at
-
-    http://www.apache.org/licenses/LICENSE-2.0
-
-Unless required by applicable law or agreed to in writing, software
-distributed under the License is distributed on an "AS IS" BASIS,
-WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-See the License for the specific language governing permissions and
-limitations under the License.
-==============================================================================*/
-
-#ifndef TENSORFLOW_LITE_EXAMPLES_LABEL_IMAGE_GET_TOP_N_IMPL_H
-#define TENSORFLOW_LITE_EXAMPLES_LABEL_IMAGE_GET_TOP_N_IMPL_H
-
-#include <algorithm>
-#include <queue>
-
-extern bool input_floating;
-
-// Returns the top N confidence values over threshold in the provided vector,
-// sorted by confidence in descending order.
-template <class T>
-void GetTopN(T* prediction, int prediction_size, size_t num_results,
-               float threshold, std::vector<std::pair<float, int>>* top_results,
-               bool input_floating) {
-  // Will contain top N results in ascending order.
-  std::priority_queue<std::pair<float, int>, std::vector<std::pair<float, int>>,
-                      std::greater<std::pair<float, int>>>
-      top_result_pq;
-
-  const long count = prediction_size;  // NOLINT(runtime/int)
-  for (int i = 0; i < count; ++i) {
-    float value;
-    if (input_floating)
-      value = prediction[i];
-    else
-      value = prediction[i] / 255.0;
-    // Only add it if it beats the threshold and has a chance at being in
-    // the top N.
-    if (value < threshold) {
-      continue;
-    }
-
-    top_result_pq.push(std::pair<float, int>(value, i));
-
-    // If at capacity, kick the smallest value out.
-    if (top_result_pq.size() > num_results) {
-      top_result_pq.pop();
-    }
-  }
-
-  // Copy to output vector and reverse into descending order.
-  while (!top_result_pq.empty()) {
-    top_results->push_back(top_result_pq.top());
-    top_result_pq.pop();
-  }
-  std::reverse(top_results->begin(), top_results->end());
-}
-
-#endif  // TENSORFLOW_LITE_EXAMPLES_LABEL_IMAGE_GET_TOP_N_IMPL_H
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_EXAMPLES_LABEL_IMAGE_GET_TOP_N_IMPL_H
+#define TENSORFLOW_LITE_EXAMPLES_LABEL_IMAGE_GET_TOP_N_IMPL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/c/c_api_internal.h"
+
+// Up to N (score, index) pairs in descending order, held by value so that
+// collecting them never touches the heap. Equal scores keep the higher index
+// first, as the priority queue this replaces did.
+template <size_t N>
+struct TopNResults {
+  float score[N];
+  int index[N];
+  size_t size;
+
+  TopNResults() : size(0) {}
+  bool empty() const { return size == 0; }
+  void clear() { size = 0; }
+
+  // Inserts the pair in order, dropping the smallest one when full.
+  void insert(float value, int i) {
+    if (size == N && !Before(value, i, score[N - 1], index[N - 1])) {
+      return;
+    }
+    size_t pos = (size < N) ? size++ : N - 1;
+    for (; pos > 0 && Before(value, i, score[pos - 1], index[pos - 1]); --pos) {
+      score[pos] = score[pos - 1];
+      index[pos] = index[pos - 1];
+    }
+    score[pos] = value;
+    index[pos] = i;
+  }
+
+ private:
+  static bool Before(float a, int ai, float b, int bi) {
+    return a > b || (a == b && ai > bi);
+  }
+};
+
+// Output value to score: float as is, quantized types through the zero
+// point and scale of the tensor.
+inline float TopNScore(float value, const TfLiteQuantizationParams&) {
+  return value;
+}
+inline float TopNScore(uint8_t value, const TfLiteQuantizationParams& params) {
+  return (value - params.zero_point) * params.scale;
+}
+inline float TopNScore(int8_t value, const TfLiteQuantizationParams& params) {
+  return (value - params.zero_point) * params.scale;
+}
+
+// Returns the top N confidence values over threshold in top_results, sorted
+// by confidence in descending order.
+template <size_t N, class T>
+void GetTopN(const T* prediction, int prediction_size, float threshold,
+             const TfLiteQuantizationParams& params,
+             TopNResults<N>* top_results) {
+  top_results->clear();
+  for (int i = 0; i < prediction_size; ++i) {
+    const float value = TopNScore(prediction[i], params);
+    // Only add it if it beats the threshold.
+    if (value < threshold) {
+      continue;
+    }
+    top_results->insert(value, i);
+  }
+}
+
+// Same over the last dimension of an output tensor, assumed to be
+// (1, 1, ..., size). Returns false for types other than float, uint8 and
+// int8.
+template <size_t N>
+bool GetTopN(const TfLiteTensor* tensor, float threshold,
+             TopNResults<N>* top_results) {
+  const int size = tensor->dims->data[tensor->dims->size - 1];
+  switch (tensor->type) {
+    case kTfLiteFloat32:
+      GetTopN<N>(tensor->data.f, size, threshold, tensor->params, top_results);
+      return true;
+    case kTfLiteUInt8:
+      GetTopN<N>(tensor->data.uint8, size, threshold, tensor->params,
+                 top_results);
+      return true;
+    case kTfLiteInt8:
+      GetTopN<N>(tensor->data.int8, size, threshold, tensor->params,
+                 top_results);
+      return true;
+    default:
+      top_results->clear();
+      return false;
+  }
+}
+
+#endif  // TENSORFLOW_LITE_EXAMPLES_LABEL_IMAGE_GET_TOP_N_IMPL_H
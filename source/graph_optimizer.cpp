@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Load-time graph optimizer, fuses standalone activations into
+ * their producers and turns RESHAPE nodes into tensor aliases.
+ */
+
+#include <algorithm>
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/interpreter.h"
+#include "graph_optimizer.h"
+
+typedef std::pair<TfLiteNode, TfLiteRegistration> NodeAndReg;
+
+/* Fused activation slot of a producer that can absorb one, or NULL */
+static TfLiteFusedActivation* fused_activation(NodeAndReg &producer)
+{
+  void *params = producer.first.builtin_data;
+  switch (producer.second.builtin_code)
+  {
+    case kTfLiteBuiltinConv2d:
+      return &((TfLiteConvParams *)params)->activation;
+    case kTfLiteBuiltinDepthwiseConv2d:
+      return &((TfLiteDepthwiseConvParams *)params)->activation;
+    case kTfLiteBuiltinFullyConnected:
+      return &((TfLiteFullyConnectedParams *)params)->activation;
+    default:
+      return 0;
+  }
+}
+
+static bool is_graph_tensor(const std::vector<int> &list, int tensor)
+{
+  return std::find(list.begin(), list.end(), tensor) != list.end();
+}
+
+GraphOptimizer::GraphOptimizer()
+  : removed_nodes(0)
+{
+}
+
+/*
+ * Returns the number of nodes removed from the execution plan. Reshapes
+ * only become aliases with alias_reshapes set, see graph_optimizer.h.
+ */
+int GraphOptimizer::optimize(tflite::Interpreter *interpreter, bool alias_reshapes)
+{
+  tflite::Subgraph &graph = interpreter->primary_subgraph();
+  std::vector<NodeAndReg> &nodes = graph.nodes_and_registration();
+  const std::vector<int> &outputs = interpreter->outputs();
+  std::vector<int> plan = interpreter->execution_plan();
+
+  /* producer node and reader count of every tensor */
+  std::vector<int> producer(interpreter->tensors_size(), -1);
+  std::vector<int> readers(interpreter->tensors_size(), 0);
+  for (int node_index : plan)
+  {
+    const TfLiteNode &node = nodes[node_index].first;
+    for (int i = 0; i < node.outputs->size; i++)
+      producer[node.outputs->data[i]] = node_index;
+    for (int i = 0; i < node.inputs->size; i++)
+      if (node.inputs->data[i] >= 0)
+        readers[node.inputs->data[i]]++;
+  }
+
+  std::vector<int> new_plan;
+  aliases.clear();
+  removed_nodes = 0;
+
+  for (int node_index : plan)
+  {
+    NodeAndReg &entry = nodes[node_index];
+    TfLiteNode &node = entry.first;
+    int code = entry.second.builtin_code;
+    int in = node.inputs->data[0];
+    int out = node.outputs->data[0];
+
+    if (code == kTfLiteBuiltinRelu || code == kTfLiteBuiltinRelu6)
+    {
+      /* producer writes the activation output directly */
+      int p = producer[in];
+      TfLiteFusedActivation *activation = (p >= 0) ? fused_activation(nodes[p]) : 0;
+      if (activation && *activation == kTfLiteActNone && readers[in] == 1 &&
+          !is_graph_tensor(outputs, in))
+      {
+        *activation = (code == kTfLiteBuiltinRelu) ? kTfLiteActRelu : kTfLiteActRelu6;
+        nodes[p].first.outputs->data[0] = out;
+        producer[out] = p;
+        removed_nodes++;
+        continue;
+      }
+    }
+    else if (code == kTfLiteBuiltinReshape && alias_reshapes)
+    {
+      /* same bytes in the same order, only the dims differ */
+      TfLiteTensor *src = interpreter->tensor(in);
+      TfLiteTensor *dst = interpreter->tensor(out);
+      if (src->type == dst->type && src->bytes == dst->bytes && src->bytes > 0 &&
+          !is_graph_tensor(outputs, out) && !is_graph_tensor(outputs, in))
+      {
+        int root = in;
+        for (size_t i = 0; i < aliases.size(); i++)
+          if (aliases[i].first == in)
+            root = aliases[i].second;
+
+        dst->allocation_type = kTfLiteMmapRo;
+        aliases.push_back(std::make_pair(out, root));
+        removed_nodes++;
+        continue;
+      }
+    }
+    new_plan.push_back(node_index);
+  }
+
+  if (removed_nodes > 0 && interpreter->SetExecutionPlan(new_plan) != kTfLiteOk)
+  {
+    removed_nodes = 0;
+    return -1;
+  }
+  return removed_nodes;
+}
+
+/*
+ * The interpreter's planner sees no reader of an aliased tensor, so without
+ * a memory plan each one is kept in the persistent arena for the whole run.
+ */
+void GraphOptimizer::pin_alias_sources(tflite::Interpreter *interpreter)
+{
+  const std::vector<int> &inputs = interpreter->inputs();
+  for (size_t i = 0; i < aliases.size(); i++)
+  {
+    TfLiteTensor *root = interpreter->tensor(aliases[i].second);
+    if (root->allocation_type == kTfLiteArenaRw && !is_graph_tensor(inputs, aliases[i].second))
+      root->allocation_type = kTfLiteArenaRwPersistent;
+  }
+}
+
+void GraphOptimizer::bind_aliases(tflite::Interpreter *interpreter)
+{
+  for (size_t i = 0; i < aliases.size(); i++)
+  {
+    TfLiteTensor *alias = interpreter->tensor(aliases[i].first);
+    alias->data.raw = interpreter->tensor(aliases[i].second)->data.raw;
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __GRAPH_OPTIMIZER_H__
+#define __GRAPH_OPTIMIZER_H__
+
+#include <vector>
+
+namespace tflite {
+class Interpreter;
+}
+
+/*
+ * Load-time rewrite of the interpreter's execution plan, run once between
+ * InterpreterBuilder and AllocateTensors:
+ *
+ *  - a RELU / RELU6 node whose input comes only from a CONV_2D,
+ *    DEPTHWISE_CONV_2D or FULLY_CONNECTED node without an activation is
+ *    folded into that node as its fused activation;
+ *  - with alias_reshapes, a RESHAPE node becomes an alias: its output
+ *    tensor shares the input's memory and the node leaves the plan.
+ *
+ * Aliases are only cheap under a MemoryPlan, which gives the aliased input
+ * the lifetime of its alias. The interpreter's planner cannot: without a
+ * plan, pin_alias_sources() has to keep every aliased input in the
+ * persistent arena, and that costs more than the reshape copies it saves
+ * (37184 against 33984 arena bytes for ds_cnn_s_model). ModelRegistry
+ * therefore only aliases reshapes for a model with a memory plan, and pins
+ * the sources if the plan is then rejected.
+ *
+ * Alias pointers are arena addresses, so bind_aliases() has to follow every
+ * AllocateTensors(). Graph inputs and outputs are never rewritten.
+ */
+class GraphOptimizer
+{
+  private:
+    /* (alias tensor, tensor whose memory it uses) */
+    std::vector<std::pair<int, int> > aliases;
+    int removed_nodes;
+
+  public:
+    GraphOptimizer();
+    int optimize(tflite::Interpreter *interpreter, bool alias_reshapes);
+    void pin_alias_sources(tflite::Interpreter *interpreter);
+    void bind_aliases(tflite::Interpreter *interpreter);
+    int nodes_removed() const { return removed_nodes; }
+};
+
+#endif
@@ -1,437 +1,887 @@
-/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
-   Copyright 2018-2019 NXP. All Rights Reserved.
-
-Licensed under the Apache License, Version 2.0 (the "License");
-you may not use this file except in compliance with the License.
-You may obtain a copy of the License at
-
-    http://www.apache.org/licenses/LICENSE-2.0
-
-Unless required by applicable law or agreed to in writing, software
-distributed under the License is distributed on an "AS IS" BASIS,
-WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-See the License for the specific language governing permissions and
-limitations under the License.
-==============================================================================*/
-
-/* File modified by NXP. Changes are described in file
-   /middleware/eiq/tensorflow-lite/readme.txt in section "Release notes" */
-
-#include "board.h"
-
-#include "fsl_sai.h"
-
-#include "pin_mux.h"
-#include "clock_config.h"
-
-
-#include <iomanip>
-#include <iostream>
-#include <string>
-#include <vector>
-
-#include "tensorflow/lite/kernels/register.h"
-#include "tensorflow/lite/model.h"
-#include "tensorflow/lite/optional_debug_tools.h"
-#include "tensorflow/lite/string_util.h"
-
-#include "timer.h"
-#include "get_top_n.h"
-#include "ds_cnn_s_model.h"
-#include "kws_mfcc.h"
-
-#include "commands.h"
-
-
-#define LOG(x) std::cout
-#define TF_QUANTIZED
-#define LOG(x) std::cout
-
-/*******************************************************************************
- * Definitions
- ******************************************************************************/
-/* SAI instance and clock */
-#define DEMO_CODEC_WM8960
-#define DEMO_SAI SAI1
-#define DEMO_SAI_CHANNEL (0)
-#define DEMO_SAI_BITWIDTH (kSAI_WordWidth16bits)
-#define DEMO_SAI_IRQ SAI1_IRQn
-#define SAI_TxIRQHandler SAI1_IRQHandler
-
-/* Select Audio/Video PLL (786.48 MHz) as sai1 clock source */
-#define DEMO_SAI1_CLOCK_SOURCE_SELECT (2U)
-/* Clock pre divider for sai1 clock source */
-#define DEMO_SAI1_CLOCK_SOURCE_PRE_DIVIDER (0U)
-/* Clock divider for sai1 clock source */
-#define DEMO_SAI1_CLOCK_SOURCE_DIVIDER (63U)
-/* Get frequency of sai1 clock */
-#define DEMO_SAI_CLK_FREQ                                                        \
-    (CLOCK_GetFreq(kCLOCK_AudioPllClk) / (DEMO_SAI1_CLOCK_SOURCE_DIVIDER + 1U) / \
-     (DEMO_SAI1_CLOCK_SOURCE_PRE_DIVIDER + 1U))
-
-/* I2C instance and clock */
-#define DEMO_I2C LPI2C1
-
-/* Select USB1 PLL (480 MHz) as master lpi2c clock source */
-#define DEMO_LPI2C_CLOCK_SOURCE_SELECT (0U)
-/* Clock divider for master lpi2c clock source */
-#define DEMO_LPI2C_CLOCK_SOURCE_DIVIDER (5U)
-/* Get frequency of lpi2c clock */
-#define DEMO_I2C_CLK_FREQ ((CLOCK_GetFreq(kCLOCK_Usb1PllClk) / 8) / (DEMO_LPI2C_CLOCK_SOURCE_DIVIDER + 1U))
-
-#define OVER_SAMPLE_RATE (384U)
-#define BUFFER_SIZE (1024U)
-/* 16Khz * 2 bytes */
-#define AUDIO_NUM (16U * 2)
-/* Two buffers are switching for simultaneously reading and writing. */
-#define BUFFER_NUMBER (2U * AUDIO_NUM)
-#define BUFFER_TOTAL_SIZE (BUFFER_SIZE * BUFFER_NUMBER)
-#define STRIDE_SIZE (STRIDE_MS * AUDIO_NUM)
-#define DETECTION_TRESHOLD 30
-
-/* demo audio sample rate */
-#define DEMO_AUDIO_SAMPLE_RATE (kSAI_SampleRate16KHz)
-/* demo audio master clock */
-#if (defined FSL_FEATURE_SAI_HAS_MCLKDIV_REGISTER && FSL_FEATURE_SAI_HAS_MCLKDIV_REGISTER) || \
-    (defined FSL_FEATURE_PCC_HAS_SAI_DIVIDER && FSL_FEATURE_PCC_HAS_SAI_DIVIDER)
-#define DEMO_AUDIO_MASTER_CLOCK OVER_SAMPLE_RATE *DEMO_AUDIO_SAMPLE_RATE
-#else
-#define DEMO_AUDIO_MASTER_CLOCK DEMO_SAI_CLK_FREQ
-#endif
-/* demo audio data channel */
-#define DEMO_AUDIO_DATA_CHANNEL (1U)
-/* demo audio bit width */
-#define DEMO_AUDIO_BIT_WIDTH kSAI_WordWidth16bits
-
-/*******************************************************************************
- * Prototypes
- ******************************************************************************/
-
-/*******************************************************************************
- * Variables
- ******************************************************************************/
-volatile bool dataReady = false;
-sai_transfer_t xferRx = {0};
-sai_transfer_t xferTx = {0};
-
-
-
-static uint8_t indexRx = 0U, indexTx = 0U, indexStart = 0U;
-
-/*!
- * @brief AUDIO PLL setting: Frequency = Fref * (DIV_SELECT + NUM / DENOM)
- *                              = 24 * (32 + 77/100)
- *                              = 786.48 MHz
- */
-clock_audio_pll_config_t audioPllConfig;
-
-#if !defined(__ARMCC_VERSION)
-AT_NONCACHEABLE_SECTION_ALIGN(uint8_t audioBuff[BUFFER_TOTAL_SIZE], 4);
-#else
-AT_NONCACHEABLE_SECTION_ALIGN_INIT(uint8_t audioBuff[BUFFER_TOTAL_SIZE], 4);
-#endif
-
-sai_handle_t txHandle = {0};
-sai_handle_t rxHandle = {0};
-
-
-
-/*******************************************************************************
- * Code
- ******************************************************************************/
-
-/*!
- * @brief Initializes audio - PPL configuration and wm8960 configuration.
- *
- * @param Enable Sai Mclk output flag. Set tru for output otherwise input is used
- */
-void audio_init()
-{
-  audioPllConfig.loopDivider = 32;  /* PLL loop divider. Valid range for DIV_SELECT divider value: 27~54. */
-  audioPllConfig.postDivider = 1;   /* Divider after the PLL, should only be 1, 2, 4, 8, 16. */
-  audioPllConfig.numerator = 77;    /* 30 bit numerator of fractional loop divider. */
-  audioPllConfig.denominator = 100; /* 30 bit denominator of fractional loop divider */
-
-}
-
-/*!
- * @brief Enables Sai output Mclk output
- *
- * @param Enables Sai Mclk output flag. Set tru for output otherwise input is used
- */
-void BOARD_EnableSaiMclkOutput(bool enable)
-{
-  if (enable)
-  {
-    IOMUXC_GPR->GPR1 |= IOMUXC_GPR_GPR1_SAI1_MCLK_DIR_MASK;
-  }
-  else
-  {
-    IOMUXC_GPR->GPR1 &= (~IOMUXC_GPR_GPR1_SAI1_MCLK_DIR_MASK);
-  }
-}
-
-/*!
- * @brief RX callback
- *
- * @param pointer to I2S base address
- * @param pointer to sai edma handler
- * @param status
- * @param pointer to user data
- */
-static void rx_callback(I2S_Type *base, sai_handle_t *handle, status_t status, void *userData)
-{
-  if (kStatus_SAI_RxError == status)
-  {
-    LOG(INFO) << "SAI_Rx failed!\r\n";
-    return;
-  }
-  else
-  {
-    xferRx.data = audioBuff + indexRx * BUFFER_SIZE;
-    xferRx.dataSize = BUFFER_SIZE;
-    if (kStatus_Success == SAI_TransferReceiveNonBlocking(DEMO_SAI, &rxHandle, &xferRx))
-    {
-      indexTx = indexRx;
-      indexRx++;
-    }
-
-    if ((indexRx % AUDIO_NUM) == 0U)
-    {
-      indexStart = indexRx - AUDIO_NUM;
-      dataReady = true;
-    }
-
-    if (indexRx == BUFFER_NUMBER)
-    {
-      indexRx = 0U;
-    }
-  }
-}
-
-/*!
- * @brief TX callback
- *
- * @param pointer to I2S base address
- * @param pointer to sai edma handler
- * @param status
- * @param pointer to user data
- */
-static void tx_callback(I2S_Type *base, sai_handle_t *handle, status_t status, void *userData)
-{
-  if (kStatus_SAI_TxError == status)
-  {
-    return;
-  }
-  else
-  {
-    xferTx.dataSize = BUFFER_SIZE;
-    xferTx.data = audioBuff + indexTx * BUFFER_SIZE;
-
-    if (SAI_TransferSendNonBlocking(base, &txHandle, &xferTx) != kStatus_Success)
-    {
-      LOG(INFO) << "SAI_Tx failed!\r\n";
-      return;
-    }
-  }
-}
-
-/*!
- * @brief Starts record playback and sets up RX and TX handlers
- *
- * @param pointer to I2S base address
- */
-void RecordPlayback(I2S_Type *base)
-{
-  sai_transfer_t xfer = {NULL, 0};
-  memset(audioBuff, 0, BUFFER_SIZE * BUFFER_NUMBER);
-  SAI_TxSoftwareReset(base, kSAI_ResetTypeSoftware);
-  SAI_RxSoftwareReset(base, kSAI_ResetTypeSoftware);
-
-  xfer.dataSize = BUFFER_SIZE;
-  xfer.data = audioBuff;
-
-  SAI_TransferSendNonBlocking(base, &txHandle, &xfer);
-  SAI_TransferReceiveNonBlocking(base, &rxHandle, &xfer);
-}
-
-/*!
- * @brief Initialize @parameters for inference
- *
- * @param reference to flat buffer
- * @param reference to interpreter
- * @param pointer to storing input tensor address
- * @param verbose mode flag. Set true for verbose mode
- */
-void InferenceInit(std::unique_ptr<tflite::FlatBufferModel> &model,
-                   std::unique_ptr<tflite::Interpreter> &interpreter,
-                   TfLiteTensor** input_tensor, bool isVerbose)
-{
-  model = tflite::FlatBufferModel::BuildFromBuffer((const char*)ds_cnn_s_model, ds_cnn_s_model_len);
-  if (!model)
-  {
-    LOG(FATAL) << "\nFailed to load model \r\n";
-    return;
-  }
-
-  tflite::ops::builtin::BuiltinOpResolver resolver;
-
-  tflite::InterpreterBuilder(*model, resolver)(&interpreter);
-  if (!interpreter)
-  {
-    LOG(FATAL) << "Failed to construct interpreterr\r\n";
-    return;
-  }
-
-  int input = interpreter->inputs()[0];
-
-  if (interpreter->AllocateTensors() != kTfLiteOk)
-  {
-    LOG(FATAL) << "Failed to allocate tensors!\r\n";
-    return;
-  }
-
-  /* Get input dimension from the input tensor metadata
-     assuming one input only */
-  *input_tensor = interpreter->tensor(input);
-  
-  if (isVerbose)
-  {
-    const std::vector<int> inputs = interpreter->inputs();
-    const std::vector<int> outputs = interpreter->outputs();
-
-    LOG(INFO) << "input: " << inputs[0] << "\r\n";
-    LOG(INFO) << "number of inputs: " << inputs.size() << "\r\n";
-    LOG(INFO) << "number of outputs: " << outputs.size() << "\r\n";
-
-    LOG(INFO) << "tensors size: " << interpreter->tensors_size() << "\r\n";
-    LOG(INFO) << "nodes size: " << interpreter->nodes_size() << "\r\n";
-    LOG(INFO) << "inputs: " << interpreter->inputs().size() << "\r\n";
-    LOG(INFO) << "input(0) name: " << interpreter->GetInputName(0) << "\r\n";
-
-    int t_size = interpreter->tensors_size();
-    for (int i = 0; i < t_size; i++)
-    {
-      if (interpreter->tensor(i)->name)
-      {
-        LOG(INFO) << i << ": " << interpreter->tensor(i)->name << ", "
-                  << interpreter->tensor(i)->bytes << ", "
-                  << interpreter->tensor(i)->type << ", "
-                  << interpreter->tensor(i)->params.scale << ", "
-                  << interpreter->tensor(i)->params.zero_point << "\r\n";
-      }
-    }
-
-    LOG(INFO) << "\r\n";
-  }
-}
-
-/*!
- * @brief Runs inference input buffer and print result to console
- *
- * @param pointer to kws mfcc class
- * @param reference to flat buffer model
- * @param pointer to labels string array
- * @param reference to interpreter
- * @param pointer to input tensor
- */
-void RunInference(KWS_MFCC *kws, float* buf, const std::string *labels,
-                  std::unique_ptr<tflite::FlatBufferModel> &model,
-                  std::unique_ptr<tflite::Interpreter> &interpreter,
-                  TfLiteTensor* input_tensor)
-{
-  kws->audio_buffer = buf;
-  kws->extract_features();
-  float* in = (float*)kws->mfcc_buffer;
-
-  /* Get input dimension from the input tensor metadata
-     assuming one input only */
-  int input_bytes = input_tensor->bytes;
-
-
-  int input = interpreter->inputs()[0];
-    float* input_voice = interpreter->typed_tensor<float>(input);
-    for(int i = 0; i < input_bytes/4; i++){
-  	  input_voice[i] = in[i];
-    }
-
-  auto start = GetTimeInUS();
-  if (interpreter->Invoke() != kTfLiteOk)
-  {
-    LOG(FATAL) << "Failed to invoke tflite!\r\n";
-    return;
-  }
-  auto end = GetTimeInUS();
-
-  const float threshold = (float)DETECTION_TRESHOLD /100;
-
-  std::vector<std::pair<float, int>> top_results;
-
-  int output = interpreter->outputs()[0];
-  TfLiteTensor* output_tensor = interpreter->tensor(output);
-  TfLiteIntArray* output_dims = output_tensor->dims;
-
-  /* Assume output dims to be something like (1, 1, ... , size) */
-  auto output_size = output_dims->data[output_dims->size - 1];
-
-  GetTopN<float>(interpreter->typed_output_tensor<float>(0),
-  		  	  	  output_size, 1, threshold,
-				  &top_results, true);
-
-  if (!top_results.empty())
-  {
-    auto result = top_results.front();
-    const float confidence = result.first;
-    const int index = result.second;
-    if (confidence * 100 > DETECTION_TRESHOLD)
-    {
-      LOG(INFO) << "----------------------------------------\r\n";
-      LOG(INFO) << "     Inference time:   " << (end - start) / 1000 << " ms\r\n";
-      LOG(INFO) << "     Detected: " << std::setw(10) << labels[index] << " (" << (int)(confidence * 100) << "%)\r\n";
-      LOG(INFO) << "----------------------------------------\r\n\r\n";
-    }
-  }
-}
-
-/*!
- * @brief Initializes device and run KWS application
- */
-int main(void)
-{
-
-  /* (recording_win x frame_shift) is the actual recording window size. */
-  int recording_win = 249;
-  KWS_MFCC kws_mfcc(recording_win);
-  const std::string labels[] = {"baby_cry", "baby_laugh","silence"};
-
-  /* Init board hardware */
-  BOARD_ConfigMPU();
-  BOARD_InitBootPins();
-  BOARD_InitDEBUG_UART();
-  BOARD_InitSDRAM();
-  BOARD_BootClockRUN();
-  BOARD_InitDebugConsole();
-
-  InitTimer();
-
-  std::unique_ptr<tflite::FlatBufferModel> model;
-  std::unique_ptr<tflite::Interpreter> interpreter;
-  TfLiteTensor* input_tensor = 0;
-  InferenceInit(model, interpreter, &input_tensor, false);
-
-  LOG(INFO) << "Baby Cry Detection example using a TensorFlow Lite model.\r\n" << std::endl;
-  LOG(INFO) << "Detection threshold: " << DETECTION_TRESHOLD << "%\r\n";
-
-  LOG(INFO) << "\r\nStatic data processing:\r\n" << std::endl;
-
-  RunInference(&kws_mfcc, (float*)OFF, labels, model, interpreter, input_tensor);
-  RunInference(&kws_mfcc, (float*)RIGHT, labels, model, interpreter, input_tensor);
-
-  //RunInference(&kws_mfcc, (int16_t*)LEFT, labels, model, interpreter, input_tensor);
-  //RunInference(&kws_mfcc, (int16_t*)ON, labels, model, interpreter, input_tensor);
-
-  //RunInference(&kws_mfcc, (int16_t*)TOP, labels, model, interpreter, input_tensor);
-  RunInference(&kws_mfcc, (float*)BOTTOM, labels, model, interpreter, input_tensor);
-  LOG(INFO) << "\r\nThe End\r\n" << std::endl;
-
-}
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+   Copyright 2018-2019 NXP. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+/* File modified by NXP. Changes are described in file
+   /middleware/eiq/tensorflow-lite/readme.txt in section "Release notes" */
+
+#include "board.h"
+
+#include "fsl_sai.h"
+
+#include "pin_mux.h"
+#include "clock_config.h"
+
+
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/mutable_op_resolver.h"
+#include "tensorflow/lite/model.h"
+#include "tensorflow/lite/optional_debug_tools.h"
+#include "tensorflow/lite/string_util.h"
+
+#include "timer.h"
+#include "get_top_n.h"
+#ifdef TF_QUANTIZED
+/* Full integer (int8) export of the same model, see README */
+#include "ds_cnn_s_model_int8.h"
+#include "ds_cnn_s_model_int8_ops.h"
+#define DEMO_MODEL ds_cnn_s_model_int8
+#define DEMO_MODEL_LEN ds_cnn_s_model_int8_len
+#define DEMO_MODEL_OPS RegisterModelOps_ds_cnn_s_model_int8
+#elif defined(FP16_WEIGHTS)
+/* Float model with fp16 weight storage, see tools/fp16_weights_gen.cpp */
+#include "ds_cnn_s_model_fp16.h"
+#include "ds_cnn_s_model_fp16_ops.h"
+#include "ds_cnn_s_model_fp16_plan.h"
+#define DEMO_MODEL ds_cnn_s_model_fp16
+#define DEMO_MODEL_LEN ds_cnn_s_model_fp16_len
+#define DEMO_MODEL_OPS RegisterModelOps_ds_cnn_s_model_fp16
+#define DEMO_MODEL_PLAN ds_cnn_s_model_fp16_plan
+#define DEMO_MODEL_PLAN_ARENA_SIZE DS_CNN_S_MODEL_FP16_PLAN_ARENA_SIZE
+#else
+#include "ds_cnn_s_model.h"
+#include "ds_cnn_s_model_ops.h"
+#include "ds_cnn_s_model_plan.h"
+#define DEMO_MODEL ds_cnn_s_model
+#define DEMO_MODEL_LEN ds_cnn_s_model_len
+#define DEMO_MODEL_OPS RegisterModelOps_ds_cnn_s_model
+#define DEMO_MODEL_PLAN ds_cnn_s_model_plan
+#define DEMO_MODEL_PLAN_ARENA_SIZE DS_CNN_S_MODEL_PLAN_ARENA_SIZE
+#endif
+#if defined(DEMO_FP16_DETECTOR) && !defined(FP16_WEIGHTS)
+/* fp16 weight copy run next to the demo model, to compare their scores */
+#include "ds_cnn_s_model_fp16.h"
+#include "ds_cnn_s_model_fp16_ops.h"
+#include "ds_cnn_s_model_fp16_plan.h"
+#endif
+#include "kws_mfcc.h"
+#include "resampler.h"
+#include "vad.h"
+#include "streaming_model.h"
+#include "model_registry.h"
+#include "memory_tiers.h"
+#include "deadline_scheduler.h"
+#include "op_profiler.h"
+#include "pipeline_benchmark.h"
+#include "posterior_filter.h"
+#include "audio_ring.h"
+
+#include "commands.h"
+
+
+#define LOG(x) std::cout
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* SAI instance and clock */
+#define DEMO_CODEC_WM8960
+#define DEMO_SAI SAI1
+#define DEMO_SAI_CHANNEL (0)
+#define DEMO_SAI_BITWIDTH (kSAI_WordWidth16bits)
+#define DEMO_SAI_IRQ SAI1_IRQn
+#define SAI_TxIRQHandler SAI1_IRQHandler
+
+/* Select Audio/Video PLL (786.48 MHz) as sai1 clock source */
+#define DEMO_SAI1_CLOCK_SOURCE_SELECT (2U)
+/* Clock pre divider for sai1 clock source */
+#define DEMO_SAI1_CLOCK_SOURCE_PRE_DIVIDER (0U)
+/* Clock divider for sai1 clock source */
+#define DEMO_SAI1_CLOCK_SOURCE_DIVIDER (63U)
+/* Get frequency of sai1 clock */
+#define DEMO_SAI_CLK_FREQ                                                        \
+    (CLOCK_GetFreq(kCLOCK_AudioPllClk) / (DEMO_SAI1_CLOCK_SOURCE_DIVIDER + 1U) / \
+     (DEMO_SAI1_CLOCK_SOURCE_PRE_DIVIDER + 1U))
+
+/* I2C instance and clock */
+#define DEMO_I2C LPI2C1
+
+/* Select USB1 PLL (480 MHz) as master lpi2c clock source */
+#define DEMO_LPI2C_CLOCK_SOURCE_SELECT (0U)
+/* Clock divider for master lpi2c clock source */
+#define DEMO_LPI2C_CLOCK_SOURCE_DIVIDER (5U)
+/* Get frequency of lpi2c clock */
+#define DEMO_I2C_CLK_FREQ ((CLOCK_GetFreq(kCLOCK_Usb1PllClk) / 8) / (DEMO_LPI2C_CLOCK_SOURCE_DIVIDER + 1U))
+
+#define OVER_SAMPLE_RATE (384U)
+#define BUFFER_SIZE (1024U)
+/* 16Khz * 2 bytes */
+#define AUDIO_NUM (16U * 2)
+/* Capture ring of two windows of blocks, a power of two */
+#define BUFFER_NUMBER (2U * AUDIO_NUM)
+#define BUFFER_TOTAL_SIZE (BUFFER_SIZE * BUFFER_NUMBER)
+#define STRIDE_SIZE (STRIDE_MS * AUDIO_NUM)
+#define DETECTION_TRESHOLD 30
+/* Frames per streaming hop in live mode, 8 x 10 ms. Streaming inference
+   needs a multiple of the model's total time stride (4). */
+#define LIVE_HOP_FRAMES 8
+/* Captured samples resampled per step, bounds the staging buffer */
+#define RESAMPLE_CHUNK (BUFFER_SIZE / 2)
+/* Label reported without inference when the VAD gates a window */
+#define SILENCE_LABEL_INDEX 2
+/* Live windows between VAD duty-cycle reports */
+#define VAD_REPORT_WINDOWS 100
+/* Capture to result budget of a live window, one capture window by default */
+#ifndef LIVE_WINDOW_DEADLINE_US
+#define LIVE_WINDOW_DEADLINE_US 1000000
+#endif
+/* Live decisions on posteriors averaged over the last hops, see
+   posterior_filter.h and tools/posterior_replay.cpp to tune them */
+#ifndef LIVE_AVERAGE_HOPS
+#define LIVE_AVERAGE_HOPS 3
+#endif
+#ifndef LIVE_ATTACK_HOPS
+#define LIVE_ATTACK_HOPS 2
+#endif
+#ifndef LIVE_RELEASE_HOPS
+#define LIVE_RELEASE_HOPS 3
+#endif
+
+/* demo audio sample rate */
+#define DEMO_AUDIO_SAMPLE_RATE (kSAI_SampleRate16KHz)
+/* demo audio master clock */
+#if (defined FSL_FEATURE_SAI_HAS_MCLKDIV_REGISTER && FSL_FEATURE_SAI_HAS_MCLKDIV_REGISTER) || \
+    (defined FSL_FEATURE_PCC_HAS_SAI_DIVIDER && FSL_FEATURE_PCC_HAS_SAI_DIVIDER)
+#define DEMO_AUDIO_MASTER_CLOCK OVER_SAMPLE_RATE *DEMO_AUDIO_SAMPLE_RATE
+#else
+#define DEMO_AUDIO_MASTER_CLOCK DEMO_SAI_CLK_FREQ
+#endif
+/* demo audio data channel */
+#define DEMO_AUDIO_DATA_CHANNEL (1U)
+/* demo audio bit width */
+#define DEMO_AUDIO_BIT_WIDTH kSAI_WordWidth16bits
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#ifdef PROFILE_OPS
+/* Per-op cycles of the first model, attached in main */
+OpProfiler opProfiler;
+#endif
+/* Capture windows, stamped by rx_callback every AUDIO_NUM committed blocks */
+DeadlineScheduler liveWindows(LIVE_WINDOW_DEADLINE_US);
+/* Raise and clear thresholds of the smoothed live posteriors, per label */
+static const ClassThreshold kLiveThresholds[] = {
+  {DETECTION_TRESHOLD / 100.0f, 0.20f},   // baby_cry
+  {DETECTION_TRESHOLD / 100.0f, 0.20f},   // baby_laugh
+  {2.0f, 2.0f}                            // silence, never reported
+};
+static const PosteriorConfig kLivePosteriorConfig = {LIVE_AVERAGE_HOPS, LIVE_ATTACK_HOPS,
+                                                      LIVE_RELEASE_HOPS};
+sai_transfer_t xferRx = {0};
+sai_transfer_t xferTx = {0};
+
+
+/*!
+ * @brief AUDIO PLL setting: Frequency = Fref * (DIV_SELECT + NUM / DENOM)
+ *                              = 24 * (32 + 77/100)
+ *                              = 786.48 MHz
+ */
+clock_audio_pll_config_t audioPllConfig;
+
+#if !defined(__ARMCC_VERSION)
+AT_NONCACHEABLE_SECTION_ALIGN(uint8_t audioBuff[BUFFER_TOTAL_SIZE], 4);
+#else
+AT_NONCACHEABLE_SECTION_ALIGN_INIT(uint8_t audioBuff[BUFFER_TOTAL_SIZE], 4);
+#endif
+/* Blocks of audioBuff between rx_callback and the live loop */
+static_assert((BUFFER_NUMBER & (BUFFER_NUMBER - 1)) == 0, "capture ring needs a power of two blocks");
+AudioRing captureRing(audioBuff, BUFFER_SIZE, BUFFER_NUMBER);
+
+sai_handle_t txHandle = {0};
+sai_handle_t rxHandle = {0};
+
+
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Initializes audio - PPL configuration and wm8960 configuration.
+ *
+ * @param Enable Sai Mclk output flag. Set tru for output otherwise input is used
+ */
+void audio_init()
+{
+  audioPllConfig.loopDivider = 32;  /* PLL loop divider. Valid range for DIV_SELECT divider value: 27~54. */
+  audioPllConfig.postDivider = 1;   /* Divider after the PLL, should only be 1, 2, 4, 8, 16. */
+  audioPllConfig.numerator = 77;    /* 30 bit numerator of fractional loop divider. */
+  audioPllConfig.denominator = 100; /* 30 bit denominator of fractional loop divider */
+
+}
+
+/*!
+ * @brief Enables Sai output Mclk output
+ *
+ * @param Enables Sai Mclk output flag. Set tru for output otherwise input is used
+ */
+void BOARD_EnableSaiMclkOutput(bool enable)
+{
+  if (enable)
+  {
+    IOMUXC_GPR->GPR1 |= IOMUXC_GPR_GPR1_SAI1_MCLK_DIR_MASK;
+  }
+  else
+  {
+    IOMUXC_GPR->GPR1 &= (~IOMUXC_GPR_GPR1_SAI1_MCLK_DIR_MASK);
+  }
+}
+
+/*!
+ * @brief RX callback
+ *
+ * @param pointer to I2S base address
+ * @param pointer to sai edma handler
+ * @param status
+ * @param pointer to user data
+ */
+static void rx_callback(I2S_Type *base, sai_handle_t *handle, status_t status, void *userData)
+{
+  if (kStatus_SAI_RxError == status)
+  {
+    LOG(INFO) << "SAI_Rx failed!\r\n";
+    return;
+  }
+  else
+  {
+    /* the block just received is complete; a full ring drops it and it is received again */
+    if (captureRing.commit() && (captureRing.committed() % AUDIO_NUM) == 0U)
+    {
+      liveWindows.captured(GetTimeInUS());
+    }
+
+    xferRx.data = captureRing.write_block();
+    xferRx.dataSize = BUFFER_SIZE;
+    SAI_TransferReceiveNonBlocking(DEMO_SAI, &rxHandle, &xferRx);
+  }
+}
+
+/*!
+ * @brief TX callback
+ *
+ * @param pointer to I2S base address
+ * @param pointer to sai edma handler
+ * @param status
+ * @param pointer to user data
+ */
+static void tx_callback(I2S_Type *base, sai_handle_t *handle, status_t status, void *userData)
+{
+  if (kStatus_SAI_TxError == status)
+  {
+    return;
+  }
+  else
+  {
+    xferTx.dataSize = BUFFER_SIZE;
+    xferTx.data = (uint8_t *)captureRing.newest_block();
+
+    if (SAI_TransferSendNonBlocking(base, &txHandle, &xferTx) != kStatus_Success)
+    {
+      LOG(INFO) << "SAI_Tx failed!\r\n";
+      return;
+    }
+  }
+}
+
+/*!
+ * @brief Starts record playback and sets up RX and TX handlers
+ *
+ * @param pointer to I2S base address
+ */
+void RecordPlayback(I2S_Type *base)
+{
+  sai_transfer_t xfer = {NULL, 0};
+  memset(audioBuff, 0, BUFFER_SIZE * BUFFER_NUMBER);
+  SAI_TxSoftwareReset(base, kSAI_ResetTypeSoftware);
+  SAI_RxSoftwareReset(base, kSAI_ResetTypeSoftware);
+
+  xfer.dataSize = BUFFER_SIZE;
+  xfer.data = captureRing.write_block();
+
+  SAI_TransferSendNonBlocking(base, &txHandle, &xfer);
+  SAI_TransferReceiveNonBlocking(base, &rxHandle, &xfer);
+}
+
+/*!
+ * @brief Initialize @parameters for inference
+ *
+ * @param pointer to model registry with every detector added
+ * @param verbose mode flag. Set true for verbose mode
+ * @return true if all models are ready to invoke
+ */
+bool InferenceInit(ModelRegistry *registry, bool isVerbose)
+{
+  if (!registry->load())
+  {
+    return false;
+  }
+
+  for (int m = 0; isVerbose && m < registry->size(); m++)
+  {
+    tflite::Interpreter *interpreter = registry->interpreter(m);
+    const std::vector<int> inputs = interpreter->inputs();
+    const std::vector<int> outputs = interpreter->outputs();
+
+    LOG(INFO) << "input: " << inputs[0] << "\r\n";
+    LOG(INFO) << "number of inputs: " << inputs.size() << "\r\n";
+    LOG(INFO) << "number of outputs: " << outputs.size() << "\r\n";
+
+    LOG(INFO) << "tensors size: " << interpreter->tensors_size() << "\r\n";
+    LOG(INFO) << "nodes size: " << interpreter->nodes_size() << "\r\n";
+    LOG(INFO) << "inputs: " << interpreter->inputs().size() << "\r\n";
+    LOG(INFO) << "input(0) name: " << interpreter->GetInputName(0) << "\r\n";
+
+    int t_size = interpreter->tensors_size();
+    for (int i = 0; i < t_size; i++)
+    {
+      if (interpreter->tensor(i)->name)
+      {
+        LOG(INFO) << i << ": " << interpreter->tensor(i)->name << ", "
+                  << interpreter->tensor(i)->bytes << ", "
+                  << interpreter->tensor(i)->type << ", "
+                  << interpreter->tensor(i)->params.scale << ", "
+                  << interpreter->tensor(i)->params.zero_point << "\r\n";
+      }
+    }
+
+    LOG(INFO) << "\r\n";
+  }
+  return true;
+}
+
+/*!
+ * @brief Binds the feature window of kws to the registry's feature buffer,
+ * the input of every model, so features are written in place. A window
+ * bound to an older feature buffer is not carried over, since that buffer
+ * may have been freed; the window then restarts from zeros.
+ *
+ * @param pointer to kws mfcc class
+ * @param pointer to model registry
+ * @return true if features are written straight into the shared buffer
+ */
+bool BindFeatureInput(KWS_MFCC *kws, ModelRegistry *registry)
+{
+  if (kws->is_bound_to(registry->feature_buffer()))
+  {
+    return true;
+  }
+  /* only the owned ring is known to still be valid */
+  const bool keep_window = !kws->is_bound();
+  if (!kws->bind_output(registry->feature_buffer(), registry->feature_capacity(), keep_window))
+  {
+    kws->unbind_output(keep_window);
+    return false;
+  }
+  return true;
+}
+
+/*!
+ * @brief Invokes one registered model. With PROFILE_OPS the op profiler
+ * records the first model's Invoke.
+ *
+ * @param pointer to model registry
+ * @param index of the model
+ * @return false if Invoke failed or was cancelled
+ */
+bool InvokeModel(ModelRegistry *registry, int index)
+{
+#ifdef PROFILE_OPS
+  if (index == 0)
+  {
+    opProfiler.Reset();
+    opProfiler.StartProfiling();
+    bool ok = registry->invoke(index);
+    opProfiler.StopProfiling();
+    if (ok)
+    {
+      opProfiler.collect(registry->interpreter(index));
+    }
+    return ok;
+  }
+#endif
+  return registry->invoke(index);
+}
+
+/*!
+ * @brief Prints the share of windows the VAD gate skipped
+ *
+ * @param pointer to voice activity detector
+ */
+void PrintVadStats(const VAD *vad)
+{
+  LOG(INFO) << "VAD skipped " << vad->skipped_windows() << "/" << vad->total_windows()
+            << " windows (" << (int)(vad->skipped_fraction() * 100) << "%)\r\n";
+}
+
+/*!
+ * @brief Feeds the posteriors of one hop to a model's decision filter
+ *
+ * @param pointer to decision filter of the model
+ * @param pointer to streaming model scores, NULL to read the output tensor
+ * @param pointer to output tensor
+ * @param number of labels
+ */
+void FilterPosteriors(PosteriorFilter *filter, const float *stream_scores,
+                      const TfLiteTensor *output, int num_labels)
+{
+  float posteriors[POSTERIOR_MAX_CLASSES];
+  for (int i = 0; i < num_labels && i < POSTERIOR_MAX_CLASSES; i++)
+  {
+    if (stream_scores)
+    {
+      posteriors[i] = stream_scores[i];
+    }
+    else if (output->type == kTfLiteInt8)
+    {
+      posteriors[i] = TopNScore(output->data.int8[i], output->params);
+    }
+    else if (output->type == kTfLiteUInt8)
+    {
+      posteriors[i] = TopNScore(output->data.uint8[i], output->params);
+    }
+    else
+    {
+      posteriors[i] = output->data.f[i];
+    }
+  }
+  filter->process(posteriors);
+}
+
+/*!
+ * @brief Runs inference input buffer and print result to console. Every
+ * registered model scores the same features. When the VAD reports silence
+ * for the new audio, feature extraction and Invoke are skipped and the
+ * silence label is reported instead.
+ *
+ * Without decision filters every window is thresholded on its own. With
+ * them, a label is reported once, on the hop its smoothed posterior is
+ * raised.
+ *
+ * @param pointer to kws mfcc class
+ * @param pointer to voice activity detector, NULL to always run inference
+ * @param pointer to streaming model of the first model, NULL to run the interpreter
+ * @param pointer to audio buffer
+ * @param pointer to model registry
+ * @param pointer to one decision filter per model, NULL to threshold each window
+ * @return false if an Invoke failed or was cancelled
+ */
+bool RunInference(KWS_MFCC *kws, VAD *vad, StreamingModel *stream, float* buf,
+                  ModelRegistry *registry, PosteriorFilter *filters)
+{
+  const int hop_frames = kws->audio_block_size / kws->frame_shift;
+  bool bound = BindFeatureInput(kws, registry);
+
+  /* only the last audio_block_size samples are new in this window */
+  const float *new_audio = buf + (kws->audio_buffer_size - kws->audio_block_size);
+  if (vad && !vad->process(new_audio, kws->audio_block_size))
+  {
+    kws->skip_features();
+    if (stream)
+    {
+      stream->shift(hop_frames);
+    }
+    if (filters)
+    {
+      /* a gated hop counts as certain silence */
+      float silence[POSTERIOR_MAX_CLASSES] = {0};
+      silence[SILENCE_LABEL_INDEX] = 1.0f;
+      for (int m = 0; m < registry->size(); m++)
+      {
+        filters[m].process(silence);
+      }
+      return true;
+    }
+    LOG(INFO) << "     Detected: " << std::setw(10) << registry->spec(0).labels[SILENCE_LABEL_INDEX]
+              << " (VAD)\r\n";
+    return true;
+  }
+
+  kws->audio_buffer = buf;
+  kws->extract_features();
+
+  if (bound)
+  {
+    /* the window moves through the shared buffer every streaming hop */
+    registry->set_feature_window(kws->mfcc_buffer);
+  }
+  else
+  {
+    memcpy(registry->feature_buffer(), kws->mfcc_buffer, registry->feature_size() * sizeof(float));
+    registry->set_feature_window(registry->feature_buffer());
+  }
+
+  for (int m = 0; m < registry->size(); m++)
+  {
+    const ModelSpec &spec = registry->spec(m);
+    tflite::Interpreter *interpreter = registry->interpreter(m);
+    /* cached activations are kept for the first model only */
+    StreamingModel *model_stream = (m == 0) ? stream : NULL;
+
+    auto start = GetTimeInUS();
+    const float *stream_scores = 0;
+    if (model_stream)
+    {
+      /* only the columns that see the new hop are recomputed */
+      model_stream->shift(hop_frames);
+      stream_scores = model_stream->invoke(kws->mfcc_buffer);
+    }
+#ifndef STREAMING_VERIFY
+    else
+#endif
+    if (!InvokeModel(registry, m))
+    {
+      return false;
+    }
+    auto end = GetTimeInUS();
+
+    const float threshold = (float)spec.threshold / 100;
+
+    TopNResults<1> top_results;
+
+    int output = interpreter->outputs()[0];
+    TfLiteTensor* output_tensor = interpreter->tensor(output);
+
+    if (stream_scores)
+    {
+      TfLiteIntArray* output_dims = output_tensor->dims;
+
+      /* Assume output dims to be something like (1, 1, ... , size) */
+      auto output_size = output_dims->data[output_dims->size - 1];
+#ifdef STREAMING_VERIFY
+      const float *scores = interpreter->typed_output_tensor<float>(0);
+      float max_diff = 0.0f;
+      for (int i = 0; i < output_size; i++)
+      {
+        max_diff = std::max(max_diff, fabsf(stream_scores[i] - scores[i]));
+      }
+      LOG(INFO) << "Streaming vs Invoke max diff: " << max_diff << ", MACs "
+                << model_stream->macs() << "/" << model_stream->macs_full_window() << "\r\n";
+#endif
+      GetTopN<1>(stream_scores, output_size, threshold, output_tensor->params, &top_results);
+    }
+    else
+    {
+      /* Integer outputs are dequantized so scores and threshold stay in [0, 1] */
+      GetTopN<1>(output_tensor, threshold, &top_results);
+    }
+
+    if (filters)
+    {
+      FilterPosteriors(&filters[m], stream_scores, output_tensor, spec.num_labels);
+      top_results.clear();
+      if (filters[m].raised())
+      {
+        top_results.insert(filters[m].smoothed()[filters[m].active_class()],
+                           filters[m].active_class());
+      }
+    }
+
+    if (!top_results.empty())
+    {
+      const float confidence = top_results.score[0];
+      const int index = top_results.index[0];
+      if ((filters || confidence * 100 > spec.threshold) && index < spec.num_labels)
+      {
+        LOG(INFO) << "----------------------------------------\r\n";
+        if (registry->size() > 1)
+        {
+          LOG(INFO) << "     Model:            " << spec.name << "\r\n";
+        }
+        LOG(INFO) << "     Inference time:   " << (end - start) / 1000 << " ms\r\n";
+        LOG(INFO) << "     Detected: " << std::setw(10) << spec.labels[index] << " (" << (int)(confidence * 100) << "%)\r\n";
+        LOG(INFO) << "----------------------------------------\r\n\r\n";
+      }
+    }
+  }
+  return true;
+}
+
+#ifdef DEMO_LIVE_AUDIO
+/*!
+ * @brief Prints dropped, cancelled and late live windows and capture overruns
+ *
+ * @param pointer to deadline scheduler
+ * @param pointer to capture ring
+ */
+void PrintDeadlineStats(const DeadlineScheduler *scheduler, const AudioRing *ring)
+{
+  LOG(INFO) << "Windows processed " << scheduler->processed_windows()
+            << ", late " << scheduler->late_windows()
+            << ", dropped " << scheduler->dropped_windows()
+            << ", cancelled " << scheduler->cancelled_windows()
+            << ", max latency " << scheduler->max_latency() / 1000 << " ms"
+            << ", capture overruns " << ring->overruns() << " blocks\r\n";
+}
+
+/*!
+ * @brief Runs streaming inference on the SAI capture. Every captured block is
+ * resampled from DEMO_AUDIO_SAMPLE_RATE to the front-end rate and staged
+ * until a full hop (plus frame overlap) is available. Requires the SAI and
+ * codec bring-up from the SDK sai example before RecordPlayback.
+ *
+ * Capture windows come from the deadline scheduler, always the newest. A
+ * window still being processed when the next one completes is abandoned,
+ * mid-Invoke if need be, and the stream restarts on the newest audio. The
+ * window is read in place from the capture ring, and each block goes back
+ * to the capture as soon as it is resampled.
+ *
+ * Each model's posteriors go through a PosteriorFilter, so a detection is
+ * reported once when its smoothed posterior is raised rather than on every
+ * window over the threshold.
+ *
+ * @param pointer to kws mfcc class in streaming mode
+ * @param pointer to capture to front-end resampler
+ * @param pointer to voice activity detector
+ * @param pointer to streaming model of the first model, NULL to run the interpreter
+ * @param pointer to model registry
+ * @param pointer to deadline scheduler stamped by the capture
+ * @param pointer to capture ring filled by the capture
+ */
+void RunLiveInference(KWS_MFCC *kws, Resampler *resampler, VAD *vad, StreamingModel *stream,
+                      ModelRegistry *registry, DeadlineScheduler *scheduler, AudioRing *ring)
+{
+  const int block_samples = BUFFER_SIZE / sizeof(int16_t);
+  const int staging_size = kws->audio_buffer_size + resampler->max_output(RESAMPLE_CHUNK);
+  float *staging = new float[staging_size];
+  int staged = 0;
+  bool completed = true;
+  /* VAD window count of the last report, stale hops do not advance it */
+  uint32_t reported_windows = 0;
+
+  /* one decision filter per detector, all of them share the labels */
+  std::vector<PosteriorFilter> filters;
+  for (int m = 0; m < registry->size(); m++)
+  {
+    filters.push_back(PosteriorFilter(registry->spec(m).num_labels, kLiveThresholds,
+                                      kLivePosteriorConfig));
+  }
+
+  registry->set_cancellation(scheduler, DeadlineScheduler::check_cancelled);
+  RecordPlayback(DEMO_SAI);
+
+  while (1)
+  {
+    int skipped = scheduler->next();
+    if (skipped < 0)
+    {
+      continue;
+    }
+    if (skipped > 0 || !completed)
+    {
+      /* the audio does not follow on from the last hop, restart the stream */
+      kws->reset();
+      if (stream)
+      {
+        stream->reset();
+      }
+      resampler->reset();
+      for (size_t m = 0; m < filters.size(); m++)
+      {
+        filters[m].reset();
+      }
+      staged = 0;
+    }
+
+    /* complete windows older than the newest are dropped unread */
+    uint32_t windows = ring->available() / AUDIO_NUM;
+    if (windows == 0)
+    {
+      continue;
+    }
+    ring->release((windows - 1) * AUDIO_NUM);
+    AudioSpan span;
+    ring->peek(AUDIO_NUM, &span);
+
+    completed = true;
+    uint32_t consumed = 0;
+    for (int part = 0; part < 2; part++)
+    {
+      const uint8_t *data = part ? span.second : span.first;
+      const uint32_t size = part ? span.second_size : span.first_size;
+      for (uint32_t offset = 0; completed && offset < size; offset += BUFFER_SIZE)
+      {
+        const int16_t *pcm = (const int16_t *)(data + offset);
+        for (int i = 0; completed && i < block_samples; i += RESAMPLE_CHUNK)
+        {
+          staged += resampler->process(pcm + i, RESAMPLE_CHUNK, staging + staged, staging_size - staged);
+
+          while (completed && staged >= kws->audio_buffer_size)
+          {
+            /* a newer capture window makes the rest of this one obsolete */
+            completed = !scheduler->stale() && RunInference(kws, vad, stream, staging, registry,
+                                                            filters.data());
+            const uint32_t vad_windows = vad->total_windows();
+            if (vad_windows != reported_windows && vad_windows % VAD_REPORT_WINDOWS == 0)
+            {
+              reported_windows = vad_windows;
+              PrintVadStats(vad);
+              PrintDeadlineStats(scheduler, ring);
+#ifdef PROFILE_OPS
+              opProfiler.report();
+#endif
+            }
+            /* keep the frame overlap for the next hop */
+            staged -= kws->audio_block_size;
+            memmove(staging, staging + kws->audio_block_size, staged * sizeof(float));
+          }
+        }
+        /* the block is resampled, the capture may fill it again */
+        ring->release(1);
+        consumed++;
+      }
+    }
+    /* an abandoned window leaves its remaining blocks unread */
+    ring->release(AUDIO_NUM - consumed);
+    scheduler->finish(completed);
+  }
+}
+#endif
+
+/*!
+ * @brief Initializes device and run KWS application
+ */
+int main(void)
+{
+
+  /* (recording_win x frame_shift) is the actual recording window size. */
+  int recording_win = 249;
+  KWS_MFCC kws_mfcc(recording_win);
+  const std::string labels[] = {"baby_cry", "baby_laugh","silence"};
+
+  /* Init board hardware */
+  BOARD_ConfigMPU();
+  BOARD_InitBootPins();
+  BOARD_InitDEBUG_UART();
+  BOARD_InitSDRAM();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  InitTimer();
+
+  /* Detectors sharing the feature buffer and the tensor arena */
+  ModelRegistry registry;
+  const ModelSpec baby_cry = {"baby_cry", DEMO_MODEL, DEMO_MODEL_LEN, DEMO_MODEL_OPS,
+#ifdef DEMO_MODEL_PLAN
+                              &DEMO_MODEL_PLAN,
+#else
+                              NULL,
+#endif
+#ifdef FP16_WEIGHTS
+                              true,
+#else
+                              false,
+#endif
+                              labels, 3, DETECTION_TRESHOLD};
+  registry.add(baby_cry);
+#if defined(DEMO_FP16_DETECTOR) && !defined(FP16_WEIGHTS)
+  const ModelSpec baby_cry_fp16 = {"baby_cry_fp16", ds_cnn_s_model_fp16, ds_cnn_s_model_fp16_len,
+                                   RegisterModelOps_ds_cnn_s_model_fp16, &ds_cnn_s_model_fp16_plan,
+                                   true, labels, 3, DETECTION_TRESHOLD};
+  registry.add(baby_cry_fp16);
+#endif
+#if defined(DEMO_MODEL_PLAN) && defined(ENABLE_MEMORY_PLAN)
+  LOG(INFO) << "Memory plan: " << DEMO_MODEL_PLAN.arena_size << " + "
+            << DEMO_MODEL_PLAN.boundary_size << " bytes, interpreter planner "
+            << DEMO_MODEL_PLAN.greedy_arena_size << " bytes\r\n";
+#endif
+  int init_start = GetTimeInUS();
+  if (!InferenceInit(&registry, false))
+  {
+    LOG(FATAL) << "\nFailed to load models \r\n";
+    return -1;
+  }
+  int init_us = GetTimeInUS() - init_start;
+  LOG(INFO) << registry.size() << " model(s) loaded in " << init_us << " us\r\n";
+  MemoryTierReport();
+#ifdef PROFILE_OPS
+  ProfilerCyclesInit();
+  registry.interpreter(0)->SetProfiler(&opProfiler);
+#endif
+
+  LOG(INFO) << "Baby Cry Detection example using a TensorFlow Lite model.\r\n" << std::endl;
+  LOG(INFO) << "Detection threshold: " << DETECTION_TRESHOLD << "%\r\n";
+#ifdef DEMO_LIVE_AUDIO
+  LOG(INFO) << "Live posteriors averaged over " << LIVE_AVERAGE_HOPS << " hops, raised after "
+            << LIVE_ATTACK_HOPS << ", cleared after " << LIVE_RELEASE_HOPS << "\r\n";
+#endif
+
+  LOG(INFO) << "\r\nStatic data processing:\r\n" << std::endl;
+
+  /* The samples are unrelated windows, so they bypass the stateful VAD */
+  RunInference(&kws_mfcc, NULL, NULL, (float*)OFF, &registry, NULL);
+  RunInference(&kws_mfcc, NULL, NULL, (float*)RIGHT, &registry, NULL);
+
+  //RunInference(&kws_mfcc, (int16_t*)LEFT, labels, model, interpreter, input_tensor);
+  //RunInference(&kws_mfcc, (int16_t*)ON, labels, model, interpreter, input_tensor);
+
+  //RunInference(&kws_mfcc, (int16_t*)TOP, labels, model, interpreter, input_tensor);
+  RunInference(&kws_mfcc, NULL, NULL, (float*)BOTTOM, &registry, NULL);
+#ifdef PROFILE_OPS
+  opProfiler.report();
+  opProfiler.reset_stats();
+#endif
+
+#ifdef DEMO_BENCHMARK
+  /* Regression baseline of the whole chain on the sample windows */
+  PipelineBenchmark benchmark(&kws_mfcc, &registry, init_us);
+  PipelineLoggingListener benchmark_log;
+  benchmark.add_listener(&benchmark_log);
+  benchmark.add_window((float*)OFF);
+  benchmark.add_window((float*)RIGHT);
+  benchmark.add_window((float*)BOTTOM);
+  ProfilerCyclesInit();
+  LOG(INFO) << "\r\nBenchmark:\r\n" << std::endl;
+  if (benchmark.run())
+  {
+    benchmark.report();
+  }
+#ifdef PROFILE_OPS
+  opProfiler.report();
+  opProfiler.reset_stats();
+#endif
+#endif
+
+#ifdef DEMO_LIVE_AUDIO
+  /* Streaming features over the capture, resampled to the model's rate */
+  KWS_MFCC kws_live(LIVE_HOP_FRAMES, kFrontendConfig44k);
+  Resampler resampler(DEMO_AUDIO_SAMPLE_RATE, kws_live.config.samp_freq);
+  VAD vad_live(kws_live.frame_shift);
+
+  /* Cached per-layer activations, falls back to Invoke for other graphs */
+  StreamingModel stream_model;
+  StreamingModel *stream = NULL;
+  if (stream_model.build(registry.interpreter(0)) && LIVE_HOP_FRAMES % stream_model.alignment() == 0)
+  {
+    stream = &stream_model;
+    LOG(INFO) << "Streaming inference: " << stream_model.macs_full_window() << " MACs per full window\r\n";
+  }
+
+  LOG(INFO) << "\r\nLive audio processing:\r\n" << std::endl;
+  RunLiveInference(&kws_live, &resampler, &vad_live, stream, &registry, &liveWindows,
+                   &captureRing);
+#endif
+  LOG(INFO) << "\r\nThe End\r\n" << std::endl;
+
+}
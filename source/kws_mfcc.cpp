@@ -1,84 +1,197 @@
-/*
- * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
- *
- * SPDX-License-Identifier: Apache-2.0
- *
- * Licensed under the Apache License, Version 2.0 (the License); you may
- * not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- * www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an AS IS BASIS, WITHOUT
- * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-/*
- * Description: Keyword spotting example code using MFCC feature extraction
- * and neural network. 
- */
-#include <iomanip>
-#include <iostream>
-#include <string>
-#include <vector>
-#include "kws_mfcc.h"
-
-
-
-#define LOG(x) std::cout
-
-KWS_MFCC::KWS_MFCC(int record_win)
-{
-  recording_win = record_win;
-  LOG(INFO) << "here.\r\n" << std::endl;
-
-  init_mfcc();
-}
-
-KWS_MFCC::KWS_MFCC(float*  audio_data_buffer)
-{
-  recording_win = NUM_FRAMES;
-  audio_buffer = audio_data_buffer;
-  init_mfcc();
-}
-
-KWS_MFCC::~KWS_MFCC()
-{
-  delete mfcc;
-  delete mfcc_buffer;
-}
-
-void KWS_MFCC::init_mfcc()
-{
-  num_mfcc_features = NUM_MFCC_COEFFS;
-  num_frames = NUM_FRAMES;
-  frame_len = FRAME_LEN;
-  frame_shift = FRAME_SHIFT;
-
-  audio_buffer = 0;
-  mfcc_buffer_size = 0;
-
-  mfcc = new MFCC(num_mfcc_features, frame_len);
-  mfcc_buffer = new float[num_frames * num_mfcc_features];
-  audio_block_size = recording_win * frame_shift;
-  audio_buffer_size = audio_block_size + frame_len - frame_shift;
-}
-
-void KWS_MFCC::extract_features() 
-{
-  if (num_frames > recording_win)
-  {
-    // move old features left
-    memmove(mfcc_buffer, mfcc_buffer + (recording_win * num_mfcc_features), (num_frames - recording_win) * num_mfcc_features);
-  }
-  // compute features only for the newly recorded audio
-  int32_t mfcc_buffer_head = (num_frames - recording_win) * num_mfcc_features; 
-  for (uint16_t f = 0; f < recording_win; f++) 
-  {
-    mfcc->mfcc_compute(audio_buffer + (f * frame_shift), &mfcc_buffer[mfcc_buffer_head]);
-    mfcc_buffer_head += num_mfcc_features;
-  }
-}
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Keyword spotting example code using MFCC feature extraction
+ * and neural network. 
+ */
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "kws_mfcc.h"
+
+
+
+#define LOG(x) std::cout
+
+KWS_MFCC::KWS_MFCC(int record_win, const FrontendConfig &frontend_config)
+  : config(frontend_config)
+{
+  recording_win = record_win;
+  init_mfcc();
+}
+
+KWS_MFCC::KWS_MFCC(float*  audio_data_buffer, const FrontendConfig &frontend_config)
+  : config(frontend_config)
+{
+  recording_win = config.num_frames;
+  init_mfcc();
+  audio_buffer = audio_data_buffer;
+}
+
+KWS_MFCC::~KWS_MFCC()
+{
+  delete mfcc;
+  if (!output_bound)
+    delete [] mfcc_ring;
+  delete [] silence_features;
+}
+
+void KWS_MFCC::init_mfcc()
+{
+  num_mfcc_features = config.num_features();
+  num_frames = config.num_frames;
+  frame_len = config.frame_len();
+  frame_shift = config.frame_shift();
+
+  audio_buffer = 0;
+  if (recording_win <= 0 || recording_win > num_frames)
+    recording_win = num_frames;
+
+  mfcc = new MFCC(config);
+  mfcc_buffer_size = num_frames * num_mfcc_features;
+  output_bound = false;
+  mfcc_ring = new float[ring_size()];
+
+  float *zero_frame = new float[frame_len];
+  memset(zero_frame, 0, sizeof(float) * frame_len);
+  silence_features = new float[num_mfcc_features];
+  mfcc->mfcc_compute(zero_frame, silence_features);
+  delete [] zero_frame;
+
+  reset();
+  audio_block_size = recording_win * frame_shift;
+  audio_buffer_size = audio_block_size + frame_len - frame_shift;
+}
+
+int KWS_MFCC::ring_size() const
+{
+  if (recording_win == num_frames)
+    return mfcc_buffer_size;
+  return 2 * mfcc_buffer_size;
+}
+
+void KWS_MFCC::reset()
+{
+  memset(mfcc_ring, 0, sizeof(float) * ring_size());
+  mfcc_ring_head = 0;
+  mfcc_buffer = mfcc_ring;
+}
+
+/*
+ * Make buffer the feature ring, e.g. the models' shared input buffer. It
+ * has to hold ring_size() floats, twice the window in streaming mode. The
+ * current window is carried over and the owned ring is released. Binding
+ * again after the old buffer was freed (arena reallocation) must pass
+ * keep_window = false, which restarts the window from zeros.
+ */
+bool KWS_MFCC::bind_output(float *buffer, int buffer_size, bool keep_window)
+{
+  if (buffer == 0 || buffer_size < ring_size())
+    return false;
+
+  if (keep_window)
+  {
+    memmove(buffer, mfcc_buffer, sizeof(float) * mfcc_buffer_size);
+    if (ring_size() > mfcc_buffer_size)
+      memcpy(buffer + mfcc_buffer_size, buffer, sizeof(float) * mfcc_buffer_size);
+  }
+  else
+  {
+    memset(buffer, 0, sizeof(float) * ring_size());
+  }
+  if (!output_bound)
+    delete [] mfcc_ring;
+
+  output_bound = true;
+  mfcc_ring = buffer;
+  mfcc_ring_head = 0;
+  mfcc_buffer = mfcc_ring;
+  return true;
+}
+
+/*
+ * Go back to an owned feature ring. The current window is carried over
+ * only with keep_window; pass false when the bound buffer may already have
+ * been freed, which restarts the window from zeros.
+ */
+void KWS_MFCC::unbind_output(bool keep_window)
+{
+  if (!output_bound)
+    return;
+
+  float *bound_window = mfcc_buffer;
+  output_bound = false;
+  mfcc_ring = new float[ring_size()];
+  if (keep_window)
+  {
+    memcpy(mfcc_ring, bound_window, sizeof(float) * mfcc_buffer_size);
+    if (ring_size() > mfcc_buffer_size)
+      memcpy(mfcc_ring + mfcc_buffer_size, mfcc_ring, sizeof(float) * mfcc_buffer_size);
+  }
+  else
+  {
+    memset(mfcc_ring, 0, sizeof(float) * ring_size());
+  }
+  mfcc_ring_head = 0;
+  mfcc_buffer = mfcc_ring;
+}
+
+void KWS_MFCC::extract_features() 
+{
+  // compute features only for the newly recorded audio, in runs of
+  // contiguous ring rows so each run is one batched MFCC call
+  int f = 0;
+  while (f < recording_win)
+  {
+    int run = num_frames - mfcc_ring_head;
+    if (run > recording_win - f)
+      run = recording_win - f;
+
+    float *run_out = &mfcc_ring[mfcc_ring_head * num_mfcc_features];
+    mfcc->mfcc_compute_batch(audio_buffer + (f * frame_shift), run, run_out);
+    if (recording_win < num_frames)
+    {
+      // mirror the frames so the window never wraps
+      memcpy(run_out + mfcc_buffer_size, run_out, sizeof(float) * run * num_mfcc_features);
+    }
+    mfcc_ring_head += run;
+    if (mfcc_ring_head == num_frames)
+      mfcc_ring_head = 0;
+    f += run;
+  }
+  // oldest frame sits at the head
+  mfcc_buffer = &mfcc_ring[mfcc_ring_head * num_mfcc_features];
+}
+
+void KWS_MFCC::skip_features()
+{
+  for (int f = 0; f < recording_win; f++)
+  {
+    float *frame_out = &mfcc_ring[mfcc_ring_head * num_mfcc_features];
+    memcpy(frame_out, silence_features, sizeof(float) * num_mfcc_features);
+    if (recording_win < num_frames)
+    {
+      memcpy(frame_out + mfcc_buffer_size, silence_features, sizeof(float) * num_mfcc_features);
+    }
+    if (++mfcc_ring_head == num_frames)
+      mfcc_ring_head = 0;
+  }
+  mfcc_buffer = &mfcc_ring[mfcc_ring_head * num_mfcc_features];
+}
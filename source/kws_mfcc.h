@@ -1,57 +1,89 @@
-/*
- * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
- *
- * SPDX-License-Identifier: Apache-2.0
- *
- * Licensed under the Apache License, Version 2.0 (the License); you may
- * not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- * www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an AS IS BASIS, WITHOUT
- * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-#ifndef __KWS_MFCC_H__
-#define __KWS_MFCC_H__
-
-#include "mfcc.h"
-
-#define SAMP_FREQ 44100
-#define MFCC_DEC_BITS 1
-#define FRAME_SHIFT_MS 10
-#define FRAME_SHIFT ((int16_t)(SAMP_FREQ * 0.001 * FRAME_SHIFT_MS))
-#define NUM_FRAMES 249
-#define NUM_MFCC_COEFFS 13
-#define MFCC_BUFFER_SIZE (NUM_FRAMES*NUM_MFCC_COEFFS)
-#define FRAME_LEN_MS 25
-#define FRAME_LEN ((int16_t)(SAMP_FREQ * 0.001 * FRAME_LEN_MS))
-
-class KWS_MFCC
-{
-public:  
-  KWS_MFCC(float* audio_data_buffer);
-  KWS_MFCC(int record_win);
-  ~KWS_MFCC();
-  void extract_features();
-  float* audio_buffer;
-  float *mfcc_buffer;
-  int num_frames;
-  int num_mfcc_features;
-  int frame_len;
-  int frame_shift;
-  int audio_block_size;
-  int audio_buffer_size;
-
-protected:
-  void init_mfcc();
-  MFCC *mfcc;
-  int mfcc_buffer_size;
-  int recording_win;
-};
-
-#endif
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KWS_MFCC_H__
+#define __KWS_MFCC_H__
+
+#include "mfcc.h"
+
+/*
+ * Feature extractor for a sliding window of config.num_frames feature frames,
+ * configured by a FrontendConfig (kFrontendConfig44k by default).
+ *
+ * With record_win == num_frames every call recomputes the whole window from
+ * audio_buffer. With record_win < num_frames the extractor runs in streaming
+ * mode: each call only computes the record_win frames covered by the new
+ * audio hop and keeps the older frames in a feature ring buffer. In that mode
+ * audio_buffer must hold audio_buffer_size samples, i.e. the last
+ * (frame_len - frame_shift) samples of the previous hop followed by
+ * audio_block_size new samples.
+ *
+ * skip_features() stands in for extract_features() when the hop was gated as
+ * silence: it advances the window by record_win frames of precomputed silence
+ * features without touching audio_buffer, so streaming timing is preserved.
+ *
+ * bind_output() makes a caller-supplied buffer (the models' input) the
+ * feature ring, so features are written in place instead of being copied out
+ * of mfcc_buffer. In streaming mode that buffer holds the mirrored ring, and
+ * mfcc_buffer moves through it by record_win rows per hop; readers have to
+ * take mfcc_buffer after every call instead of the start of the buffer.
+ */
+class KWS_MFCC
+{
+public:  
+  KWS_MFCC(float* audio_data_buffer,
+           const FrontendConfig &frontend_config = kFrontendConfig44k);
+  KWS_MFCC(int record_win,
+           const FrontendConfig &frontend_config = kFrontendConfig44k);
+  ~KWS_MFCC();
+  void extract_features();
+  void skip_features();
+  void reset();
+  bool bind_output(float *buffer, int buffer_size, bool keep_window = true);
+  void unbind_output(bool keep_window = true);
+  /* Floats of the feature ring, the smallest buffer bind_output() takes */
+  int ring_size() const;
+  bool is_bound() const { return output_bound; }
+  bool is_bound_to(const float *buffer) const { return output_bound && mfcc_ring == buffer; }
+  FrontendConfig config;
+  float* audio_buffer;
+  /* Contiguous view of the latest num_frames frames, oldest first. */
+  float *mfcc_buffer;
+  int num_frames;
+  int num_mfcc_features;
+  int frame_len;
+  int frame_shift;
+  int audio_block_size;
+  int audio_buffer_size;
+
+protected:
+  void init_mfcc();
+  MFCC *mfcc;
+  /* Feature ring; mirrored (2 x num_frames rows) in streaming mode so the
+     window starting at mfcc_ring_head is always contiguous. When bound it
+     is the caller's buffer. */
+  float *mfcc_ring;
+  bool output_bound;
+  int mfcc_ring_head;
+  int mfcc_buffer_size;
+  int recording_win;
+  /* Features of an all-zero frame, stored by skip_features() */
+  float *silence_features;
+};
+
+#endif
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Runs the graph from an arena laid out offline by
+ * tools/memory_plan_gen.cpp instead of the interpreter's ArenaPlanner.
+ */
+
+#include <algorithm>
+#include <iostream>
+
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "memory_plan.h"
+
+#define LOG(x) std::cout
+
+static inline size_t align_up(size_t bytes)
+{
+  return (bytes + MEMORY_PLAN_ALIGNMENT - 1) & ~(size_t)(MEMORY_PLAN_ALIGNMENT - 1);
+}
+
+PlannedArena::PlannedArena(const MemoryPlan &memory_plan, uint8_t *arena_buffer, size_t arena_buffer_size)
+  : plan(memory_plan),
+    arena(arena_buffer),
+    arena_size(arena_buffer_size),
+    scratch(0),
+    scratch_size(0),
+    cancellation_data(0),
+    check_cancelled(0)
+{
+  delegate.data_ = this;
+  delegate.Prepare = delegate_prepare;
+  delegate.CopyFromBufferHandle = 0;
+  delegate.CopyToBufferHandle = 0;
+  delegate.FreeBufferHandle = 0;
+  /* the interpreter keeps the graph resizable, bind() follows each allocation */
+  delegate.flags = kTfLiteDelegateFlagsAllowDynamicTensors;
+}
+
+PlannedArena::~PlannedArena()
+{
+  delete [] scratch;
+}
+
+/* Plan made for this model, and every intermediate tensor placed in it */
+bool PlannedArena::validate(tflite::Interpreter *interpreter, const uint8_t *model_data, size_t model_len)
+{
+  if (plan.model_len != model_len || plan.model_checksum != MemoryPlanChecksum(model_data, model_len))
+  {
+    LOG(INFO) << "Memory plan: made for a different model\r\n";
+    return false;
+  }
+  if (arena_size < (size_t)plan.arena_size || ((uintptr_t)arena % MEMORY_PLAN_ALIGNMENT) != 0)
+  {
+    LOG(INFO) << "Memory plan: arena needs " << plan.arena_size << " aligned bytes\r\n";
+    return false;
+  }
+
+  const std::vector<int> &inputs = interpreter->inputs();
+  const std::vector<int> &outputs = interpreter->outputs();
+  std::vector<bool> planned(interpreter->tensors_size(), false);
+  for (int i = 0; i < plan.num_entries; i++)
+  {
+    const MemoryPlanEntry &e = plan.entries[i];
+    if (e.tensor < 0 || e.tensor >= (int)interpreter->tensors_size() ||
+        interpreter->tensor(e.tensor)->bytes != (size_t)e.bytes ||
+        e.offset % MEMORY_PLAN_ALIGNMENT != 0 || e.offset + e.bytes > plan.arena_size ||
+        std::find(inputs.begin(), inputs.end(), e.tensor) != inputs.end() ||
+        std::find(outputs.begin(), outputs.end(), e.tensor) != outputs.end())
+    {
+      LOG(INFO) << "Memory plan: bad entry for tensor " << e.tensor << "\r\n";
+      return false;
+    }
+    planned[e.tensor] = true;
+  }
+
+  for (int node_index : interpreter->execution_plan())
+  {
+    const TfLiteNode &node = interpreter->node_and_registration(node_index)->first;
+    for (int i = 0; i < node.outputs->size; i++)
+    {
+      int t = node.outputs->data[i];
+      if (!planned[t] && std::find(outputs.begin(), outputs.end(), t) == outputs.end())
+      {
+        LOG(INFO) << "Memory plan: tensor " << t << " is not planned, "
+                  << "was the graph optimized as for the plan?\r\n";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/*
+ * Hands the whole execution plan to the planned arena. Called after
+ * GraphOptimizer::optimize() and before AllocateTensors(); on false the
+ * interpreter plans the arena as usual.
+ */
+bool PlannedArena::apply(tflite::Interpreter *interpreter, const uint8_t *model_data, size_t model_len)
+{
+  if (!validate(interpreter, model_data, model_len))
+    return false;
+
+  nodes = interpreter->execution_plan();
+  if (interpreter->ModifyGraphWithDelegate(&delegate) != kTfLiteOk)
+  {
+    LOG(INFO) << "Memory plan: delegation failed\r\n";
+    return false;
+  }
+  return true;
+}
+
+void PlannedArena::bind_context(TfLiteContext *context)
+{
+  for (int i = 0; i < plan.num_entries; i++)
+    context->tensors[plan.entries[i].tensor].data.raw = (char *)arena + plan.entries[i].offset;
+}
+
+/* Pointers are also set on every invoke, this is for readers before that */
+void PlannedArena::bind(tflite::Interpreter *interpreter)
+{
+  for (int i = 0; i < plan.num_entries; i++)
+    interpreter->tensor(plan.entries[i].tensor)->data.raw = (char *)arena + plan.entries[i].offset;
+}
+
+void PlannedArena::set_cancellation(void *data, bool (*check_cancelled_func)(void *data))
+{
+  cancellation_data = data;
+  check_cancelled = check_cancelled_func;
+}
+
+TfLiteStatus PlannedArena::delegate_prepare(TfLiteContext *context, TfLiteDelegate *delegate)
+{
+  PlannedArena *self = (PlannedArena *)delegate->data_;
+  static const TfLiteRegistration registration = {
+    kernel_init, 0, kernel_prepare, kernel_invoke, 0,
+    kTfLiteBuiltinDelegate, "PlannedArena", 1
+  };
+
+  TfLiteIntArray *replace = TfLiteIntArrayCreate(self->nodes.size());
+  for (size_t i = 0; i < self->nodes.size(); i++)
+    replace->data[i] = self->nodes[i];
+  TfLiteStatus status = context->ReplaceNodeSubsetsWithDelegateKernels(context, registration,
+                                                                       replace, delegate);
+  TfLiteIntArrayFree(replace);
+  return status;
+}
+
+void* PlannedArena::kernel_init(TfLiteContext *, const char *buffer, size_t)
+{
+  const TfLiteDelegateParams *params = (const TfLiteDelegateParams *)buffer;
+  PlannedArena *self = (PlannedArena *)params->delegate->data_;
+  self->nodes.assign(params->nodes_to_replace->data,
+                     params->nodes_to_replace->data + params->nodes_to_replace->size);
+  return self;
+}
+
+/* Prepares the original kernels in order, then sizes the shared scratch */
+TfLiteStatus PlannedArena::kernel_prepare(TfLiteContext *context, TfLiteNode *node)
+{
+  PlannedArena *self = (PlannedArena *)node->user_data;
+  size_t scratch_needed = 0;
+
+  for (int node_index : self->nodes)
+  {
+    TfLiteNode *inner;
+    TfLiteRegistration *reg;
+    TF_LITE_ENSURE_STATUS(context->GetNodeAndRegistration(context, node_index, &inner, &reg));
+    if (reg->prepare)
+      TF_LITE_ENSURE_STATUS(reg->prepare(context, inner));
+
+    /* temporaries only live within their node */
+    size_t node_scratch = 0;
+    for (int i = 0; inner->temporaries && i < inner->temporaries->size; i++)
+      node_scratch += align_up(context->tensors[inner->temporaries->data[i]].bytes);
+    scratch_needed = std::max(scratch_needed, node_scratch);
+  }
+
+  if (scratch_needed > self->scratch_size)
+  {
+    delete [] self->scratch;
+    self->scratch = new uint8_t[scratch_needed + MEMORY_PLAN_ALIGNMENT];
+    self->scratch_size = scratch_needed;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus PlannedArena::kernel_invoke(TfLiteContext *context, TfLiteNode *node)
+{
+  PlannedArena *self = (PlannedArena *)node->user_data;
+  uint8_t *scratch_base = (uint8_t *)align_up((size_t)self->scratch);
+
+  self->bind_context(context);
+  for (int node_index : self->nodes)
+  {
+    /* as the interpreter does before each of its nodes */
+    if (self->check_cancelled && self->check_cancelled(self->cancellation_data))
+      return kTfLiteError;
+
+    TfLiteNode *inner;
+    TfLiteRegistration *reg;
+    TF_LITE_ENSURE_STATUS(context->GetNodeAndRegistration(context, node_index, &inner, &reg));
+
+    size_t offset = 0;
+    for (int i = 0; inner->temporaries && i < inner->temporaries->size; i++)
+    {
+      TfLiteTensor *t = &context->tensors[inner->temporaries->data[i]];
+      t->data.raw = (char *)scratch_base + offset;
+      offset += align_up(t->bytes);
+    }
+    /* the interpreter only profiles this delegate node, report each kernel too */
+    const char *op_name = context->profiler
+        ? tflite::EnumNameBuiltinOperator((tflite::BuiltinOperator)reg->builtin_code) : 0;
+    TFLITE_SCOPED_TAGGED_OPERATOR_PROFILE((tflite::Profiler *)context->profiler, op_name, node_index);
+    TF_LITE_ENSURE_STATUS(reg->invoke(context, inner));
+  }
+  return kTfLiteOk;
+}
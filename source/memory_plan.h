@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MEMORY_PLAN_H__
+#define __MEMORY_PLAN_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "tensorflow/lite/c/c_api_internal.h"
+
+namespace tflite {
+class Interpreter;
+}
+
+/* Offset alignment of planned tensors */
+#define MEMORY_PLAN_ALIGNMENT 16
+
+/* One intermediate tensor at a fixed arena offset */
+typedef struct {
+  int tensor;
+  int offset;
+  int bytes;
+} MemoryPlanEntry;
+
+/*
+ * Offline tensor placement for one model, written by
+ * tools/memory_plan_gen.cpp. It covers the intermediate tensors of the plan
+ * GraphOptimizer produces (aliases share their source's offset); graph
+ * inputs and outputs stay with the interpreter. The model length and
+ * checksum tie the plan to the exact flatbuffer it was made for.
+ */
+typedef struct {
+  uint32_t model_len;
+  uint32_t model_checksum;
+  int arena_size;               // planned intermediates
+  int boundary_size;            // graph inputs and outputs, still in the interpreter arena
+  int greedy_arena_size;        // ArenaPlanner estimate for the graph without the plan
+  const MemoryPlanEntry *entries;
+  int num_entries;
+} MemoryPlan;
+
+/* FNV-1a over the flatbuffer, shared with the generator */
+static inline uint32_t MemoryPlanChecksum(const uint8_t *data, size_t len)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/*
+ * Runs the graph from a caller-owned arena laid out by a MemoryPlan instead
+ * of the interpreter's ArenaPlanner.
+ *
+ * apply() is called after GraphOptimizer::optimize() and before
+ * AllocateTensors(). It checks that the plan matches the model and covers
+ * every intermediate tensor, then hands all nodes to a delegate kernel. The
+ * interpreter is then left with only the graph input and output to plan.
+ * The delegate prepares and invokes the original kernels in order, with
+ * tensor pointers taken from the plan. Per-node temporaries share one
+ * scratch buffer sized at prepare time. bind() has to follow every
+ * AllocateTensors(), like GraphOptimizer::bind_aliases().
+ *
+ * The interpreter sees a single node, so it can only test its
+ * cancellation function before the whole graph; set_cancellation() gives
+ * the delegate the same function to test between the original kernels.
+ */
+class PlannedArena
+{
+  private:
+    const MemoryPlan &plan;
+    uint8_t *arena;
+    size_t arena_size;
+    uint8_t *scratch;
+    size_t scratch_size;
+    std::vector<int> nodes;
+    TfLiteDelegate delegate;
+    void *cancellation_data;
+    bool (*check_cancelled)(void *data);
+
+    bool validate(tflite::Interpreter *interpreter, const uint8_t *model_data, size_t model_len);
+    void bind_context(TfLiteContext *context);
+
+    static TfLiteStatus delegate_prepare(TfLiteContext *context, TfLiteDelegate *delegate);
+    static void* kernel_init(TfLiteContext *context, const char *buffer, size_t length);
+    static TfLiteStatus kernel_prepare(TfLiteContext *context, TfLiteNode *node);
+    static TfLiteStatus kernel_invoke(TfLiteContext *context, TfLiteNode *node);
+
+  public:
+    PlannedArena(const MemoryPlan &memory_plan, uint8_t *arena_buffer, size_t arena_buffer_size);
+    ~PlannedArena();
+    bool apply(tflite::Interpreter *interpreter, const uint8_t *model_data, size_t model_len);
+    void bind(tflite::Interpreter *interpreter);
+    void set_cancellation(void *data, bool (*check_cancelled_func)(void *data));
+    size_t scratch_bytes() const { return scratch_size; }
+};
+
+#endif
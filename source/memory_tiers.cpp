@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Per-tier buffer pools in named linker sections, a layout
+ * report and the access cost model used to rank layouts on the host.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "memory_tiers.h"
+
+#define LOG(x) std::cout
+
+/* Bookkeeping limits */
+#define MEMORY_TIER_MAX_RECORDS 32
+#define MEMORY_TIER_ALIGN 16
+
+const MemoryTierInfo kMemoryTiers[kMemoryTierCount] = {
+  /* name     base         size        read  write */
+  {"ITCM",  0x00000000U, 0x00020000U, 1.0f, 1.0f},
+  {"DTCM",  0x20000000U, 0x00020000U, 1.0f, 1.0f},
+  {"OCRAM", 0x20200000U, 0x000C0000U, 2.5f, 1.5f},
+  {"SDRAM", 0x80000000U, 0x01E00000U, 6.0f, 3.0f},
+  {"FLASH", 0x70000000U, 0x00400000U, 10.0f, 0.0f},
+};
+
+/* Pools are not zeroed at startup, MemoryTierAlloc hands out raw memory */
+#if MEMORY_TIER_POOL_ITCM > 0
+MEMORY_TIER_SECTION(".noinit.$SRAM_ITC")
+static uint8_t pool_itcm[MEMORY_TIER_POOL_ITCM] __attribute__((aligned(MEMORY_TIER_ALIGN)));
+#endif
+#if MEMORY_TIER_POOL_DTCM > 0
+MEMORY_TIER_SECTION(".noinit.$SRAM_DTC")
+static uint8_t pool_dtcm[MEMORY_TIER_POOL_DTCM] __attribute__((aligned(MEMORY_TIER_ALIGN)));
+#endif
+#if MEMORY_TIER_POOL_OCRAM > 0
+MEMORY_TIER_SECTION(".noinit.$SRAM_OC2")
+static uint8_t pool_ocram[MEMORY_TIER_POOL_OCRAM] __attribute__((aligned(MEMORY_TIER_ALIGN)));
+#endif
+#if MEMORY_TIER_POOL_SDRAM > 0
+MEMORY_TIER_SECTION(".noinit.$BOARD_SDRAM")
+static uint8_t pool_sdram[MEMORY_TIER_POOL_SDRAM] __attribute__((aligned(MEMORY_TIER_ALIGN)));
+#endif
+
+/* Block header, blocks tile the pool back to back */
+typedef struct {
+  uint32_t size;                // including the header
+  uint32_t used;
+  uint32_t pad[2];
+} PoolBlock;
+
+typedef struct {
+  uint8_t *base;
+  uint32_t size;
+  bool ready;
+  uint32_t used;
+  uint32_t peak;
+} Pool;
+
+static Pool pools[kMemoryTierCount] = {
+#if MEMORY_TIER_POOL_ITCM > 0
+  {pool_itcm, MEMORY_TIER_POOL_ITCM, false, 0, 0},
+#else
+  {0, 0, false, 0, 0},
+#endif
+#if MEMORY_TIER_POOL_DTCM > 0
+  {pool_dtcm, MEMORY_TIER_POOL_DTCM, false, 0, 0},
+#else
+  {0, 0, false, 0, 0},
+#endif
+#if MEMORY_TIER_POOL_OCRAM > 0
+  {pool_ocram, MEMORY_TIER_POOL_OCRAM, false, 0, 0},
+#else
+  {0, 0, false, 0, 0},
+#endif
+#if MEMORY_TIER_POOL_SDRAM > 0
+  {pool_sdram, MEMORY_TIER_POOL_SDRAM, false, 0, 0},
+#else
+  {0, 0, false, 0, 0},
+#endif
+  {0, 0, false, 0, 0},
+};
+
+typedef struct {
+  const char *name;
+  const void *ptr;
+  size_t bytes;
+  MemoryTier requested;
+  bool heap;
+} PlacementRecord;
+
+static PlacementRecord records[MEMORY_TIER_MAX_RECORDS];
+static int num_records = 0;
+
+static inline uint32_t align_up(size_t bytes)
+{
+  return (uint32_t)((bytes + MEMORY_TIER_ALIGN - 1) & ~(size_t)(MEMORY_TIER_ALIGN - 1));
+}
+
+static int pool_of(const void *ptr)
+{
+  for (int t = 0; t < kMemoryTierCount; t++)
+    if (pools[t].base && (const uint8_t *)ptr >= pools[t].base &&
+        (const uint8_t *)ptr < pools[t].base + pools[t].size)
+      return t;
+  return -1;
+}
+
+/* First fit, the block is split when the rest can hold another one */
+static void* pool_alloc(Pool &pool, size_t bytes)
+{
+  if (!pool.base)
+    return 0;
+  if (!pool.ready) {
+    PoolBlock *first = (PoolBlock *)pool.base;
+    first->size = pool.size & ~(uint32_t)(MEMORY_TIER_ALIGN - 1);
+    first->used = 0;
+    pool.ready = true;
+  }
+
+  uint32_t need = align_up(bytes) + sizeof(PoolBlock);
+  for (uint32_t offset = 0; offset < pool.size; ) {
+    PoolBlock *block = (PoolBlock *)(pool.base + offset);
+    if (!block->used && block->size >= need) {
+      if (block->size - need >= 2 * sizeof(PoolBlock)) {
+        PoolBlock *rest = (PoolBlock *)(pool.base + offset + need);
+        rest->size = block->size - need;
+        rest->used = 0;
+        block->size = need;
+      }
+      block->used = 1;
+      pool.used += block->size;
+      if (pool.used > pool.peak)
+        pool.peak = pool.used;
+      return block + 1;
+    }
+    offset += block->size;
+  }
+  return 0;
+}
+
+static void pool_free(Pool &pool, void *ptr)
+{
+  PoolBlock *block = (PoolBlock *)ptr - 1;
+  block->used = 0;
+  pool.used -= block->size;
+
+  /* merge runs of free blocks */
+  for (uint32_t offset = 0; offset < pool.size; ) {
+    PoolBlock *b = (PoolBlock *)(pool.base + offset);
+    while (!b->used && offset + b->size < pool.size) {
+      PoolBlock *next = (PoolBlock *)(pool.base + offset + b->size);
+      if (next->used)
+        break;
+      b->size += next->size;
+    }
+    offset += b->size;
+  }
+}
+
+static void add_record(const void *ptr, size_t bytes, MemoryTier requested, const char *name, bool heap)
+{
+  if (num_records == MEMORY_TIER_MAX_RECORDS)
+    return;
+  PlacementRecord r = {name, ptr, bytes, requested, heap};
+  records[num_records++] = r;
+}
+
+void* MemoryTierAlloc(MemoryTier tier, size_t bytes, const char *name)
+{
+  void *ptr = (tier < kMemoryTierCount) ? pool_alloc(pools[tier], bytes) : 0;
+  bool heap = (ptr == 0);
+  if (heap) {
+    if (tier != kMemoryTierFLASH && pools[tier].base)
+      LOG(INFO) << "Memory tiers: " << kMemoryTiers[tier].name << " pool full, "
+                << name << " goes to the heap\r\n";
+    ptr = new uint8_t[bytes];
+  }
+  add_record(ptr, bytes, tier, name, heap);
+  return ptr;
+}
+
+void MemoryTierFree(void *ptr)
+{
+  if (!ptr)
+    return;
+  for (int i = 0; i < num_records; i++) {
+    if (records[i].ptr == ptr) {
+      records[i] = records[--num_records];
+      break;
+    }
+  }
+  int t = pool_of(ptr);
+  if (t >= 0)
+    pool_free(pools[t], ptr);
+  else
+    delete [] (uint8_t *)ptr;
+}
+
+void MemoryTierRecord(const void *ptr, size_t bytes, MemoryTier requested, const char *name)
+{
+  add_record(ptr, bytes, requested, name, false);
+}
+
+MemoryTier MemoryTierOf(const void *ptr)
+{
+  int t = pool_of(ptr);
+  if (t >= 0)
+    return (MemoryTier)t;
+#if defined(__arm__)
+  uint32_t address = (uint32_t)(uintptr_t)ptr;
+  for (int i = 0; i < kMemoryTierCount; i++)
+    if (address >= kMemoryTiers[i].base && address - kMemoryTiers[i].base < kMemoryTiers[i].size)
+      return (MemoryTier)i;
+#endif
+  return kMemoryTierCount;
+}
+
+float MemoryTierCycles(MemoryTier tier, size_t bytes_read, size_t bytes_written)
+{
+  const MemoryTierInfo &info = kMemoryTiers[tier];
+  return (bytes_read / 4) * info.read_cycles + (bytes_written / 4) * info.write_cycles;
+}
+
+size_t MemoryTierPeak(MemoryTier tier)
+{
+  return (tier < kMemoryTierCount) ? pools[tier].peak : 0;
+}
+
+void MemoryTierReport(void)
+{
+  LOG(INFO) << "Memory layout:\r\n";
+  for (int i = 0; i < num_records; i++) {
+    const PlacementRecord &r = records[i];
+    MemoryTier actual = MemoryTierOf(r.ptr);
+    LOG(INFO) << "  " << std::left << std::setw(20) << r.name << std::right
+              << std::setw(8) << r.bytes << " B  0x" << std::hex << std::setw(8)
+              << std::setfill('0') << (uint32_t)(uintptr_t)r.ptr << std::dec << std::setfill(' ')
+              << "  " << (actual < kMemoryTierCount ? kMemoryTiers[actual].name : "heap")
+              << (r.heap && actual < kMemoryTierCount ? " (heap)" : "")
+              << (actual != r.requested ? ", wanted " : "")
+              << (actual != r.requested ? kMemoryTiers[r.requested].name : "") << "\r\n";
+  }
+  for (int t = 0; t < kMemoryTierCount; t++) {
+    if (pools[t].base)
+      LOG(INFO) << "  " << kMemoryTiers[t].name << " pool: " << pools[t].peak << " of "
+                << pools[t].size << " B peak\r\n";
+  }
+}
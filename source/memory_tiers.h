@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MEMORY_TIERS_H__
+#define __MEMORY_TIERS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Memory tiers of the i.MX RT1064 as mapped by BOARD_ConfigMPU. Buffers
+ * are pinned to a tier by allocating them from that tier's pool, a static
+ * block placed in the tier's linker section. A pool that is full or has
+ * size 0 falls back to the heap, and the report shows where each buffer
+ * really landed.
+ */
+typedef enum {
+  kMemoryTierITCM,
+  kMemoryTierDTCM,
+  kMemoryTierOCRAM,
+  kMemoryTierSDRAM,
+  kMemoryTierFLASH,             // XIP, read only, nothing is allocated here
+  kMemoryTierCount
+} MemoryTier;
+
+typedef struct {
+  const char *name;
+  uint32_t base;
+  uint32_t size;
+  /* Modeled core cycles per 32-bit access, streaming through the L1
+     caches at 600 MHz. Coarse, meant for ranking layouts on the host. */
+  float read_cycles;
+  float write_cycles;
+} MemoryTierInfo;
+
+extern const MemoryTierInfo kMemoryTiers[kMemoryTierCount];
+
+/* Pool sizes in bytes, 0 disables a tier */
+#ifndef MEMORY_TIER_POOL_ITCM
+#define MEMORY_TIER_POOL_ITCM 0
+#endif
+#ifndef MEMORY_TIER_POOL_DTCM
+#define MEMORY_TIER_POOL_DTCM (64 * 1024)
+#endif
+#ifndef MEMORY_TIER_POOL_OCRAM
+#define MEMORY_TIER_POOL_OCRAM (128 * 1024)
+#endif
+#ifndef MEMORY_TIER_POOL_SDRAM
+#define MEMORY_TIER_POOL_SDRAM (256 * 1024)
+#endif
+
+/* Placement of the application's buffers, override with -D */
+#ifndef TENSOR_ARENA_TIER
+#define TENSOR_ARENA_TIER kMemoryTierDTCM
+#endif
+#ifndef MFCC_SCRATCH_TIER
+#define MFCC_SCRATCH_TIER kMemoryTierDTCM
+#endif
+/* repacked conv weights and other per-inference hot copies */
+#ifndef HOT_WEIGHTS_TIER
+#define HOT_WEIGHTS_TIER kMemoryTierDTCM
+#endif
+/* the flatbuffer itself, copied out of flash unless FLASH */
+#ifndef MODEL_DATA_TIER
+#define MODEL_DATA_TIER kMemoryTierFLASH
+#endif
+
+/* MCUXpresso managed linker script sections of each RAM tier */
+#if defined(__arm__) && defined(__GNUC__)
+#define MEMORY_TIER_SECTION(section) __attribute__((section(section)))
+#else
+#define MEMORY_TIER_SECTION(section)
+#endif
+
+void* MemoryTierAlloc(MemoryTier tier, size_t bytes, const char *name);
+void MemoryTierFree(void *ptr);
+/* Records a buffer placed elsewhere (heap, flash) for the report */
+void MemoryTierRecord(const void *ptr, size_t bytes, MemoryTier requested, const char *name);
+/* Tier holding an address; on the host, the tier its pool stands for */
+MemoryTier MemoryTierOf(const void *ptr);
+/* Modeled cycles for the given traffic */
+float MemoryTierCycles(MemoryTier tier, size_t bytes_read, size_t bytes_written);
+/* Most bytes of the tier's pool in use at once */
+size_t MemoryTierPeak(MemoryTier tier);
+void MemoryTierReport(void);
+
+#endif
@@ -1,204 +1,342 @@
-/*
- * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
- *
- * SPDX-License-Identifier: Apache-2.0
- *
- * Licensed under the Apache License, Version 2.0 (the License); you may
- * not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- * www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an AS IS BASIS, WITHOUT
- * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-/*
- * Description: MFCC feature extraction to match with TensorFlow MFCC Op
- */
-
-#include <string.h>
-
-#include "mfcc.h"
-#include "float.h"
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-MFCC::MFCC(int num_mfcc_features, int frame_len)
-  : num_mfcc_features(num_mfcc_features), 
-    frame_len(frame_len)
-{
-  // Round-up to nearest power of 2.
-  frame_len_padded = pow(2, ceil((log(frame_len) / log(2))));
-
-  frame = new float[frame_len_padded];
-  buffer = new float[frame_len_padded];
-  mel_energies = new float[NUM_FBANK_BINS];
-
-  // create window function
-  window_func = new float[frame_len];
-  for (int i = 0; i < frame_len; i++)
-    window_func[i] = 0.5 - 0.5 * cos(M_2PI * ((float)i) / (frame_len));
-
-  // create mel filterbank
-  fbank_filter_first = new int32_t[NUM_FBANK_BINS];
-  fbank_filter_last = new int32_t[NUM_FBANK_BINS];
-  mel_fbank = create_mel_fbank();
-  
-  // create DCT matrix
-  dct_matrix = create_dct_matrix(NUM_FBANK_BINS, num_mfcc_features);
-
-  // initialize FFT
-  rfft = new arm_rfft_fast_instance_f32;
-  arm_rfft_fast_init_f32(rfft, frame_len_padded);
-}
-
-MFCC::~MFCC()
-{
-  delete [] frame;
-  delete [] buffer;
-  delete [] mel_energies;
-  delete [] window_func;
-  delete [] fbank_filter_first;
-  delete [] fbank_filter_last;
-  delete [] dct_matrix;
-  delete rfft;
-  for (int i = 0; i < NUM_FBANK_BINS; i++)
-    delete mel_fbank[i];
-  delete mel_fbank;
-}
-
-float * MFCC::create_dct_matrix(int32_t input_length, int32_t coefficient_count)
-{
-  int32_t k, n;
-  float* M = new float[input_length * coefficient_count];
-  float normalizer;
-  arm_sqrt_f32(2.0 / (float)input_length, &normalizer);
-  for (k = 0; k < coefficient_count; k++) {
-    for (n = 0; n < input_length; n++) {
-      M[k * input_length + n] = normalizer * cos(((double)M_PI) / input_length * (n + 0.5) * k);
-    }
-  }
-  return M;
-}
-
-float ** MFCC::create_mel_fbank()
-{
-  int32_t bin, i;
-
-  int32_t num_fft_bins = frame_len_padded / 2;
-  float fft_bin_width = ((float)SAMP_FREQ) / frame_len_padded;
-  float mel_low_freq = MelScale(MEL_LOW_FREQ);
-  float mel_high_freq = MelScale(MEL_HIGH_FREQ); 
-  float mel_freq_delta = (mel_high_freq - mel_low_freq) / (NUM_FBANK_BINS + 1);
-
-  float *this_bin = new float[num_fft_bins];
-
-  float ** mel_fbank =  new float*[NUM_FBANK_BINS];
-
-  for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
-    float left_mel = mel_low_freq + bin * mel_freq_delta;
-    float center_mel = mel_low_freq + (bin + 1) * mel_freq_delta;
-    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
-
-    int32_t first_index = -1, last_index = -1;
-
-    for (i = 0; i < num_fft_bins; i++) {
-      float freq = (fft_bin_width * i);  // center freq of this fft bin.
-      float mel = MelScale(freq);
-      this_bin[i] = 0.0;
-
-      if (mel > left_mel && mel < right_mel) {
-        float weight;
-        if (mel <= center_mel) {
-          weight = (mel - left_mel) / (center_mel - left_mel);
-        } else {
-          weight = (right_mel-mel) / (right_mel-center_mel);
-        }
-        this_bin[i] = weight;
-        if (first_index == -1)
-          first_index = i;
-        last_index = i;
-      }
-    }
-
-    fbank_filter_first[bin] = first_index;
-    fbank_filter_last[bin] = last_index;
-    mel_fbank[bin] = new float[last_index-first_index+1]; 
-
-    int32_t j = 0;
-    // copy the part we care about
-    for (i = first_index; i <= last_index; i++) {
-      mel_fbank[bin][j++] = this_bin[i];
-    }
-  }
-  delete []this_bin;
-  return mel_fbank;
-}
-
-void MFCC::mfcc_compute(const float * audio_data, float* mfcc_out)
-{
-  int32_t i, j, bin;
-
-  // TensorFlow way of normalizing .wav data to (-1, 1)
-  for (i = 0; i < frame_len; i++) {
-    frame[i] = (float)(audio_data[i]) * 1.0 / (1 << 15); 
-  }
-  // Fill up remaining with zeros
-  memset(&frame[frame_len], 0, sizeof(float) * (frame_len_padded-frame_len));
-
-  for (i = 0; i < frame_len; i++) {
-    frame[i] *= window_func[i];
-  }
-
-  // Compute FFT
-  arm_rfft_fast_f32(rfft, frame, buffer, 0);
-
-  // Convert to power spectrum
-  // frame is stored as [real0, realN/2-1, real1, im1, real2, im2, ...]
-  int32_t half_dim = frame_len_padded / 2;
-  float first_energy = buffer[0] * buffer[0],
-        last_energy =  buffer[1] * buffer[1];  // handle this special case
-  for (i = 1; i < half_dim; i++) {
-    float real = buffer[i * 2], im = buffer[i * 2 + 1];
-    buffer[i] = real * real + im * im;
-  }
-  buffer[0] = first_energy;
-  buffer[half_dim] = last_energy;
-
-  float sqrt_data;
-  // Apply mel filterbanks
-  for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
-    j = 0;
-    float mel_energy = 0;
-    int32_t first_index = fbank_filter_first[bin];
-    int32_t last_index = fbank_filter_last[bin];
-    for (i = first_index; i <= last_index; i++) {
-      arm_sqrt_f32(buffer[i], &sqrt_data);
-      mel_energy += (sqrt_data) * mel_fbank[bin][j++];
-    }
-    mel_energies[bin] = mel_energy;
-
-    // avoid log of zero
-    if (mel_energy == 0.0)
-      mel_energies[bin] = FLT_MIN;
-  }
-
-  //Take log
-  for (bin = 0; bin < NUM_FBANK_BINS; bin++)
-    mel_energies[bin] = logf(mel_energies[bin]);
-
-  //Take DCT. Uses matrix mul.
-  for (i = 0; i < num_mfcc_features; i++) {
-    float sum = 0.0;
-    for (j = 0; j < NUM_FBANK_BINS; j++) {
-      sum += dct_matrix[i*NUM_FBANK_BINS+j] * mel_energies[j];
-    }
-    mfcc_out[i] = sum;
-  }
-}
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: MFCC feature extraction to match with TensorFlow MFCC Op
+ */
+
+#include <string.h>
+
+#include "mfcc.h"
+#include "memory_tiers.h"
+#include "float.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*
+ * Natural log of a block, with the signature of arm_vlog_f32. The CMSIS-DSP
+ * in this tree (V1.6.0) predates arm_vlog_f32, and on cores without Helium
+ * that function is this same logf loop, so it lives here until the library
+ * is updated.
+ */
+static inline void mfcc_vlog_f32(const float * src, float * dst, uint32_t block_size)
+{
+  for (uint32_t i = 0; i < block_size; i++)
+    dst[i] = logf(src[i]);
+}
+
+MFCC::MFCC(const FrontendConfig &config)
+  : samp_freq(config.samp_freq),
+    num_fbank_bins(config.num_fbank_bins),
+    low_freq(config.mel_low_freq),
+    high_freq(config.mel_high_freq),
+    log_mel_output(config.output == FRONTEND_OUTPUT_LOG_MEL),
+    num_mfcc_features(config.num_mfcc_coeffs), 
+    frame_len(config.frame_len()),
+    frame_shift(config.frame_shift())
+{
+  // Round-up to nearest power of 2.
+  frame_len_padded = pow(2, ceil((log(frame_len) / log(2))));
+
+  // per-frame working set, see MFCC_SCRATCH_TIER
+  frame = (float *)MemoryTierAlloc(MFCC_SCRATCH_TIER, frame_len_padded * sizeof(float), "mfcc frame");
+  buffer = (float *)MemoryTierAlloc(MFCC_SCRATCH_TIER, frame_len_padded * sizeof(float), "mfcc fft");
+  mel_energies = (float *)MemoryTierAlloc(MFCC_SCRATCH_TIER, num_fbank_bins * sizeof(float), "mfcc mel");
+
+  const MFCC_Tables *tables = 0;
+#ifndef MFCC_RUNTIME_TABLES
+  tables = MFCC_FindTables(config);
+#endif
+  own_tables = (tables == 0);
+
+  if (tables) {
+    window_func = tables->window_func;
+    fbank_filter_first = tables->fbank_filter_first;
+    fbank_weight_offset = tables->fbank_weight_offset;
+    mel_fbank = tables->mel_fbank;
+    dct_matrix = tables->dct_matrix;
+  } else {
+    // create window function
+    float * window = new float[frame_len];
+    for (int i = 0; i < frame_len; i++)
+      window[i] = 0.5 - 0.5 * cos(M_2PI * ((float)i) / (frame_len));
+    window_func = window;
+
+    // create mel filterbank
+    int32_t * filter_first = new int32_t[num_fbank_bins];
+    int32_t * weight_offset = new int32_t[num_fbank_bins + 1];
+    mel_fbank = create_mel_fbank(filter_first, weight_offset);
+    fbank_filter_first = filter_first;
+    fbank_weight_offset = weight_offset;
+
+    // create DCT matrix
+    if (log_mel_output)
+      dct_matrix = 0;
+    else
+      dct_matrix = create_dct_matrix(num_fbank_bins, num_mfcc_features);
+  }
+
+  // scratch and transposed DCT matrix for batched frames
+  mel_batch = (float *)MemoryTierAlloc(MFCC_SCRATCH_TIER,
+                                       MFCC_BATCH_FRAMES * num_fbank_bins * sizeof(float), "mfcc batch");
+  dct_matrix_t = 0;
+  if (!log_mel_output) {
+    dct_matrix_t = (float *)MemoryTierAlloc(MFCC_SCRATCH_TIER,
+                                            num_fbank_bins * num_mfcc_features * sizeof(float), "mfcc dct");
+    for (int k = 0; k < num_mfcc_features; k++)
+      for (int n = 0; n < num_fbank_bins; n++)
+        dct_matrix_t[n * num_mfcc_features + k] = dct_matrix[k * num_fbank_bins + n];
+  }
+
+  // initialize FFT
+  rfft = new arm_rfft_fast_instance_f32;
+  arm_rfft_fast_init_f32(rfft, frame_len_padded);
+}
+
+MFCC::~MFCC()
+{
+  MemoryTierFree(frame);
+  MemoryTierFree(buffer);
+  MemoryTierFree(mel_energies);
+  MemoryTierFree(mel_batch);
+  MemoryTierFree(dct_matrix_t);
+  if (own_tables) {
+    delete [] window_func;
+    delete [] fbank_filter_first;
+    delete [] fbank_weight_offset;
+    delete [] mel_fbank;
+    delete [] dct_matrix;
+  }
+  delete rfft;
+}
+
+#ifndef MFCC_RUNTIME_TABLES
+const MFCC_Tables * MFCC_FindTables(const FrontendConfig &config)
+{
+  for (int i = 0; i < mfcc_const_tables_count; i++) {
+    const MFCC_Tables *t = mfcc_const_tables[i];
+    if (t->samp_freq == config.samp_freq &&
+        t->frame_len == config.frame_len() &&
+        t->num_fbank_bins == config.num_fbank_bins &&
+        t->num_mfcc_features == config.num_mfcc_coeffs &&
+        t->mel_low_freq == config.mel_low_freq &&
+        t->mel_high_freq == config.mel_high_freq)
+      return t;
+  }
+  return 0;
+}
+#endif
+
+/* Exposes the tables in use, e.g. for tools/mfcc_tables_gen.cpp. */
+void MFCC::get_tables(MFCC_Tables * tables) const
+{
+  tables->samp_freq = samp_freq;
+  tables->frame_len = frame_len;
+  tables->num_fbank_bins = num_fbank_bins;
+  tables->num_mfcc_features = num_mfcc_features;
+  tables->mel_low_freq = low_freq;
+  tables->mel_high_freq = high_freq;
+  tables->fbank_filter_first = fbank_filter_first;
+  tables->fbank_weight_offset = fbank_weight_offset;
+  tables->window_func = window_func;
+  tables->mel_fbank = mel_fbank;
+  tables->dct_matrix = dct_matrix;
+}
+
+float * MFCC::create_dct_matrix(int32_t input_length, int32_t coefficient_count)
+{
+  int32_t k, n;
+  float* M = new float[input_length * coefficient_count];
+  float normalizer;
+  arm_sqrt_f32(2.0 / (float)input_length, &normalizer);
+  for (k = 0; k < coefficient_count; k++) {
+    for (n = 0; n < input_length; n++) {
+      M[k * input_length + n] = normalizer * cos(((double)M_PI) / input_length * (n + 0.5) * k);
+    }
+  }
+  return M;
+}
+
+float * MFCC::create_mel_fbank(int32_t * filter_first, int32_t * weight_offset)
+{
+  int32_t bin, i, j;
+
+  int32_t num_fft_bins = frame_len_padded / 2;
+  float fft_bin_width = ((float)samp_freq) / frame_len_padded;
+  float mel_low_freq = MelScale(low_freq);
+  float mel_high_freq = MelScale(high_freq); 
+  float mel_freq_delta = (mel_high_freq - mel_low_freq) / (num_fbank_bins + 1);
+
+  // first pass: find the span of FFT bins each filter covers
+  int32_t num_weights = 0;
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float left_mel = mel_low_freq + bin * mel_freq_delta;
+    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
+
+    int32_t first_index = -1, last_index = -1;
+
+    for (i = 0; i < num_fft_bins; i++) {
+      float freq = (fft_bin_width * i);  // center freq of this fft bin.
+      float mel = MelScale(freq);
+      if (mel > left_mel && mel < right_mel) {
+        if (first_index == -1)
+          first_index = i;
+        last_index = i;
+      }
+    }
+
+    if (first_index == -1) {
+      // filter narrower than one FFT bin, contributes nothing
+      first_index = 0;
+      last_index = -1;
+    }
+    filter_first[bin] = first_index;
+    weight_offset[bin] = num_weights;
+    num_weights += last_index - first_index + 1;
+  }
+  weight_offset[num_fbank_bins] = num_weights;
+
+  // second pass: store all weights back to back
+  float * mel_fbank = new float[num_weights];
+
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float left_mel = mel_low_freq + bin * mel_freq_delta;
+    float center_mel = mel_low_freq + (bin + 1) * mel_freq_delta;
+    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
+
+    i = filter_first[bin];
+    for (j = weight_offset[bin]; j < weight_offset[bin + 1]; j++, i++) {
+      float freq = (fft_bin_width * i);
+      float mel = MelScale(freq);
+      float weight;
+      if (mel <= center_mel) {
+        weight = (mel - left_mel) / (center_mel - left_mel);
+      } else {
+        weight = (right_mel-mel) / (right_mel-center_mel);
+      }
+      mel_fbank[j] = weight;
+    }
+  }
+  return mel_fbank;
+}
+
+/* Window, FFT and mel filterbank for one frame, before the log */
+void MFCC::compute_mel_energies(const float * audio_data, float* mel_out)
+{
+  int32_t i, bin;
+
+  // TensorFlow way of normalizing .wav data to (-1, 1)
+  for (i = 0; i < frame_len; i++) {
+    frame[i] = (float)(audio_data[i]) * 1.0 / (1 << 15); 
+  }
+  // Fill up remaining with zeros
+  memset(&frame[frame_len], 0, sizeof(float) * (frame_len_padded-frame_len));
+
+  for (i = 0; i < frame_len; i++) {
+    frame[i] *= window_func[i];
+  }
+
+  // Compute FFT
+  arm_rfft_fast_f32(rfft, frame, buffer, 0);
+
+  // Convert to magnitude spectrum, one sqrt per FFT bin
+  // frame is stored as [real0, realN/2-1, real1, im1, real2, im2, ...]
+  int32_t half_dim = frame_len_padded / 2;
+  float first_mag = fabsf(buffer[0]),
+        last_mag = fabsf(buffer[1]);  // handle this special case
+  // in place is safe, output index i+1 never passes input index 2*(i+1)
+  arm_cmplx_mag_f32(&buffer[2], &buffer[1], half_dim - 1);
+  buffer[0] = first_mag;
+  buffer[half_dim] = last_mag;
+
+  // Apply mel filterbanks
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float mel_energy = 0;
+    int32_t offset = fbank_weight_offset[bin];
+    int32_t num_weights = fbank_weight_offset[bin + 1] - offset;
+    if (num_weights > 0)
+      arm_dot_prod_f32(&buffer[fbank_filter_first[bin]], &mel_fbank[offset], num_weights, &mel_energy);
+    mel_out[bin] = mel_energy;
+
+    // avoid log of zero
+    if (mel_energy == 0.0)
+      mel_out[bin] = FLT_MIN;
+  }
+}
+
+void MFCC::mfcc_compute(const float * audio_data, float* mfcc_out)
+{
+  int32_t i, j;
+
+  compute_mel_energies(audio_data, mel_energies);
+
+  //Take log
+  if (log_mel_output) {
+    mfcc_vlog_f32(mel_energies, mfcc_out, num_fbank_bins);
+    return;
+  }
+  mfcc_vlog_f32(mel_energies, mel_energies, num_fbank_bins);
+
+  //Take DCT. Uses matrix mul.
+  for (i = 0; i < num_mfcc_features; i++) {
+    float sum = 0.0;
+    for (j = 0; j < num_fbank_bins; j++) {
+      sum += dct_matrix[i*num_fbank_bins+j] * mel_energies[j];
+    }
+    mfcc_out[i] = sum;
+  }
+}
+
+/*
+ * Same features as mfcc_compute for n_frames frames spaced frame_shift
+ * samples apart, written as consecutive rows of mfcc_out. Mel energies of up
+ * to MFCC_BATCH_FRAMES frames are gathered into a matrix, the log runs over
+ * the whole block and the DCT is a single arm_mat_mult_f32.
+ */
+void MFCC::mfcc_compute_batch(const float * audio_data, int n_frames, float* mfcc_out)
+{
+  int32_t num_out = log_mel_output ? num_fbank_bins : num_mfcc_features;
+
+  while (n_frames > 0) {
+    int32_t batch = (n_frames < MFCC_BATCH_FRAMES) ? n_frames : MFCC_BATCH_FRAMES;
+    int32_t batch_bins = batch * num_fbank_bins;
+    // in log-mel mode the energies go straight to the output rows
+    float * mel = log_mel_output ? mfcc_out : mel_batch;
+
+    for (int32_t f = 0; f < batch; f++)
+      compute_mel_energies(audio_data + f * frame_shift, &mel[f * num_fbank_bins]);
+
+    //Take log of the whole block
+    mfcc_vlog_f32(mel, mel, batch_bins);
+
+    //Take DCT, (batch x bins) * (bins x coeffs)
+    if (!log_mel_output) {
+      arm_matrix_instance_f32 mel_mat, dct_mat, out_mat;
+      arm_mat_init_f32(&mel_mat, batch, num_fbank_bins, mel_batch);
+      arm_mat_init_f32(&dct_mat, num_fbank_bins, num_mfcc_features, dct_matrix_t);
+      arm_mat_init_f32(&out_mat, batch, num_mfcc_features, mfcc_out);
+      arm_mat_mult_f32(&mel_mat, &dct_mat, &out_mat);
+    }
+
+    audio_data += batch * frame_shift;
+    mfcc_out += batch * num_out;
+    n_frames -= batch;
+  }
+}
@@ -1,68 +1,88 @@
-/*
- * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
- *
- * SPDX-License-Identifier: Apache-2.0
- *
- * Licensed under the Apache License, Version 2.0 (the License); you may
- * not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- * www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an AS IS BASIS, WITHOUT
- * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-#ifndef __MFCC_H__
-#define __MFCC_H__
-
-extern "C" {
-  #include "arm_math.h"
-}
-
-
-#include "string.h"
-
-#define SAMP_FREQ 44100
-#define NUM_FBANK_BINS 40
-#define MEL_LOW_FREQ 20
-#define MEL_HIGH_FREQ 4000
-
-#define M_2PI 6.283185307179586476925286766559005
-
-class MFCC
-{
-  private:
-    int num_mfcc_features;
-    int frame_len;
-    int frame_len_padded;
-    float * frame;
-    float * buffer;
-    float * mel_energies;
-    float * window_func;
-    int32_t * fbank_filter_first;
-    int32_t * fbank_filter_last;
-    float ** mel_fbank;
-    float * dct_matrix;
-    arm_rfft_fast_instance_f32 * rfft;
-    float * create_dct_matrix(int32_t input_length, int32_t coefficient_count); 
-    float ** create_mel_fbank();
- 
-    static inline float InverseMelScale(float mel_freq) {
-      return 700.0f * (expf (mel_freq / 1127.0f) - 1.0f);
-    }
-
-    static inline float MelScale(float freq) {
-      return 1127.0f * logf (1.0f + freq / 700.0f);
-    }
-
-  public:
-    MFCC(int num_mfcc_features, int frame_len);
-    ~MFCC();
-    void mfcc_compute(const float* data, float* mfcc_out);
-};
-
-#endif
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MFCC_H__
+#define __MFCC_H__
+
+extern "C" {
+  #include "arm_math.h"
+}
+
+
+#include "string.h"
+#include "frontend_config.h"
+#include "mfcc_tables.h"
+
+#define M_2PI 6.283185307179586476925286766559005
+
+/* Frames per log + DCT matrix multiply in mfcc_compute_batch */
+#define MFCC_BATCH_FRAMES 16
+
+class MFCC
+{
+  private:
+    int samp_freq;
+    int num_fbank_bins;
+    int low_freq;
+    int high_freq;
+    bool log_mel_output;
+    int num_mfcc_features;
+    int frame_len;
+    int frame_shift;
+    int frame_len_padded;
+    float * frame;
+    float * buffer;
+    float * mel_energies;
+    /* MFCC_BATCH_FRAMES x num_fbank_bins log mel energies */
+    float * mel_batch;
+    /* num_fbank_bins x num_mfcc_features, dct_matrix transposed so a batch
+       is one (frames x bins) * (bins x coeffs) product */
+    float * dct_matrix_t;
+    /* Tables either point into the generated MFCC_Tables in flash or are
+       computed on the heap when no generated set matches (own_tables). */
+    bool own_tables;
+    const float * window_func;
+    /* Filterbank in CSR form: filter "bin" has weights
+       mel_fbank[fbank_weight_offset[bin] .. fbank_weight_offset[bin+1]-1]
+       for the FFT bins starting at fbank_filter_first[bin]. */
+    const int32_t * fbank_filter_first;
+    const int32_t * fbank_weight_offset;
+    const float * mel_fbank;
+    const float * dct_matrix;
+    arm_rfft_fast_instance_f32 * rfft;
+    float * create_dct_matrix(int32_t input_length, int32_t coefficient_count); 
+    float * create_mel_fbank(int32_t * filter_first, int32_t * weight_offset);
+    void compute_mel_energies(const float* data, float* mel_out);
+ 
+  public:
+    static inline float InverseMelScale(float mel_freq) {
+      return 700.0f * (expf (mel_freq / 1127.0f) - 1.0f);
+    }
+
+    static inline float MelScale(float freq) {
+      return 1127.0f * logf (1.0f + freq / 700.0f);
+    }
+
+    MFCC(const FrontendConfig &config);
+    ~MFCC();
+    void mfcc_compute(const float* data, float* mfcc_out);
+    void mfcc_compute_batch(const float* data, int n_frames, float* mfcc_out);
+    void get_tables(MFCC_Tables * tables) const;
+};
+
+#endif
@@ -0,0 +1,334 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Fixed-point MFCC feature extraction. Follows MFCC::mfcc_compute
+ * step by step, but keeps the signal in integer formats from the int16 PCM
+ * input to the quantized output features.
+ */
+
+#include <string.h>
+
+#include "mfcc_q15.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* ln(2) in Q16 */
+#define LN2_Q16 45426
+/* ln(FLT_MIN) in Q16, matches the float engine's log of an empty bin */
+#define LOG_FLT_MIN_Q16 (-5723688)
+/* Fractional bits of the Q15 window x Q31 frame x Q15 weight product,
+   before the FFT scaling is taken into account. */
+#define MEL_ENERGY_FRAC_BITS 45
+
+/* log2(1 + i/32) in Q16 */
+static const int32_t log2_lut[33] = {
+  0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+  27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904,
+  47705, 49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534,
+  64047, 65536
+};
+
+static inline q15_t float_to_q15(float x)
+{
+  int32_t v = (int32_t)roundf(x * (1 << 15));
+  if (v > 32767)
+    v = 32767;
+  else if (v < -32768)
+    v = -32768;
+  return (q15_t)v;
+}
+
+MFCC_Q15::MFCC_Q15(const FrontendConfig &config, int mfcc_dec_bits)
+  : samp_freq(config.samp_freq),
+    num_fbank_bins(config.num_fbank_bins),
+    low_freq(config.mel_low_freq),
+    high_freq(config.mel_high_freq),
+    log_mel_output(config.output == FRONTEND_OUTPUT_LOG_MEL),
+    num_mfcc_features(config.num_mfcc_coeffs),
+    frame_len(config.frame_len()),
+    mfcc_dec_bits(mfcc_dec_bits)
+{
+  // Round-up to nearest power of 2.
+  frame_len_padded = pow(2, ceil((log(frame_len) / log(2))));
+  // arm_rfft_q31 scales its output down by log2(fft length) bits
+  fft_scale_bits = (int)round(log(frame_len_padded) / log(2));
+
+  frame = new q31_t[frame_len_padded];
+  buffer = new q31_t[frame_len_padded * 2];
+  mag_spectrum = new q31_t[frame_len_padded / 2 + 1];
+  mel_energies = new int32_t[num_fbank_bins];
+
+  const MFCC_Tables *tables = 0;
+#ifndef MFCC_RUNTIME_TABLES
+  tables = MFCC_FindTables(config);
+#endif
+  own_tables = (tables == 0);
+
+  if (tables) {
+    window_func = tables->window_func_q15;
+    fbank_filter_first = tables->fbank_filter_first;
+    fbank_weight_offset = tables->fbank_weight_offset;
+    mel_fbank = tables->mel_fbank_q15;
+    dct_matrix = tables->dct_matrix_q15;
+  } else {
+    // create window function
+    q15_t * window = new q15_t[frame_len];
+    for (int i = 0; i < frame_len; i++)
+      window[i] = float_to_q15(0.5 - 0.5 * cos(M_2PI * ((float)i) / (frame_len)));
+    window_func = window;
+
+    // create mel filterbank
+    int32_t * filter_first = new int32_t[num_fbank_bins];
+    int32_t * weight_offset = new int32_t[num_fbank_bins + 1];
+    mel_fbank = create_mel_fbank(filter_first, weight_offset);
+    fbank_filter_first = filter_first;
+    fbank_weight_offset = weight_offset;
+
+    // create DCT matrix
+    if (log_mel_output)
+      dct_matrix = 0;
+    else
+      dct_matrix = create_dct_matrix(num_fbank_bins, num_mfcc_features);
+  }
+
+  // initialize FFT
+  rfft = new arm_rfft_instance_q31;
+  arm_rfft_init_q31(rfft, frame_len_padded, 0, 1);
+}
+
+MFCC_Q15::~MFCC_Q15()
+{
+  delete [] frame;
+  delete [] buffer;
+  delete [] mag_spectrum;
+  delete [] mel_energies;
+  if (own_tables) {
+    delete [] window_func;
+    delete [] fbank_filter_first;
+    delete [] fbank_weight_offset;
+    delete [] mel_fbank;
+    delete [] dct_matrix;
+  }
+  delete rfft;
+}
+
+/* Exposes the Q15 tables in use, e.g. for tools/mfcc_tables_gen.cpp. */
+void MFCC_Q15::get_tables(MFCC_Tables * tables) const
+{
+  tables->samp_freq = samp_freq;
+  tables->frame_len = frame_len;
+  tables->num_fbank_bins = num_fbank_bins;
+  tables->num_mfcc_features = num_mfcc_features;
+  tables->mel_low_freq = low_freq;
+  tables->mel_high_freq = high_freq;
+  tables->fbank_filter_first = fbank_filter_first;
+  tables->fbank_weight_offset = fbank_weight_offset;
+  tables->window_func_q15 = window_func;
+  tables->mel_fbank_q15 = mel_fbank;
+  tables->dct_matrix_q15 = dct_matrix;
+}
+
+q15_t * MFCC_Q15::create_dct_matrix(int32_t input_length, int32_t coefficient_count)
+{
+  int32_t k, n;
+  q15_t* M = new q15_t[input_length * coefficient_count];
+  float normalizer;
+  arm_sqrt_f32(2.0 / (float)input_length, &normalizer);
+  for (k = 0; k < coefficient_count; k++) {
+    for (n = 0; n < input_length; n++) {
+      M[k * input_length + n] = float_to_q15(normalizer * cos(((double)M_PI) / input_length * (n + 0.5) * k));
+    }
+  }
+  return M;
+}
+
+q15_t * MFCC_Q15::create_mel_fbank(int32_t * filter_first, int32_t * weight_offset)
+{
+  int32_t bin, i, j;
+
+  int32_t num_fft_bins = frame_len_padded / 2;
+  float fft_bin_width = ((float)samp_freq) / frame_len_padded;
+  float mel_low_freq = MFCC::MelScale(low_freq);
+  float mel_high_freq = MFCC::MelScale(high_freq);
+  float mel_freq_delta = (mel_high_freq - mel_low_freq) / (num_fbank_bins + 1);
+
+  // first pass: find the span of FFT bins each filter covers
+  int32_t num_weights = 0;
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float left_mel = mel_low_freq + bin * mel_freq_delta;
+    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
+
+    int32_t first_index = -1, last_index = -1;
+
+    for (i = 0; i < num_fft_bins; i++) {
+      float freq = (fft_bin_width * i);  // center freq of this fft bin.
+      float mel = MFCC::MelScale(freq);
+      if (mel > left_mel && mel < right_mel) {
+        if (first_index == -1)
+          first_index = i;
+        last_index = i;
+      }
+    }
+
+    if (first_index == -1) {
+      // filter narrower than one FFT bin, contributes nothing
+      first_index = 0;
+      last_index = -1;
+    }
+    filter_first[bin] = first_index;
+    weight_offset[bin] = num_weights;
+    num_weights += last_index - first_index + 1;
+  }
+  weight_offset[num_fbank_bins] = num_weights;
+
+  // second pass: store all weights back to back
+  q15_t * mel_fbank = new q15_t[num_weights];
+
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float left_mel = mel_low_freq + bin * mel_freq_delta;
+    float center_mel = mel_low_freq + (bin + 1) * mel_freq_delta;
+    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
+
+    i = filter_first[bin];
+    for (j = weight_offset[bin]; j < weight_offset[bin + 1]; j++, i++) {
+      float freq = (fft_bin_width * i);
+      float mel = MFCC::MelScale(freq);
+      float weight;
+      if (mel <= center_mel) {
+        weight = (mel - left_mel) / (center_mel - left_mel);
+      } else {
+        weight = (right_mel-mel) / (right_mel-center_mel);
+      }
+      mel_fbank[j] = float_to_q15(weight);
+    }
+  }
+  return mel_fbank;
+}
+
+/*
+ * log2(x) in Q16 for x > 0. The integer part comes from the position of the
+ * leading one, the fraction from a 32 segment table with linear interpolation
+ * (max error about 2e-4).
+ */
+int32_t MFCC_Q15::log_q16(uint64_t x)
+{
+  uint32_t hi = (uint32_t)(x >> 32);
+  int32_t msb = hi ? 63 - __CLZ(hi) : 31 - __CLZ((uint32_t)x);
+
+  // 5 table index bits followed by 16 interpolation bits below the leading one
+  uint32_t frac;
+  if (msb >= 21)
+    frac = (uint32_t)(x >> (msb - 21)) & 0x1FFFFF;
+  else
+    frac = (uint32_t)(x << (21 - msb)) & 0x1FFFFF;
+  int32_t idx = frac >> 16;
+  int32_t t = frac & 0xFFFF;
+  int32_t y = log2_lut[idx] + (((log2_lut[idx + 1] - log2_lut[idx]) * t) >> 16);
+
+  return (msb << 16) + y;
+}
+
+void MFCC_Q15::compute_log_mel(const int16_t * audio_data)
+{
+  int32_t i, j, bin;
+
+  // Window the frame. int16 x Q15 gives Q30, so one more shift lands in Q31.
+  for (i = 0; i < frame_len; i++) {
+    frame[i] = ((q31_t)audio_data[i] * window_func[i]) << 1;
+  }
+  // Fill up remaining with zeros
+  memset(&frame[frame_len], 0, sizeof(q31_t) * (frame_len_padded-frame_len));
+
+  // Compute FFT, output holds frame_len_padded complex bins
+  arm_rfft_q31(rfft, frame, buffer);
+
+  // Magnitude spectrum up to and including Nyquist, in 2.30
+  int32_t half_dim = frame_len_padded / 2;
+  arm_cmplx_mag_q31(buffer, mag_spectrum, half_dim + 1);
+
+  // Apply mel filterbanks and take log
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    uint64_t mel_energy = 0;
+    const q31_t *mag = &mag_spectrum[fbank_filter_first[bin]];
+    for (j = fbank_weight_offset[bin]; j < fbank_weight_offset[bin + 1]; j++) {
+      mel_energy += (uint64_t)(uint32_t)*mag++ * (uint16_t)mel_fbank[j];
+    }
+
+    // avoid log of zero
+    if (mel_energy == 0) {
+      mel_energies[bin] = LOG_FLT_MIN_Q16;
+      continue;
+    }
+
+    // undo the fixed-point scaling, then convert log2 to natural log
+    int32_t log2_energy = log_q16(mel_energy) - ((MEL_ENERGY_FRAC_BITS - fft_scale_bits) << 16);
+    mel_energies[bin] = (int32_t)(((int64_t)log2_energy * LN2_Q16) >> 16);
+  }
+}
+
+/* One output feature in Q31: a DCT output (Q15 matrix x Q16 log energies)
+   or, in log-mel mode, the log energy itself. */
+q63_t MFCC_Q15::feature(int32_t index)
+{
+  if (log_mel_output)
+    return (q63_t)mel_energies[index] << 15;
+
+  q63_t sum = 0;
+  const q15_t *row = &dct_matrix[index * num_fbank_bins];
+  for (int32_t j = 0; j < num_fbank_bins; j++) {
+    sum += (q63_t)row[j] * mel_energies[j];
+  }
+  return sum;
+}
+
+void MFCC_Q15::mfcc_compute(const int16_t * audio_data, q7_t* mfcc_out)
+{
+  compute_log_mel(audio_data);
+
+  int32_t shift = 31 - mfcc_dec_bits;
+  int32_t num_out = log_mel_output ? num_fbank_bins : num_mfcc_features;
+  for (int32_t i = 0; i < num_out; i++) {
+    q63_t sum = (feature(i) + ((q63_t)1 << (shift - 1))) >> shift;
+    if (sum >= 127)
+      mfcc_out[i] = 127;
+    else if (sum <= -128)
+      mfcc_out[i] = -128;
+    else
+      mfcc_out[i] = (q7_t)sum;
+  }
+}
+
+void MFCC_Q15::mfcc_compute(const int16_t * audio_data, q15_t* mfcc_out)
+{
+  compute_log_mel(audio_data);
+
+  int32_t shift = 31 - mfcc_dec_bits;
+  int32_t num_out = log_mel_output ? num_fbank_bins : num_mfcc_features;
+  for (int32_t i = 0; i < num_out; i++) {
+    q63_t sum = (feature(i) + ((q63_t)1 << (shift - 1))) >> shift;
+    if (sum >= 32767)
+      mfcc_out[i] = 32767;
+    else if (sum <= -32768)
+      mfcc_out[i] = -32768;
+    else
+      mfcc_out[i] = (q15_t)sum;
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MFCC_Q15_H__
+#define __MFCC_Q15_H__
+
+#include "mfcc.h"
+
+/*
+ * Integer MFCC engine. Takes int16 PCM straight from the SAI and produces
+ * the same features as MFCC::mfcc_compute (MFCC or log-mel, as configured),
+ * quantized with mfcc_dec_bits fractional bits. The window, mel filterbank and DCT matrix are stored in
+ * Q15, the FFT runs in Q31 and the log is a table based log2.
+ */
+class MFCC_Q15
+{
+  private:
+    int samp_freq;
+    int num_fbank_bins;
+    int low_freq;
+    int high_freq;
+    bool log_mel_output;
+    int num_mfcc_features;
+    int frame_len;
+    int frame_len_padded;
+    int fft_scale_bits;
+    int mfcc_dec_bits;
+    q31_t * frame;
+    q31_t * buffer;
+    q31_t * mag_spectrum;
+    int32_t * mel_energies;
+    /* generated tables in flash, or heap copies when own_tables */
+    bool own_tables;
+    const q15_t * window_func;
+    /* CSR filterbank, same layout as MFCC */
+    const int32_t * fbank_filter_first;
+    const int32_t * fbank_weight_offset;
+    const q15_t * mel_fbank;
+    const q15_t * dct_matrix;
+    arm_rfft_instance_q31 * rfft;
+    q15_t * create_dct_matrix(int32_t input_length, int32_t coefficient_count);
+    q15_t * create_mel_fbank(int32_t * filter_first, int32_t * weight_offset);
+    void compute_log_mel(const int16_t* audio_data);
+    q63_t feature(int32_t index);
+
+    static int32_t log_q16(uint64_t x);
+
+  public:
+    MFCC_Q15(const FrontendConfig &config, int mfcc_dec_bits);
+    ~MFCC_Q15();
+    void mfcc_compute(const int16_t* data, q7_t* mfcc_out);
+    void mfcc_compute(const int16_t* data, q15_t* mfcc_out);
+    void get_tables(MFCC_Tables * tables) const;
+};
+
+#endif
@@ -0,0 +1,1043 @@
+/*
+ * Generated by tools/mfcc_tables_gen.cpp, do not edit.
+ */
+
+#include "mfcc_tables.h"
+
+/* 44100 Hz, 1102 sample frame, 40 mel bins (20-4000 Hz), 13 coefficients */
+
+static const int32_t fbank_filter_first_44100_1102[40] = {
+  1, 3, 5, 6, 8, 10, 12, 14, 16, 18,
+  21, 23, 26, 29, 31, 34, 38, 41, 44, 48,
+  51, 55, 59, 64, 68, 73, 78, 83, 88, 94,
+  100, 106, 113, 119, 126, 134, 142, 150, 158, 167,
+};
+
+static const int32_t fbank_weight_offset_44100_1102[41] = {
+  0, 4, 7, 10, 14, 18, 22, 26, 30, 35,
+  40, 45, 51, 56, 61, 68, 75, 81, 88, 95,
+  102, 110, 119, 128, 137, 147, 157, 167, 178, 190,
+  202, 215, 228, 241, 256, 272, 288, 304, 321, 339,
+  358,
+};
+
+static const float window_func_44100_1102[1102] = {
+  0.00000000e+00f, 8.12709550e-06f, 3.25081201e-05f, 7.31422770e-05f, 1.30028246e-04f,
+  2.03164192e-04f, 2.92547717e-04f, 3.98175907e-04f, 5.20045345e-04f, 6.58152101e-04f,
+  8.12491635e-04f, 9.83058941e-04f, 1.16984849e-03f, 1.37285423e-03f, 1.59206952e-03f,
+  1.82748714e-03f, 2.07909965e-03f, 2.34689866e-03f, 2.63087568e-03f, 2.93102139e-03f,
+  3.24732601e-03f, 3.57977930e-03f, 3.92837031e-03f, 4.29308787e-03f, 4.67391964e-03f,
+  5.07085398e-03f, 5.48387785e-03f, 5.91297774e-03f, 6.35813922e-03f, 6.81934832e-03f,
+  7.29659013e-03f, 7.78984837e-03f, 8.29910766e-03f, 8.82435217e-03f, 9.36556328e-03f,
+  9.92272422e-03f, 1.04958173e-02f, 1.10848229e-02f, 1.16897225e-02f, 1.23104956e-02f,
+  1.29471235e-02f, 1.35995848e-02f, 1.42678572e-02f, 1.49519211e-02f, 1.56517532e-02f,
+  1.63673293e-02f, 1.70986280e-02f, 1.78456251e-02f, 1.86082963e-02f, 1.93866175e-02f,
+  2.01805625e-02f, 2.09901053e-02f, 2.18152199e-02f, 2.26558801e-02f, 2.35120580e-02f,
+  2.43837237e-02f, 2.52708532e-02f, 2.61734147e-02f, 2.70913783e-02f, 2.80247182e-02f,
+  2.89733987e-02f, 2.99373921e-02f, 3.09166666e-02f, 3.19111906e-02f, 3.29209305e-02f,
+  3.39458548e-02f, 3.49859297e-02f, 3.60411219e-02f, 3.71113978e-02f, 3.81967202e-02f,
+  3.92970555e-02f, 4.04123664e-02f, 4.15426195e-02f, 4.26877737e-02f, 4.38477993e-02f,
+  4.50226478e-02f, 4.62122895e-02f, 4.74166833e-02f, 4.86357883e-02f, 4.98695709e-02f,
+  5.11179827e-02f, 5.23809865e-02f, 5.36585413e-02f, 5.49506098e-02f, 5.62571436e-02f,
+  5.75781018e-02f, 5.89134432e-02f, 6.02631234e-02f, 6.16271012e-02f, 6.30053282e-02f,
+  6.43977597e-02f, 6.58043548e-02f, 6.72250614e-02f, 6.86598346e-02f, 7.01086372e-02f,
+  7.15714097e-02f, 7.30481148e-02f, 7.45386928e-02f, 7.60431066e-02f, 7.75613040e-02f,
+  7.90932328e-02f, 8.06388408e-02f, 8.21980834e-02f, 8.37709084e-02f, 8.53572637e-02f,
+  8.69570971e-02f, 8.85703638e-02f, 9.01970044e-02f, 9.18369591e-02f, 9.34901908e-02f,
+  9.51566324e-02f, 9.68362391e-02f, 9.85289514e-02f, 1.00234710e-01f, 1.01953469e-01f,
+  1.03685163e-01f, 1.05429746e-01f, 1.07187152e-01f, 1.08957328e-01f, 1.10740222e-01f,
+  1.12535767e-01f, 1.14343904e-01f, 1.16164580e-01f, 1.17997736e-01f, 1.19843304e-01f,
+  1.21701241e-01f, 1.23571470e-01f, 1.25453934e-01f, 1.27348572e-01f, 1.29255325e-01f,
+  1.31174147e-01f, 1.33104935e-01f, 1.35047659e-01f, 1.37002259e-01f, 1.38968647e-01f,
+  1.40946776e-01f, 1.42936572e-01f, 1.44937977e-01f, 1.46950930e-01f, 1.48975357e-01f,
+  1.51011184e-01f, 1.53058365e-01f, 1.55116826e-01f, 1.57186508e-01f, 1.59267321e-01f,
+  1.61359221e-01f, 1.63462117e-01f, 1.65575951e-01f, 1.67700678e-01f, 1.69836193e-01f,
+  1.71982437e-01f, 1.74139351e-01f, 1.76306859e-01f, 1.78484887e-01f, 1.80673361e-01f,
+  1.82872236e-01f, 1.85081393e-01f, 1.87300801e-01f, 1.89530388e-01f, 1.91770047e-01f,
+  1.94019735e-01f, 1.96279362e-01f, 1.98548868e-01f, 2.00828180e-01f, 2.03117222e-01f,
+  2.05415905e-01f, 2.07724154e-01f, 2.10041925e-01f, 2.12369099e-01f, 2.14705646e-01f,
+  2.17051461e-01f, 2.19406471e-01f, 2.21770599e-01f, 2.24143773e-01f, 2.26525918e-01f,
+  2.28916958e-01f, 2.31316805e-01f, 2.33725384e-01f, 2.36142620e-01f, 2.38568440e-01f,
+  2.41002753e-01f, 2.43445486e-01f, 2.45896563e-01f, 2.48355895e-01f, 2.50823408e-01f,
+  2.53299028e-01f, 2.55782664e-01f, 2.58274227e-01f, 2.60773659e-01f, 2.63280869e-01f,
+  2.65795767e-01f, 2.68318295e-01f, 2.70848334e-01f, 2.73385853e-01f, 2.75930703e-01f,
+  2.78482854e-01f, 2.81042218e-01f, 2.83608675e-01f, 2.86182195e-01f, 2.88762629e-01f,
+  2.91349977e-01f, 2.93944061e-01f, 2.96544880e-01f, 2.99152285e-01f, 3.01766247e-01f,
+  3.04386616e-01f, 3.07013363e-01f, 3.09646398e-01f, 3.12285602e-01f, 3.14930916e-01f,
+  3.17582250e-01f, 3.20239514e-01f, 3.22902620e-01f, 3.25571477e-01f, 3.28245997e-01f,
+  3.30926120e-01f, 3.33611727e-01f, 3.36302757e-01f, 3.38999093e-01f, 3.41700673e-01f,
+  3.44407380e-01f, 3.47119182e-01f, 3.49835932e-01f, 3.52557540e-01f, 3.55283976e-01f,
+  3.58015120e-01f, 3.60750854e-01f, 3.63491118e-01f, 3.66235822e-01f, 3.68984878e-01f,
+  3.71738195e-01f, 3.74495685e-01f, 3.77257258e-01f, 3.80022824e-01f, 3.82792264e-01f,
+  3.85565549e-01f, 3.88342530e-01f, 3.91123146e-01f, 3.93907309e-01f, 3.96694899e-01f,
+  3.99485856e-01f, 4.02280092e-01f, 4.05077487e-01f, 4.07877982e-01f, 4.10681486e-01f,
+  4.13487881e-01f, 4.16297078e-01f, 4.19108987e-01f, 4.21923548e-01f, 4.24740642e-01f,
+  4.27560180e-01f, 4.30382073e-01f, 4.33206230e-01f, 4.36032563e-01f, 4.38860983e-01f,
+  4.41691369e-01f, 4.44523662e-01f, 4.47357744e-01f, 4.50193554e-01f, 4.53031003e-01f,
+  4.55869943e-01f, 4.58710313e-01f, 4.61552054e-01f, 4.64395046e-01f, 4.67239171e-01f,
+  4.70084369e-01f, 4.72930551e-01f, 4.75777596e-01f, 4.78625447e-01f, 4.81473982e-01f,
+  4.84323114e-01f, 4.87172753e-01f, 4.90022838e-01f, 4.92873222e-01f, 4.95723844e-01f,
+  4.98574585e-01f, 5.01425385e-01f, 5.04276156e-01f, 5.07126808e-01f, 5.09977162e-01f,
+  5.12827218e-01f, 5.15676856e-01f, 5.18526018e-01f, 5.21374583e-01f, 5.24222374e-01f,
+  5.27069449e-01f, 5.29915631e-01f, 5.32760859e-01f, 5.35604954e-01f, 5.38447917e-01f,
+  5.41289687e-01f, 5.44130087e-01f, 5.46968997e-01f, 5.49806416e-01f, 5.52642226e-01f,
+  5.55476308e-01f, 5.58308601e-01f, 5.61139047e-01f, 5.63967407e-01f, 5.66793740e-01f,
+  5.69617927e-01f, 5.72439790e-01f, 5.75259328e-01f, 5.78076422e-01f, 5.80891013e-01f,
+  5.83702922e-01f, 5.86512148e-01f, 5.89318514e-01f, 5.92122018e-01f, 5.94922483e-01f,
+  5.97719908e-01f, 6.00514114e-01f, 6.03305101e-01f, 6.06092691e-01f, 6.08876884e-01f,
+  6.11657500e-01f, 6.14434481e-01f, 6.17207706e-01f, 6.19977176e-01f, 6.22742772e-01f,
+  6.25504315e-01f, 6.28261805e-01f, 6.31015122e-01f, 6.33764148e-01f, 6.36508882e-01f,
+  6.39249146e-01f, 6.41984880e-01f, 6.44716024e-01f, 6.47442460e-01f, 6.50164068e-01f,
+  6.52880847e-01f, 6.55592620e-01f, 6.58299327e-01f, 6.61000907e-01f, 6.63697243e-01f,
+  6.66388273e-01f, 6.69073880e-01f, 6.71754003e-01f, 6.74428523e-01f, 6.77097380e-01f,
+  6.79760516e-01f, 6.82417750e-01f, 6.85069084e-01f, 6.87714398e-01f, 6.90353632e-01f,
+  6.92986608e-01f, 6.95613384e-01f, 6.98233783e-01f, 7.00847685e-01f, 7.03455150e-01f,
+  7.06055939e-01f, 7.08650053e-01f, 7.11237371e-01f, 7.13817835e-01f, 7.16391325e-01f,
+  7.18957782e-01f, 7.21517146e-01f, 7.24069297e-01f, 7.26614177e-01f, 7.29151666e-01f,
+  7.31681705e-01f, 7.34204233e-01f, 7.36719131e-01f, 7.39226341e-01f, 7.41725743e-01f,
+  7.44217336e-01f, 7.46701002e-01f, 7.49176562e-01f, 7.51644135e-01f, 7.54103422e-01f,
+  7.56554544e-01f, 7.58997262e-01f, 7.61431575e-01f, 7.63857365e-01f, 7.66274631e-01f,
+  7.68683195e-01f, 7.71083057e-01f, 7.73474097e-01f, 7.75856197e-01f, 7.78229415e-01f,
+  7.80593514e-01f, 7.82948554e-01f, 7.85294354e-01f, 7.87630916e-01f, 7.89958060e-01f,
+  7.92275846e-01f, 7.94584095e-01f, 7.96882808e-01f, 7.99171805e-01f, 8.01451147e-01f,
+  8.03720653e-01f, 8.05980265e-01f, 8.08229923e-01f, 8.10469627e-01f, 8.12699199e-01f,
+  8.14918578e-01f, 8.17127764e-01f, 8.19326639e-01f, 8.21515143e-01f, 8.23693156e-01f,
+  8.25860620e-01f, 8.28017533e-01f, 8.30163836e-01f, 8.32299352e-01f, 8.34424019e-01f,
+  8.36537898e-01f, 8.38640809e-01f, 8.40732694e-01f, 8.42813492e-01f, 8.44883144e-01f,
+  8.46941650e-01f, 8.48988831e-01f, 8.51024628e-01f, 8.53049099e-01f, 8.55062008e-01f,
+  8.57063413e-01f, 8.59053254e-01f, 8.61031353e-01f, 8.62997770e-01f, 8.64952326e-01f,
+  8.66895080e-01f, 8.68825853e-01f, 8.70744646e-01f, 8.72651398e-01f, 8.74546051e-01f,
+  8.76428545e-01f, 8.78298759e-01f, 8.80156696e-01f, 8.82002294e-01f, 8.83835435e-01f,
+  8.85656118e-01f, 8.87464225e-01f, 8.89259756e-01f, 8.91042650e-01f, 8.92812848e-01f,
+  8.94570231e-01f, 8.96314859e-01f, 8.98046553e-01f, 8.99765313e-01f, 9.01471078e-01f,
+  9.03163791e-01f, 9.04843390e-01f, 9.06509817e-01f, 9.08163011e-01f, 9.09802973e-01f,
+  9.11429644e-01f, 9.13042903e-01f, 9.14642751e-01f, 9.16229069e-01f, 9.17801917e-01f,
+  9.19361174e-01f, 9.20906782e-01f, 9.22438681e-01f, 9.23956871e-01f, 9.25461292e-01f,
+  9.26951885e-01f, 9.28428590e-01f, 9.29891348e-01f, 9.31340158e-01f, 9.32774961e-01f,
+  9.34195638e-01f, 9.35602248e-01f, 9.36994672e-01f, 9.38372910e-01f, 9.39736903e-01f,
+  9.41086531e-01f, 9.42421913e-01f, 9.43742871e-01f, 9.45049405e-01f, 9.46341455e-01f,
+  9.47619021e-01f, 9.48882043e-01f, 9.50130403e-01f, 9.51364219e-01f, 9.52583313e-01f,
+  9.53787684e-01f, 9.54977334e-01f, 9.56152201e-01f, 9.57312226e-01f, 9.58457410e-01f,
+  9.59587634e-01f, 9.60702956e-01f, 9.61803257e-01f, 9.62888598e-01f, 9.63958859e-01f,
+  9.65014040e-01f, 9.66054142e-01f, 9.67079043e-01f, 9.68088806e-01f, 9.69083309e-01f,
+  9.70062613e-01f, 9.71026599e-01f, 9.71975267e-01f, 9.72908616e-01f, 9.73826587e-01f,
+  9.74729121e-01f, 9.75616276e-01f, 9.76487935e-01f, 9.77344096e-01f, 9.78184760e-01f,
+  9.79009867e-01f, 9.79819417e-01f, 9.80613410e-01f, 9.81391728e-01f, 9.82154369e-01f,
+  9.82901394e-01f, 9.83632684e-01f, 9.84348238e-01f, 9.85048056e-01f, 9.85732138e-01f,
+  9.86400425e-01f, 9.87052858e-01f, 9.87689495e-01f, 9.88310277e-01f, 9.88915205e-01f,
+  9.89504158e-01f, 9.90077257e-01f, 9.90634441e-01f, 9.91175652e-01f, 9.91700888e-01f,
+  9.92210150e-01f, 9.92703438e-01f, 9.93180633e-01f, 9.93641853e-01f, 9.94087040e-01f,
+  9.94516134e-01f, 9.94929135e-01f, 9.95326102e-01f, 9.95706916e-01f, 9.96071637e-01f,
+  9.96420205e-01f, 9.96752679e-01f, 9.97069001e-01f, 9.97369111e-01f, 9.97653127e-01f,
+  9.97920871e-01f, 9.98172522e-01f, 9.98407960e-01f, 9.98627126e-01f, 9.98830140e-01f,
+  9.99016941e-01f, 9.99187529e-01f, 9.99341846e-01f, 9.99479949e-01f, 9.99601841e-01f,
+  9.99707460e-01f, 9.99796808e-01f, 9.99869943e-01f, 9.99926865e-01f, 9.99967515e-01f,
+  9.99991894e-01f, 1.00000000e+00f, 9.99991894e-01f, 9.99967515e-01f, 9.99926865e-01f,
+  9.99869943e-01f, 9.99796808e-01f, 9.99707460e-01f, 9.99601841e-01f, 9.99479949e-01f,
+  9.99341846e-01f, 9.99187529e-01f, 9.99016941e-01f, 9.98830140e-01f, 9.98627126e-01f,
+  9.98407960e-01f, 9.98172522e-01f, 9.97920871e-01f, 9.97653127e-01f, 9.97369111e-01f,
+  9.97069001e-01f, 9.96752679e-01f, 9.96420205e-01f, 9.96071637e-01f, 9.95706916e-01f,
+  9.95326102e-01f, 9.94929135e-01f, 9.94516134e-01f, 9.94087040e-01f, 9.93641853e-01f,
+  9.93180633e-01f, 9.92703438e-01f, 9.92210150e-01f, 9.91700888e-01f, 9.91175652e-01f,
+  9.90634441e-01f, 9.90077257e-01f, 9.89504158e-01f, 9.88915205e-01f, 9.88310277e-01f,
+  9.87689495e-01f, 9.87052858e-01f, 9.86400425e-01f, 9.85732138e-01f, 9.85048056e-01f,
+  9.84348238e-01f, 9.83632684e-01f, 9.82901394e-01f, 9.82154369e-01f, 9.81391728e-01f,
+  9.80613410e-01f, 9.79819417e-01f, 9.79009867e-01f, 9.78184760e-01f, 9.77344096e-01f,
+  9.76487935e-01f, 9.75616276e-01f, 9.74729121e-01f, 9.73826587e-01f, 9.72908616e-01f,
+  9.71975267e-01f, 9.71026599e-01f, 9.70062613e-01f, 9.69083309e-01f, 9.68088806e-01f,
+  9.67079043e-01f, 9.66054142e-01f, 9.65014040e-01f, 9.63958859e-01f, 9.62888598e-01f,
+  9.61803257e-01f, 9.60702956e-01f, 9.59587634e-01f, 9.58457410e-01f, 9.57312226e-01f,
+  9.56152201e-01f, 9.54977334e-01f, 9.53787684e-01f, 9.52583313e-01f, 9.51364219e-01f,
+  9.50130403e-01f, 9.48882043e-01f, 9.47619021e-01f, 9.46341455e-01f, 9.45049405e-01f,
+  9.43742871e-01f, 9.42421913e-01f, 9.41086531e-01f, 9.39736903e-01f, 9.38372910e-01f,
+  9.36994672e-01f, 9.35602248e-01f, 9.34195638e-01f, 9.32774961e-01f, 9.31340158e-01f,
+  9.29891348e-01f, 9.28428590e-01f, 9.26951885e-01f, 9.25461292e-01f, 9.23956871e-01f,
+  9.22438681e-01f, 9.20906782e-01f, 9.19361174e-01f, 9.17801917e-01f, 9.16229069e-01f,
+  9.14642751e-01f, 9.13042903e-01f, 9.11429644e-01f, 9.09802973e-01f, 9.08163011e-01f,
+  9.06509817e-01f, 9.04843390e-01f, 9.03163791e-01f, 9.01471078e-01f, 8.99765313e-01f,
+  8.98046553e-01f, 8.96314859e-01f, 8.94570231e-01f, 8.92812848e-01f, 8.91042650e-01f,
+  8.89259756e-01f, 8.87464225e-01f, 8.85656118e-01f, 8.83835435e-01f, 8.82002294e-01f,
+  8.80156696e-01f, 8.78298759e-01f, 8.76428545e-01f, 8.74546051e-01f, 8.72651398e-01f,
+  8.70744646e-01f, 8.68825853e-01f, 8.66895080e-01f, 8.64952326e-01f, 8.62997770e-01f,
+  8.61031353e-01f, 8.59053254e-01f, 8.57063413e-01f, 8.55062008e-01f, 8.53049099e-01f,
+  8.51024628e-01f, 8.48988831e-01f, 8.46941650e-01f, 8.44883144e-01f, 8.42813492e-01f,
+  8.40732694e-01f, 8.38640809e-01f, 8.36537898e-01f, 8.34424019e-01f, 8.32299352e-01f,
+  8.30163836e-01f, 8.28017533e-01f, 8.25860620e-01f, 8.23693156e-01f, 8.21515143e-01f,
+  8.19326639e-01f, 8.17127764e-01f, 8.14918578e-01f, 8.12699199e-01f, 8.10469627e-01f,
+  8.08229923e-01f, 8.05980265e-01f, 8.03720653e-01f, 8.01451147e-01f, 7.99171805e-01f,
+  7.96882808e-01f, 7.94584095e-01f, 7.92275846e-01f, 7.89958060e-01f, 7.87630916e-01f,
+  7.85294354e-01f, 7.82948554e-01f, 7.80593514e-01f, 7.78229415e-01f, 7.75856197e-01f,
+  7.73474097e-01f, 7.71083057e-01f, 7.68683195e-01f, 7.66274631e-01f, 7.63857365e-01f,
+  7.61431575e-01f, 7.58997262e-01f, 7.56554544e-01f, 7.54103422e-01f, 7.51644135e-01f,
+  7.49176562e-01f, 7.46701002e-01f, 7.44217336e-01f, 7.41725743e-01f, 7.39226341e-01f,
+  7.36719131e-01f, 7.34204233e-01f, 7.31681705e-01f, 7.29151666e-01f, 7.26614177e-01f,
+  7.24069297e-01f, 7.21517146e-01f, 7.18957782e-01f, 7.16391325e-01f, 7.13817835e-01f,
+  7.11237371e-01f, 7.08650053e-01f, 7.06055939e-01f, 7.03455150e-01f, 7.00847685e-01f,
+  6.98233783e-01f, 6.95613384e-01f, 6.92986608e-01f, 6.90353632e-01f, 6.87714398e-01f,
+  6.85069084e-01f, 6.82417750e-01f, 6.79760516e-01f, 6.77097380e-01f, 6.74428523e-01f,
+  6.71754003e-01f, 6.69073880e-01f, 6.66388273e-01f, 6.63697243e-01f, 6.61000907e-01f,
+  6.58299327e-01f, 6.55592620e-01f, 6.52880847e-01f, 6.50164068e-01f, 6.47442460e-01f,
+  6.44716024e-01f, 6.41984880e-01f, 6.39249146e-01f, 6.36508882e-01f, 6.33764148e-01f,
+  6.31015122e-01f, 6.28261805e-01f, 6.25504315e-01f, 6.22742772e-01f, 6.19977176e-01f,
+  6.17207706e-01f, 6.14434481e-01f, 6.11657500e-01f, 6.08876884e-01f, 6.06092691e-01f,
+  6.03305101e-01f, 6.00514114e-01f, 5.97719908e-01f, 5.94922483e-01f, 5.92122018e-01f,
+  5.89318514e-01f, 5.86512148e-01f, 5.83702922e-01f, 5.80891013e-01f, 5.78076422e-01f,
+  5.75259328e-01f, 5.72439790e-01f, 5.69617927e-01f, 5.66793740e-01f, 5.63967407e-01f,
+  5.61139047e-01f, 5.58308601e-01f, 5.55476308e-01f, 5.52642226e-01f, 5.49806416e-01f,
+  5.46968997e-01f, 5.44130087e-01f, 5.41289687e-01f, 5.38447917e-01f, 5.35604954e-01f,
+  5.32760859e-01f, 5.29915631e-01f, 5.27069449e-01f, 5.24222374e-01f, 5.21374583e-01f,
+  5.18526018e-01f, 5.15676856e-01f, 5.12827218e-01f, 5.09977162e-01f, 5.07126808e-01f,
+  5.04276156e-01f, 5.01425385e-01f, 4.98574585e-01f, 4.95723844e-01f, 4.92873222e-01f,
+  4.90022838e-01f, 4.87172753e-01f, 4.84323114e-01f, 4.81473982e-01f, 4.78625447e-01f,
+  4.75777596e-01f, 4.72930551e-01f, 4.70084369e-01f, 4.67239171e-01f, 4.64395046e-01f,
+  4.61552054e-01f, 4.58710313e-01f, 4.55869943e-01f, 4.53031003e-01f, 4.50193554e-01f,
+  4.47357744e-01f, 4.44523662e-01f, 4.41691369e-01f, 4.38860983e-01f, 4.36032563e-01f,
+  4.33206230e-01f, 4.30382073e-01f, 4.27560180e-01f, 4.24740642e-01f, 4.21923548e-01f,
+  4.19108987e-01f, 4.16297078e-01f, 4.13487881e-01f, 4.10681486e-01f, 4.07877982e-01f,
+  4.05077487e-01f, 4.02280092e-01f, 3.99485856e-01f, 3.96694899e-01f, 3.93907309e-01f,
+  3.91123146e-01f, 3.88342530e-01f, 3.85565549e-01f, 3.82792264e-01f, 3.80022824e-01f,
+  3.77257258e-01f, 3.74495685e-01f, 3.71738195e-01f, 3.68984878e-01f, 3.66235822e-01f,
+  3.63491118e-01f, 3.60750854e-01f, 3.58015120e-01f, 3.55283976e-01f, 3.52557540e-01f,
+  3.49835932e-01f, 3.47119182e-01f, 3.44407380e-01f, 3.41700673e-01f, 3.38999093e-01f,
+  3.36302757e-01f, 3.33611727e-01f, 3.30926120e-01f, 3.28245997e-01f, 3.25571477e-01f,
+  3.22902620e-01f, 3.20239514e-01f, 3.17582250e-01f, 3.14930916e-01f, 3.12285602e-01f,
+  3.09646398e-01f, 3.07013363e-01f, 3.04386616e-01f, 3.01766247e-01f, 2.99152285e-01f,
+  2.96544880e-01f, 2.93944061e-01f, 2.91349977e-01f, 2.88762629e-01f, 2.86182195e-01f,
+  2.83608675e-01f, 2.81042218e-01f, 2.78482854e-01f, 2.75930703e-01f, 2.73385853e-01f,
+  2.70848334e-01f, 2.68318295e-01f, 2.65795767e-01f, 2.63280869e-01f, 2.60773659e-01f,
+  2.58274227e-01f, 2.55782664e-01f, 2.53299028e-01f, 2.50823408e-01f, 2.48355895e-01f,
+  2.45896563e-01f, 2.43445486e-01f, 2.41002753e-01f, 2.38568440e-01f, 2.36142620e-01f,
+  2.33725384e-01f, 2.31316805e-01f, 2.28916958e-01f, 2.26525918e-01f, 2.24143773e-01f,
+  2.21770599e-01f, 2.19406471e-01f, 2.17051461e-01f, 2.14705646e-01f, 2.12369099e-01f,
+  2.10041925e-01f, 2.07724154e-01f, 2.05415905e-01f, 2.03117222e-01f, 2.00828180e-01f,
+  1.98548868e-01f, 1.96279362e-01f, 1.94019735e-01f, 1.91770047e-01f, 1.89530388e-01f,
+  1.87300801e-01f, 1.85081393e-01f, 1.82872236e-01f, 1.80673361e-01f, 1.78484887e-01f,
+  1.76306859e-01f, 1.74139351e-01f, 1.71982437e-01f, 1.69836193e-01f, 1.67700678e-01f,
+  1.65575951e-01f, 1.63462117e-01f, 1.61359221e-01f, 1.59267321e-01f, 1.57186508e-01f,
+  1.55116826e-01f, 1.53058365e-01f, 1.51011184e-01f, 1.48975357e-01f, 1.46950930e-01f,
+  1.44937977e-01f, 1.42936572e-01f, 1.40946776e-01f, 1.38968647e-01f, 1.37002259e-01f,
+  1.35047659e-01f, 1.33104935e-01f, 1.31174147e-01f, 1.29255325e-01f, 1.27348572e-01f,
+  1.25453934e-01f, 1.23571470e-01f, 1.21701241e-01f, 1.19843304e-01f, 1.17997736e-01f,
+  1.16164580e-01f, 1.14343904e-01f, 1.12535767e-01f, 1.10740222e-01f, 1.08957328e-01f,
+  1.07187152e-01f, 1.05429746e-01f, 1.03685163e-01f, 1.01953469e-01f, 1.00234710e-01f,
+  9.85289514e-02f, 9.68362391e-02f, 9.51566324e-02f, 9.34901908e-02f, 9.18369591e-02f,
+  9.01970044e-02f, 8.85703638e-02f, 8.69570971e-02f, 8.53572637e-02f, 8.37709084e-02f,
+  8.21980834e-02f, 8.06388408e-02f, 7.90932328e-02f, 7.75613040e-02f, 7.60431066e-02f,
+  7.45386928e-02f, 7.30481148e-02f, 7.15714097e-02f, 7.01086372e-02f, 6.86598346e-02f,
+  6.72250614e-02f, 6.58043548e-02f, 6.43977597e-02f, 6.30053282e-02f, 6.16271012e-02f,
+  6.02631234e-02f, 5.89134432e-02f, 5.75781018e-02f, 5.62571436e-02f, 5.49506098e-02f,
+  5.36585413e-02f, 5.23809865e-02f, 5.11179827e-02f, 4.98695709e-02f, 4.86357883e-02f,
+  4.74166833e-02f, 4.62122895e-02f, 4.50226478e-02f, 4.38477993e-02f, 4.26877737e-02f,
+  4.15426195e-02f, 4.04123664e-02f, 3.92970555e-02f, 3.81967202e-02f, 3.71113978e-02f,
+  3.60411219e-02f, 3.49859297e-02f, 3.39458548e-02f, 3.29209305e-02f, 3.19111906e-02f,
+  3.09166666e-02f, 2.99373921e-02f, 2.89733987e-02f, 2.80247182e-02f, 2.70913783e-02f,
+  2.61734147e-02f, 2.52708532e-02f, 2.43837237e-02f, 2.35120580e-02f, 2.26558801e-02f,
+  2.18152199e-02f, 2.09901053e-02f, 2.01805625e-02f, 1.93866175e-02f, 1.86082963e-02f,
+  1.78456251e-02f, 1.70986280e-02f, 1.63673293e-02f, 1.56517532e-02f, 1.49519211e-02f,
+  1.42678572e-02f, 1.35995848e-02f, 1.29471235e-02f, 1.23104956e-02f, 1.16897225e-02f,
+  1.10848229e-02f, 1.04958173e-02f, 9.92272422e-03f, 9.36556328e-03f, 8.82435217e-03f,
+  8.29910766e-03f, 7.78984837e-03f, 7.29659013e-03f, 6.81934832e-03f, 6.35813922e-03f,
+  5.91297774e-03f, 5.48387785e-03f, 5.07085398e-03f, 4.67391964e-03f, 4.29308787e-03f,
+  3.92837031e-03f, 3.57977930e-03f, 3.24732601e-03f, 2.93102139e-03f, 2.63087568e-03f,
+  2.34689866e-03f, 2.07909965e-03f, 1.82748714e-03f, 1.59206952e-03f, 1.37285423e-03f,
+  1.16984849e-03f, 9.83058941e-04f, 8.12491635e-04f, 6.58152101e-04f, 5.20045345e-04f,
+  3.98175907e-04f, 2.92547717e-04f, 2.03164192e-04f, 1.30028246e-04f, 7.31422770e-05f,
+  3.25081201e-05f, 8.12709550e-06f,
+};
+
+static const float mel_fbank_44100_1102[358] = {
+  4.64868061e-02f, 6.89154685e-01f, 6.86537802e-01f, 7.95704126e-02f, 3.13462168e-01f,
+  9.20429587e-01f, 4.89006311e-01f, 5.10993659e-01f, 9.13981855e-01f, 3.53700101e-01f,
+  8.60181749e-02f, 6.46299899e-01f, 8.07424068e-01f, 2.74470836e-01f, 1.92575917e-01f,
+  7.25529134e-01f, 7.54205644e-01f, 2.46038169e-01f, 2.45794356e-01f, 7.53961861e-01f,
+  7.49419332e-01f, 2.63835430e-01f, 2.50580698e-01f, 7.36164570e-01f, 7.88806677e-01f,
+  3.23883355e-01f, 2.11193323e-01f, 6.76116645e-01f, 8.68646324e-01f, 4.22698498e-01f,
+  1.31353661e-01f, 5.77301502e-01f, 9.85668242e-01f, 5.57207227e-01f, 1.36985570e-01f,
+  1.43317636e-02f, 4.42792773e-01f, 8.63014400e-01f, 7.24690914e-01f, 3.20030063e-01f,
+  2.75309056e-01f, 6.79969966e-01f, 9.22726333e-01f, 5.32517254e-01f, 1.49153873e-01f,
+  7.72736818e-02f, 4.67482775e-01f, 8.50846112e-01f, 7.72399545e-01f, 4.02029335e-01f,
+  3.78314257e-02f, 2.27600470e-01f, 5.97970665e-01f, 9.62168574e-01f, 6.79604232e-01f,
+  3.27153951e-01f, 3.20395797e-01f, 6.72846079e-01f, 9.80297208e-01f, 6.38860404e-01f,
+  3.02675098e-01f, 1.97027829e-02f, 3.61139596e-01f, 6.97324932e-01f, 9.71584976e-01f,
+  6.45433903e-01f, 3.24079841e-01f, 7.38425320e-03f, 2.84149945e-02f, 3.54566067e-01f,
+  6.75920188e-01f, 9.92615759e-01f, 6.95209861e-01f, 3.87433618e-01f, 8.39312300e-02f,
+  3.04790109e-01f, 6.12566352e-01f, 9.16068792e-01f, 7.84585476e-01f, 4.89285201e-01f,
+  1.97922602e-01f, 2.15414494e-01f, 5.10714829e-01f, 8.02077413e-01f, 9.10392284e-01f,
+  6.26597047e-01f, 3.46437752e-01f, 6.98267817e-02f, 8.96077082e-02f, 3.73402923e-01f,
+  6.53562248e-01f, 9.30173218e-01f, 7.96672285e-01f, 5.26888788e-01f, 2.60397881e-01f,
+  2.03327700e-01f, 4.73111242e-01f, 7.39602089e-01f, 9.97116804e-01f, 7.36968935e-01f,
+  4.79879379e-01f, 2.25781858e-01f, 2.88316770e-03f, 2.63031065e-01f, 5.20120621e-01f,
+  7.74218142e-01f, 9.74603117e-01f, 7.26277232e-01f, 4.80744600e-01f, 2.37938896e-01f,
+  2.53969077e-02f, 2.73722768e-01f, 5.19255400e-01f, 7.62061119e-01f, 9.97800946e-01f,
+  7.60271549e-01f, 5.25298655e-01f, 2.92825460e-01f, 6.27975166e-02f, 2.19906121e-03f,
+  2.39728436e-01f, 4.74701315e-01f, 7.07174540e-01f, 9.37202454e-01f, 8.35167468e-01f,
+  6.09883249e-01f, 3.86895120e-01f, 1.66160494e-01f, 1.64832532e-01f, 3.90116781e-01f,
+  6.13104880e-01f, 8.33839476e-01f, 9.47634399e-01f, 7.31271863e-01f, 5.17027915e-01f,
+  3.04867059e-01f, 9.47442651e-02f, 5.23655899e-02f, 2.68728107e-01f, 4.82972056e-01f,
+  6.95132971e-01f, 9.05255735e-01f, 8.86624098e-01f, 6.80463850e-01f, 4.76232857e-01f,
+  2.73893178e-01f, 7.34069794e-02f, 1.13375925e-01f, 3.19536150e-01f, 5.23767114e-01f,
+  7.26106822e-01f, 9.26593006e-01f, 8.74745846e-01f, 6.77874207e-01f, 4.82761383e-01f,
+  2.89371848e-01f, 9.76795033e-02f, 1.25254169e-01f, 3.22125763e-01f, 5.17238617e-01f,
+  7.10628152e-01f, 9.02320504e-01f, 9.07655776e-01f, 7.19267488e-01f, 5.32491267e-01f,
+  3.47296268e-01f, 1.63658828e-01f, 9.23442170e-02f, 2.80732483e-01f, 4.67508733e-01f,
+  6.52703762e-01f, 8.36341143e-01f, 9.81550634e-01f, 8.00948262e-01f, 6.21827781e-01f,
+  4.44160640e-01f, 2.67925650e-01f, 9.31014791e-02f, 1.84493903e-02f, 1.99051723e-01f,
+  3.78172249e-01f, 5.55839360e-01f, 7.32074320e-01f, 9.06898499e-01f, 9.19666827e-01f,
+  7.47595608e-01f, 5.76871276e-01f, 4.07465458e-01f, 2.39366278e-01f, 7.25500807e-02f,
+  8.03331956e-02f, 2.52404422e-01f, 4.23128724e-01f, 5.92534542e-01f, 7.60633707e-01f,
+  9.27449942e-01f, 9.06995595e-01f, 7.42686152e-01f, 5.79605281e-01f, 4.17731673e-01f,
+  2.57046342e-01f, 9.75374803e-02f, 9.30044279e-02f, 2.57313818e-01f, 4.20394689e-01f,
+  5.82268298e-01f, 7.42953658e-01f, 9.02462542e-01f, 9.39179003e-01f, 7.81961560e-01f,
+  6.25870824e-01f, 4.70883161e-01f, 3.16989094e-01f, 1.64169744e-01f, 1.24132149e-02f,
+  6.08209670e-02f, 2.18038455e-01f, 3.74129206e-01f, 5.29116869e-01f, 6.83010876e-01f,
+  8.35830271e-01f, 9.87586796e-01f, 8.61700594e-01f, 7.12022424e-01f, 5.63359737e-01f,
+  4.15703058e-01f, 2.69040585e-01f, 1.23353370e-01f, 1.38299406e-01f, 2.87977606e-01f,
+  4.36640292e-01f, 5.84296942e-01f, 7.30959415e-01f, 8.76646638e-01f, 9.78629589e-01f,
+  8.34857345e-01f, 6.92024887e-01f, 5.50122738e-01f, 4.09134269e-01f, 2.69050062e-01f,
+  1.29858226e-01f, 2.13704240e-02f, 1.65142626e-01f, 3.07975084e-01f, 4.49877262e-01f,
+  5.90865731e-01f, 7.30949938e-01f, 8.70141745e-01f, 9.91544604e-01f, 8.54104459e-01f,
+  7.17523634e-01f, 5.81787825e-01f, 4.46892321e-01f, 3.12820584e-01f, 1.79572642e-01f,
+  4.71271351e-02f, 8.45537800e-03f, 1.45895526e-01f, 2.82476395e-01f, 4.18212205e-01f,
+  5.53107679e-01f, 6.87179387e-01f, 8.20427358e-01f, 9.52872872e-01f, 9.15479362e-01f,
+  7.84622192e-01f, 6.54543817e-01f, 5.25234759e-01f, 3.96685541e-01f, 2.68889070e-01f,
+  1.41833529e-01f, 1.55141521e-02f, 8.45206454e-02f, 2.15377808e-01f, 3.45456183e-01f,
+  4.74765241e-01f, 6.03314459e-01f, 7.31110930e-01f, 8.58166456e-01f, 9.84485865e-01f,
+  8.89921248e-01f, 7.65045524e-01f, 6.40879929e-01f, 5.17412603e-01f, 3.94641280e-01f,
+  2.72556394e-01f, 1.51148528e-01f, 3.04105561e-02f, 1.10078782e-01f, 2.34954506e-01f,
+  3.59120101e-01f, 4.82587367e-01f, 6.05358720e-01f, 7.27443576e-01f, 8.48851442e-01f,
+  9.69589472e-01f, 9.10337925e-01f, 7.90921092e-01f, 6.72152877e-01f, 5.54026127e-01f,
+  4.36536133e-01f, 3.19673419e-01f, 2.03430921e-01f, 8.78062174e-02f, 8.96620452e-02f,
+  2.09078878e-01f, 3.27847123e-01f, 4.45973873e-01f, 5.63463867e-01f, 6.80326581e-01f,
+  7.96569109e-01f, 9.12193775e-01f, 9.72787499e-01f, 8.58372390e-01f, 7.44551480e-01f,
+  6.31322324e-01f, 5.18675447e-01f, 4.06606168e-01f, 2.95112133e-01f, 1.84181437e-01f,
+  7.38093928e-02f, 2.72124950e-02f, 1.41627595e-01f, 2.55448550e-01f, 3.68677706e-01f,
+  4.81324553e-01f, 5.93393803e-01f, 7.04887867e-01f, 8.15818548e-01f, 9.26190615e-01f,
+  9.63991284e-01f, 8.54727030e-01f, 7.46000171e-01f, 6.37817681e-01f, 5.30165493e-01f,
+  4.23038781e-01f, 3.16437572e-01f, 2.10352391e-01f, 1.04778521e-01f, 3.60087380e-02f,
+  1.45272970e-01f, 2.53999859e-01f, 3.62182289e-01f, 4.69834507e-01f, 5.76961219e-01f,
+  6.83562458e-01f, 7.89647579e-01f, 8.95221472e-01f, 9.99715924e-01f, 8.95154953e-01f,
+  7.91091084e-01f, 6.87519550e-01f, 5.84435642e-01f, 4.81839359e-01f, 3.79716516e-01f,
+  2.78076559e-01f, 1.76900566e-01f, 7.61932731e-02f,
+};
+
+static const float dct_matrix_44100_1102[520] = {
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23434404e-01f, 2.22056851e-01f, 2.19310254e-01f, 2.15211526e-01f, 2.09785953e-01f,
+  2.03066990e-01f, 1.95096031e-01f, 1.85922250e-01f, 1.75602198e-01f, 1.64199501e-01f,
+  1.51784465e-01f, 1.38433620e-01f, 1.24229282e-01f, 1.09259032e-01f, 9.36151594e-02f,
+  7.73941278e-02f, 6.06959276e-02f, 4.36235219e-02f, 2.62821615e-02f, 8.77876114e-03f,
+  -8.77876114e-03f, -2.62821615e-02f, -4.36235219e-02f, -6.06959276e-02f, -7.73941278e-02f,
+  -9.36151594e-02f, -1.09259032e-01f, -1.24229282e-01f, -1.38433620e-01f, -1.51784465e-01f,
+  -1.64199501e-01f, -1.75602198e-01f, -1.85922250e-01f, -1.95096031e-01f, -2.03066990e-01f,
+  -2.09785953e-01f, -2.15211526e-01f, -2.19310254e-01f, -2.22056851e-01f, -2.23434404e-01f,
+  2.22917497e-01f, 2.17428520e-01f, 2.06585735e-01f, 1.90656140e-01f, 1.70031935e-01f,
+  1.45220995e-01f, 1.16834231e-01f, 8.55706185e-02f, 5.21999709e-02f, 1.75439864e-02f,
+  -1.75439864e-02f, -5.21999709e-02f, -8.55706185e-02f, -1.16834231e-01f, -1.45220995e-01f,
+  -1.70031935e-01f, -1.90656140e-01f, -2.06585735e-01f, -2.17428520e-01f, -2.22917497e-01f,
+  -2.22917497e-01f, -2.17428520e-01f, -2.06585735e-01f, -1.90656140e-01f, -1.70031935e-01f,
+  -1.45220995e-01f, -1.16834231e-01f, -8.55706185e-02f, -5.21999709e-02f, -1.75439864e-02f,
+  1.75439864e-02f, 5.21999709e-02f, 8.55706185e-02f, 1.16834231e-01f, 1.45220995e-01f,
+  1.70031935e-01f, 1.90656140e-01f, 2.06585735e-01f, 2.17428520e-01f, 2.22917497e-01f,
+  2.22056851e-01f, 2.09785953e-01f, 1.85922250e-01f, 1.51784465e-01f, 1.09259032e-01f,
+  6.06959276e-02f, 8.77876114e-03f, -4.36235219e-02f, -9.36151594e-02f, -1.38433620e-01f,
+  -1.75602198e-01f, -2.03066990e-01f, -2.19310254e-01f, -2.23434404e-01f, -2.15211526e-01f,
+  -1.95096031e-01f, -1.64199501e-01f, -1.24229282e-01f, -7.73941278e-02f, -2.62821615e-02f,
+  2.62821615e-02f, 7.73941278e-02f, 1.24229282e-01f, 1.64199501e-01f, 1.95096031e-01f,
+  2.15211526e-01f, 2.23434404e-01f, 2.19310254e-01f, 2.03066990e-01f, 1.75602198e-01f,
+  1.38433620e-01f, 9.36151594e-02f, 4.36235219e-02f, -8.77876114e-03f, -6.06959276e-02f,
+  -1.09259032e-01f, -1.51784465e-01f, -1.85922250e-01f, -2.09785953e-01f, -2.22056851e-01f,
+  2.20853820e-01f, 1.99235111e-01f, 1.58113882e-01f, 1.01515360e-01f, 3.49798091e-02f,
+  -3.49798091e-02f, -1.01515360e-01f, -1.58113882e-01f, -1.99235111e-01f, -2.20853820e-01f,
+  -2.20853820e-01f, -1.99235111e-01f, -1.58113882e-01f, -1.01515360e-01f, -3.49798091e-02f,
+  3.49798091e-02f, 1.01515360e-01f, 1.58113882e-01f, 1.99235111e-01f, 2.20853820e-01f,
+  2.20853820e-01f, 1.99235111e-01f, 1.58113882e-01f, 1.01515360e-01f, 3.49798091e-02f,
+  -3.49798091e-02f, -1.01515360e-01f, -1.58113882e-01f, -1.99235111e-01f, -2.20853820e-01f,
+  -2.20853820e-01f, -1.99235111e-01f, -1.58113882e-01f, -1.01515360e-01f, -3.49798091e-02f,
+  3.49798091e-02f, 1.01515360e-01f, 1.58113882e-01f, 1.99235111e-01f, 2.20853820e-01f,
+  2.19310254e-01f, 1.85922250e-01f, 1.24229282e-01f, 4.36235219e-02f, -4.36235219e-02f,
+  -1.24229282e-01f, -1.85922250e-01f, -2.19310254e-01f, -2.19310254e-01f, -1.85922250e-01f,
+  -1.24229282e-01f, -4.36235219e-02f, 4.36235219e-02f, 1.24229282e-01f, 1.85922250e-01f,
+  2.19310254e-01f, 2.19310254e-01f, 1.85922250e-01f, 1.24229282e-01f, 4.36235219e-02f,
+  -4.36235219e-02f, -1.24229282e-01f, -1.85922250e-01f, -2.19310254e-01f, -2.19310254e-01f,
+  -1.85922250e-01f, -1.24229282e-01f, -4.36235219e-02f, 4.36235219e-02f, 1.24229282e-01f,
+  1.85922250e-01f, 2.19310254e-01f, 2.19310254e-01f, 1.85922250e-01f, 1.24229282e-01f,
+  4.36235219e-02f, -4.36235219e-02f, -1.24229282e-01f, -1.85922250e-01f, -2.19310254e-01f,
+  2.17428520e-01f, 1.70031935e-01f, 8.55706185e-02f, -1.75439864e-02f, -1.16834231e-01f,
+  -1.90656140e-01f, -2.22917497e-01f, -2.06585735e-01f, -1.45220995e-01f, -5.21999709e-02f,
+  5.21999709e-02f, 1.45220995e-01f, 2.06585735e-01f, 2.22917497e-01f, 1.90656140e-01f,
+  1.16834231e-01f, 1.75439864e-02f, -8.55706185e-02f, -1.70031935e-01f, -2.17428520e-01f,
+  -2.17428520e-01f, -1.70031935e-01f, -8.55706185e-02f, 1.75439864e-02f, 1.16834231e-01f,
+  1.90656140e-01f, 2.22917497e-01f, 2.06585735e-01f, 1.45220995e-01f, 5.21999709e-02f,
+  -5.21999709e-02f, -1.45220995e-01f, -2.06585735e-01f, -2.22917497e-01f, -1.90656140e-01f,
+  -1.16834231e-01f, -1.75439864e-02f, 8.55706185e-02f, 1.70031935e-01f, 2.17428520e-01f,
+  2.15211526e-01f, 1.51784465e-01f, 4.36235219e-02f, -7.73941278e-02f, -1.75602198e-01f,
+  -2.22056851e-01f, -2.03066990e-01f, -1.24229282e-01f, -8.77876114e-03f, 1.09259032e-01f,
+  1.95096031e-01f, 2.23434404e-01f, 1.85922250e-01f, 9.36151594e-02f, -2.62821615e-02f,
+  -1.38433620e-01f, -2.09785953e-01f, -2.19310254e-01f, -1.64199501e-01f, -6.06959276e-02f,
+  6.06959276e-02f, 1.64199501e-01f, 2.19310254e-01f, 2.09785953e-01f, 1.38433620e-01f,
+  2.62821615e-02f, -9.36151594e-02f, -1.85922250e-01f, -2.23434404e-01f, -1.95096031e-01f,
+  -1.09259032e-01f, 8.77876114e-03f, 1.24229282e-01f, 2.03066990e-01f, 2.22056851e-01f,
+  1.75602198e-01f, 7.73941278e-02f, -4.36235219e-02f, -1.51784465e-01f, -2.15211526e-01f,
+  2.12662697e-01f, 1.31432772e-01f, 1.36919675e-17f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -4.10759032e-17f, 1.31432772e-01f, 2.12662697e-01f,
+  2.12662697e-01f, 1.31432772e-01f, 6.84598365e-17f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -9.58437698e-17f, 1.31432772e-01f, 2.12662697e-01f,
+  2.12662697e-01f, 1.31432772e-01f, 1.23227703e-16f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -5.47817076e-16f, 1.31432772e-01f, 2.12662697e-01f,
+  2.12662697e-01f, 1.31432772e-01f, -2.19209890e-16f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -6.02584956e-16f, 1.31432772e-01f, 2.12662697e-01f,
+  2.09785953e-01f, 1.09259032e-01f, -4.36235219e-02f, -1.75602198e-01f, -2.23434404e-01f,
+  -1.64199501e-01f, -2.62821615e-02f, 1.24229282e-01f, 2.15211526e-01f, 2.03066990e-01f,
+  9.36151594e-02f, -6.06959276e-02f, -1.85922250e-01f, -2.22056851e-01f, -1.51784465e-01f,
+  -8.77876114e-03f, 1.38433620e-01f, 2.19310254e-01f, 1.95096031e-01f, 7.73941278e-02f,
+  -7.73941278e-02f, -1.95096031e-01f, -2.19310254e-01f, -1.38433620e-01f, 8.77876114e-03f,
+  1.51784465e-01f, 2.22056851e-01f, 1.85922250e-01f, 6.06959276e-02f, -9.36151594e-02f,
+  -2.03066990e-01f, -2.15211526e-01f, -1.24229282e-01f, 2.62821615e-02f, 1.64199501e-01f,
+  2.23434404e-01f, 1.75602198e-01f, 4.36235219e-02f, -1.09259032e-01f, -2.09785953e-01f,
+  2.06585735e-01f, 8.55706185e-02f, -8.55706185e-02f, -2.06585735e-01f, -2.06585735e-01f,
+  -8.55706185e-02f, 8.55706185e-02f, 2.06585735e-01f, 2.06585735e-01f, 8.55706185e-02f,
+  -8.55706185e-02f, -2.06585735e-01f, -2.06585735e-01f, -8.55706185e-02f, 8.55706185e-02f,
+  2.06585735e-01f, 2.06585735e-01f, 8.55706185e-02f, -8.55706185e-02f, -2.06585735e-01f,
+  -2.06585735e-01f, -8.55706185e-02f, 8.55706185e-02f, 2.06585735e-01f, 2.06585735e-01f,
+  8.55706185e-02f, -8.55706185e-02f, -2.06585735e-01f, -2.06585735e-01f, -8.55706185e-02f,
+  8.55706185e-02f, 2.06585735e-01f, 2.06585735e-01f, 8.55706185e-02f, -8.55706185e-02f,
+  -2.06585735e-01f, -2.06585735e-01f, -8.55706185e-02f, 8.55706185e-02f, 2.06585735e-01f,
+  2.03066990e-01f, 6.06959276e-02f, -1.24229282e-01f, -2.22056851e-01f, -1.64199501e-01f,
+  8.77876114e-03f, 1.75602198e-01f, 2.19310254e-01f, 1.09259032e-01f, -7.73941278e-02f,
+  -2.09785953e-01f, -1.95096031e-01f, -4.36235219e-02f, 1.38433620e-01f, 2.23434404e-01f,
+  1.51784465e-01f, -2.62821615e-02f, -1.85922250e-01f, -2.15211526e-01f, -9.36151594e-02f,
+  9.36151594e-02f, 2.15211526e-01f, 1.85922250e-01f, 2.62821615e-02f, -1.51784465e-01f,
+  -2.23434404e-01f, -1.38433620e-01f, 4.36235219e-02f, 1.95096031e-01f, 2.09785953e-01f,
+  7.73941278e-02f, -1.09259032e-01f, -2.19310254e-01f, -1.75602198e-01f, -8.77876114e-03f,
+  1.64199501e-01f, 2.22056851e-01f, 1.24229282e-01f, -6.06959276e-02f, -2.03066990e-01f,
+  1.99235111e-01f, 3.49798091e-02f, -1.58113882e-01f, -2.20853820e-01f, -1.01515360e-01f,
+  1.01515360e-01f, 2.20853820e-01f, 1.58113882e-01f, -3.49798091e-02f, -1.99235111e-01f,
+  -1.99235111e-01f, -3.49798091e-02f, 1.58113882e-01f, 2.20853820e-01f, 1.01515360e-01f,
+  -1.01515360e-01f, -2.20853820e-01f, -1.58113882e-01f, 3.49798091e-02f, 1.99235111e-01f,
+  1.99235111e-01f, 3.49798091e-02f, -1.58113882e-01f, -2.20853820e-01f, -1.01515360e-01f,
+  1.01515360e-01f, 2.20853820e-01f, 1.58113882e-01f, -3.49798091e-02f, -1.99235111e-01f,
+  -1.99235111e-01f, -3.49798091e-02f, 1.58113882e-01f, 2.20853820e-01f, 1.01515360e-01f,
+  -1.01515360e-01f, -2.20853820e-01f, -1.58113882e-01f, 3.49798091e-02f, 1.99235111e-01f,
+};
+
+static const q15_t window_func_q15_44100_1102[1102] = {
+  0, 0, 1, 2, 4, 7, 10, 13, 17, 22,
+  27, 32, 38, 45, 52, 60, 68, 77, 86, 96,
+  106, 117, 129, 141, 153, 166, 180, 194, 208, 223,
+  239, 255, 272, 289, 307, 325, 344, 363, 383, 403,
+  424, 446, 468, 490, 513, 536, 560, 585, 610, 635,
+  661, 688, 715, 742, 770, 799, 828, 858, 888, 918,
+  949, 981, 1013, 1046, 1079, 1112, 1146, 1181, 1216, 1252,
+  1288, 1324, 1361, 1399, 1437, 1475, 1514, 1554, 1594, 1634,
+  1675, 1716, 1758, 1801, 1843, 1887, 1930, 1975, 2019, 2065,
+  2110, 2156, 2203, 2250, 2297, 2345, 2394, 2442, 2492, 2542,
+  2592, 2642, 2693, 2745, 2797, 2849, 2902, 2956, 3009, 3063,
+  3118, 3173, 3229, 3284, 3341, 3398, 3455, 3512, 3570, 3629,
+  3688, 3747, 3806, 3867, 3927, 3988, 4049, 4111, 4173, 4235,
+  4298, 4362, 4425, 4489, 4554, 4619, 4684, 4749, 4815, 4882,
+  4948, 5015, 5083, 5151, 5219, 5287, 5356, 5426, 5495, 5565,
+  5636, 5706, 5777, 5849, 5920, 5992, 6065, 6137, 6211, 6284,
+  6358, 6432, 6506, 6581, 6656, 6731, 6807, 6883, 6959, 7035,
+  7112, 7190, 7267, 7345, 7423, 7501, 7580, 7659, 7738, 7817,
+  7897, 7977, 8058, 8138, 8219, 8300, 8381, 8463, 8545, 8627,
+  8710, 8792, 8875, 8958, 9042, 9125, 9209, 9293, 9378, 9462,
+  9547, 9632, 9717, 9803, 9888, 9974, 10060, 10146, 10233, 10320,
+  10407, 10494, 10581, 10668, 10756, 10844, 10932, 11020, 11108, 11197,
+  11286, 11374, 11463, 11553, 11642, 11731, 11821, 11911, 12001, 12091,
+  12181, 12271, 12362, 12453, 12543, 12634, 12725, 12816, 12908, 12999,
+  13090, 13182, 13274, 13365, 13457, 13549, 13641, 13733, 13826, 13918,
+  14010, 14103, 14195, 14288, 14381, 14473, 14566, 14659, 14752, 14845,
+  14938, 15031, 15124, 15217, 15310, 15404, 15497, 15590, 15684, 15777,
+  15870, 15964, 16057, 16150, 16244, 16337, 16431, 16524, 16618, 16711,
+  16804, 16898, 16991, 17084, 17178, 17271, 17364, 17458, 17551, 17644,
+  17737, 17830, 17923, 18016, 18109, 18202, 18295, 18387, 18480, 18573,
+  18665, 18758, 18850, 18942, 19035, 19127, 19219, 19311, 19403, 19494,
+  19586, 19678, 19769, 19860, 19952, 20043, 20134, 20225, 20315, 20406,
+  20497, 20587, 20677, 20767, 20857, 20947, 21037, 21126, 21215, 21305,
+  21394, 21482, 21571, 21660, 21748, 21836, 21924, 22012, 22100, 22187,
+  22274, 22361, 22448, 22535, 22622, 22708, 22794, 22880, 22965, 23051,
+  23136, 23221, 23306, 23390, 23475, 23559, 23643, 23726, 23810, 23893,
+  23976, 24058, 24141, 24223, 24305, 24387, 24468, 24549, 24630, 24710,
+  24791, 24871, 24951, 25030, 25109, 25188, 25267, 25345, 25423, 25501,
+  25578, 25656, 25733, 25809, 25885, 25961, 26037, 26112, 26187, 26262,
+  26336, 26410, 26484, 26557, 26631, 26703, 26776, 26848, 26919, 26991,
+  27062, 27132, 27203, 27273, 27342, 27412, 27481, 27549, 27617, 27685,
+  27753, 27820, 27886, 27953, 28019, 28084, 28149, 28214, 28279, 28343,
+  28406, 28470, 28533, 28595, 28657, 28719, 28780, 28841, 28901, 28962,
+  29021, 29080, 29139, 29198, 29256, 29313, 29370, 29427, 29484, 29539,
+  29595, 29650, 29705, 29759, 29812, 29866, 29919, 29971, 30023, 30075,
+  30126, 30176, 30226, 30276, 30326, 30374, 30423, 30471, 30518, 30565,
+  30612, 30658, 30703, 30749, 30793, 30838, 30881, 30925, 30967, 31010,
+  31052, 31093, 31134, 31174, 31214, 31254, 31293, 31331, 31369, 31407,
+  31444, 31480, 31516, 31552, 31587, 31622, 31656, 31689, 31722, 31755,
+  31787, 31819, 31850, 31880, 31910, 31940, 31969, 31998, 32026, 32053,
+  32080, 32107, 32133, 32158, 32183, 32208, 32232, 32255, 32278, 32300,
+  32322, 32344, 32365, 32385, 32405, 32424, 32443, 32461, 32479, 32496,
+  32513, 32529, 32545, 32560, 32574, 32588, 32602, 32615, 32627, 32639,
+  32651, 32662, 32672, 32682, 32691, 32700, 32708, 32716, 32723, 32730,
+  32736, 32741, 32746, 32751, 32755, 32758, 32761, 32764, 32766, 32767,
+  32767, 32767, 32767, 32767, 32766, 32764, 32761, 32758, 32755, 32751,
+  32746, 32741, 32736, 32730, 32723, 32716, 32708, 32700, 32691, 32682,
+  32672, 32662, 32651, 32639, 32627, 32615, 32602, 32588, 32574, 32560,
+  32545, 32529, 32513, 32496, 32479, 32461, 32443, 32424, 32405, 32385,
+  32365, 32344, 32322, 32300, 32278, 32255, 32232, 32208, 32183, 32158,
+  32133, 32107, 32080, 32053, 32026, 31998, 31969, 31940, 31910, 31880,
+  31850, 31819, 31787, 31755, 31722, 31689, 31656, 31622, 31587, 31552,
+  31516, 31480, 31444, 31407, 31369, 31331, 31293, 31254, 31214, 31174,
+  31134, 31093, 31052, 31010, 30967, 30925, 30881, 30838, 30793, 30749,
+  30703, 30658, 30612, 30565, 30518, 30471, 30423, 30374, 30326, 30276,
+  30226, 30176, 30126, 30075, 30023, 29971, 29919, 29866, 29812, 29759,
+  29705, 29650, 29595, 29539, 29484, 29427, 29370, 29313, 29256, 29198,
+  29139, 29080, 29021, 28962, 28901, 28841, 28780, 28719, 28657, 28595,
+  28533, 28470, 28406, 28343, 28279, 28214, 28149, 28084, 28019, 27953,
+  27886, 27820, 27753, 27685, 27617, 27549, 27481, 27412, 27342, 27273,
+  27203, 27132, 27062, 26991, 26919, 26848, 26776, 26703, 26631, 26557,
+  26484, 26410, 26336, 26262, 26187, 26112, 26037, 25961, 25885, 25809,
+  25733, 25656, 25578, 25501, 25423, 25345, 25267, 25188, 25109, 25030,
+  24951, 24871, 24791, 24710, 24630, 24549, 24468, 24387, 24305, 24223,
+  24141, 24058, 23976, 23893, 23810, 23726, 23643, 23559, 23475, 23390,
+  23306, 23221, 23136, 23051, 22965, 22880, 22794, 22708, 22622, 22535,
+  22448, 22361, 22274, 22187, 22100, 22012, 21924, 21836, 21748, 21660,
+  21571, 21482, 21394, 21305, 21215, 21126, 21037, 20947, 20857, 20767,
+  20677, 20587, 20497, 20406, 20315, 20225, 20134, 20043, 19952, 19860,
+  19769, 19678, 19586, 19494, 19403, 19311, 19219, 19127, 19035, 18942,
+  18850, 18758, 18665, 18573, 18480, 18387, 18295, 18202, 18109, 18016,
+  17923, 17830, 17737, 17644, 17551, 17458, 17364, 17271, 17178, 17084,
+  16991, 16898, 16804, 16711, 16618, 16524, 16431, 16337, 16244, 16150,
+  16057, 15964, 15870, 15777, 15684, 15590, 15497, 15404, 15310, 15217,
+  15124, 15031, 14938, 14845, 14752, 14659, 14566, 14473, 14381, 14288,
+  14195, 14103, 14010, 13918, 13826, 13733, 13641, 13549, 13457, 13365,
+  13274, 13182, 13090, 12999, 12908, 12816, 12725, 12634, 12543, 12453,
+  12362, 12271, 12181, 12091, 12001, 11911, 11821, 11731, 11642, 11553,
+  11463, 11374, 11286, 11197, 11108, 11020, 10932, 10844, 10756, 10668,
+  10581, 10494, 10407, 10320, 10233, 10146, 10060, 9974, 9888, 9803,
+  9717, 9632, 9547, 9462, 9378, 9293, 9209, 9125, 9042, 8958,
+  8875, 8792, 8710, 8627, 8545, 8463, 8381, 8300, 8219, 8138,
+  8058, 7977, 7897, 7817, 7738, 7659, 7580, 7501, 7423, 7345,
+  7267, 7190, 7112, 7035, 6959, 6883, 6807, 6731, 6656, 6581,
+  6506, 6432, 6358, 6284, 6211, 6137, 6065, 5992, 5920, 5849,
+  5777, 5706, 5636, 5565, 5495, 5426, 5356, 5287, 5219, 5151,
+  5083, 5015, 4948, 4882, 4815, 4749, 4684, 4619, 4554, 4489,
+  4425, 4362, 4298, 4235, 4173, 4111, 4049, 3988, 3927, 3867,
+  3806, 3747, 3688, 3629, 3570, 3512, 3455, 3398, 3341, 3284,
+  3229, 3173, 3118, 3063, 3009, 2956, 2902, 2849, 2797, 2745,
+  2693, 2642, 2592, 2542, 2492, 2442, 2394, 2345, 2297, 2250,
+  2203, 2156, 2110, 2065, 2019, 1975, 1930, 1887, 1843, 1801,
+  1758, 1716, 1675, 1634, 1594, 1554, 1514, 1475, 1437, 1399,
+  1361, 1324, 1288, 1252, 1216, 1181, 1146, 1112, 1079, 1046,
+  1013, 981, 949, 918, 888, 858, 828, 799, 770, 742,
+  715, 688, 661, 635, 610, 585, 560, 536, 513, 490,
+  468, 446, 424, 403, 383, 363, 344, 325, 307, 289,
+  272, 255, 239, 223, 208, 194, 180, 166, 153, 141,
+  129, 117, 106, 96, 86, 77, 68, 60, 52, 45,
+  38, 32, 27, 22, 17, 13, 10, 7, 4, 2,
+  1, 0,
+};
+
+static const q15_t mel_fbank_q15_44100_1102[358] = {
+  1523, 22582, 22496, 2607, 10272, 30161, 16024, 16744, 29949, 11590,
+  2819, 21178, 26458, 8994, 6310, 23774, 24714, 8062, 8054, 24706,
+  24557, 8645, 8211, 24123, 25848, 10613, 6920, 22155, 28464, 13851,
+  4304, 18917, 32298, 18259, 4489, 470, 14509, 28279, 23747, 10487,
+  9021, 22281, 30236, 17450, 4887, 2532, 15318, 27881, 25310, 13174,
+  1240, 7458, 19594, 31528, 22269, 10720, 10499, 22048, 32122, 20934,
+  9918, 646, 11834, 22850, 31837, 21150, 10619, 242, 931, 11618,
+  22149, 32526, 22781, 12695, 2750, 9987, 20073, 30018, 25709, 16033,
+  6486, 7059, 16735, 26282, 29832, 20532, 11352, 2288, 2936, 12236,
+  21416, 30480, 26105, 17265, 8533, 6663, 15503, 24235, 32674, 24149,
+  15725, 7398, 94, 8619, 17043, 25370, 31936, 23799, 15753, 7797,
+  832, 8969, 17015, 24971, 32696, 24913, 17213, 9595, 2058, 72,
+  7855, 15555, 23173, 30710, 27367, 19985, 12678, 5445, 5401, 12783,
+  20090, 27323, 31052, 23962, 16942, 9990, 3105, 1716, 8806, 15826,
+  22778, 29663, 29053, 22297, 15605, 8975, 2405, 3715, 10471, 17163,
+  23793, 30363, 28664, 22213, 15819, 9482, 3201, 4104, 10555, 16949,
+  23286, 29567, 29742, 23569, 17449, 11380, 5363, 3026, 9199, 15319,
+  21388, 27405, 32163, 26245, 20376, 14554, 8779, 3051, 605, 6523,
+  12392, 18214, 23989, 29717, 30136, 24497, 18903, 13352, 7844, 2377,
+  2632, 8271, 13865, 19416, 24924, 30391, 29720, 24336, 18993, 13688,
+  8423, 3196, 3048, 8432, 13775, 19080, 24345, 29572, 30775, 25623,
+  20509, 15430, 10387, 5380, 407, 1993, 7145, 12259, 17338, 22381,
+  27388, 32361, 28236, 23332, 18460, 13622, 8816, 4042, 4532, 9436,
+  14308, 19146, 23952, 28726, 32068, 27357, 22676, 18026, 13407, 8816,
+  4255, 700, 5411, 10092, 14742, 19361, 23952, 28513, 32491, 27987,
+  23512, 19064, 14644, 10251, 5884, 1544, 277, 4781, 9256, 13704,
+  18124, 22517, 26884, 31224, 29998, 25711, 21448, 17211, 12999, 8811,
+  4648, 508, 2770, 7058, 11320, 15557, 19769, 23957, 28120, 32260,
+  29161, 25069, 21000, 16955, 12932, 8931, 4953, 996, 3607, 7699,
+  11768, 15813, 19836, 23837, 27815, 31772, 29830, 25917, 22025, 18154,
+  14304, 10475, 6666, 2877, 2938, 6851, 10743, 14614, 18464, 22293,
+  26102, 29891, 31876, 28127, 24397, 20687, 16996, 13324, 9670, 6035,
+  2419, 892, 4641, 8371, 12081, 15772, 19444, 23098, 26733, 30349,
+  31588, 28008, 24445, 20900, 17372, 13862, 10369, 6893, 3433, 1180,
+  4760, 8323, 11868, 15396, 18906, 22399, 25875, 29335, 32759, 29332,
+  25922, 22529, 19151, 15789, 12443, 9112, 5797, 2497,
+};
+
+static const q15_t dct_matrix_q15_44100_1102[520] = {
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7321, 7276, 7186, 7052, 6874, 6654, 6393, 6092, 5754, 5380,
+  4974, 4536, 4071, 3580, 3068, 2536, 1989, 1429, 861, 288,
+  -288, -861, -1429, -1989, -2536, -3068, -3580, -4071, -4536, -4974,
+  -5380, -5754, -6092, -6393, -6654, -6874, -7052, -7186, -7276, -7321,
+  7305, 7125, 6769, 6247, 5572, 4759, 3828, 2804, 1710, 575,
+  -575, -1710, -2804, -3828, -4759, -5572, -6247, -6769, -7125, -7305,
+  -7305, -7125, -6769, -6247, -5572, -4759, -3828, -2804, -1710, -575,
+  575, 1710, 2804, 3828, 4759, 5572, 6247, 6769, 7125, 7305,
+  7276, 6874, 6092, 4974, 3580, 1989, 288, -1429, -3068, -4536,
+  -5754, -6654, -7186, -7321, -7052, -6393, -5380, -4071, -2536, -861,
+  861, 2536, 4071, 5380, 6393, 7052, 7321, 7186, 6654, 5754,
+  4536, 3068, 1429, -288, -1989, -3580, -4974, -6092, -6874, -7276,
+  7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181, -6529, -7237,
+  -7237, -6529, -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+  7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181, -6529, -7237,
+  -7237, -6529, -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+  7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186, -7186, -6092,
+  -4071, -1429, 1429, 4071, 6092, 7186, 7186, 6092, 4071, 1429,
+  -1429, -4071, -6092, -7186, -7186, -6092, -4071, -1429, 1429, 4071,
+  6092, 7186, 7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186,
+  7125, 5572, 2804, -575, -3828, -6247, -7305, -6769, -4759, -1710,
+  1710, 4759, 6769, 7305, 6247, 3828, 575, -2804, -5572, -7125,
+  -7125, -5572, -2804, 575, 3828, 6247, 7305, 6769, 4759, 1710,
+  -1710, -4759, -6769, -7305, -6247, -3828, -575, 2804, 5572, 7125,
+  7052, 4974, 1429, -2536, -5754, -7276, -6654, -4071, -288, 3580,
+  6393, 7321, 6092, 3068, -861, -4536, -6874, -7186, -5380, -1989,
+  1989, 5380, 7186, 6874, 4536, 861, -3068, -6092, -7321, -6393,
+  -3580, 288, 4071, 6654, 7276, 5754, 2536, -1429, -4974, -7052,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6874, 3580, -1429, -5754, -7321, -5380, -861, 4071, 7052, 6654,
+  3068, -1989, -6092, -7276, -4974, -288, 4536, 7186, 6393, 2536,
+  -2536, -6393, -7186, -4536, 288, 4974, 7276, 6092, 1989, -3068,
+  -6654, -7052, -4071, 861, 5380, 7321, 5754, 1429, -3580, -6874,
+  6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769, 6769, 2804,
+  -2804, -6769, -6769, -2804, 2804, 6769, 6769, 2804, -2804, -6769,
+  -6769, -2804, 2804, 6769, 6769, 2804, -2804, -6769, -6769, -2804,
+  2804, 6769, 6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+  6654, 1989, -4071, -7276, -5380, 288, 5754, 7186, 3580, -2536,
+  -6874, -6393, -1429, 4536, 7321, 4974, -861, -6092, -7052, -3068,
+  3068, 7052, 6092, 861, -4974, -7321, -4536, 1429, 6393, 6874,
+  2536, -3580, -7186, -5754, -288, 5380, 7276, 4071, -1989, -6654,
+  6529, 1146, -5181, -7237, -3326, 3326, 7237, 5181, -1146, -6529,
+  -6529, -1146, 5181, 7237, 3326, -3326, -7237, -5181, 1146, 6529,
+  6529, 1146, -5181, -7237, -3326, 3326, 7237, 5181, -1146, -6529,
+  -6529, -1146, 5181, 7237, 3326, -3326, -7237, -5181, 1146, 6529,
+};
+
+static const MFCC_Tables tables_44100_1102 = {
+  44100, 1102, 40, 13, 20, 4000,
+  fbank_filter_first_44100_1102, fbank_weight_offset_44100_1102,
+  window_func_44100_1102, mel_fbank_44100_1102, dct_matrix_44100_1102,
+  window_func_q15_44100_1102, mel_fbank_q15_44100_1102, dct_matrix_q15_44100_1102
+};
+
+/* 16000 Hz, 400 sample frame, 40 mel bins (20-4000 Hz), 13 coefficients */
+
+static const int32_t fbank_filter_first_16000_400[40] = {
+  1, 2, 3, 5, 6, 7, 8, 10, 11, 13,
+  15, 16, 18, 20, 22, 24, 26, 28, 31, 33,
+  36, 38, 41, 44, 47, 50, 54, 57, 61, 65,
+  69, 73, 78, 82, 87, 92, 98, 103, 109, 115,
+};
+
+static const int32_t fbank_weight_offset_16000_400[41] = {
+  0, 2, 5, 8, 10, 12, 15, 18, 21, 25,
+  28, 31, 35, 39, 43, 47, 51, 56, 61, 66,
+  71, 76, 82, 88, 94, 101, 108, 115, 123, 131,
+  139, 148, 157, 166, 176, 187, 198, 209, 221, 234,
+  247,
+};
+
+static const float window_func_16000_400[400] = {
+  0.00000000e+00f, 6.16837569e-05f, 2.46719806e-04f, 5.55062492e-04f, 9.86635801e-04f,
+  1.54133316e-03f, 2.21901760e-03f, 3.01952218e-03f, 3.94264935e-03f, 4.98817116e-03f,
+  6.15582988e-03f, 7.44533679e-03f, 8.85637477e-03f, 1.03885951e-02f, 1.20416190e-02f,
+  1.38150398e-02f, 1.57084186e-02f, 1.77212916e-02f, 1.98531579e-02f, 2.21034922e-02f,
+  2.44717412e-02f, 2.69573200e-02f, 2.95596160e-02f, 3.22779864e-02f, 3.51117589e-02f,
+  3.80602330e-02f, 4.11226861e-02f, 4.42983620e-02f, 4.75864746e-02f, 5.09862117e-02f,
+  5.44967391e-02f, 5.81171848e-02f, 6.18466586e-02f, 6.56842440e-02f, 6.96289837e-02f,
+  7.36799166e-02f, 7.78360367e-02f, 8.20963159e-02f, 8.64597112e-02f, 9.09251422e-02f,
+  9.54915062e-02f, 1.00157671e-01f, 1.04922496e-01f, 1.09784797e-01f, 1.14743382e-01f,
+  1.19797014e-01f, 1.24944463e-01f, 1.30184457e-01f, 1.35515690e-01f, 1.40936852e-01f,
+  1.46446615e-01f, 1.52043596e-01f, 1.57726452e-01f, 1.63493738e-01f, 1.69344068e-01f,
+  1.75275981e-01f, 1.81288004e-01f, 1.87378675e-01f, 1.93546474e-01f, 1.99789882e-01f,
+  2.06107378e-01f, 2.12497368e-01f, 2.18958318e-01f, 2.25488588e-01f, 2.32086599e-01f,
+  2.38750711e-01f, 2.45479286e-01f, 2.52270669e-01f, 2.59123176e-01f, 2.66035080e-01f,
+  2.73004740e-01f, 2.80030429e-01f, 2.87110358e-01f, 2.94242829e-01f, 3.01426053e-01f,
+  3.08658272e-01f, 3.15937728e-01f, 3.23262572e-01f, 3.30631047e-01f, 3.38041306e-01f,
+  3.45491499e-01f, 3.52979839e-01f, 3.60504448e-01f, 3.68063480e-01f, 3.75655055e-01f,
+  3.83277327e-01f, 3.90928388e-01f, 3.98606360e-01f, 4.06309336e-01f, 4.14035439e-01f,
+  4.21782762e-01f, 4.29549396e-01f, 4.37333375e-01f, 4.45132852e-01f, 4.52945858e-01f,
+  4.60770458e-01f, 4.68604743e-01f, 4.76446778e-01f, 4.84294623e-01f, 4.92146343e-01f,
+  5.00000000e-01f, 5.07853687e-01f, 5.15705407e-01f, 5.23553252e-01f, 5.31395257e-01f,
+  5.39229572e-01f, 5.47054172e-01f, 5.54867148e-01f, 5.62666595e-01f, 5.70450604e-01f,
+  5.78217208e-01f, 5.85964561e-01f, 5.93690634e-01f, 6.01393640e-01f, 6.09071612e-01f,
+  6.16722703e-01f, 6.24344945e-01f, 6.31936550e-01f, 6.39495552e-01f, 6.47020161e-01f,
+  6.54508471e-01f, 6.61958694e-01f, 6.69368982e-01f, 6.76737428e-01f, 6.84062302e-01f,
+  6.91341698e-01f, 6.98573947e-01f, 7.05757201e-01f, 7.12889671e-01f, 7.19969571e-01f,
+  7.26995230e-01f, 7.33964920e-01f, 7.40876853e-01f, 7.47729361e-01f, 7.54520714e-01f,
+  7.61249304e-01f, 7.67913401e-01f, 7.74511397e-01f, 7.81041682e-01f, 7.87502646e-01f,
+  7.93892622e-01f, 8.00210118e-01f, 8.06453526e-01f, 8.12621355e-01f, 8.18711996e-01f,
+  8.24724019e-01f, 8.30655932e-01f, 8.36506248e-01f, 8.42273533e-01f, 8.47956419e-01f,
+  8.53553414e-01f, 8.59063148e-01f, 8.64484310e-01f, 8.69815528e-01f, 8.75055552e-01f,
+  8.80203009e-01f, 8.85256648e-01f, 8.90215218e-01f, 8.95077527e-01f, 8.99842322e-01f,
+  9.04508471e-01f, 9.09074843e-01f, 9.13540304e-01f, 9.17903662e-01f, 9.22163963e-01f,
+  9.26320076e-01f, 9.30370986e-01f, 9.34315741e-01f, 9.38153327e-01f, 9.41882789e-01f,
+  9.45503235e-01f, 9.49013770e-01f, 9.52413499e-01f, 9.55701649e-01f, 9.58877325e-01f,
+  9.61939752e-01f, 9.64888215e-01f, 9.67721999e-01f, 9.70440388e-01f, 9.73042667e-01f,
+  9.75528240e-01f, 9.77896512e-01f, 9.80146825e-01f, 9.82278705e-01f, 9.84291553e-01f,
+  9.86184955e-01f, 9.87958372e-01f, 9.89611387e-01f, 9.91143644e-01f, 9.92554665e-01f,
+  9.93844151e-01f, 9.95011806e-01f, 9.96057332e-01f, 9.96980488e-01f, 9.97780979e-01f,
+  9.98458683e-01f, 9.99013364e-01f, 9.99444962e-01f, 9.99753296e-01f, 9.99938309e-01f,
+  1.00000000e+00f, 9.99938309e-01f, 9.99753296e-01f, 9.99444962e-01f, 9.99013364e-01f,
+  9.98458683e-01f, 9.97780979e-01f, 9.96980488e-01f, 9.96057332e-01f, 9.95011806e-01f,
+  9.93844151e-01f, 9.92554665e-01f, 9.91143644e-01f, 9.89611387e-01f, 9.87958372e-01f,
+  9.86184955e-01f, 9.84291553e-01f, 9.82278705e-01f, 9.80146825e-01f, 9.77896512e-01f,
+  9.75528240e-01f, 9.73042667e-01f, 9.70440388e-01f, 9.67721999e-01f, 9.64888215e-01f,
+  9.61939752e-01f, 9.58877325e-01f, 9.55701649e-01f, 9.52413499e-01f, 9.49013770e-01f,
+  9.45503235e-01f, 9.41882789e-01f, 9.38153327e-01f, 9.34315741e-01f, 9.30370986e-01f,
+  9.26320076e-01f, 9.22163963e-01f, 9.17903662e-01f, 9.13540304e-01f, 9.09074843e-01f,
+  9.04508471e-01f, 8.99842322e-01f, 8.95077527e-01f, 8.90215218e-01f, 8.85256648e-01f,
+  8.80203009e-01f, 8.75055552e-01f, 8.69815528e-01f, 8.64484310e-01f, 8.59063148e-01f,
+  8.53553414e-01f, 8.47956419e-01f, 8.42273533e-01f, 8.36506248e-01f, 8.30655932e-01f,
+  8.24724019e-01f, 8.18711996e-01f, 8.12621355e-01f, 8.06453526e-01f, 8.00210118e-01f,
+  7.93892622e-01f, 7.87502646e-01f, 7.81041682e-01f, 7.74511397e-01f, 7.67913401e-01f,
+  7.61249304e-01f, 7.54520714e-01f, 7.47729361e-01f, 7.40876853e-01f, 7.33964920e-01f,
+  7.26995230e-01f, 7.19969571e-01f, 7.12889671e-01f, 7.05757201e-01f, 6.98573947e-01f,
+  6.91341698e-01f, 6.84062302e-01f, 6.76737428e-01f, 6.69368982e-01f, 6.61958694e-01f,
+  6.54508471e-01f, 6.47020161e-01f, 6.39495552e-01f, 6.31936550e-01f, 6.24344945e-01f,
+  6.16722703e-01f, 6.09071612e-01f, 6.01393640e-01f, 5.93690634e-01f, 5.85964561e-01f,
+  5.78217208e-01f, 5.70450604e-01f, 5.62666595e-01f, 5.54867148e-01f, 5.47054172e-01f,
+  5.39229572e-01f, 5.31395257e-01f, 5.23553252e-01f, 5.15705407e-01f, 5.07853687e-01f,
+  5.00000000e-01f, 4.92146343e-01f, 4.84294623e-01f, 4.76446778e-01f, 4.68604743e-01f,
+  4.60770458e-01f, 4.52945858e-01f, 4.45132852e-01f, 4.37333375e-01f, 4.29549396e-01f,
+  4.21782762e-01f, 4.14035439e-01f, 4.06309336e-01f, 3.98606360e-01f, 3.90928388e-01f,
+  3.83277327e-01f, 3.75655055e-01f, 3.68063480e-01f, 3.60504448e-01f, 3.52979839e-01f,
+  3.45491499e-01f, 3.38041306e-01f, 3.30631047e-01f, 3.23262572e-01f, 3.15937728e-01f,
+  3.08658272e-01f, 3.01426053e-01f, 2.94242829e-01f, 2.87110358e-01f, 2.80030429e-01f,
+  2.73004740e-01f, 2.66035080e-01f, 2.59123176e-01f, 2.52270669e-01f, 2.45479286e-01f,
+  2.38750711e-01f, 2.32086599e-01f, 2.25488588e-01f, 2.18958318e-01f, 2.12497368e-01f,
+  2.06107378e-01f, 1.99789882e-01f, 1.93546474e-01f, 1.87378675e-01f, 1.81288004e-01f,
+  1.75275981e-01f, 1.69344068e-01f, 1.63493738e-01f, 1.57726452e-01f, 1.52043596e-01f,
+  1.46446615e-01f, 1.40936852e-01f, 1.35515690e-01f, 1.30184457e-01f, 1.24944463e-01f,
+  1.19797014e-01f, 1.14743382e-01f, 1.09784797e-01f, 1.04922496e-01f, 1.00157671e-01f,
+  9.54915062e-02f, 9.09251422e-02f, 8.64597112e-02f, 8.20963159e-02f, 7.78360367e-02f,
+  7.36799166e-02f, 6.96289837e-02f, 6.56842440e-02f, 6.18466586e-02f, 5.81171848e-02f,
+  5.44967391e-02f, 5.09862117e-02f, 4.75864746e-02f, 4.42983620e-02f, 4.11226861e-02f,
+  3.80602330e-02f, 3.51117589e-02f, 3.22779864e-02f, 2.95596160e-02f, 2.69573200e-02f,
+  2.44717412e-02f, 2.21034922e-02f, 1.98531579e-02f, 1.77212916e-02f, 1.57084186e-02f,
+  1.38150398e-02f, 1.20416190e-02f, 1.03885951e-02f, 8.85637477e-03f, 7.44533679e-03f,
+  6.15582988e-03f, 4.98817116e-03f, 3.94264935e-03f, 3.01952218e-03f, 2.21901760e-03f,
+  1.54133316e-03f, 9.86635801e-04f, 5.55062492e-04f, 2.46719806e-04f, 6.16837569e-05f,
+};
+
+static const float mel_fbank_16000_400[247] = {
+  3.38829845e-01f, 7.46632218e-01f, 2.53367752e-01f, 8.68835390e-01f, 2.49362141e-02f,
+  1.31164625e-01f, 9.75063801e-01f, 2.12418362e-01f, 7.87581623e-01f, 4.29029524e-01f,
+  5.70970476e-01f, 6.72750950e-01f, 3.27249020e-01f, 9.41771030e-01f, 2.34452844e-01f,
+  5.82289957e-02f, 7.65547156e-01f, 5.49311996e-01f, 4.50688004e-01f, 8.84997249e-01f,
+  2.40284130e-01f, 1.15002736e-01f, 7.59715855e-01f, 6.14046633e-01f, 5.25383558e-03f,
+  3.85953367e-01f, 9.94746149e-01f, 4.12960023e-01f, 5.87039948e-01f, 8.36297750e-01f,
+  2.74462491e-01f, 1.63702235e-01f, 7.25537539e-01f, 7.26708055e-01f, 1.92349210e-01f,
+  2.73291945e-01f, 8.07650805e-01f, 6.70742869e-01f, 1.61297426e-01f, 3.29257131e-01f,
+  8.38702559e-01f, 6.63456082e-01f, 1.76703677e-01f, 3.36543947e-01f, 8.23296309e-01f,
+  7.00560749e-01f, 2.34565735e-01f, 2.99439222e-01f, 7.65434265e-01f, 7.78304338e-01f,
+  3.31371784e-01f, 2.21695662e-01f, 6.68628216e-01f, 8.93396437e-01f, 4.64025587e-01f,
+  4.29278538e-02f, 1.06603578e-01f, 5.35974443e-01f, 9.57072139e-01f, 6.29793882e-01f,
+  2.24322259e-01f, 3.70206118e-01f, 7.75677741e-01f, 8.26238871e-01f, 4.35276300e-01f,
+  5.11843301e-02f, 1.73761129e-01f, 5.64723670e-01f, 9.48815644e-01f, 6.73726261e-01f,
+  3.02678168e-01f, 3.26273739e-01f, 6.97321832e-01f, 9.37822640e-01f, 5.78959107e-01f,
+  2.25897312e-01f, 6.21773303e-02f, 4.21040922e-01f, 7.74102688e-01f, 8.78445625e-01f,
+  5.36431253e-01f, 1.99688479e-01f, 1.21554352e-01f, 4.63568717e-01f, 8.00311506e-01f,
+  8.68051589e-01f, 5.41378558e-01f, 2.19513178e-01f, 1.31948411e-01f, 4.58621442e-01f,
+  7.80486822e-01f, 9.02318120e-01f, 5.89665592e-01f, 2.81420648e-01f, 9.76818725e-02f,
+  4.10334408e-01f, 7.18579352e-01f, 9.77460206e-01f, 6.77675366e-01f, 3.81943077e-01f,
+  9.01591405e-02f, 2.25397851e-02f, 3.22324604e-01f, 6.18056893e-01f, 9.09840882e-01f,
+  8.02219391e-01f, 5.18024504e-01f, 2.37482041e-01f, 1.97780579e-01f, 4.81975496e-01f,
+  7.62517989e-01f, 9.60487843e-01f, 6.86967969e-01f, 4.16823685e-01f, 1.49979174e-01f,
+  3.95121798e-02f, 3.13032001e-01f, 5.83176315e-01f, 8.50020826e-01f, 8.86354208e-01f,
+  6.25873148e-01f, 3.68457556e-01f, 1.14038721e-01f, 1.13645777e-01f, 3.74126822e-01f,
+  6.31542444e-01f, 8.85961294e-01f, 8.62547994e-01f, 6.13921523e-01f, 3.68088275e-01f,
+  1.24991417e-01f, 1.37451977e-01f, 3.86078447e-01f, 6.31911695e-01f, 8.75008583e-01f,
+  8.84567022e-01f, 6.46763086e-01f, 4.11513239e-01f, 1.78772554e-01f, 1.15432963e-01f,
+  3.53236914e-01f, 5.88486791e-01f, 8.21227431e-01f, 9.48486567e-01f, 7.20593750e-01f,
+  4.95060980e-01f, 2.71829069e-01f, 5.08529954e-02f, 5.15134223e-02f, 2.79406220e-01f,
+  5.04939020e-01f, 7.28170931e-01f, 9.49146986e-01f, 8.32092583e-01f, 6.15495682e-01f,
+  4.01029229e-01f, 1.88638732e-01f, 1.67907432e-01f, 3.84504318e-01f, 5.98970771e-01f,
+  8.11361253e-01f, 9.78300571e-01f, 7.69967318e-01f, 5.63598812e-01f, 3.59159470e-01f,
+  1.56616241e-01f, 2.16994546e-02f, 2.30032697e-01f, 4.36401218e-01f, 6.40840530e-01f,
+  8.43383789e-01f, 9.55935955e-01f, 7.57075906e-01f, 5.60012579e-01f, 3.64710391e-01f,
+  1.71138570e-01f, 4.40640748e-02f, 2.42924064e-01f, 4.39987421e-01f, 6.35289609e-01f,
+  8.28861415e-01f, 9.79263961e-01f, 7.89060533e-01f, 6.00497544e-01f, 4.13551331e-01f,
+  2.28186324e-01f, 4.43812683e-02f, 2.07360350e-02f, 2.10939437e-01f, 3.99502426e-01f,
+  5.86448669e-01f, 7.71813691e-01f, 9.55618739e-01f, 8.62112164e-01f, 6.81343675e-01f,
+  5.02061784e-01f, 3.24240386e-01f, 1.47855848e-01f, 1.37887850e-01f, 3.18656325e-01f,
+  4.97938216e-01f, 6.75759614e-01f, 8.52144122e-01f, 9.72879827e-01f, 7.99293637e-01f,
+  6.27078056e-01f, 4.56206977e-01f, 2.86661476e-01f, 1.18420273e-01f, 2.71201767e-02f,
+  2.00706348e-01f, 3.72921944e-01f, 5.43793023e-01f, 7.13338554e-01f, 8.81579697e-01f,
+  9.51469183e-01f, 7.85779715e-01f, 6.21337771e-01f, 4.58121955e-01f, 2.96120524e-01f,
+  1.35307357e-01f, 4.85308431e-02f, 2.14220285e-01f, 3.78662229e-01f, 5.41878045e-01f,
+  7.03879476e-01f, 8.64692628e-01f, 9.75668311e-01f, 8.17193866e-01f, 6.59850895e-01f,
+  5.03639460e-01f, 3.48531067e-01f, 1.94521055e-01f, 4.15856913e-02f, 2.43317001e-02f,
+  1.82806134e-01f, 3.40149075e-01f, 4.96360540e-01f, 6.51468933e-01f, 8.05478930e-01f,
+  9.58414316e-01f, 8.89715254e-01f, 7.38891065e-01f, 5.89098871e-01f, 4.40329313e-01f,
+  2.92563409e-01f, 1.45796448e-01f,
+};
+
+static const float dct_matrix_16000_400[520] = {
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f, 2.23606795e-01f,
+  2.23434404e-01f, 2.22056851e-01f, 2.19310254e-01f, 2.15211526e-01f, 2.09785953e-01f,
+  2.03066990e-01f, 1.95096031e-01f, 1.85922250e-01f, 1.75602198e-01f, 1.64199501e-01f,
+  1.51784465e-01f, 1.38433620e-01f, 1.24229282e-01f, 1.09259032e-01f, 9.36151594e-02f,
+  7.73941278e-02f, 6.06959276e-02f, 4.36235219e-02f, 2.62821615e-02f, 8.77876114e-03f,
+  -8.77876114e-03f, -2.62821615e-02f, -4.36235219e-02f, -6.06959276e-02f, -7.73941278e-02f,
+  -9.36151594e-02f, -1.09259032e-01f, -1.24229282e-01f, -1.38433620e-01f, -1.51784465e-01f,
+  -1.64199501e-01f, -1.75602198e-01f, -1.85922250e-01f, -1.95096031e-01f, -2.03066990e-01f,
+  -2.09785953e-01f, -2.15211526e-01f, -2.19310254e-01f, -2.22056851e-01f, -2.23434404e-01f,
+  2.22917497e-01f, 2.17428520e-01f, 2.06585735e-01f, 1.90656140e-01f, 1.70031935e-01f,
+  1.45220995e-01f, 1.16834231e-01f, 8.55706185e-02f, 5.21999709e-02f, 1.75439864e-02f,
+  -1.75439864e-02f, -5.21999709e-02f, -8.55706185e-02f, -1.16834231e-01f, -1.45220995e-01f,
+  -1.70031935e-01f, -1.90656140e-01f, -2.06585735e-01f, -2.17428520e-01f, -2.22917497e-01f,
+  -2.22917497e-01f, -2.17428520e-01f, -2.06585735e-01f, -1.90656140e-01f, -1.70031935e-01f,
+  -1.45220995e-01f, -1.16834231e-01f, -8.55706185e-02f, -5.21999709e-02f, -1.75439864e-02f,
+  1.75439864e-02f, 5.21999709e-02f, 8.55706185e-02f, 1.16834231e-01f, 1.45220995e-01f,
+  1.70031935e-01f, 1.90656140e-01f, 2.06585735e-01f, 2.17428520e-01f, 2.22917497e-01f,
+  2.22056851e-01f, 2.09785953e-01f, 1.85922250e-01f, 1.51784465e-01f, 1.09259032e-01f,
+  6.06959276e-02f, 8.77876114e-03f, -4.36235219e-02f, -9.36151594e-02f, -1.38433620e-01f,
+  -1.75602198e-01f, -2.03066990e-01f, -2.19310254e-01f, -2.23434404e-01f, -2.15211526e-01f,
+  -1.95096031e-01f, -1.64199501e-01f, -1.24229282e-01f, -7.73941278e-02f, -2.62821615e-02f,
+  2.62821615e-02f, 7.73941278e-02f, 1.24229282e-01f, 1.64199501e-01f, 1.95096031e-01f,
+  2.15211526e-01f, 2.23434404e-01f, 2.19310254e-01f, 2.03066990e-01f, 1.75602198e-01f,
+  1.38433620e-01f, 9.36151594e-02f, 4.36235219e-02f, -8.77876114e-03f, -6.06959276e-02f,
+  -1.09259032e-01f, -1.51784465e-01f, -1.85922250e-01f, -2.09785953e-01f, -2.22056851e-01f,
+  2.20853820e-01f, 1.99235111e-01f, 1.58113882e-01f, 1.01515360e-01f, 3.49798091e-02f,
+  -3.49798091e-02f, -1.01515360e-01f, -1.58113882e-01f, -1.99235111e-01f, -2.20853820e-01f,
+  -2.20853820e-01f, -1.99235111e-01f, -1.58113882e-01f, -1.01515360e-01f, -3.49798091e-02f,
+  3.49798091e-02f, 1.01515360e-01f, 1.58113882e-01f, 1.99235111e-01f, 2.20853820e-01f,
+  2.20853820e-01f, 1.99235111e-01f, 1.58113882e-01f, 1.01515360e-01f, 3.49798091e-02f,
+  -3.49798091e-02f, -1.01515360e-01f, -1.58113882e-01f, -1.99235111e-01f, -2.20853820e-01f,
+  -2.20853820e-01f, -1.99235111e-01f, -1.58113882e-01f, -1.01515360e-01f, -3.49798091e-02f,
+  3.49798091e-02f, 1.01515360e-01f, 1.58113882e-01f, 1.99235111e-01f, 2.20853820e-01f,
+  2.19310254e-01f, 1.85922250e-01f, 1.24229282e-01f, 4.36235219e-02f, -4.36235219e-02f,
+  -1.24229282e-01f, -1.85922250e-01f, -2.19310254e-01f, -2.19310254e-01f, -1.85922250e-01f,
+  -1.24229282e-01f, -4.36235219e-02f, 4.36235219e-02f, 1.24229282e-01f, 1.85922250e-01f,
+  2.19310254e-01f, 2.19310254e-01f, 1.85922250e-01f, 1.24229282e-01f, 4.36235219e-02f,
+  -4.36235219e-02f, -1.24229282e-01f, -1.85922250e-01f, -2.19310254e-01f, -2.19310254e-01f,
+  -1.85922250e-01f, -1.24229282e-01f, -4.36235219e-02f, 4.36235219e-02f, 1.24229282e-01f,
+  1.85922250e-01f, 2.19310254e-01f, 2.19310254e-01f, 1.85922250e-01f, 1.24229282e-01f,
+  4.36235219e-02f, -4.36235219e-02f, -1.24229282e-01f, -1.85922250e-01f, -2.19310254e-01f,
+  2.17428520e-01f, 1.70031935e-01f, 8.55706185e-02f, -1.75439864e-02f, -1.16834231e-01f,
+  -1.90656140e-01f, -2.22917497e-01f, -2.06585735e-01f, -1.45220995e-01f, -5.21999709e-02f,
+  5.21999709e-02f, 1.45220995e-01f, 2.06585735e-01f, 2.22917497e-01f, 1.90656140e-01f,
+  1.16834231e-01f, 1.75439864e-02f, -8.55706185e-02f, -1.70031935e-01f, -2.17428520e-01f,
+  -2.17428520e-01f, -1.70031935e-01f, -8.55706185e-02f, 1.75439864e-02f, 1.16834231e-01f,
+  1.90656140e-01f, 2.22917497e-01f, 2.06585735e-01f, 1.45220995e-01f, 5.21999709e-02f,
+  -5.21999709e-02f, -1.45220995e-01f, -2.06585735e-01f, -2.22917497e-01f, -1.90656140e-01f,
+  -1.16834231e-01f, -1.75439864e-02f, 8.55706185e-02f, 1.70031935e-01f, 2.17428520e-01f,
+  2.15211526e-01f, 1.51784465e-01f, 4.36235219e-02f, -7.73941278e-02f, -1.75602198e-01f,
+  -2.22056851e-01f, -2.03066990e-01f, -1.24229282e-01f, -8.77876114e-03f, 1.09259032e-01f,
+  1.95096031e-01f, 2.23434404e-01f, 1.85922250e-01f, 9.36151594e-02f, -2.62821615e-02f,
+  -1.38433620e-01f, -2.09785953e-01f, -2.19310254e-01f, -1.64199501e-01f, -6.06959276e-02f,
+  6.06959276e-02f, 1.64199501e-01f, 2.19310254e-01f, 2.09785953e-01f, 1.38433620e-01f,
+  2.62821615e-02f, -9.36151594e-02f, -1.85922250e-01f, -2.23434404e-01f, -1.95096031e-01f,
+  -1.09259032e-01f, 8.77876114e-03f, 1.24229282e-01f, 2.03066990e-01f, 2.22056851e-01f,
+  1.75602198e-01f, 7.73941278e-02f, -4.36235219e-02f, -1.51784465e-01f, -2.15211526e-01f,
+  2.12662697e-01f, 1.31432772e-01f, 1.36919675e-17f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -4.10759032e-17f, 1.31432772e-01f, 2.12662697e-01f,
+  2.12662697e-01f, 1.31432772e-01f, 6.84598365e-17f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -9.58437698e-17f, 1.31432772e-01f, 2.12662697e-01f,
+  2.12662697e-01f, 1.31432772e-01f, 1.23227703e-16f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -5.47817076e-16f, 1.31432772e-01f, 2.12662697e-01f,
+  2.12662697e-01f, 1.31432772e-01f, -2.19209890e-16f, -1.31432772e-01f, -2.12662697e-01f,
+  -2.12662697e-01f, -1.31432772e-01f, -6.02584956e-16f, 1.31432772e-01f, 2.12662697e-01f,
+  2.09785953e-01f, 1.09259032e-01f, -4.36235219e-02f, -1.75602198e-01f, -2.23434404e-01f,
+  -1.64199501e-01f, -2.62821615e-02f, 1.24229282e-01f, 2.15211526e-01f, 2.03066990e-01f,
+  9.36151594e-02f, -6.06959276e-02f, -1.85922250e-01f, -2.22056851e-01f, -1.51784465e-01f,
+  -8.77876114e-03f, 1.38433620e-01f, 2.19310254e-01f, 1.95096031e-01f, 7.73941278e-02f,
+  -7.73941278e-02f, -1.95096031e-01f, -2.19310254e-01f, -1.38433620e-01f, 8.77876114e-03f,
+  1.51784465e-01f, 2.22056851e-01f, 1.85922250e-01f, 6.06959276e-02f, -9.36151594e-02f,
+  -2.03066990e-01f, -2.15211526e-01f, -1.24229282e-01f, 2.62821615e-02f, 1.64199501e-01f,
+  2.23434404e-01f, 1.75602198e-01f, 4.36235219e-02f, -1.09259032e-01f, -2.09785953e-01f,
+  2.06585735e-01f, 8.55706185e-02f, -8.55706185e-02f, -2.06585735e-01f, -2.06585735e-01f,
+  -8.55706185e-02f, 8.55706185e-02f, 2.06585735e-01f, 2.06585735e-01f, 8.55706185e-02f,
+  -8.55706185e-02f, -2.06585735e-01f, -2.06585735e-01f, -8.55706185e-02f, 8.55706185e-02f,
+  2.06585735e-01f, 2.06585735e-01f, 8.55706185e-02f, -8.55706185e-02f, -2.06585735e-01f,
+  -2.06585735e-01f, -8.55706185e-02f, 8.55706185e-02f, 2.06585735e-01f, 2.06585735e-01f,
+  8.55706185e-02f, -8.55706185e-02f, -2.06585735e-01f, -2.06585735e-01f, -8.55706185e-02f,
+  8.55706185e-02f, 2.06585735e-01f, 2.06585735e-01f, 8.55706185e-02f, -8.55706185e-02f,
+  -2.06585735e-01f, -2.06585735e-01f, -8.55706185e-02f, 8.55706185e-02f, 2.06585735e-01f,
+  2.03066990e-01f, 6.06959276e-02f, -1.24229282e-01f, -2.22056851e-01f, -1.64199501e-01f,
+  8.77876114e-03f, 1.75602198e-01f, 2.19310254e-01f, 1.09259032e-01f, -7.73941278e-02f,
+  -2.09785953e-01f, -1.95096031e-01f, -4.36235219e-02f, 1.38433620e-01f, 2.23434404e-01f,
+  1.51784465e-01f, -2.62821615e-02f, -1.85922250e-01f, -2.15211526e-01f, -9.36151594e-02f,
+  9.36151594e-02f, 2.15211526e-01f, 1.85922250e-01f, 2.62821615e-02f, -1.51784465e-01f,
+  -2.23434404e-01f, -1.38433620e-01f, 4.36235219e-02f, 1.95096031e-01f, 2.09785953e-01f,
+  7.73941278e-02f, -1.09259032e-01f, -2.19310254e-01f, -1.75602198e-01f, -8.77876114e-03f,
+  1.64199501e-01f, 2.22056851e-01f, 1.24229282e-01f, -6.06959276e-02f, -2.03066990e-01f,
+  1.99235111e-01f, 3.49798091e-02f, -1.58113882e-01f, -2.20853820e-01f, -1.01515360e-01f,
+  1.01515360e-01f, 2.20853820e-01f, 1.58113882e-01f, -3.49798091e-02f, -1.99235111e-01f,
+  -1.99235111e-01f, -3.49798091e-02f, 1.58113882e-01f, 2.20853820e-01f, 1.01515360e-01f,
+  -1.01515360e-01f, -2.20853820e-01f, -1.58113882e-01f, 3.49798091e-02f, 1.99235111e-01f,
+  1.99235111e-01f, 3.49798091e-02f, -1.58113882e-01f, -2.20853820e-01f, -1.01515360e-01f,
+  1.01515360e-01f, 2.20853820e-01f, 1.58113882e-01f, -3.49798091e-02f, -1.99235111e-01f,
+  -1.99235111e-01f, -3.49798091e-02f, 1.58113882e-01f, 2.20853820e-01f, 1.01515360e-01f,
+  -1.01515360e-01f, -2.20853820e-01f, -1.58113882e-01f, 3.49798091e-02f, 1.99235111e-01f,
+};
+
+static const q15_t window_func_q15_16000_400[400] = {
+  0, 2, 8, 18, 32, 51, 73, 99, 129, 163,
+  202, 244, 290, 340, 395, 453, 515, 581, 651, 724,
+  802, 883, 969, 1058, 1151, 1247, 1348, 1452, 1559, 1671,
+  1786, 1904, 2027, 2152, 2282, 2414, 2551, 2690, 2833, 2979,
+  3129, 3282, 3438, 3597, 3760, 3926, 4094, 4266, 4441, 4618,
+  4799, 4982, 5168, 5357, 5549, 5743, 5940, 6140, 6342, 6547,
+  6754, 6963, 7175, 7389, 7605, 7823, 8044, 8266, 8491, 8717,
+  8946, 9176, 9408, 9642, 9877, 10114, 10353, 10593, 10834, 11077,
+  11321, 11566, 11813, 12061, 12309, 12559, 12810, 13062, 13314, 13567,
+  13821, 14075, 14331, 14586, 14842, 15099, 15355, 15612, 15869, 16127,
+  16384, 16641, 16899, 17156, 17413, 17669, 17926, 18182, 18437, 18693,
+  18947, 19201, 19454, 19706, 19958, 20209, 20459, 20707, 20955, 21202,
+  21447, 21691, 21934, 22175, 22415, 22654, 22891, 23126, 23360, 23592,
+  23822, 24051, 24277, 24502, 24724, 24945, 25163, 25379, 25593, 25805,
+  26014, 26221, 26426, 26628, 26828, 27025, 27219, 27411, 27600, 27786,
+  27969, 28150, 28327, 28502, 28674, 28842, 29008, 29171, 29330, 29486,
+  29639, 29789, 29935, 30078, 30217, 30354, 30486, 30616, 30741, 30864,
+  30982, 31097, 31209, 31316, 31420, 31521, 31617, 31710, 31799, 31885,
+  31966, 32044, 32117, 32187, 32253, 32315, 32373, 32428, 32478, 32524,
+  32566, 32605, 32639, 32669, 32695, 32717, 32736, 32750, 32760, 32766,
+  32767, 32766, 32760, 32750, 32736, 32717, 32695, 32669, 32639, 32605,
+  32566, 32524, 32478, 32428, 32373, 32315, 32253, 32187, 32117, 32044,
+  31966, 31885, 31799, 31710, 31617, 31521, 31420, 31316, 31209, 31097,
+  30982, 30864, 30741, 30616, 30486, 30354, 30217, 30078, 29935, 29789,
+  29639, 29486, 29330, 29171, 29008, 28842, 28674, 28502, 28327, 28150,
+  27969, 27786, 27600, 27411, 27219, 27025, 26828, 26628, 26426, 26221,
+  26014, 25805, 25593, 25379, 25163, 24945, 24724, 24502, 24277, 24051,
+  23822, 23592, 23360, 23126, 22891, 22654, 22415, 22175, 21934, 21691,
+  21447, 21202, 20955, 20707, 20459, 20209, 19958, 19706, 19454, 19201,
+  18947, 18693, 18437, 18182, 17926, 17669, 17413, 17156, 16899, 16641,
+  16384, 16127, 15869, 15612, 15355, 15099, 14842, 14586, 14331, 14075,
+  13821, 13567, 13314, 13062, 12810, 12559, 12309, 12061, 11813, 11566,
+  11321, 11077, 10834, 10593, 10353, 10114, 9877, 9642, 9408, 9176,
+  8946, 8717, 8491, 8266, 8044, 7823, 7605, 7389, 7175, 6963,
+  6754, 6547, 6342, 6140, 5940, 5743, 5549, 5357, 5168, 4982,
+  4799, 4618, 4441, 4266, 4094, 3926, 3760, 3597, 3438, 3282,
+  3129, 2979, 2833, 2690, 2551, 2414, 2282, 2152, 2027, 1904,
+  1786, 1671, 1559, 1452, 1348, 1247, 1151, 1058, 969, 883,
+  802, 724, 651, 581, 515, 453, 395, 340, 290, 244,
+  202, 163, 129, 99, 73, 51, 32, 18, 8, 2,
+};
+
+static const q15_t mel_fbank_q15_16000_400[247] = {
+  11103, 24466, 8302, 28470, 817, 4298, 31951, 6961, 25807, 14058,
+  18710, 22045, 10723, 30860, 7683, 1908, 25085, 18000, 14768, 29000,
+  7874, 3768, 24894, 20121, 172, 12647, 32596, 13532, 19236, 27404,
+  8994, 5364, 23774, 23813, 6303, 8955, 26465, 21979, 5285, 10789,
+  27483, 21740, 5790, 11028, 26978, 22956, 7686, 9812, 25082, 25503,
+  10858, 7265, 21910, 29275, 15205, 1407, 3493, 17563, 31361, 20637,
+  7351, 12131, 25417, 27074, 14263, 1677, 5694, 18505, 31091, 22077,
+  9918, 10691, 22850, 30731, 18971, 7402, 2037, 13797, 25366, 28785,
+  17578, 6543, 3983, 15190, 26225, 28444, 17740, 7193, 4324, 15028,
+  25575, 29567, 19322, 9222, 3201, 13446, 23546, 32029, 22206, 12516,
+  2954, 739, 10562, 20252, 29814, 26287, 16975, 7782, 6481, 15793,
+  24986, 31473, 22511, 13658, 4915, 1295, 10257, 19110, 27853, 29044,
+  20509, 12074, 3737, 3724, 12259, 20694, 29031, 28264, 20117, 12062,
+  4096, 4504, 12651, 20706, 28672, 28985, 21193, 13484, 5858, 3783,
+  11575, 19284, 26910, 31080, 23612, 16222, 8907, 1666, 1688, 9156,
+  16546, 23861, 31102, 27266, 20169, 13141, 6181, 5502, 12599, 19627,
+  26587, 32057, 25230, 18468, 11769, 5132, 711, 7538, 14300, 20999,
+  27636, 31324, 24808, 18350, 11951, 5608, 1444, 7960, 14418, 20817,
+  27160, 32089, 25856, 19677, 13551, 7477, 1454, 679, 6912, 13091,
+  19217, 25291, 31314, 28250, 22326, 16452, 10625, 4845, 4518, 10442,
+  16316, 22143, 27923, 31879, 26191, 20548, 14949, 9393, 3880, 889,
+  6577, 12220, 17819, 23375, 28888, 31178, 25748, 20360, 15012, 9703,
+  4434, 1590, 7020, 12408, 17756, 23065, 28334, 31971, 26778, 21622,
+  16503, 11421, 6374, 1363, 797, 5990, 11146, 16265, 21347, 26394,
+  31405, 29154, 24212, 19304, 14429, 9587, 4777,
+};
+
+static const q15_t dct_matrix_q15_16000_400[520] = {
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327, 7327,
+  7321, 7276, 7186, 7052, 6874, 6654, 6393, 6092, 5754, 5380,
+  4974, 4536, 4071, 3580, 3068, 2536, 1989, 1429, 861, 288,
+  -288, -861, -1429, -1989, -2536, -3068, -3580, -4071, -4536, -4974,
+  -5380, -5754, -6092, -6393, -6654, -6874, -7052, -7186, -7276, -7321,
+  7305, 7125, 6769, 6247, 5572, 4759, 3828, 2804, 1710, 575,
+  -575, -1710, -2804, -3828, -4759, -5572, -6247, -6769, -7125, -7305,
+  -7305, -7125, -6769, -6247, -5572, -4759, -3828, -2804, -1710, -575,
+  575, 1710, 2804, 3828, 4759, 5572, 6247, 6769, 7125, 7305,
+  7276, 6874, 6092, 4974, 3580, 1989, 288, -1429, -3068, -4536,
+  -5754, -6654, -7186, -7321, -7052, -6393, -5380, -4071, -2536, -861,
+  861, 2536, 4071, 5380, 6393, 7052, 7321, 7186, 6654, 5754,
+  4536, 3068, 1429, -288, -1989, -3580, -4974, -6092, -6874, -7276,
+  7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181, -6529, -7237,
+  -7237, -6529, -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+  7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181, -6529, -7237,
+  -7237, -6529, -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+  7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186, -7186, -6092,
+  -4071, -1429, 1429, 4071, 6092, 7186, 7186, 6092, 4071, 1429,
+  -1429, -4071, -6092, -7186, -7186, -6092, -4071, -1429, 1429, 4071,
+  6092, 7186, 7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186,
+  7125, 5572, 2804, -575, -3828, -6247, -7305, -6769, -4759, -1710,
+  1710, 4759, 6769, 7305, 6247, 3828, 575, -2804, -5572, -7125,
+  -7125, -5572, -2804, 575, 3828, 6247, 7305, 6769, 4759, 1710,
+  -1710, -4759, -6769, -7305, -6247, -3828, -575, 2804, 5572, 7125,
+  7052, 4974, 1429, -2536, -5754, -7276, -6654, -4071, -288, 3580,
+  6393, 7321, 6092, 3068, -861, -4536, -6874, -7186, -5380, -1989,
+  1989, 5380, 7186, 6874, 4536, 861, -3068, -6092, -7321, -6393,
+  -3580, 288, 4071, 6654, 7276, 5754, 2536, -1429, -4974, -7052,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+  6874, 3580, -1429, -5754, -7321, -5380, -861, 4071, 7052, 6654,
+  3068, -1989, -6092, -7276, -4974, -288, 4536, 7186, 6393, 2536,
+  -2536, -6393, -7186, -4536, 288, 4974, 7276, 6092, 1989, -3068,
+  -6654, -7052, -4071, 861, 5380, 7321, 5754, 1429, -3580, -6874,
+  6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769, 6769, 2804,
+  -2804, -6769, -6769, -2804, 2804, 6769, 6769, 2804, -2804, -6769,
+  -6769, -2804, 2804, 6769, 6769, 2804, -2804, -6769, -6769, -2804,
+  2804, 6769, 6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+  6654, 1989, -4071, -7276, -5380, 288, 5754, 7186, 3580, -2536,
+  -6874, -6393, -1429, 4536, 7321, 4974, -861, -6092, -7052, -3068,
+  3068, 7052, 6092, 861, -4974, -7321, -4536, 1429, 6393, 6874,
+  2536, -3580, -7186, -5754, -288, 5380, 7276, 4071, -1989, -6654,
+  6529, 1146, -5181, -7237, -3326, 3326, 7237, 5181, -1146, -6529,
+  -6529, -1146, 5181, 7237, 3326, -3326, -7237, -5181, 1146, 6529,
+  6529, 1146, -5181, -7237, -3326, 3326, 7237, 5181, -1146, -6529,
+  -6529, -1146, 5181, 7237, 3326, -3326, -7237, -5181, 1146, 6529,
+};
+
+static const MFCC_Tables tables_16000_400 = {
+  16000, 400, 40, 13, 20, 4000,
+  fbank_filter_first_16000_400, fbank_weight_offset_16000_400,
+  window_func_16000_400, mel_fbank_16000_400, dct_matrix_16000_400,
+  window_func_q15_16000_400, mel_fbank_q15_16000_400, dct_matrix_q15_16000_400
+};
+
+const MFCC_Tables * const mfcc_const_tables[] = {
+  &tables_44100_1102,
+  &tables_16000_400,
+};
+
+const int mfcc_const_tables_count = sizeof(mfcc_const_tables) / sizeof(mfcc_const_tables[0]);
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MFCC_TABLES_H__
+#define __MFCC_TABLES_H__
+
+extern "C" {
+  #include "arm_math.h"
+}
+
+#include "frontend_config.h"
+
+/*
+ * Precomputed MFCC front-end tables for one configuration. Instances are
+ * generated offline by tools/mfcc_tables_gen.cpp into mfcc_tables.cpp and
+ * live in flash, so MFCC and MFCC_Q15 need no heap and no libm calls for
+ * them at boot. Build with MFCC_RUNTIME_TABLES to always compute the
+ * tables at runtime instead.
+ */
+typedef struct
+{
+  /* configuration the tables were generated for */
+  int32_t samp_freq;
+  int32_t frame_len;
+  int32_t num_fbank_bins;
+  int32_t num_mfcc_features;
+  int32_t mel_low_freq;
+  int32_t mel_high_freq;
+
+  /* shared CSR layout of the mel filterbank, see MFCC */
+  const int32_t * fbank_filter_first;
+  const int32_t * fbank_weight_offset;
+
+  /* float engine */
+  const float * window_func;
+  const float * mel_fbank;
+  const float * dct_matrix;
+
+  /* Q15 engine */
+  const q15_t * window_func_q15;
+  const q15_t * mel_fbank_q15;
+  const q15_t * dct_matrix_q15;
+} MFCC_Tables;
+
+extern const MFCC_Tables * const mfcc_const_tables[];
+extern const int mfcc_const_tables_count;
+
+/* Returns the generated tables matching the configuration, or NULL. */
+const MFCC_Tables * MFCC_FindTables(const FrontendConfig &config);
+
+#endif
@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Several detectors over one feature buffer and one
+ * time-shared tensor arena, see model_registry.h.
+ */
+
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+#include "model_registry.h"
+#include "optimized_ops.h"
+#include "fp16_weights.h"
+#include "memory_tiers.h"
+#include "timer.h"
+
+#define LOG(x) std::cout
+
+/* Float features into an integer input with the tensor's scale and zero point */
+template <class T>
+static void quantize_input(const float *in, T *out, int size, const TfLiteQuantizationParams &params)
+{
+  const float inv_scale = 1.0f / params.scale;
+  for (int i = 0; i < size; i++)
+  {
+    int32_t q = (int32_t)roundf(in[i] * inv_scale) + params.zero_point;
+    q = std::max<int32_t>(q, std::numeric_limits<T>::min());
+    q = std::min<int32_t>(q, std::numeric_limits<T>::max());
+    out[i] = (T)q;
+  }
+}
+
+/* Names every operator code of the model the resolver has no kernel for */
+static bool check_model_ops(const tflite::FlatBufferModel &model, const tflite::OpResolver &resolver)
+{
+  bool ok = true;
+  auto *opcodes = model.GetModel()->operator_codes();
+  for (unsigned i = 0; opcodes && i < opcodes->size(); i++)
+  {
+    const tflite::OperatorCode *opcode = opcodes->Get(i);
+    const TfLiteRegistration *registration;
+    if (opcode->builtin_code() == tflite::BuiltinOperator_CUSTOM)
+    {
+      registration = resolver.FindOp(opcode->custom_code()->c_str(), opcode->version());
+    }
+    else
+    {
+      registration = resolver.FindOp(opcode->builtin_code(), opcode->version());
+    }
+    if (!registration)
+    {
+      LOG(FATAL) << "Op not registered: " << tflite::EnumNameBuiltinOperator(opcode->builtin_code())
+                 << " v" << opcode->version() << ", regenerate the model ops header\r\n";
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+ModelRegistry::ModelRegistry()
+  : num_models(0),
+    arena(0),
+    arena_size(0),
+    features(0),
+    feature_count(0),
+    window(0),
+    cancellation_data(0),
+    check_cancelled(0)
+{
+  for (int i = 0; i < MODEL_REGISTRY_MAX_MODELS; i++)
+  {
+    models[i].spec = 0;
+    models[i].planned = 0;
+    models[i].shared_input = false;
+  }
+}
+
+ModelRegistry::~ModelRegistry()
+{
+  /* interpreters first, they still reference the delegates */
+  for (int i = 0; i < num_models; i++)
+  {
+    models[i].interpreter.reset();
+    delete models[i].planned;
+  }
+}
+
+bool ModelRegistry::add(const ModelSpec &spec)
+{
+  if (num_models == MODEL_REGISTRY_MAX_MODELS || features)
+  {
+    LOG(FATAL) << "Cannot register model " << spec.name << "\r\n";
+    return false;
+  }
+  models[num_models++].spec = &spec;
+  return true;
+}
+
+/*
+ * Builds every registered model. The shared arena is sized before the
+ * first interpreter exists, from the plans alone.
+ */
+bool ModelRegistry::load()
+{
+#ifdef ENABLE_MEMORY_PLAN
+  for (int i = 0; i < num_models; i++)
+  {
+    if (models[i].spec->plan)
+    {
+      arena_size = std::max(arena_size, (size_t)models[i].spec->plan->arena_size);
+    }
+  }
+  if (arena_size)
+  {
+    arena = (uint8_t *)MemoryTierAlloc(TENSOR_ARENA_TIER, arena_size, "tensor arena");
+    LOG(INFO) << "Shared tensor arena: " << arena_size << " bytes for "
+              << num_models << " models\r\n";
+  }
+#endif
+
+  for (int i = 0; i < num_models; i++)
+  {
+    if (!build(models[i]))
+    {
+      LOG(FATAL) << "Failed to load model " << models[i].spec->name << "\r\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ModelRegistry::build(Entry &entry)
+{
+  const ModelSpec &spec = *entry.spec;
+  auto start = GetTimeInUS();
+
+  /* Weights are read in place from flash (XIP) unless MODEL_DATA_TIER moves them */
+  const uint8_t *model_data = spec.model_data;
+  if (MODEL_DATA_TIER != kMemoryTierFLASH)
+  {
+    uint8_t *copy = (uint8_t *)MemoryTierAlloc(MODEL_DATA_TIER, spec.model_len, spec.name);
+    memcpy(copy, spec.model_data, spec.model_len);
+    model_data = copy;
+  }
+  else
+  {
+    MemoryTierRecord(spec.model_data, spec.model_len, kMemoryTierFLASH, spec.name);
+  }
+  entry.model = tflite::FlatBufferModel::BuildFromBuffer((const char*)model_data, spec.model_len);
+  if (!entry.model)
+  {
+    return false;
+  }
+
+  /* Only the kernels the model uses, see tools/op_resolver_gen.cpp */
+  tflite::MutableOpResolver resolver;
+  spec.register_ops(&resolver);
+#ifdef ENABLE_OPTIMIZED_OPS
+  /* Tuned kernels for the model's layer shapes override the builtins */
+  RegisterOptimizedOps(&resolver);
+#endif
+  if (!check_model_ops(*entry.model, resolver))
+  {
+    return false;
+  }
+
+  tflite::InterpreterBuilder(*entry.model, resolver)(&entry.interpreter);
+  if (!entry.interpreter)
+  {
+    return false;
+  }
+  tflite::Interpreter *interpreter = entry.interpreter.get();
+
+  /* fp16 weight storage is the opt-in to reduced weight precision */
+  if (spec.allow_fp16)
+  {
+    interpreter->SetAllowFp16PrecisionForFp32(true);
+  }
+  int expanded = ExpandFp16Weights(interpreter);
+  if (expanded < 0)
+  {
+    return false;
+  }
+  if (expanded > 0)
+  {
+    LOG(INFO) << "Expanded " << expanded << " bytes of fp16 weights\r\n";
+  }
+
+#ifdef ENABLE_GRAPH_OPTIMIZER
+  /* Fuse activations before the arena is planned, alias reshapes only under a memory plan */
+  int removed = entry.optimizer.optimize(interpreter, arena && spec.plan);
+  LOG(INFO) << "Graph optimizer removed " << removed << " of "
+            << interpreter->nodes_size() << " nodes\r\n";
+#endif
+
+  /* The first model fixes the feature window every other model has to take */
+  TfLiteTensor *input = interpreter->tensor(interpreter->inputs()[0]);
+  int input_count = 1;
+  for (int i = 0; i < input->dims->size; i++)
+  {
+    input_count *= input->dims->data[i];
+  }
+  if (!features)
+  {
+    feature_count = input_count;
+    features = (float *)MemoryTierAlloc(TENSOR_ARENA_TIER, feature_capacity() * sizeof(float), "features");
+    window = features;
+  }
+  else if (input_count != feature_count)
+  {
+    LOG(FATAL) << spec.name << " takes " << input_count << " features, the registry has "
+               << feature_count << "\r\n";
+    return false;
+  }
+
+#ifdef ENABLE_SHARED_INPUT
+  /* Float inputs read the shared buffer, like an aliased reshape reads its source */
+  entry.shared_input = (input->type == kTfLiteFloat32);
+  if (entry.shared_input)
+  {
+    input->allocation_type = kTfLiteMmapRo;
+    input->data.f = window;
+  }
+#endif
+
+  /* Intermediate tensors at the offsets of tools/memory_plan_gen.cpp */
+  if (arena && spec.plan)
+  {
+    entry.planned = new PlannedArena(*spec.plan, arena, arena_size);
+    if (!entry.planned->apply(interpreter, spec.model_data, spec.model_len))
+    {
+      delete entry.planned;
+      entry.planned = 0;
+    }
+  }
+#ifdef ENABLE_GRAPH_OPTIMIZER
+  if (!entry.planned)
+  {
+    entry.optimizer.pin_alias_sources(interpreter);
+  }
+#endif
+
+  if (interpreter->AllocateTensors() != kTfLiteOk)
+  {
+    LOG(FATAL) << "Failed to allocate tensors!\r\n";
+    return false;
+  }
+  bind(entry);
+  if (check_cancelled)
+  {
+    interpreter->SetCancellationFunction(cancellation_data, check_cancelled);
+    if (entry.planned)
+    {
+      entry.planned->set_cancellation(cancellation_data, check_cancelled);
+    }
+  }
+
+  if (!entry.shared_input)
+  {
+    /* the interpreter's own arena comes from malloc, wherever the heap is */
+    MemoryTierRecord(input->data.raw, input->bytes, TENSOR_ARENA_TIER, "input tensor");
+  }
+  LOG(INFO) << spec.name << " ready in " << GetTimeInUS() - start << " us, "
+            << (entry.planned ? "shared" : "interpreter") << " arena, "
+            << (entry.shared_input ? "shared" : "own") << " input\r\n";
+  return true;
+}
+
+/* Has to follow every AllocateTensors() */
+void ModelRegistry::bind(Entry &entry)
+{
+  tflite::Interpreter *interpreter = entry.interpreter.get();
+  if (entry.shared_input)
+  {
+    interpreter->tensor(interpreter->inputs()[0])->data.f = window;
+  }
+#ifdef ENABLE_GRAPH_OPTIMIZER
+  entry.optimizer.bind_aliases(interpreter);
+#endif
+  if (entry.planned)
+  {
+    entry.planned->bind(interpreter);
+  }
+}
+
+/*
+ * A streaming KWS_MFCC moves its window through the feature buffer every
+ * hop. Float inputs, and the reshapes aliasing them, follow it here instead
+ * of the window being moved to the start of the buffer.
+ */
+void ModelRegistry::set_feature_window(float *new_window)
+{
+  if (new_window == window)
+  {
+    return;
+  }
+  window = new_window;
+  for (int i = 0; i < num_models; i++)
+  {
+    if (models[i].shared_input)
+    {
+      bind(models[i]);
+    }
+  }
+}
+
+bool ModelRegistry::invoke(int index)
+{
+  Entry &entry = models[index];
+  tflite::Interpreter *interpreter = entry.interpreter.get();
+
+  if (!entry.shared_input)
+  {
+    int input = interpreter->inputs()[0];
+    TfLiteTensor *tensor = interpreter->tensor(input);
+    switch (tensor->type)
+    {
+      case kTfLiteFloat32:
+        memcpy(interpreter->typed_tensor<float>(input), window, feature_count * sizeof(float));
+        break;
+      case kTfLiteInt8:
+        quantize_input<int8_t>(window, interpreter->typed_tensor<int8_t>(input),
+                               feature_count, tensor->params);
+        break;
+      case kTfLiteUInt8:
+        quantize_input<uint8_t>(window, interpreter->typed_tensor<uint8_t>(input),
+                                feature_count, tensor->params);
+        break;
+      default:
+        LOG(FATAL) << "Unsupported input tensor type " << tensor->type << "\r\n";
+        return false;
+    }
+  }
+
+  if (interpreter->Invoke() != kTfLiteOk)
+  {
+    if (!cancelled())
+    {
+      LOG(FATAL) << "Failed to invoke " << entry.spec->name << "\r\n";
+    }
+    return false;
+  }
+  return true;
+}
+
+/* Models loaded later pick it up in build() */
+void ModelRegistry::set_cancellation(void *data, bool (*check_cancelled_func)(void *data))
+{
+  cancellation_data = data;
+  check_cancelled = check_cancelled_func;
+  for (int i = 0; i < num_models; i++)
+  {
+    if (models[i].interpreter)
+    {
+      models[i].interpreter->SetCancellationFunction(data, check_cancelled_func);
+    }
+    if (models[i].planned)
+    {
+      models[i].planned->set_cancellation(data, check_cancelled_func);
+    }
+  }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MODEL_REGISTRY_H__
+#define __MODEL_REGISTRY_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/model.h"
+#include "tensorflow/lite/mutable_op_resolver.h"
+#include "graph_optimizer.h"
+#include "memory_plan.h"
+
+/*
+ * Load-time features that have not run on the board yet are opt-in; without
+ * them every model runs as exported, with the builtin kernels, its own
+ * interpreter arena and its own input tensor.
+ *
+ *   ENABLE_OPTIMIZED_OPS    CONV_2D override of optimized_ops.h
+ *   ENABLE_GRAPH_OPTIMIZER  activation fusion and reshape aliases, graph_optimizer.h
+ *   ENABLE_MEMORY_PLAN      offline tensor placement, memory_plan.h
+ *   ENABLE_SHARED_INPUT     float inputs read the feature window in place
+ */
+/* the plans are made for the optimized graph */
+#if defined(ENABLE_MEMORY_PLAN) && !defined(ENABLE_GRAPH_OPTIMIZER)
+#define ENABLE_GRAPH_OPTIMIZER
+#endif
+
+/* Detectors one registry can hold */
+#ifndef MODEL_REGISTRY_MAX_MODELS
+#define MODEL_REGISTRY_MAX_MODELS 4
+#endif
+
+/* RegisterModelOps_<name>() of a header written by tools/op_resolver_gen.cpp */
+typedef void (*RegisterOpsFunc)(tflite::MutableOpResolver *resolver);
+
+/* One detector: the model, its kernels and how its scores are reported */
+typedef struct {
+  const char *name;
+  const uint8_t *model_data;
+  unsigned int model_len;
+  RegisterOpsFunc register_ops;
+  const MemoryPlan *plan;       // NULL to let the interpreter plan
+  bool allow_fp16;              // opt-in for models with fp16 weights
+  const std::string *labels;
+  int num_labels;
+  int threshold;                // detection threshold in percent
+} ModelSpec;
+
+/*
+ * Runs several detectors over the same audio with the RAM of about one.
+ *
+ * All models take the same feature window, so the registry owns a single
+ * float feature buffer with room for a mirrored streaming window, two
+ * windows long. KWS_MFCC binds it as its feature ring and writes it in
+ * place, and set_feature_window() marks the current window inside it. With
+ * ENABLE_SHARED_INPUT the input tensor of every float model points at that
+ * window (the interpreter does not allocate the input); otherwise invoke()
+ * copies the window into the model's input, quantized for integer models.
+ *
+ * Models are invoked one after the other and never concurrently, so the
+ * intermediate tensors of all offline memory plans time-share one arena,
+ * sized for the largest plan. Each PlannedArena rebinds its tensor pointers
+ * on every invoke, so running one model leaves the others valid; only the
+ * small graph outputs stay per interpreter. A model without a plan, or whose
+ * plan does not apply, falls back to its own interpreter arena.
+ *
+ * add() every spec, then load() once. Specs have to outlive the registry.
+ */
+class ModelRegistry
+{
+  private:
+    struct Entry {
+      const ModelSpec *spec;
+      std::unique_ptr<tflite::FlatBufferModel> model;
+      std::unique_ptr<tflite::Interpreter> interpreter;
+      GraphOptimizer optimizer;
+      PlannedArena *planned;
+      bool shared_input;
+    };
+
+    Entry models[MODEL_REGISTRY_MAX_MODELS];
+    int num_models;
+    uint8_t *arena;
+    size_t arena_size;
+    float *features;
+    int feature_count;
+    /* Window the float inputs read, see set_feature_window() */
+    float *window;
+    void *cancellation_data;
+    bool (*check_cancelled)(void *data);
+
+    bool build(Entry &entry);
+    void bind(Entry &entry);
+
+  public:
+    ModelRegistry();
+    ~ModelRegistry();
+    bool add(const ModelSpec &spec);
+    bool load();
+    /* Copies or quantizes the features if needed and runs one model */
+    bool invoke(int index);
+    /* Makes window (feature_size() floats) the input of every model */
+    void set_feature_window(float *window);
+    /* Lets every model abandon an Invoke, see Interpreter::SetCancellationFunction */
+    void set_cancellation(void *data, bool (*check_cancelled_func)(void *data));
+    bool cancelled() const { return check_cancelled && check_cancelled(cancellation_data); }
+
+    int size() const { return num_models; }
+    const ModelSpec &spec(int index) const { return *models[index].spec; }
+    tflite::Interpreter *interpreter(int index) const { return models[index].interpreter.get(); }
+    float *feature_buffer() const { return features; }
+    /* Floats of one window, and of the whole buffer (two windows) */
+    int feature_size() const { return feature_count; }
+    int feature_capacity() const { return 2 * feature_count; }
+    size_t shared_arena_bytes() const { return arena_size; }
+};
+
+#endif
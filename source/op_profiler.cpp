@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Per-operator cycle profile of Invoke, see op_profiler.h.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "op_profiler.h"
+
+#if defined(__arm__)
+#include "fsl_device_registers.h"
+#else
+#include <time.h>
+#endif
+
+#define LOG(x) std::cout
+
+void ProfilerCyclesInit(void)
+{
+#if defined(__arm__)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  /* the M7 DWT is locked after reset */
+  DWT->LAR = 0xC5ACCE55;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t ProfilerCycles(void)
+{
+#if defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec);
+#endif
+}
+
+float ProfilerCyclesToUs(uint32_t cycles)
+{
+#if defined(__arm__)
+  return cycles / (SystemCoreClock / 1000000.0f);
+#else
+  return cycles / 1000.0f;
+#endif
+}
+
+OpProfiler::OpProfiler()
+  : BufferedProfiler(OP_PROFILER_MAX_EVENTS)
+{
+  reset_stats();
+}
+
+uint32_t OpProfiler::BeginEvent(const char *tag, EventType event_type, uint32_t event_metadata,
+                                uint32_t event_subgraph_index)
+{
+  uint32_t handle = BufferedProfiler::BeginEvent(tag, event_type, event_metadata,
+                                                 event_subgraph_index);
+  if (handle < OP_PROFILER_MAX_EVENTS)
+  {
+    end_cycles[handle] = 0;
+    begin_cycles[handle] = ProfilerCycles();
+  }
+  return handle;
+}
+
+void OpProfiler::EndEvent(uint32_t event_handle)
+{
+  if (event_handle < OP_PROFILER_MAX_EVENTS)
+  {
+    end_cycles[event_handle] = ProfilerCycles();
+  }
+  BufferedProfiler::EndEvent(event_handle);
+}
+
+void OpProfiler::add_sample(OpStats &stats, uint32_t cycles)
+{
+  stats.count++;
+  stats.total += cycles;
+  if (cycles < stats.min)
+    stats.min = cycles;
+  if (cycles > stats.max)
+    stats.max = cycles;
+}
+
+/*
+ * Events of the last Invoke. The buffer is reset before every Invoke and
+ * never wraps, so event i is handle i.
+ */
+void OpProfiler::collect(tflite::Interpreter *interpreter)
+{
+  std::vector<const tflite::profiling::ProfileEvent *> events = GetProfileEvents();
+  for (size_t i = 0; i < events.size() && i < OP_PROFILER_MAX_EVENTS; i++)
+  {
+    const tflite::profiling::ProfileEvent *event = events[i];
+    if (event->event_type != tflite::Profiler::EventType::OPERATOR_INVOKE_EVENT || !end_cycles[i])
+      continue;
+    int node = event->event_metadata;
+    const auto *node_reg = interpreter->node_and_registration(node);
+    if (!node_reg || node_reg->second.builtin_code == kTfLiteBuiltinDelegate)
+      continue;
+
+    if ((int)nodes.size() <= node)
+    {
+      OpStats empty = {0, 0, 0, UINT32_MAX, 0};
+      nodes.resize(node + 1, empty);
+    }
+    /* named from the registration, event tags differ between callers */
+    const TfLiteRegistration &reg = node_reg->second;
+    nodes[node].op = (reg.builtin_code == tflite::BuiltinOperator_CUSTOM && reg.custom_name)
+                         ? reg.custom_name
+                         : tflite::EnumNameBuiltinOperator((tflite::BuiltinOperator)reg.builtin_code);
+    add_sample(nodes[node], end_cycles[i] - begin_cycles[i]);
+  }
+  invokes++;
+}
+
+void OpProfiler::report() const
+{
+  uint64_t total = 0;
+  std::vector<OpStats> types;
+  for (size_t n = 0; n < nodes.size(); n++)
+  {
+    if (!nodes[n].count)
+      continue;
+    total += nodes[n].total;
+
+    size_t t = 0;
+    while (t < types.size() && strcmp(types[t].op, nodes[n].op))
+      t++;
+    if (t == types.size())
+    {
+      OpStats empty = {nodes[n].op, 0, 0, UINT32_MAX, 0};
+      types.push_back(empty);
+    }
+    types[t].count += nodes[n].count;
+    types[t].total += nodes[n].total;
+    types[t].min = std::min(types[t].min, nodes[n].min);
+    types[t].max = std::max(types[t].max, nodes[n].max);
+  }
+  if (!total)
+  {
+    LOG(INFO) << "Op profile: no operator events\r\n";
+    return;
+  }
+
+#if defined(__arm__)
+  const char *unit = "cycles";
+#else
+  const char *unit = "ns";
+#endif
+  LOG(INFO) << "Op profile over " << invokes << " invokes, " << unit << " per op:\r\n";
+  LOG(INFO) << std::setw(6) << "node" << "  " << std::left << std::setw(18) << "op" << std::right
+            << std::setw(7) << "count" << std::setw(10) << "avg" << std::setw(10) << "min"
+            << std::setw(10) << "max" << std::setw(7) << "%" << "\r\n";
+  for (size_t n = 0; n < nodes.size(); n++)
+  {
+    const OpStats &s = nodes[n];
+    if (!s.count)
+      continue;
+    LOG(INFO) << std::setw(6) << n << "  " << std::left << std::setw(18) << s.op << std::right
+              << std::setw(7) << s.count << std::setw(10) << s.total / s.count
+              << std::setw(10) << s.min << std::setw(10) << s.max
+              << std::setw(7) << std::fixed << std::setprecision(1)
+              << 100.0 * s.total / total << "\r\n";
+  }
+
+  LOG(INFO) << "By op type:\r\n";
+  LOG(INFO) << std::left << std::setw(24) << "op" << std::right
+            << std::setw(7) << "count" << std::setw(10) << "avg" << std::setw(10) << "min"
+            << std::setw(10) << "max" << std::setw(7) << "%" << "\r\n";
+  for (size_t t = 0; t < types.size(); t++)
+  {
+    const OpStats &s = types[t];
+    LOG(INFO) << std::left << std::setw(24) << s.op << std::right
+              << std::setw(7) << s.count << std::setw(10) << s.total / s.count
+              << std::setw(10) << s.min << std::setw(10) << s.max
+              << std::setw(7) << std::fixed << std::setprecision(1)
+              << 100.0 * s.total / total << "\r\n";
+  }
+  LOG(INFO) << std::defaultfloat << "Total " << total / invokes << " " << unit
+            << " per invoke\r\n";
+}
+
+void OpProfiler::reset_stats()
+{
+  nodes.clear();
+  invokes = 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __OP_PROFILER_H__
+#define __OP_PROFILER_H__
+
+#include <stdint.h>
+#include <vector>
+
+#include "tensorflow/lite/profiling/buffered_profiler.h"
+
+namespace tflite {
+class Interpreter;
+}
+
+/* Events one Invoke can record, operators plus the delegate node */
+#ifndef OP_PROFILER_MAX_EVENTS
+#define OP_PROFILER_MAX_EVENTS 64
+#endif
+
+/*
+ * Cycle counter for the op timings: DWT->CYCCNT on the M7, nanoseconds of
+ * CLOCK_MONOTONIC on the host. Differences are taken modulo 2^32, so a
+ * single op must stay below 7 s at 600 MHz.
+ */
+void ProfilerCyclesInit(void);
+uint32_t ProfilerCycles(void);
+float ProfilerCyclesToUs(uint32_t cycles);
+
+/*
+ * BufferedProfiler attached with Interpreter::SetProfiler that also stamps
+ * each event with ProfilerCycles(), since the buffer's own timestamps are
+ * whole microseconds. Operators run by PlannedArena report through the
+ * context's profiler as well, so a memory-planned graph still shows its
+ * individual layers; the delegate node itself is left out of the tables.
+ *
+ * Per Invoke: Reset(), StartProfiling(), Invoke, StopProfiling(), then
+ * collect(), which folds the events into per-node statistics. report()
+ * prints them per node and per op type: count, average, minimum and
+ * maximum cycles and share of the total.
+ */
+class OpProfiler : public tflite::profiling::BufferedProfiler
+{
+  private:
+    typedef struct {
+      const char *op;
+      uint32_t count;
+      uint64_t total;
+      uint32_t min;
+      uint32_t max;
+    } OpStats;
+
+    uint32_t begin_cycles[OP_PROFILER_MAX_EVENTS];
+    uint32_t end_cycles[OP_PROFILER_MAX_EVENTS];
+    std::vector<OpStats> nodes;
+    uint32_t invokes;
+
+    static void add_sample(OpStats &stats, uint32_t cycles);
+
+  public:
+    OpProfiler();
+    uint32_t BeginEvent(const char *tag, EventType event_type, uint32_t event_metadata,
+                        uint32_t event_subgraph_index) override;
+    void EndEvent(uint32_t event_handle) override;
+    void collect(tflite::Interpreter *interpreter);
+    void report() const;
+    void reset_stats();
+};
+
+#endif
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: CONV_2D override running the register blocked 1-D kernel for
+ * the model's convolutions, falling back to the builtin kernel otherwise.
+ */
+
+#include <float.h>
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/builtin_op_kernels.h"
+#include "optimized_ops.h"
+#include "conv1d_kernels.h"
+#include "memory_tiers.h"
+
+typedef struct {
+  void *builtin_data;           // the builtin kernel's own op data
+  bool fast;
+  Conv1dParams params;
+  float *packed;
+} Conv1dOpData;
+
+static TfLiteRegistration* builtin_conv()
+{
+  return tflite::ops::builtin::Register_CONV_2D();
+}
+
+static void* conv1d_init(TfLiteContext *context, const char *buffer, size_t length)
+{
+  Conv1dOpData *data = new Conv1dOpData;
+  data->builtin_data = builtin_conv()->init ? builtin_conv()->init(context, buffer, length) : 0;
+  data->fast = false;
+  data->packed = 0;
+  return data;
+}
+
+static void conv1d_free(TfLiteContext *context, void *buffer)
+{
+  Conv1dOpData *data = (Conv1dOpData *)buffer;
+  if (builtin_conv()->free)
+    builtin_conv()->free(context, data->builtin_data);
+  MemoryTierFree(data->packed);
+  delete data;
+}
+
+/* Does this node fit the 1-D kernel? Fills params if so. */
+static bool conv1d_supported(TfLiteContext *context, TfLiteNode *node, Conv1dParams *p)
+{
+  const TfLiteConvParams *conv = (const TfLiteConvParams *)node->builtin_data;
+  const TfLiteTensor *in = &context->tensors[node->inputs->data[0]];
+  const TfLiteTensor *filter = &context->tensors[node->inputs->data[1]];
+  const TfLiteTensor *bias = (node->inputs->size > 2 && node->inputs->data[2] >= 0) ?
+                             &context->tensors[node->inputs->data[2]] : 0;
+  const TfLiteTensor *out = &context->tensors[node->outputs->data[0]];
+
+  if (in->type != kTfLiteFloat32 || filter->type != kTfLiteFloat32 ||
+      out->type != kTfLiteFloat32 || filter->allocation_type != kTfLiteMmapRo ||
+      in->dims->size != 4 || filter->dims->size != 4 || in->dims->data[0] != 1 ||
+      filter->dims->data[3] != in->dims->data[3] || conv->dilation_width_factor != 1 ||
+      conv->dilation_height_factor != 1)
+    return false;
+  if (conv->activation != kTfLiteActNone && conv->activation != kTfLiteActRelu &&
+      conv->activation != kTfLiteActRelu6)
+    return false;
+  if (bias && (bias->type != kTfLiteFloat32 || bias->dims->size != 1 ||
+               bias->dims->data[0] != filter->dims->data[0]))
+    return false;
+
+  /* time along W for [1,1,T,C], along H for [1,T,1,C] */
+  bool time_w = in->dims->data[1] == 1;
+  if (!time_w && in->dims->data[2] != 1)
+    return false;
+  int axis = time_w ? 2 : 1;
+  if (filter->dims->data[time_w ? 1 : 2] != 1)
+    return false;
+
+  p->in_len = in->dims->data[axis];
+  p->in_ch = in->dims->data[3];
+  p->out_ch = filter->dims->data[0];
+  p->kernel = filter->dims->data[axis];
+  p->stride = time_w ? conv->stride_width : conv->stride_height;
+  p->pad = 0;
+  if (conv->padding == kTfLitePaddingSame) {
+    p->out_len = (p->in_len + p->stride - 1) / p->stride;
+    int total = (p->out_len - 1) * p->stride + p->kernel - p->in_len;
+    p->pad = (total > 0) ? total / 2 : 0;
+  } else {
+    p->out_len = (p->in_len - p->kernel) / p->stride + 1;
+  }
+  if (p->out_len <= 0)
+    return false;
+  p->act_min = (conv->activation == kTfLiteActNone) ? -FLT_MAX : 0.0f;
+  p->act_max = (conv->activation == kTfLiteActRelu6) ? 6.0f : FLT_MAX;
+  return true;
+}
+
+/*
+ * The fast path only sizes the output: the builtin Prepare would also add
+ * the im2col / transposed weight temporaries the 1-D kernel never reads.
+ */
+static TfLiteStatus conv1d_prepare(TfLiteContext *context, TfLiteNode *node)
+{
+  Conv1dOpData *data = (Conv1dOpData *)node->user_data;
+
+  MemoryTierFree(data->packed);
+  data->packed = 0;
+  data->fast = conv1d_supported(context, node, &data->params);
+  if (!data->fast) {
+    node->user_data = data->builtin_data;
+    TfLiteStatus status = builtin_conv()->prepare(context, node);
+    node->user_data = data;
+    return status;
+  }
+
+  const Conv1dParams &p = data->params;
+  const TfLiteTensor *in = &context->tensors[node->inputs->data[0]];
+  const TfLiteTensor *filter = &context->tensors[node->inputs->data[1]];
+  TfLiteTensor *out = &context->tensors[node->outputs->data[0]];
+  TfLiteIntArray *out_dims = TfLiteIntArrayCopy(in->dims);
+  out_dims->data[(in->dims->data[1] == 1) ? 2 : 1] = p.out_len;
+  out_dims->data[3] = p.out_ch;
+  TF_LITE_ENSURE_STATUS(context->ResizeTensor(context, out, out_dims));
+
+  data->packed = (float *)MemoryTierAlloc(HOT_WEIGHTS_TIER, Conv1dPackedSize(p.out_ch, p.kernel, p.in_ch) *
+                                          sizeof(float), "conv weights");
+  Conv1dPackWeights(filter->data.f, p.out_ch, p.kernel, p.in_ch, data->packed);
+  return kTfLiteOk;
+}
+
+static TfLiteStatus conv1d_invoke(TfLiteContext *context, TfLiteNode *node)
+{
+  Conv1dOpData *data = (Conv1dOpData *)node->user_data;
+
+  if (!data->fast) {
+    node->user_data = data->builtin_data;
+    TfLiteStatus status = builtin_conv()->invoke(context, node);
+    node->user_data = data;
+    return status;
+  }
+
+  const TfLiteTensor *in = &context->tensors[node->inputs->data[0]];
+  const TfLiteTensor *bias = (node->inputs->size > 2 && node->inputs->data[2] >= 0) ?
+                             &context->tensors[node->inputs->data[2]] : 0;
+  TfLiteTensor *out = &context->tensors[node->outputs->data[0]];
+  Conv1dFloat(data->params, in->data.f, data->packed, bias ? bias->data.f : 0,
+              out->data.f, 0, data->params.out_len);
+  return kTfLiteOk;
+}
+
+TfLiteRegistration* Register_CONV_1D_OPT()
+{
+  static TfLiteRegistration r = {
+    conv1d_init, conv1d_free, conv1d_prepare, conv1d_invoke, 0,
+    kTfLiteBuiltinConv2d, 0, 1
+  };
+  return &r;
+}
+
+void RegisterOptimizedOps(tflite::MutableOpResolver *resolver)
+{
+  resolver->AddBuiltin(tflite::BuiltinOperator_CONV_2D, Register_CONV_1D_OPT(),
+                       1, OPTIMIZED_CONV_2D_MAX_VERSION);
+}
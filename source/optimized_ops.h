@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __OPTIMIZED_OPS_H__
+#define __OPTIMIZED_OPS_H__
+
+#include "tensorflow/lite/mutable_op_resolver.h"
+
+/* CONV_2D versions the override is registered for, as the TF Lite 2.1 builtin */
+#define OPTIMIZED_CONV_2D_MAX_VERSION 3
+
+/*
+ * Kernels tuned for this model's layer shapes, registered over the builtins
+ * after RegisterModelOps(). Each override wraps the builtin registration:
+ * nodes the fast path covers are prepared (output shape only) and run by it,
+ * all others fall through to the builtin Prepare and Invoke.
+ *
+ * CONV_2D: float 1xK / Kx1 convolution, stride along time only, dilation 1,
+ * constant weights, no or ReLU/ReLU6 activation; see conv1d_kernels.h.
+ */
+TfLiteRegistration* Register_CONV_1D_OPT();
+void RegisterOptimizedOps(tflite::MutableOpResolver *resolver);
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Warm-up and timed runs of the audio to label chain with
+ * per-stage percentiles, see pipeline_benchmark.h.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+#if defined(__linux__)
+#include "tensorflow/lite/profiling/memory_info.h"
+#elif defined(__NEWLIB__)
+#include <malloc.h>
+#endif
+#include "pipeline_benchmark.h"
+#include "kws_mfcc.h"
+#include "model_registry.h"
+#include "memory_tiers.h"
+#include "op_profiler.h"
+#include "get_top_n.h"
+
+#define LOG(x) std::cout
+
+using tflite::benchmark::BenchmarkParam;
+using tflite::benchmark::RunType;
+
+static const char *kStageNames[kStageCount] = {
+  "audio", "features", "invoke", "top-n", "total"
+};
+
+/*
+ * Heap bytes in use: the TF Lite memory profiler on Linux, newlib's
+ * mallinfo() on the target, -1 where neither is available.
+ */
+static int heap_in_use()
+{
+#if defined(__linux__)
+  return tflite::profiling::memory::GetMemoryUsage().total_allocated_bytes;
+#elif defined(__NEWLIB__)
+  return (int)mallinfo().uordblks;
+#else
+  return -1;
+#endif
+}
+
+/* Nearest-rank percentile of sorted samples */
+static uint32_t percentile(const std::vector<uint32_t> &sorted, int p)
+{
+  size_t rank = (sorted.size() * p + 99) / 100;
+  return sorted[rank ? rank - 1 : 0];
+}
+
+PipelineBenchmark::PipelineBenchmark(KWS_MFCC *kws_mfcc, ModelRegistry *model_registry,
+                                     int64_t startup_latency_us)
+  : kws(kws_mfcc),
+    registry(model_registry),
+    startup_us(startup_latency_us),
+    heap_start(0),
+    heap_peak(0)
+{
+  staging = new float[kws->audio_buffer_size];
+  params.AddParam("warmup_runs", BenchmarkParam::Create<int32_t>(BENCHMARK_WARMUP_RUNS));
+  params.AddParam("num_runs", BenchmarkParam::Create<int32_t>(BENCHMARK_NUM_RUNS));
+}
+
+PipelineBenchmark::~PipelineBenchmark()
+{
+  delete [] staging;
+}
+
+void PipelineBenchmark::add_window(const float *audio)
+{
+  windows.push_back(audio);
+}
+
+void PipelineBenchmark::sample_heap()
+{
+  heap_peak = std::max(heap_peak, heap_in_use());
+}
+
+/* The chain of RunInference, one timestamp between stages, summed over the models */
+bool PipelineBenchmark::run_once(const float *window, uint32_t *cycles)
+{
+  uint32_t t0 = ProfilerCycles();
+  memcpy(staging, window, kws->audio_buffer_size * sizeof(float));
+  uint32_t t1 = ProfilerCycles();
+
+  kws->audio_buffer = staging;
+  kws->extract_features();
+  if (kws->is_bound_to(registry->feature_buffer()))
+  {
+    registry->set_feature_window(kws->mfcc_buffer);
+  }
+  else
+  {
+    memcpy(registry->feature_buffer(), kws->mfcc_buffer, registry->feature_size() * sizeof(float));
+    registry->set_feature_window(registry->feature_buffer());
+  }
+  uint32_t t2 = ProfilerCycles();
+  sample_heap();
+
+  /* every detector, as RunInference does */
+  uint32_t invoke_cycles = 0, top_n_cycles = 0;
+  for (int m = 0; m < registry->size(); m++)
+  {
+    uint32_t t3 = ProfilerCycles();
+    if (!registry->invoke(m))
+    {
+      return false;
+    }
+    uint32_t t4 = ProfilerCycles();
+    sample_heap();
+
+    tflite::Interpreter *interpreter = registry->interpreter(m);
+    const TfLiteTensor *output = interpreter->tensor(interpreter->outputs()[0]);
+    TopNResults<1> top_results;
+    uint32_t t5 = ProfilerCycles();
+    GetTopN<1>(output, 0.0f, &top_results);
+    uint32_t t6 = ProfilerCycles();
+    invoke_cycles += t4 - t3;
+    top_n_cycles += t6 - t5;
+  }
+
+  cycles[kStageAudio] = t1 - t0;
+  cycles[kStageFeatures] = t2 - t1;
+  cycles[kStageInvoke] = invoke_cycles;
+  cycles[kStageTopN] = top_n_cycles;
+  cycles[kStageTotal] = cycles[kStageAudio] + cycles[kStageFeatures] +
+                        cycles[kStageInvoke] + cycles[kStageTopN];
+  return true;
+}
+
+bool PipelineBenchmark::run()
+{
+  if (windows.empty())
+  {
+    return false;
+  }
+  const int warmup_runs = params.Get<int32_t>("warmup_runs");
+  const int num_runs = params.Get<int32_t>("num_runs");
+  tensorflow::Stat<int64_t> warmup_us, inference_us;
+  uint32_t cycles[kStageCount];
+
+  for (int s = 0; s < kStageCount; s++)
+  {
+    samples[s].clear();
+    samples[s].reserve(num_runs);
+  }
+  heap_start = heap_in_use();
+  heap_peak = heap_start;
+
+  listeners.OnBenchmarkStart(params);
+  for (int i = 0; i < warmup_runs + num_runs; i++)
+  {
+    RunType type = (i < warmup_runs) ? tflite::benchmark::WARMUP : tflite::benchmark::REGULAR;
+    listeners.OnSingleRunStart(type);
+    bool ok = run_once(windows[i % windows.size()], cycles);
+    listeners.OnSingleRunEnd();
+    if (!ok)
+    {
+      return false;
+    }
+
+    int64_t us = (int64_t)ProfilerCyclesToUs(cycles[kStageTotal]);
+    if (type == tflite::benchmark::WARMUP)
+    {
+      warmup_us.UpdateStat(us);
+      continue;
+    }
+    inference_us.UpdateStat(us);
+    for (int s = 0; s < kStageCount; s++)
+    {
+      samples[s].push_back(cycles[s]);
+    }
+  }
+
+  uint64_t input_bytes = kws->audio_buffer_size * sizeof(float);
+  listeners.OnBenchmarkEnd(tflite::benchmark::BenchmarkResults(startup_us, input_bytes,
+                                                               warmup_us, inference_us));
+  return true;
+}
+
+void PipelineBenchmark::report() const
+{
+  if (samples[kStageTotal].empty())
+  {
+    return;
+  }
+  LOG(INFO) << "Pipeline over " << samples[kStageTotal].size() << " runs, us:\r\n";
+  LOG(INFO) << std::left << std::setw(10) << "stage" << std::right << std::setw(10) << "p50"
+            << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "max" << "\r\n";
+  for (int s = 0; s < kStageCount; s++)
+  {
+    std::vector<uint32_t> sorted = samples[s];
+    std::sort(sorted.begin(), sorted.end());
+    LOG(INFO) << std::left << std::setw(10) << kStageNames[s] << std::right << std::fixed
+              << std::setprecision(1)
+              << std::setw(10) << ProfilerCyclesToUs(percentile(sorted, 50))
+              << std::setw(10) << ProfilerCyclesToUs(percentile(sorted, 90))
+              << std::setw(10) << ProfilerCyclesToUs(percentile(sorted, 99))
+              << std::setw(10) << ProfilerCyclesToUs(sorted.back()) << "\r\n";
+  }
+  LOG(INFO) << std::defaultfloat;
+
+  size_t pools = 0;
+  for (int t = 0; t < kMemoryTierCount; t++)
+  {
+    pools += MemoryTierPeak((MemoryTier)t);
+  }
+  if (heap_start >= 0)
+  {
+    LOG(INFO) << "Peak heap " << heap_peak << " B (" << heap_peak - heap_start
+              << " B during the runs), ";
+  }
+  LOG(INFO) << "Shared arena " << registry->shared_arena_bytes()
+            << " B, tier pools " << pools << " B peak\r\n";
+}
+
+void PipelineLoggingListener::OnBenchmarkEnd(const tflite::benchmark::BenchmarkResults &results)
+{
+  const tensorflow::Stat<int64_t> &inference = results.inference_time_us();
+  const tensorflow::Stat<int64_t> &warmup = results.warmup_time_us();
+  LOG(INFO) << "Startup " << results.startup_latency_us() << " us, warm-up avg "
+            << (int64_t)warmup.avg() << " us over " << warmup.count() << " runs\r\n";
+  LOG(INFO) << "Inference avg " << (int64_t)inference.avg() << " us, min " << inference.min()
+            << ", max " << inference.max() << ", std " << inference.std_deviation()
+            << " over " << inference.count() << " runs\r\n";
+}
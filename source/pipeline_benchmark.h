@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_BENCHMARK_H__
+#define __PIPELINE_BENCHMARK_H__
+
+#include <stdint.h>
+#include <vector>
+
+#include "tensorflow/lite/tools/benchmark/benchmark_model.h"
+
+class KWS_MFCC;
+class ModelRegistry;
+
+/* Defaults of the "warmup_runs" and "num_runs" parameters */
+#ifndef BENCHMARK_WARMUP_RUNS
+#define BENCHMARK_WARMUP_RUNS 5
+#endif
+#ifndef BENCHMARK_NUM_RUNS
+#define BENCHMARK_NUM_RUNS 50
+#endif
+
+enum PipelineStage {
+  kStageAudio,          // window copied in from the capture buffer
+  kStageFeatures,       // KWS_MFCC::extract_features
+  kStageInvoke,         // Invoke of every registered model
+  kStageTopN,           // GetTopN over each model's scores
+  kStageTotal,
+  kStageCount
+};
+
+/*
+ * Times the application's chain on fixed audio: window copy, feature
+ * extraction, Invoke and GetTopN, exactly as RunInference runs them but
+ * without the VAD gate or logging. Each run takes the next of the given
+ * windows. Runs are reported to tflite::benchmark::BenchmarkListener's,
+ * with the whole chain as the inference time, so the TensorFlow Lite
+ * benchmark listeners can be attached as they are.
+ *
+ * run() does "warmup_runs" untimed and "num_runs" timed iterations and
+ * returns false if an Invoke fails. report() prints p50, p90, p99 and max
+ * per stage, the peak heap seen during the runs (where the C library
+ * reports it, see heap_in_use()) and the tensor memory.
+ * Stage times come from ProfilerCycles() (op_profiler.h).
+ */
+class PipelineBenchmark
+{
+  private:
+    KWS_MFCC *kws;
+    ModelRegistry *registry;
+    std::vector<const float *> windows;
+    float *staging;
+    tflite::benchmark::BenchmarkParams params;
+    tflite::benchmark::BenchmarkListeners listeners;
+    std::vector<uint32_t> samples[kStageCount];
+    int64_t startup_us;
+    int heap_start;
+    int heap_peak;
+
+    bool run_once(const float *window, uint32_t *cycles);
+    void sample_heap();
+
+  public:
+    PipelineBenchmark(KWS_MFCC *kws_mfcc, ModelRegistry *model_registry, int64_t startup_latency_us);
+    ~PipelineBenchmark();
+    /* One kws->audio_buffer_size window of audio, kept by the caller */
+    void add_window(const float *audio);
+    void add_listener(tflite::benchmark::BenchmarkListener *listener) { listeners.AddListener(listener); }
+    tflite::benchmark::BenchmarkParams *mutable_params() { return &params; }
+    bool run();
+    void report() const;
+};
+
+/* Logs the end to end results, like the TensorFlow Lite benchmark tool */
+class PipelineLoggingListener : public tflite::benchmark::BenchmarkListener
+{
+  public:
+    void OnBenchmarkEnd(const tflite::benchmark::BenchmarkResults &results) override;
+};
+
+#endif
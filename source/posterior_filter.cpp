@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Moving average and attack/release hysteresis over the
+ * posteriors of successive hops, see posterior_filter.h.
+ */
+
+#include "posterior_filter.h"
+
+PosteriorFilter::PosteriorFilter(int num_classes, const ClassThreshold *class_thresholds,
+                                 const PosteriorConfig &posterior_config)
+  : config(posterior_config), num_classes(num_classes), detections(0)
+{
+  if (this->num_classes > POSTERIOR_MAX_CLASSES)
+    this->num_classes = POSTERIOR_MAX_CLASSES;
+  if (config.average_hops < 1)
+    config.average_hops = 1;
+  if (config.average_hops > POSTERIOR_MAX_HOPS)
+    config.average_hops = POSTERIOR_MAX_HOPS;
+  if (config.attack_hops < 1)
+    config.attack_hops = 1;
+  if (config.release_hops < 1)
+    config.release_hops = 1;
+  for (int c = 0; c < this->num_classes; c++)
+    thresholds[c] = class_thresholds[c];
+  reset();
+}
+
+void PosteriorFilter::reset()
+{
+  for (int c = 0; c < num_classes; c++) {
+    sum[c] = 0.0f;
+    average[c] = 0.0f;
+    attack[c] = 0;
+  }
+  head = 0;
+  filled = 0;
+  active = -1;
+  release = 0;
+  onset = false;
+}
+
+int PosteriorFilter::process(const float* posteriors)
+{
+  // moving average, the oldest hop leaves once the history is full
+  float *slot = history[head];
+  for (int c = 0; c < num_classes; c++) {
+    if (filled == config.average_hops)
+      sum[c] -= slot[c];
+    slot[c] = posteriors[c];
+    sum[c] += posteriors[c];
+  }
+  head = (head + 1) % config.average_hops;
+  if (filled < config.average_hops)
+    filled++;
+  for (int c = 0; c < num_classes; c++)
+    average[c] = sum[c] / filled;
+
+  onset = false;
+  if (active >= 0) {
+    if (average[active] < thresholds[active].off)
+      release++;
+    else
+      release = 0;
+    if (release < config.release_hops)
+      return active;
+    active = -1;
+    release = 0;
+  }
+
+  // the class held longest above its on threshold wins, then the larger average
+  int best = -1;
+  for (int c = 0; c < num_classes; c++) {
+    attack[c] = (average[c] >= thresholds[c].on) ? attack[c] + 1 : 0;
+    if (attack[c] >= config.attack_hops &&
+        (best < 0 || attack[c] > attack[best] ||
+         (attack[c] == attack[best] && average[c] > average[best])))
+      best = c;
+  }
+  if (best >= 0) {
+    active = best;
+    onset = true;
+    detections++;
+    for (int c = 0; c < num_classes; c++)
+      attack[c] = 0;
+  }
+  return active;
+}
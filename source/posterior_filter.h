@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __POSTERIOR_FILTER_H__
+#define __POSTERIOR_FILTER_H__
+
+#include <stdint.h>
+
+#define POSTERIOR_MAX_CLASSES 4
+#define POSTERIOR_MAX_HOPS 16
+
+/*
+ * Decision thresholds of one class on the smoothed posterior. The class is
+ * raised at on and cleared under off, off <= on. An on threshold above 1
+ * never raises the class, e.g. for silence.
+ */
+typedef struct {
+  float on;
+  float off;
+} ClassThreshold;
+
+/*
+ * Temporal smoothing of the decisions. Posteriors are averaged over the
+ * last average_hops hops. A class is raised after attack_hops consecutive
+ * hops at or above its on threshold and cleared after release_hops
+ * consecutive hops under its off threshold.
+ */
+typedef struct {
+  int average_hops;
+  int attack_hops;
+  int release_hops;
+} PosteriorConfig;
+
+/* 8-frame (80 ms) hops: 240 ms average, raised after 160 ms, held 240 ms */
+static const PosteriorConfig kPosteriorConfigDefault = {3, 2, 3};
+
+/*
+ * Streaming decision layer behind a detector. process() takes the model's
+ * posteriors of one hop and returns the active class, -1 for none. At most
+ * one class is active; another one can only be raised once it is cleared,
+ * so a cry is reported once however many hops it lasts. raised() tells
+ * whether the class became active on the last hop. reset() is for audio
+ * that does not follow on from the last hop.
+ */
+class PosteriorFilter
+{
+  private:
+    PosteriorConfig config;
+    int num_classes;
+    ClassThreshold thresholds[POSTERIOR_MAX_CLASSES];
+    float history[POSTERIOR_MAX_HOPS][POSTERIOR_MAX_CLASSES];
+    float sum[POSTERIOR_MAX_CLASSES];
+    float average[POSTERIOR_MAX_CLASSES];
+    int attack[POSTERIOR_MAX_CLASSES];
+    int head;
+    int filled;
+    int active;
+    int release;
+    bool onset;
+    uint32_t detections;
+
+  public:
+    PosteriorFilter(int num_classes, const ClassThreshold *class_thresholds,
+                    const PosteriorConfig &posterior_config = kPosteriorConfigDefault);
+    int process(const float* posteriors);
+    void reset();
+    bool raised() const { return onset; }
+    int active_class() const { return active; }
+    /* Posteriors averaged over the last hops */
+    const float* smoothed() const { return average; }
+    uint32_t detection_count() const { return detections; }
+};
+
+#endif
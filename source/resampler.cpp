@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Polyphase sample-rate converter, e.g. 16 kHz SAI capture to
+ * the 44.1 kHz front-end (L/M = 441/160).
+ */
+
+#include <string.h>
+
+#include "resampler.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Passband edge as a fraction of the lower Nyquist rate. The mel filterbank
+   stops at 4 kHz, so the transition band can be generous. */
+#define RESAMPLER_CUTOFF 0.8f
+/* Kaiser beta, about 80 dB stopband */
+#define RESAMPLER_KAISER_BETA 8.0f
+
+static int gcd(int a, int b)
+{
+  while (b) {
+    int t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+Resampler::Resampler(int in_rate, int out_rate, int taps_per_phase)
+  : taps_per_phase(taps_per_phase)
+{
+  int g = gcd(in_rate, out_rate);
+  up = out_rate / g;
+  down = in_rate / g;
+
+  // cutoff relative to the upsampled rate in_rate * up
+  float nyquist = 0.5f * ((in_rate < out_rate) ? in_rate : out_rate);
+  coeffs = create_filter(RESAMPLER_CUTOFF * nyquist / ((float)in_rate * up), RESAMPLER_KAISER_BETA);
+
+  history = new float[taps_per_phase - 1 + RESAMPLER_BLOCK_SIZE];
+  reset();
+}
+
+Resampler::~Resampler()
+{
+  delete [] coeffs;
+  delete [] history;
+}
+
+void Resampler::reset()
+{
+  memset(history, 0, sizeof(float) * (taps_per_phase - 1));
+  // first output lines up with the first new input sample
+  phase_pos = (taps_per_phase - 1) * up;
+}
+
+/* Zeroth order modified Bessel function of the first kind, for the window */
+float Resampler::bessel_i0(float x)
+{
+  float sum = 1.0f, term = 1.0f;
+  float half_x = 0.5f * x;
+  for (int k = 1; k < 32; k++) {
+    term *= (half_x / k) * (half_x / k);
+    sum += term;
+    if (term < 1e-9f * sum)
+      break;
+  }
+  return sum;
+}
+
+float * Resampler::create_filter(float cutoff, float kaiser_beta)
+{
+  int num_taps = up * taps_per_phase;
+  float * h = new float[num_taps];
+  float center = 0.5f * (num_taps - 1);
+  float i0_beta = bessel_i0(kaiser_beta);
+
+  for (int i = 0; i < num_taps; i++) {
+    float t = i - center;
+    float sinc = (t == 0.0f) ? 1.0f : sinf(M_PI * 2.0f * cutoff * t) / (M_PI * 2.0f * cutoff * t);
+    float r = t / center;
+    float window = bessel_i0(kaiser_beta * sqrtf(1.0f - r * r)) / i0_beta;
+    // gain of up restores the level lost to zero stuffing
+    h[i] = 2.0f * cutoff * sinc * window * up;
+  }
+
+  // split into polyphase branches: branch p holds h[p + k * up], reversed
+  float * branches = new float[num_taps];
+  for (int p = 0; p < up; p++) {
+    for (int k = 0; k < taps_per_phase; k++) {
+      branches[p * taps_per_phase + (taps_per_phase - 1 - k)] = h[p + k * up];
+    }
+  }
+  delete [] h;
+  return branches;
+}
+
+/* Upper bound on the samples process() produces for num_in inputs */
+int Resampler::max_output(int num_in) const
+{
+  return (int)(((int64_t)num_in * up + down - 1) / down) + 1;
+}
+
+/*
+ * Converts num_in int16 samples and writes the result to out. Returns the
+ * number of samples written. Size out with max_output(num_in); samples that
+ * do not fit in max_out are dropped, the filter state still advances.
+ */
+int Resampler::process(const int16_t* in, int num_in, float* out, int max_out)
+{
+  int num_out = 0;
+  int history_len = taps_per_phase - 1;
+
+  while (num_in > 0) {
+    int block = (num_in < RESAMPLER_BLOCK_SIZE) ? num_in : RESAMPLER_BLOCK_SIZE;
+    for (int i = 0; i < block; i++)
+      history[history_len + i] = (float)in[i];
+
+    // every output whose newest input sample is inside this block
+    int end_pos = (history_len + block) * up;
+    while (phase_pos < end_pos) {
+      int newest = phase_pos / up;
+      int phase = phase_pos - newest * up;
+      if (num_out < max_out)
+        arm_dot_prod_f32(&history[newest - history_len], &coeffs[phase * taps_per_phase],
+                         taps_per_phase, &out[num_out++]);
+      phase_pos += down;
+    }
+
+    // keep the tail as history for the next block
+    memmove(history, &history[block], sizeof(float) * history_len);
+    phase_pos -= block * up;
+    in += block;
+    num_in -= block;
+  }
+  return num_out;
+}
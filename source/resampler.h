@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RESAMPLER_H__
+#define __RESAMPLER_H__
+
+extern "C" {
+  #include "arm_math.h"
+}
+
+/* Input samples handled per internal block, bounds the history buffer */
+#define RESAMPLER_BLOCK_SIZE 256
+#define RESAMPLER_TAPS_PER_PHASE 16
+
+/*
+ * Streaming rational sample-rate converter (in_rate -> out_rate) between the
+ * SAI capture and the feature extractor. The prototype lowpass is a Kaiser
+ * windowed sinc split into L polyphase branches, stored time reversed so each
+ * output sample is a single arm_dot_prod_f32 over the input history. History
+ * and phase carry across process() calls, so capture buffers of any size can
+ * be fed back to back. Output is float in int16 scale, as KWS_MFCC expects.
+ */
+class Resampler
+{
+  private:
+    int up;                 // L, interpolation factor
+    int down;               // M, decimation factor
+    int taps_per_phase;
+    float * coeffs;         // up x taps_per_phase, each branch time reversed
+    float * history;        // taps_per_phase - 1 past samples + one block
+    int phase_pos;          // next output position in upsampled time, relative to history[0]
+    float * create_filter(float cutoff, float kaiser_beta);
+
+    static float bessel_i0(float x);
+
+  public:
+    Resampler(int in_rate, int out_rate, int taps_per_phase = RESAMPLER_TAPS_PER_PHASE);
+    ~Resampler();
+    int process(const int16_t* in, int num_in, float* out, int max_out);
+    int max_output(int num_in) const;
+    void reset();
+};
+
+#endif
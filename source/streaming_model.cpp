@@ -0,0 +1,482 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Streaming inference for the 1-D conv model with per-layer
+ * activation caching along the time axis.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <iostream>
+
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/interpreter.h"
+#include "streaming_model.h"
+#include "memory_tiers.h"
+
+extern "C" {
+  #include "arm_math.h"
+}
+
+#define LOG(x) std::cout
+
+static inline int ceil_div(int a, int b)
+{
+  return (a <= 0) ? 0 : (a + b - 1) / b;
+}
+
+static inline float activate(float x, TfLiteFusedActivation activation)
+{
+  if (activation == kTfLiteActRelu)
+    return (x < 0.0f) ? 0.0f : x;
+  if (activation == kTfLiteActRelu6)
+    return (x < 0.0f) ? 0.0f : ((x > 6.0f) ? 6.0f : x);
+  return x;
+}
+
+static inline float activation_min(TfLiteFusedActivation activation)
+{
+  return (activation == kTfLiteActNone) ? -FLT_MAX : 0.0f;
+}
+
+static inline float activation_max(TfLiteFusedActivation activation)
+{
+  return (activation == kTfLiteActRelu6) ? 6.0f : FLT_MAX;
+}
+
+static inline bool supported_activation(TfLiteFusedActivation activation)
+{
+  return activation == kTfLiteActNone || activation == kTfLiteActRelu ||
+         activation == kTfLiteActRelu6;
+}
+
+/* Leading padding as TFLite computes it for SAME */
+static int leading_pad(TfLitePadding padding, int in_len, int out_len, int kernel, int stride)
+{
+  if (padding != kTfLitePaddingSame)
+    return 0;
+  int total = (out_len - 1) * stride + kernel - in_len;
+  return (total > 0) ? total / 2 : 0;
+}
+
+StreamingModel::StreamingModel()
+  : fc_out(0)
+{
+  clear();
+}
+
+StreamingModel::~StreamingModel()
+{
+  clear();
+}
+
+void StreamingModel::clear()
+{
+  for (size_t i = 0; i < layers.size(); i++) {
+    MemoryTierFree(layers[i].out);
+    MemoryTierFree(layers[i].packed);
+  }
+  layers.clear();
+  delete [] fc_out;
+  fc_out = 0;
+  fc_weights = 0;
+  fc_bias = 0;
+  fc_inputs = 0;
+  fc_units = 0;
+  fc_activation = kTfLiteActNone;
+  has_softmax = false;
+  softmax_beta = 1.0f;
+  full_macs = 0;
+  last_macs = 0;
+  reset();
+}
+
+void StreamingModel::add_conv(int in_len, int in_ch, int out_len, int out_ch, int kernel,
+                              int stride, TfLitePadding padding, const float *weights,
+                              const float *bias, TfLiteFusedActivation activation)
+{
+  StreamLayer layer;
+  layer.type = STREAM_LAYER_CONV;
+  layer.in_len = in_len;
+  layer.in_ch = in_ch;
+  layer.out_len = out_len;
+  layer.out_ch = out_ch;
+  layer.kernel = kernel;
+  layer.stride = stride;
+  layer.pad = leading_pad(padding, in_len, out_len, kernel, stride);
+  layer.packed = (float *)MemoryTierAlloc(HOT_WEIGHTS_TIER, Conv1dPackedSize(out_ch, kernel, in_ch) *
+                                          sizeof(float), "stream conv weights");
+  Conv1dPackWeights(weights, out_ch, kernel, in_ch, layer.packed);
+  layer.bias = bias;
+  layer.activation = activation;
+  layer.out = (float *)MemoryTierAlloc(TENSOR_ARENA_TIER, out_len * out_ch * sizeof(float),
+                                       "stream conv cache");
+  layers.push_back(layer);
+  full_macs += out_len * out_ch * kernel * in_ch;
+  reset();
+}
+
+void StreamingModel::add_max_pool(int in_len, int channels, int out_len, int filter, int stride,
+                                  TfLitePadding padding, TfLiteFusedActivation activation)
+{
+  StreamLayer layer;
+  layer.type = STREAM_LAYER_MAX_POOL;
+  layer.in_len = in_len;
+  layer.in_ch = channels;
+  layer.out_len = out_len;
+  layer.out_ch = channels;
+  layer.kernel = filter;
+  layer.stride = stride;
+  layer.pad = leading_pad(padding, in_len, out_len, filter, stride);
+  layer.packed = 0;
+  layer.bias = 0;
+  layer.activation = activation;
+  layer.out = (float *)MemoryTierAlloc(TENSOR_ARENA_TIER, out_len * channels * sizeof(float),
+                                       "stream pool cache");
+  layers.push_back(layer);
+  reset();
+}
+
+void StreamingModel::set_head(int inputs, int units, const float *weights, const float *bias,
+                              TfLiteFusedActivation activation, bool softmax, float beta)
+{
+  fc_inputs = inputs;
+  fc_units = units;
+  fc_weights = weights;
+  fc_bias = bias;
+  fc_activation = activation;
+  has_softmax = softmax;
+  softmax_beta = beta;
+  delete [] fc_out;
+  fc_out = new float[units];
+  full_macs += inputs * units;
+}
+
+/*
+ * Maps the interpreter's execution plan onto layers. Only a single chain of
+ * RESHAPE, CONV_2D and MAX_POOL_2D over a 1xT or Tx1 float tensor, then
+ * FULLY_CONNECTED and an optional SOFTMAX, is accepted; anything else returns
+ * false and the caller keeps using Invoke.
+ */
+bool StreamingModel::build(tflite::Interpreter *interpreter)
+{
+  return build(interpreter->primary_subgraph().context(), interpreter->inputs()[0],
+               interpreter->outputs()[0]);
+}
+
+/*
+ * Same mapping through the TfLiteContext node API, for a graph running from
+ * tensor input to tensor output.
+ */
+bool StreamingModel::build(TfLiteContext *context, int input, int output)
+{
+  clear();
+
+  int current = input;
+  bool head_done = false;
+
+  TfLiteIntArray *execution_plan;
+  if (context->GetExecutionPlan(context, &execution_plan) != kTfLiteOk)
+    return false;
+
+  /* a delegate node (PlannedArena) stands for the nodes it replaced */
+  std::vector<int> plan;
+  for (int i = 0; i < execution_plan->size; i++)
+  {
+    TfLiteNode *node;
+    TfLiteRegistration *reg;
+    if (context->GetNodeAndRegistration(context, execution_plan->data[i], &node, &reg) != kTfLiteOk)
+      return false;
+    if (reg->builtin_code == kTfLiteBuiltinDelegate)
+    {
+      const TfLiteIntArray *replaced = ((const TfLiteDelegateParams *)node->builtin_data)->nodes_to_replace;
+      plan.insert(plan.end(), replaced->data, replaced->data + replaced->size);
+    }
+    else
+    {
+      plan.push_back(execution_plan->data[i]);
+    }
+  }
+
+  for (int node_index : plan)
+  {
+    TfLiteNode *node_ptr;
+    TfLiteRegistration *reg_ptr;
+    if (context->GetNodeAndRegistration(context, node_index, &node_ptr, &reg_ptr) != kTfLiteOk)
+      return false;
+    const TfLiteNode &node = *node_ptr;
+    const TfLiteRegistration &reg = *reg_ptr;
+
+    /* reshapes aliased by GraphOptimizer share memory with their input */
+    bool chained = node.inputs->data[0] == current ||
+                   context->tensors[node.inputs->data[0]].data.raw == context->tensors[current].data.raw;
+    if (!chained || node.outputs->size != 1)
+    {
+      LOG(INFO) << "Streaming: graph is not a single chain\r\n";
+      return false;
+    }
+    const TfLiteTensor *in = &context->tensors[node.inputs->data[0]];
+    const TfLiteTensor *out = &context->tensors[node.outputs->data[0]];
+    if (in->type != kTfLiteFloat32 || out->type != kTfLiteFloat32)
+    {
+      LOG(INFO) << "Streaming: float models only\r\n";
+      return false;
+    }
+
+    /* time runs along W for [1,1,T,C] and along H for [1,T,1,C] */
+    bool is_4d = in->dims->size == 4 && in->dims->data[0] == 1;
+    bool time_w = is_4d && in->dims->data[1] == 1;
+    int time_axis = time_w ? 2 : 1;
+
+    switch (reg.builtin_code)
+    {
+      case kTfLiteBuiltinReshape:
+        break;
+
+      case kTfLiteBuiltinConv2d:
+      {
+        const TfLiteConvParams *params = (const TfLiteConvParams *)node.builtin_data;
+        const TfLiteTensor *filter = &context->tensors[node.inputs->data[1]];
+        const TfLiteTensor *bias = (node.inputs->size > 2 && node.inputs->data[2] >= 0) ?
+                                   &context->tensors[node.inputs->data[2]] : 0;
+        if (head_done || !is_4d || (!time_w && in->dims->data[2] != 1) ||
+            filter->dims->data[time_w ? 1 : 2] != 1 ||
+            params->dilation_width_factor != 1 || params->dilation_height_factor != 1 ||
+            filter->type != kTfLiteFloat32 || !supported_activation(params->activation))
+        {
+          LOG(INFO) << "Streaming: unsupported CONV_2D\r\n";
+          return false;
+        }
+        add_conv(in->dims->data[time_axis], in->dims->data[3],
+                 out->dims->data[time_axis], out->dims->data[3],
+                 filter->dims->data[time_axis],
+                 time_w ? params->stride_width : params->stride_height,
+                 params->padding, filter->data.f, bias ? bias->data.f : 0,
+                 params->activation);
+        break;
+      }
+
+      case kTfLiteBuiltinMaxPool2d:
+      {
+        const TfLitePoolParams *params = (const TfLitePoolParams *)node.builtin_data;
+        if (head_done || !is_4d || (!time_w && in->dims->data[2] != 1) ||
+            (time_w ? params->filter_height : params->filter_width) != 1 ||
+            !supported_activation(params->activation))
+        {
+          LOG(INFO) << "Streaming: unsupported MAX_POOL_2D\r\n";
+          return false;
+        }
+        add_max_pool(in->dims->data[time_axis], in->dims->data[3],
+                     out->dims->data[time_axis],
+                     time_w ? params->filter_width : params->filter_height,
+                     time_w ? params->stride_width : params->stride_height,
+                     params->padding, params->activation);
+        break;
+      }
+
+      case kTfLiteBuiltinFullyConnected:
+      {
+        const TfLiteFullyConnectedParams *params = (const TfLiteFullyConnectedParams *)node.builtin_data;
+        const TfLiteTensor *weights = &context->tensors[node.inputs->data[1]];
+        const TfLiteTensor *bias = (node.inputs->size > 2 && node.inputs->data[2] >= 0) ?
+                                   &context->tensors[node.inputs->data[2]] : 0;
+        int inputs = weights->dims->data[1];
+        if (head_done || layers.empty() || weights->type != kTfLiteFloat32 ||
+            inputs != layers.back().out_len * layers.back().out_ch ||
+            !supported_activation(params->activation))
+        {
+          LOG(INFO) << "Streaming: unsupported FULLY_CONNECTED\r\n";
+          return false;
+        }
+        set_head(inputs, weights->dims->data[0], weights->data.f, bias ? bias->data.f : 0,
+                 params->activation, false, 1.0f);
+        head_done = true;
+        break;
+      }
+
+      case kTfLiteBuiltinSoftmax:
+      {
+        const TfLiteSoftmaxParams *params = (const TfLiteSoftmaxParams *)node.builtin_data;
+        if (!head_done || has_softmax)
+        {
+          LOG(INFO) << "Streaming: unsupported SOFTMAX\r\n";
+          return false;
+        }
+        has_softmax = true;
+        softmax_beta = params->beta;
+        break;
+      }
+
+      default:
+        LOG(INFO) << "Streaming: unsupported op " << reg.builtin_code << "\r\n";
+        return false;
+    }
+    current = node.outputs->data[0];
+  }
+
+  if (!head_done || current != output)
+  {
+    LOG(INFO) << "Streaming: no fully connected head on the output\r\n";
+    return false;
+  }
+  return true;
+}
+
+/* Hop length the caches stay aligned to, product of all strides */
+int StreamingModel::alignment() const
+{
+  int align = 1;
+  for (size_t i = 0; i < layers.size(); i++)
+    align *= layers[i].stride;
+  return align;
+}
+
+void StreamingModel::shift(int frames)
+{
+  pending_shift += frames;
+}
+
+void StreamingModel::reset()
+{
+  pending_shift = 0;
+  cache_valid = false;
+}
+
+/* Output columns [begin, end) of one layer */
+void StreamingModel::run_layer(StreamLayer &layer, const float *in, int begin, int end)
+{
+  for (int j = begin; j < end; j++)
+  {
+    int start = j * layer.stride - layer.pad;
+    int k0 = (start < 0) ? -start : 0;
+    int k1 = (start + layer.kernel > layer.in_len) ? layer.in_len - start : layer.kernel;
+
+    if (layer.type == STREAM_LAYER_CONV)
+    {
+      last_macs += (k1 - k0) * layer.in_ch * layer.out_ch;
+      continue;
+    }
+
+    const float *x = in + (start + k0) * layer.in_ch;
+    float *y = layer.out + j * layer.out_ch;
+    for (int c = 0; c < layer.out_ch; c++)
+    {
+      float m = -FLT_MAX;
+      for (int k = 0; k < k1 - k0; k++)
+        m = fmaxf(m, x[k * layer.in_ch + c]);
+      y[c] = activate(m, layer.activation);
+    }
+  }
+
+  if (layer.type == STREAM_LAYER_CONV)
+  {
+    Conv1dParams params = {layer.in_len, layer.in_ch, layer.out_len, layer.out_ch,
+                           layer.kernel, layer.stride, layer.pad,
+                           activation_min(layer.activation), activation_max(layer.activation)};
+    Conv1dFloat(params, in, layer.packed, layer.bias, layer.out, begin, end);
+  }
+}
+
+void StreamingModel::run_head()
+{
+  const float *flat = layers.back().out;
+  for (int u = 0; u < fc_units; u++)
+  {
+    float32_t acc;
+    arm_dot_prod_f32((float32_t *)flat, (float32_t *)&fc_weights[u * fc_inputs], fc_inputs, &acc);
+    if (fc_bias)
+      acc += fc_bias[u];
+    fc_out[u] = activate(acc, fc_activation);
+  }
+  last_macs += fc_inputs * fc_units;
+
+  if (has_softmax)
+  {
+    float max_val = fc_out[0];
+    for (int u = 1; u < fc_units; u++)
+      max_val = fmaxf(max_val, fc_out[u]);
+    float sum = 0.0f;
+    for (int u = 0; u < fc_units; u++)
+    {
+      fc_out[u] = expf((fc_out[u] - max_val) * softmax_beta);
+      sum += fc_out[u];
+    }
+    for (int u = 0; u < fc_units; u++)
+      fc_out[u] /= sum;
+  }
+}
+
+/*
+ * Runs the model on the feature window (layers[0].in_len x in_ch floats,
+ * oldest frame first) and returns the fc_units scores.
+ *
+ * Each layer tracks the columns of its input that differ from the shifted
+ * previous input: a leading run [0, dirty_begin) next to the padded border and
+ * a trailing run [dirty_end, in_len) holding new frames. An output column is
+ * reused, shifted by shift/stride, only if its receptive field avoids both.
+ */
+const float* StreamingModel::invoke(const float *window)
+{
+  bool full = !cache_valid || pending_shift <= 0 || (pending_shift % alignment()) != 0;
+  int shift = pending_shift;
+  int dirty_begin = 0;
+  int dirty_end = full ? 0 : layers[0].in_len - shift;
+  const float *in = window;
+
+  last_macs = 0;
+  for (size_t i = 0; i < layers.size(); i++)
+  {
+    StreamLayer &layer = layers[i];
+    int begin = layer.out_len, end = 0;
+
+    if (!full && dirty_end > 0)
+    {
+      int out_shift = shift / layer.stride;
+      begin = ceil_div(dirty_begin + layer.pad, layer.stride);
+      end = ceil_div(dirty_end + layer.pad - layer.kernel + 1, layer.stride);
+      if (end > layer.out_len - out_shift)
+        end = layer.out_len - out_shift;
+      if (begin < end)
+        memmove(layer.out + begin * layer.out_ch, layer.out + (begin + out_shift) * layer.out_ch,
+                sizeof(float) * (end - begin) * layer.out_ch);
+      shift = out_shift;
+    }
+
+    if (begin >= end)
+    {
+      run_layer(layer, in, 0, layer.out_len);
+      dirty_begin = 0;
+      dirty_end = 0;
+    }
+    else
+    {
+      run_layer(layer, in, 0, begin);
+      run_layer(layer, in, end, layer.out_len);
+      dirty_begin = begin;
+      dirty_end = end;
+    }
+    in = layer.out;
+  }
+
+  run_head();
+  cache_valid = true;
+  pending_shift = 0;
+  return fc_out;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __STREAMING_MODEL_H__
+#define __STREAMING_MODEL_H__
+
+#include <stdint.h>
+#include <vector>
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "conv1d_kernels.h"
+
+namespace tflite {
+class Interpreter;
+}
+
+typedef enum {
+  STREAM_LAYER_CONV,
+  STREAM_LAYER_MAX_POOL,
+} stream_layer_t;
+
+/*
+ * One layer along the time axis. Activations are [len x channels], time
+ * major, which is also the TFLite layout of the 1xT / Tx1 NHWC tensors.
+ */
+typedef struct {
+  stream_layer_t type;
+  int in_len;
+  int in_ch;
+  int out_len;
+  int out_ch;
+  int kernel;
+  int stride;
+  int pad;                      // leading padding, TFLite SAME convention
+  float *packed;                // conv only, Conv1dPackWeights layout
+  const float *bias;            // conv only, may be NULL
+  TfLiteFusedActivation activation;
+  float *out;                   // cached activations
+} StreamLayer;
+
+/*
+ * Streaming evaluation of a 1-D conv / max-pool stack followed by a fully
+ * connected (+ softmax) head, built from the interpreter's float graph.
+ *
+ * Consecutive windows of KWS_MFCC overlap in all but the hop frames, so each
+ * layer keeps its activations for the previous window. When the window has
+ * moved by a multiple of alignment() frames, the cache is shifted and only
+ * the columns that see new frames or a padded border are recomputed; the
+ * head always runs on the full cached activations. Results match a full
+ * window Invoke up to float summation order.
+ *
+ * shift() must be told every move of the feature window, including windows
+ * that were not run (VAD skips); anything else goes through reset().
+ */
+class StreamingModel
+{
+  private:
+    std::vector<StreamLayer> layers;
+    const float *fc_weights;    // [fc_units x fc_inputs]
+    const float *fc_bias;
+    int fc_inputs;
+    int fc_units;
+    TfLiteFusedActivation fc_activation;
+    bool has_softmax;
+    float softmax_beta;
+    float *fc_out;
+    int pending_shift;
+    bool cache_valid;
+    uint32_t last_macs;
+    uint32_t full_macs;
+
+    void clear();
+    void run_layer(StreamLayer &layer, const float *in, int begin, int end);
+    void run_head();
+
+  public:
+    StreamingModel();
+    ~StreamingModel();
+    bool build(tflite::Interpreter *interpreter);
+    bool build(TfLiteContext *context, int input, int output);
+    void add_conv(int in_len, int in_ch, int out_len, int out_ch, int kernel, int stride,
+                  TfLitePadding padding, const float *weights, const float *bias,
+                  TfLiteFusedActivation activation);
+    void add_max_pool(int in_len, int channels, int out_len, int filter, int stride,
+                      TfLitePadding padding, TfLiteFusedActivation activation);
+    void set_head(int inputs, int units, const float *weights, const float *bias,
+                  TfLiteFusedActivation activation, bool softmax, float beta);
+    void shift(int frames);
+    void reset();
+    const float* invoke(const float *window);
+    int alignment() const;
+    int output_size() const { return fc_units; }
+    uint32_t macs() const { return last_macs; }
+    uint32_t macs_full_window() const { return full_macs; }
+};
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Energy and zero-crossing rate voice activity detector used to
+ * gate feature extraction and inference on silence.
+ */
+
+#include <math.h>
+#include "vad.h"
+
+extern "C" {
+  #include "arm_math.h"
+}
+
+/* int16 full scale power, 32768^2 */
+#define VAD_FULL_SCALE_POWER 1073741824.0f
+
+VAD::VAD(int frame_size, const VadConfig &vad_config)
+  : config(vad_config), frame_size(frame_size)
+{
+  reset();
+  reset_stats();
+}
+
+void VAD::reset()
+{
+  // start by assuming a quiet room, the floor drops or creeps up from here
+  noise_floor_db = config.min_energy_db;
+  hangover = 0;
+}
+
+void VAD::reset_stats()
+{
+  windows_total = 0;
+  windows_skipped = 0;
+}
+
+float VAD::skipped_fraction() const
+{
+  if (windows_total == 0)
+    return 0.0f;
+  return (float)windows_skipped / windows_total;
+}
+
+bool VAD::frame_active(const float* frame)
+{
+  float32_t power;
+  arm_dot_prod_f32((float32_t *)frame, (float32_t *)frame, frame_size, &power);
+  float energy_db = 10.0f * log10f(power / (frame_size * VAD_FULL_SCALE_POWER) + 1e-12f);
+
+  int crossings = 0;
+  for (int i = 1; i < frame_size; i++) {
+    if ((frame[i - 1] < 0.0f) != (frame[i] < 0.0f))
+      crossings++;
+  }
+  float zcr = (float)crossings / frame_size;
+
+  bool active = (energy_db > noise_floor_db + config.margin_db) &&
+                (energy_db > config.min_energy_db) &&
+                (zcr <= config.zcr_max);
+
+  // follow quieter frames at once, rise slowly so onsets stay above the floor
+  if (energy_db < noise_floor_db)
+    noise_floor_db = energy_db;
+  else if (energy_db - noise_floor_db > config.floor_rise_db)
+    noise_floor_db += config.floor_rise_db;
+  else
+    noise_floor_db = energy_db;
+
+  return active;
+}
+
+bool VAD::process(const float* audio, int num_samples)
+{
+  bool window_active = false;
+
+  for (int i = 0; i + frame_size <= num_samples; i += frame_size) {
+    if (frame_active(audio + i))
+      hangover = config.hangover_frames + 1;
+    if (hangover > 0) {
+      hangover--;
+      window_active = true;
+    }
+  }
+
+  windows_total++;
+  if (!window_active)
+    windows_skipped++;
+  return window_active;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __VAD_H__
+#define __VAD_H__
+
+#include <stdint.h>
+
+/*
+ * Tuning of the activity detector. Levels are in dB relative to int16 full
+ * scale. A frame is active when its energy is margin_db above the tracked
+ * noise floor, above min_energy_db, and its zero-crossing rate (crossings per
+ * sample) is at most zcr_max, which rejects broadband hiss. The floor follows
+ * quieter frames immediately and rises by at most floor_rise_db per frame.
+ */
+typedef struct {
+  float margin_db;
+  float min_energy_db;
+  float zcr_max;
+  float floor_rise_db;
+  int hangover_frames;   // frames kept active after the last active frame
+} VadConfig;
+
+/* 10 ms frames: 2 dB/s floor rise, 300 ms hangover */
+static const VadConfig kVadConfigDefault = {9.0f, -60.0f, 0.35f, 0.02f, 30};
+
+/*
+ * Streaming energy / zero-crossing activity detector placed in front of
+ * KWS_MFCC. process() is called once per analysis window with the audio that
+ * is new in that window, is split into frame_size sample frames and returns
+ * whether any of them was active or still inside the hangover. Noise floor
+ * and hangover carry across calls. Skip counters give the gate duty cycle.
+ */
+class VAD
+{
+  private:
+    VadConfig config;
+    int frame_size;
+    float noise_floor_db;
+    int hangover;
+    uint32_t windows_total;
+    uint32_t windows_skipped;
+    bool frame_active(const float* frame);
+
+  public:
+    VAD(int frame_size, const VadConfig &vad_config = kVadConfigDefault);
+    bool process(const float* audio, int num_samples);
+    void reset();
+    void reset_stats();
+    uint32_t total_windows() const { return windows_total; }
+    uint32_t skipped_windows() const { return windows_skipped; }
+    /* Fraction of windows that skipped feature extraction and inference */
+    float skipped_fraction() const;
+};
+
+#endif
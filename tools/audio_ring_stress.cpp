@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host stress test of the capture ring (source/audio_ring.h).
+ * A producer thread stands in for the SAI interrupt: it fills the write
+ * block with a pattern of its sequence number, as the DMA would, and
+ * commits it. The consumer peeks spans of a random number of blocks,
+ * wrapped or not, checks them in place and releases them, stalling now and
+ * then so the producer overruns.
+ *
+ * Every block read must hold a single sequence number (no torn block),
+ * sequence numbers must increase, and the gaps between them must add up to
+ * the overruns the ring counted. Any violation fails the run.
+ *
+ *   g++ -O2 -pthread -Isource tools/audio_ring_stress.cpp source/audio_ring.cpp \
+ *       -o audio_ring_stress
+ *   ./audio_ring_stress [blocks] [ring_blocks]
+ *
+ * Build with -fsanitize=thread as well to check the memory ordering.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "audio_ring.h"
+
+/* 32-bit words per block, the firmware's is 256 (1 KB) */
+#define BLOCK_WORDS 64
+
+static uint32_t pattern(uint32_t seq, int word)
+{
+  return seq * 2654435761u + word;
+}
+
+/* The sequence number of a block, 0xffffffff if it is torn */
+static uint32_t check_block(const uint8_t *block)
+{
+  const uint32_t *words = (const uint32_t *)block;
+  uint32_t seq = words[0];
+  for (int i = 1; i < BLOCK_WORDS; i++)
+    if (words[i] != pattern(seq, i))
+      return 0xffffffffu;
+  return seq;
+}
+
+int main(int argc, char **argv)
+{
+  const uint32_t total = (argc > 1) ? strtoul(argv[1], NULL, 0) : 200000;
+  const uint32_t ring_blocks = (argc > 2) ? strtoul(argv[2], NULL, 0) : 16;
+  if (ring_blocks < 2 || (ring_blocks & (ring_blocks - 1))) {
+    fprintf(stderr, "ring_blocks must be a power of two\n");
+    return 1;
+  }
+
+  std::vector<uint32_t> memory(ring_blocks * BLOCK_WORDS);
+  AudioRing ring((uint8_t *)memory.data(), BLOCK_WORDS * sizeof(uint32_t), ring_blocks);
+  std::atomic<bool> done(false);
+
+  /* the capture: one sequence number per block, committed or dropped */
+  std::thread producer([&]() {
+    std::mt19937 pace(2);
+    for (uint32_t seq = 0; seq < total; seq++) {
+      /* blocks come at an irregular but bounded rate, like DMA completions */
+      for (volatile uint32_t spin = pace() % 512; spin; spin--)
+        ;
+      uint32_t *words = (uint32_t *)ring.write_block();
+      words[0] = seq;
+      for (int i = 1; i < BLOCK_WORDS; i++)
+        words[i] = pattern(seq, i);
+      ring.commit();
+      /* the interrupt returns to the main loop, also on a single core host */
+      if (pace() % 8 == 0)
+        std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+  });
+
+  std::mt19937 rng(1);
+  uint32_t read = 0, torn = 0, disorder = 0, gaps = 0, wrapped = 0;
+  int64_t last = -1;
+  for (;;) {
+    bool finished = done.load(std::memory_order_acquire);
+    uint32_t available = ring.available();
+    if (available == 0) {
+      if (finished)
+        break;
+      continue;
+    }
+    uint32_t blocks = 1 + rng() % available;
+    AudioSpan span;
+    if (!ring.peek(blocks, &span)) {
+      fprintf(stderr, "peek of %u blocks failed with %u available\n", blocks, available);
+      return 1;
+    }
+    wrapped += (span.second != NULL);
+
+    const uint8_t *parts[2] = {span.first, span.second};
+    const uint32_t sizes[2] = {span.first_size, span.second_size};
+    for (int p = 0; p < 2; p++) {
+      for (uint32_t offset = 0; offset < sizes[p]; offset += ring.block_bytes()) {
+        uint32_t seq = check_block(parts[p] + offset);
+        if (seq == 0xffffffffu) {
+          torn++;
+          continue;
+        }
+        if ((int64_t)seq <= last)
+          disorder++;
+        else
+          gaps += seq - last - 1;
+        last = seq;
+        read++;
+      }
+    }
+    /* a slow reader now and then, so the producer overruns */
+    if (rng() % 4096 == 0)
+      std::this_thread::sleep_for(std::chrono::microseconds(rng() % 200));
+    ring.release(blocks);
+  }
+  producer.join();
+  /* blocks dropped after the last one read are overruns too */
+  gaps += total - 1 - last;
+
+  printf("%u blocks: %u read, %u overruns, %u wrapped spans\n",
+         total, read, ring.overruns(), wrapped);
+  printf("torn %u, out of order %u, missing %u\n", torn, disorder, gaps);
+  if (torn || disorder || gaps != ring.overruns()) {
+    printf("FAILED\n");
+    return 1;
+  }
+  printf("passed\n");
+  return 0;
+}
@@ -0,0 +1,474 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that scores a model on the whole dataset. Clips
+ * are read from one directory per label (16-bit PCM WAV, as converted in
+ * the README), resampled to the front-end rate and cut into back to back
+ * windows of the firmware's size. Features are extracted by KWS_MFCC on
+ * one thread per core, and the interpreter's input is resized to a batch
+ * of windows so a single Invoke scores the whole batch. A clip is
+ * classified by the mean scores of its windows.
+ *
+ * It prints clips per second, the accuracy and a confusion matrix with
+ * the recall of each label.
+ *
+ * -s sets the window step in frames, the live hop (8) instead of a whole
+ * window, and -o writes the scores of every window to a CSV file, one
+ * line per window in clip order: clip, label, window, then the scores.
+ * tools/posterior_replay.cpp replays those through PosteriorFilter.
+ *
+ *   g++ -O2 -pthread -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -I<cmsis-dsp>/Include -DARM_MATH_CM7 \
+ *       -DMODEL_HEADER='"ds_cnn_s_model.h"' -DMODEL_NAME=ds_cnn_s_model \
+ *       tools/batch_eval.cpp source/kws_mfcc.cpp source/mfcc.cpp \
+ *       source/mfcc_tables.cpp source/resampler.cpp source/fp16_weights.cpp \
+ *       source/memory_tiers.cpp \
+ *       -L<tflite-host> -ltensorflow-lite -L<cmsis-dsp> -lCMSISDSP \
+ *       -o batch_eval
+ *   ./batch_eval [-s step_frames] [-o scores.csv] dataset/ [batch_size] [model.tflite]
+ *
+ * libtensorflow-lite.a in libs/ is built for the M7; link a host build of
+ * the same TensorFlow Lite version (tensorflow/lite/tools/make).
+ *
+ * Experimental: not yet run against a host TensorFlow Lite, there are no
+ * reference accuracy or throughput figures to compare with.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/kernels/register.h"
+#include "tensorflow/lite/model.h"
+#include "kws_mfcc.h"
+#include "resampler.h"
+#include "fp16_weights.h"
+
+#ifdef MODEL_HEADER
+#include MODEL_HEADER
+#define CAT_(a, b) a##b
+#define CAT(a, b) CAT_(a, b)
+#endif
+
+/* Windows per Invoke unless given on the command line */
+#define EVAL_BATCH_SIZE 32
+
+/* Label order of the model's output, one dataset directory each */
+static const char *kLabels[] = {"baby_cry", "baby_laugh", "silence"};
+static const int kNumLabels = sizeof(kLabels) / sizeof(kLabels[0]);
+
+struct Clip {
+  std::string path;
+  int label;
+  std::vector<float> audio;     // front-end rate, int16 scale
+  std::vector<float> scores;    // summed over the clip's windows
+  int windows;
+};
+
+struct Window {
+  int clip;
+  int offset;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds_since(Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static bool read_file(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size);
+  bool ok = fread(data.data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+static uint32_t le32(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t le16(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+/* First channel of a 16-bit PCM WAV file */
+static bool read_wav(const char *path, std::vector<int16_t> &samples, int *rate)
+{
+  std::vector<unsigned char> data;
+  if (!read_file(path, data) || data.size() < 12 ||
+      memcmp(data.data(), "RIFF", 4) || memcmp(data.data() + 8, "WAVE", 4))
+    return false;
+
+  int channels = 0, bits = 0, format = 0;
+  size_t pos = 12;
+  while (pos + 8 <= data.size()) {
+    const unsigned char *chunk = data.data() + pos;
+    size_t size = le32(chunk + 4);
+    size_t body = pos + 8;
+    if (body + size > data.size())
+      size = data.size() - body;
+    if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+      format = le16(chunk + 8);
+      channels = le16(chunk + 10);
+      *rate = le32(chunk + 12);
+      bits = le16(chunk + 22);
+    } else if (!memcmp(chunk, "data", 4)) {
+      if (format != 1 || bits != 16 || channels < 1)
+        return false;
+      size_t frames = size / (2 * channels);
+      samples.resize(frames);
+      for (size_t i = 0; i < frames; i++)
+        samples[i] = (int16_t)le16(data.data() + body + 2 * channels * i);
+      return true;
+    }
+    pos = body + size + (size & 1);
+  }
+  return false;
+}
+
+/* Every WAV of dataset/<label>/ converted to the front-end rate */
+static bool load_dataset(const std::string &root, int samp_freq, std::vector<Clip> &clips)
+{
+  for (int label = 0; label < kNumLabels; label++) {
+    std::string dir = root + "/" + kLabels[label];
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+      fprintf(stderr, "no directory %s\n", dir.c_str());
+      return false;
+    }
+    std::vector<std::string> names;
+    while (struct dirent *entry = readdir(d)) {
+      std::string name = entry->d_name;
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".wav") == 0)
+        names.push_back(name);
+    }
+    closedir(d);
+    std::sort(names.begin(), names.end());
+
+    for (size_t i = 0; i < names.size(); i++) {
+      Clip clip;
+      clip.path = dir + "/" + names[i];
+      clip.label = label;
+      clip.windows = 0;
+      std::vector<int16_t> pcm;
+      int rate = 0;
+      if (!read_wav(clip.path.c_str(), pcm, &rate)) {
+        fprintf(stderr, "skipping %s: not 16-bit PCM WAV\n", clip.path.c_str());
+        continue;
+      }
+      if (rate == samp_freq) {
+        clip.audio.assign(pcm.begin(), pcm.end());
+      } else {
+        Resampler resampler(rate, samp_freq);
+        clip.audio.resize(resampler.max_output(pcm.size()));
+        clip.audio.resize(resampler.process(pcm.data(), pcm.size(),
+                                            clip.audio.data(), clip.audio.size()));
+      }
+      clips.push_back(clip);
+    }
+  }
+  return true;
+}
+
+/*
+ * The model's reshapes carry a batch of 1 in their shape tensors. Give
+ * each one its own copy with the batch size, so the graph takes the
+ * resized input.
+ */
+static void batch_reshapes(tflite::Interpreter *interpreter, int batch,
+                           std::vector<std::vector<int32_t> > &shapes)
+{
+  for (int node_index : interpreter->execution_plan()) {
+    const auto *node_reg = interpreter->node_and_registration(node_index);
+    const TfLiteNode &node = node_reg->first;
+    if (node_reg->second.builtin_code != kTfLiteBuiltinReshape || node.inputs->size != 2)
+      continue;
+    int index = node.inputs->data[1];
+    const TfLiteTensor *shape = interpreter->tensor(index);
+    if (shape->type != kTfLiteInt32 || shape->allocation_type != kTfLiteMmapRo ||
+        shape->dims->size != 1 || shape->dims->data[0] < 1 || shape->data.i32[0] != 1)
+      continue;
+
+    shapes.push_back(std::vector<int32_t>(shape->data.i32, shape->data.i32 + shape->dims->data[0]));
+    std::vector<int32_t> &copy = shapes.back();
+    copy[0] = batch;
+    interpreter->SetTensorParametersReadOnly(index, kTfLiteInt32, shape->name,
+                                             std::vector<int>(1, (int)copy.size()),
+                                             TfLiteQuantizationParams(),
+                                             (const char *)copy.data(),
+                                             copy.size() * sizeof(int32_t));
+  }
+}
+
+template <class T>
+static void quantize(const float *in, T *out, int size, const TfLiteQuantizationParams &params)
+{
+  for (int i = 0; i < size; i++) {
+    int32_t q = (int32_t)roundf(in[i] / params.scale) + params.zero_point;
+    q = std::max<int32_t>(q, std::numeric_limits<T>::min());
+    q = std::min<int32_t>(q, std::numeric_limits<T>::max());
+    out[i] = (T)q;
+  }
+}
+
+static float output_score(const TfLiteTensor *output, int index)
+{
+  switch (output->type) {
+    case kTfLiteInt8:
+      return (output->data.int8[index] - output->params.zero_point) * output->params.scale;
+    case kTfLiteUInt8:
+      return (output->data.uint8[index] - output->params.zero_point) * output->params.scale;
+    default:
+      return output->data.f[index];
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int step_frames = 0;
+  const char *scores_path = NULL;
+  int opt;
+  while ((opt = getopt(argc, argv, "s:o:")) != -1) {
+    if (opt == 's')
+      step_frames = atoi(optarg);
+    else if (opt == 'o')
+      scores_path = optarg;
+    else
+      argc = 0;
+  }
+  /* positional arguments from argv[1] on */
+  argc -= optind - 1;
+  argv += optind - 1;
+  if (argc < 2) {
+    fprintf(stderr, "usage: batch_eval [-s step_frames] [-o scores.csv] dataset_dir "
+            "[batch_size] [model.tflite]\n");
+    return 1;
+  }
+  int batch = (argc > 2) ? atoi(argv[2]) : EVAL_BATCH_SIZE;
+  if (batch < 1)
+    batch = 1;
+
+  std::vector<unsigned char> data;
+  if (argc > 3) {
+    if (!read_file(argv[3], data)) {
+      fprintf(stderr, "cannot read %s\n", argv[3]);
+      return 1;
+    }
+  } else {
+#ifdef MODEL_HEADER
+    data.assign(MODEL_NAME, MODEL_NAME + CAT(MODEL_NAME, _len));
+#else
+    fprintf(stderr, "no model given\n");
+    return 1;
+#endif
+  }
+
+  /* one full-window extractor per thread, built here: MemoryTierAlloc is not thread safe */
+  int num_threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::unique_ptr<KWS_MFCC> > extractors;
+  for (int i = 0; i < num_threads; i++)
+    extractors.emplace_back(new KWS_MFCC(kFrontendConfig44k.num_frames, kFrontendConfig44k));
+  const KWS_MFCC &geometry = *extractors[0];
+  const int feature_count = geometry.num_frames * geometry.num_mfcc_features;
+
+  Clock::time_point start = Clock::now();
+  std::vector<Clip> clips;
+  if (!load_dataset(argv[1], geometry.config.samp_freq, clips) || clips.empty())
+    return 1;
+  double load_time = seconds_since(start);
+
+  const int step = (step_frames > 0) ? step_frames * geometry.frame_shift
+                                      : geometry.audio_block_size;
+  std::vector<Window> windows;
+  for (size_t c = 0; c < clips.size(); c++) {
+    int len = clips[c].audio.size();
+    for (int offset = 0; offset + geometry.audio_buffer_size <= len; offset += step) {
+      Window w = {(int)c, offset};
+      windows.push_back(w);
+      clips[c].windows++;
+    }
+    if (clips[c].windows == 0)
+      fprintf(stderr, "%s is shorter than one window\n", clips[c].path.c_str());
+  }
+
+  std::unique_ptr<tflite::FlatBufferModel> model =
+      tflite::FlatBufferModel::BuildFromBuffer((const char *)data.data(), data.size());
+  tflite::ops::builtin::BuiltinOpResolver resolver;
+  std::unique_ptr<tflite::Interpreter> interpreter;
+  if (!model || tflite::InterpreterBuilder(*model, resolver)(&interpreter) != kTfLiteOk) {
+    fprintf(stderr, "cannot build the interpreter\n");
+    return 1;
+  }
+  interpreter->SetAllowFp16PrecisionForFp32(true);
+  if (ExpandFp16Weights(interpreter.get()) < 0)
+    return 1;
+
+  int input = interpreter->inputs()[0];
+  std::vector<std::vector<int32_t> > shapes;
+  std::vector<int> input_dims(2);
+  input_dims[0] = batch;
+  input_dims[1] = feature_count;
+  batch_reshapes(interpreter.get(), batch, shapes);
+  if (interpreter->ResizeInputTensor(input, input_dims) != kTfLiteOk ||
+      interpreter->AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "model does not take a batch of %d x %d features\n", batch, feature_count);
+    return 1;
+  }
+  TfLiteTensor *input_tensor = interpreter->tensor(input);
+  const TfLiteTensor *output_tensor = interpreter->tensor(interpreter->outputs()[0]);
+  const int num_scores = output_tensor->dims->data[output_tensor->dims->size - 1];
+  if (num_scores != kNumLabels) {
+    fprintf(stderr, "model has %d outputs for %d labels\n", num_scores, kNumLabels);
+    return 1;
+  }
+  for (size_t c = 0; c < clips.size(); c++)
+    clips[c].scores.assign(num_scores, 0.0f);
+
+  FILE *scores_file = NULL;
+  if (scores_path) {
+    scores_file = fopen(scores_path, "w");
+    if (!scores_file) {
+      fprintf(stderr, "cannot write %s\n", scores_path);
+      return 1;
+    }
+    fprintf(scores_file, "# step_ms %.1f\n", 1000.0 * step / geometry.config.samp_freq);
+  }
+
+  std::vector<float> features((size_t)batch * feature_count);
+  double feature_time = 0, invoke_time = 0;
+  start = Clock::now();
+
+  for (size_t first = 0; first < windows.size(); first += batch) {
+    int count = std::min<int>(batch, windows.size() - first);
+
+    /* features of the batch, window i on thread i % num_threads */
+    Clock::time_point t0 = Clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < num_threads && t < count; t++) {
+      workers.emplace_back([&, t]() {
+        KWS_MFCC *kws = extractors[t].get();
+        for (int i = t; i < count; i += num_threads) {
+          const Window &w = windows[first + i];
+          kws->audio_buffer = clips[w.clip].audio.data() + w.offset;
+          kws->extract_features();
+          memcpy(&features[(size_t)i * feature_count], kws->mfcc_buffer,
+                 feature_count * sizeof(float));
+        }
+      });
+    }
+    for (size_t t = 0; t < workers.size(); t++)
+      workers[t].join();
+    /* a short last batch is padded with silence and its scores ignored */
+    std::fill(features.begin() + (size_t)count * feature_count, features.end(), 0.0f);
+
+    switch (input_tensor->type) {
+      case kTfLiteInt8:
+        quantize<int8_t>(features.data(), input_tensor->data.int8, features.size(), input_tensor->params);
+        break;
+      case kTfLiteUInt8:
+        quantize<uint8_t>(features.data(), input_tensor->data.uint8, features.size(), input_tensor->params);
+        break;
+      default:
+        memcpy(input_tensor->data.f, features.data(), features.size() * sizeof(float));
+        break;
+    }
+    feature_time += seconds_since(t0);
+
+    t0 = Clock::now();
+    if (interpreter->Invoke() != kTfLiteOk) {
+      fprintf(stderr, "Invoke failed\n");
+      return 1;
+    }
+    invoke_time += seconds_since(t0);
+
+    for (int i = 0; i < count; i++) {
+      const Window &w = windows[first + i];
+      Clip &clip = clips[w.clip];
+      for (int k = 0; k < num_scores; k++)
+        clip.scores[k] += output_score(output_tensor, i * num_scores + k);
+      if (scores_file) {
+        fprintf(scores_file, "%s,%d,%d", clip.path.c_str(), clip.label, w.offset / step);
+        for (int k = 0; k < num_scores; k++)
+          fprintf(scores_file, ",%.5f", output_score(output_tensor, i * num_scores + k));
+        fprintf(scores_file, "\n");
+      }
+    }
+  }
+  double eval_time = seconds_since(start);
+  if (scores_file)
+    fclose(scores_file);
+
+  /* confusion[true label][predicted label], clips without windows left out */
+  std::vector<int> confusion(kNumLabels * kNumLabels, 0);
+  int scored = 0, correct = 0;
+  for (size_t c = 0; c < clips.size(); c++) {
+    if (clips[c].windows == 0)
+      continue;
+    const std::vector<float> &s = clips[c].scores;
+    int predicted = std::max_element(s.begin(), s.end()) - s.begin();
+    confusion[clips[c].label * kNumLabels + predicted]++;
+    correct += (predicted == clips[c].label);
+    scored++;
+  }
+
+  printf("%d clips, %d windows, batch %d, %d threads\n",
+         scored, (int)windows.size(), batch, num_threads);
+  printf("load %.2f s, features %.2f s, invoke %.2f s\n", load_time, feature_time, invoke_time);
+  printf("%.1f clips/s, %.1f windows/s\n", scored / eval_time, windows.size() / eval_time);
+  printf("accuracy %.2f%% (%d/%d)\n\n", scored ? 100.0 * correct / scored : 0.0, correct, scored);
+
+  printf("%-12s", "true\\pred");
+  for (int p = 0; p < kNumLabels; p++)
+    printf("%12s", kLabels[p]);
+  printf("%9s\n", "recall");
+  for (int l = 0; l < kNumLabels; l++) {
+    int total = 0;
+    printf("%-12s", kLabels[l]);
+    for (int p = 0; p < kNumLabels; p++) {
+      printf("%12d", confusion[l * kNumLabels + p]);
+      total += confusion[l * kNumLabels + p];
+    }
+    printf("%8.1f%%\n", total ? 100.0 * confusion[l * kNumLabels + l] / total : 0.0);
+  }
+  return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host microbenchmark for the model's convolution layers. For
+ * each layer shape it times a transcription of the TF Lite reference float
+ * Conv loop (what CONV_2D falls back to without optimized kernels) against
+ * Conv1dFloat from source/conv1d_kernels.cpp, and checks they agree.
+ *
+ *   g++ -O2 -Isource tools/conv1d_bench.cpp source/conv1d_kernels.cpp \
+ *       -o conv1d_bench
+ *   ./conv1d_bench
+ *
+ * Host timings only rank the kernels; cycle counts on the M7 have to come
+ * from the target.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include <chrono>
+#include <vector>
+#include "conv1d_kernels.h"
+
+#define BENCH_ITERATIONS 2000
+
+typedef struct {
+  const char *name;
+  int len;
+  int in_ch;
+  int out_ch;
+  int kernel;
+} LayerShape;
+
+/* conv1d and conv1d_1 of ds_cnn_s_model, SAME padding, stride 1, ReLU */
+static const LayerShape kLayers[] = {
+  {"conv1d   249x13 -> 249x8,  k3", 249, 13, 8, 3},
+  {"conv1d_1 125x8  -> 125x16, k3", 125, 8, 16, 3},
+};
+
+/* reference_ops::Conv for a [1,1,T,C] input, OHWI filter with H = 1 */
+static void reference_conv(const LayerShape &l, int pad, const float *in, const float *filter,
+                           const float *bias, float *out)
+{
+  for (int out_x = 0; out_x < l.len; ++out_x) {
+    for (int out_channel = 0; out_channel < l.out_ch; ++out_channel) {
+      const int in_x_origin = out_x - pad;
+      float total = 0.f;
+      for (int filter_x = 0; filter_x < l.kernel; ++filter_x) {
+        for (int in_channel = 0; in_channel < l.in_ch; ++in_channel) {
+          const int in_x = in_x_origin + filter_x;
+          if (in_x >= 0 && in_x < l.len) {
+            total += in[in_x * l.in_ch + in_channel] *
+                     filter[(out_channel * l.kernel + filter_x) * l.in_ch + in_channel];
+          }
+        }
+      }
+      float v = total + bias[out_channel];
+      out[out_x * l.out_ch + out_channel] = (v < 0.f) ? 0.f : v;
+    }
+  }
+}
+
+template <class F>
+static double time_us(F f)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++)
+    f();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / BENCH_ITERATIONS;
+}
+
+int main()
+{
+  printf("%-32s %10s %10s %8s %10s\n", "layer", "ref us", "opt us", "speedup", "max diff");
+  for (size_t n = 0; n < sizeof(kLayers) / sizeof(kLayers[0]); n++) {
+    const LayerShape &l = kLayers[n];
+    std::vector<float> in(l.len * l.in_ch), filter(l.out_ch * l.kernel * l.in_ch), bias(l.out_ch);
+    std::vector<float> ref(l.len * l.out_ch), opt(l.len * l.out_ch);
+    std::vector<float> packed(Conv1dPackedSize(l.out_ch, l.kernel, l.in_ch));
+    for (auto &v : in) v = rand() / (float)RAND_MAX - 0.5f;
+    for (auto &v : filter) v = rand() / (float)RAND_MAX - 0.5f;
+    for (auto &v : bias) v = rand() / (float)RAND_MAX - 0.5f;
+
+    int pad = (l.kernel - 1) / 2;
+    Conv1dParams params = {l.len, l.in_ch, l.len, l.out_ch, l.kernel, 1, pad, 0.0f, FLT_MAX};
+    Conv1dPackWeights(filter.data(), l.out_ch, l.kernel, l.in_ch, packed.data());
+
+    double t_ref = time_us([&]() { reference_conv(l, pad, in.data(), filter.data(), bias.data(), ref.data()); });
+    double t_opt = time_us([&]() { Conv1dFloat(params, in.data(), packed.data(), bias.data(), opt.data(), 0, l.len); });
+
+    float max_diff = 0.0f;
+    for (size_t i = 0; i < ref.size(); i++)
+      max_diff = fmaxf(max_diff, fabsf(ref[i] - opt[i]));
+    printf("%-32s %10.2f %10.2f %7.2fx %10.2e\n", l.name, t_ref, t_opt, t_ref / t_opt, max_diff);
+  }
+  return 0;
+}
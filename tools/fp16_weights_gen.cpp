@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that converts a float model to fp16 weight
+ * storage, e.g. source/ds_cnn_s_model_fp16.h. Every constant FLOAT32
+ * tensor with at least FP16_MIN_ELEMENTS elements (conv filters, fully
+ * connected weights) is rewritten as FLOAT16; biases and the graph stay
+ * as they are, so no DEQUANTIZE ops are added. ExpandFp16Weights()
+ * (source/fp16_weights.h) turns them back into float32 at load.
+ *
+ * The output is the model as an xxd style array, like the float header:
+ *   g++ -O2 -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -DMODEL_HEADER='"ds_cnn_s_model.h"' -DMODEL_NAME=ds_cnn_s_model \
+ *       tools/fp16_weights_gen.cpp -o fp16_weights_gen
+ *   ./fp16_weights_gen > source/ds_cnn_s_model_fp16.h
+ *   ./fp16_weights_gen model.tflite name > source/name.h
+ *
+ * The size change and the largest weight rounding error go to stderr.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "fp16.h"
+
+#ifdef MODEL_HEADER
+#include MODEL_HEADER
+#define STR_(x) #x
+#define STR(x) STR_(x)
+#define CAT_(a, b) a##b
+#define CAT(a, b) CAT_(a, b)
+#endif
+
+/* Smaller constants (biases) stay float32 */
+#define FP16_MIN_ELEMENTS 64
+
+static bool read_file(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size);
+  bool ok = fread(data.data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<unsigned char> data;
+  std::string name;
+
+  if (argc > 1) {
+    if (!read_file(argv[1], data)) {
+      fprintf(stderr, "cannot read %s\n", argv[1]);
+      return 1;
+    }
+    name = (argc > 2) ? argv[2] : "model_fp16";
+  } else {
+#ifdef MODEL_HEADER
+    data.assign(MODEL_NAME, MODEL_NAME + CAT(MODEL_NAME, _len));
+    name = std::string(STR(MODEL_NAME)) + "_fp16";
+#else
+    fprintf(stderr, "usage: %s model.tflite [name]\n", argv[0]);
+    return 1;
+#endif
+  }
+
+  flatbuffers::Verifier verifier(data.data(), data.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid TFLite model\n", name.c_str());
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(data.data());
+
+  /* a buffer is converted only if every tensor using it qualifies */
+  std::vector<int> convert(model->buffers.size(), 0);
+  for (auto &graph : model->subgraphs) {
+    for (auto &tensor : graph->tensors) {
+      const std::vector<uint8_t> &bytes = model->buffers[tensor->buffer]->data;
+      if (bytes.empty())
+        continue;
+      bool fits = tensor->type == tflite::TensorType_FLOAT32 &&
+                  bytes.size() / sizeof(float) >= FP16_MIN_ELEMENTS;
+      int &state = convert[tensor->buffer];
+      state = (state == 0 || state == 1) && fits ? 1 : -1;
+    }
+  }
+
+  int tensors = 0;
+  float max_error = 0.0f;
+  for (size_t b = 0; b < model->buffers.size(); b++) {
+    if (convert[b] != 1)
+      continue;
+    std::vector<uint8_t> &bytes = model->buffers[b]->data;
+    size_t count = bytes.size() / sizeof(float);
+    std::vector<uint8_t> half(count * sizeof(uint16_t));
+    for (size_t i = 0; i < count; i++) {
+      float value;
+      memcpy(&value, &bytes[i * sizeof(float)], sizeof(float));
+      uint16_t h = Fp16FromFloat(value);
+      memcpy(&half[i * sizeof(uint16_t)], &h, sizeof(h));
+      max_error = fmaxf(max_error, fabsf(Fp16ToFloat(h) - value));
+    }
+    bytes.swap(half);
+  }
+  for (auto &graph : model->subgraphs) {
+    for (auto &tensor : graph->tensors) {
+      if (convert[tensor->buffer] == 1) {
+        tensor->type = tflite::TensorType_FLOAT16;
+        tensors++;
+      }
+    }
+  }
+
+  flatbuffers::FlatBufferBuilder builder;
+  tflite::FinishModelBuffer(builder, tflite::Model::Pack(builder, model.get()));
+  const uint8_t *out = builder.GetBufferPointer();
+  size_t out_len = builder.GetSize();
+
+  fprintf(stderr, "%s: %d tensors to fp16, %zu -> %zu bytes, max weight error %g\n",
+          name.c_str(), tensors, data.size(), out_len, max_error);
+
+  printf("const unsigned char %s[] = {\n", name.c_str());
+  for (size_t i = 0; i < out_len; i++)
+    printf("%s0x%02x%s", (i % 12) ? " " : "  ", out[i],
+           (i + 1 == out_len) ? "\n" : ((i % 12 == 11) ? ",\n" : ","));
+  printf("};\nunsigned int %s_len = %zu;\n", name.c_str(), out_len);
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host check of KWS_MFCC streaming mode (source/kws_mfcc.h).
+ * A clip is fed hop by hop to a streaming extractor, and after every hop
+ * its window has to equal, bit for bit (memcmp), the features a
+ * full-window extractor computes from scratch over the same audio. Each
+ * hop size in kHops is checked, including hops that do not divide the
+ * window so the feature ring wraps mid-batch. A second streaming extractor
+ * bound to an outside buffer with bind_output(), as the registry's feature
+ * buffer is on the target, is checked the same way.
+ *
+ *   g++ -O2 -Isource -I<cmsis-dsp>/Include -DARM_MATH_CM7 \
+ *       tools/kws_mfcc_check.cpp source/kws_mfcc.cpp source/mfcc.cpp \
+ *       source/mfcc_tables.cpp source/memory_tiers.cpp \
+ *       -L<cmsis-dsp> -lCMSISDSP -o kws_mfcc_check
+ *   ./kws_mfcc_check [hops_per_size]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+#include "kws_mfcc.h"
+
+/* Frames per hop; 8 is the live hop */
+static const int kHops[] = {1, 4, 8, 10, 83};
+
+/* A tone sweeping up over noise, int16 scale */
+static void make_clip(std::vector<float> &audio, int samp_freq)
+{
+  srand(1);
+  for (size_t i = 0; i < audio.size(); i++) {
+    float t = (float)i / samp_freq;
+    audio[i] = 8000.0f * sinf(2.0f * (float)M_PI * (200.0f + 800.0f * t) * t) +
+               2000.0f * (rand() / (float)RAND_MAX - 0.5f);
+  }
+}
+
+/* Counts a streamed window that differs from the full-window reference */
+static int compare_window(const char *mode, int h, int hop, const float *window,
+                          const float *expected, int window_values, int failures)
+{
+  if (!memcmp(window, expected, window_values * sizeof(float)))
+    return 0;
+  int bad = 0;
+  for (int i = 0; i < window_values; i++)
+    bad += memcmp(&window[i], &expected[i], sizeof(float)) != 0;
+  if (!failures)
+    printf("  %s hop %d of %d frames: %d of %d values differ\n", mode, h, hop, bad, window_values);
+  return 1;
+}
+
+/* Mismatching windows of the streamed extractors against the full-window reference */
+static int check_hops(int hop, int num_hops, const std::vector<float> &audio)
+{
+  KWS_MFCC stream(hop, kFrontendConfig44k);
+  KWS_MFCC bound(hop, kFrontendConfig44k);
+  KWS_MFCC full(kFrontendConfig44k.num_frames, kFrontendConfig44k);
+  const int window_values = full.num_frames * full.num_mfcc_features;
+  int failures = 0;
+
+  std::vector<float> ring(bound.ring_size());
+  if (!bound.bind_output(&ring[0], (int)ring.size(), false)) {
+    printf("  bind_output rejected a %d float buffer\n", (int)ring.size());
+    return 1;
+  }
+
+  for (int h = 0; h < num_hops; h++) {
+    stream.audio_buffer = (float *)&audio[(size_t)h * stream.audio_block_size];
+    stream.extract_features();
+    bound.audio_buffer = stream.audio_buffer;
+    bound.extract_features();
+    if (bound.mfcc_buffer < &ring[0] || bound.mfcc_buffer + window_values > &ring[0] + ring.size()) {
+      printf("  bound hop %d of %d frames: window outside the bound buffer\n", h, hop);
+      return failures + 1;
+    }
+
+    /* the window ends with this hop and starts num_frames frames earlier */
+    int end_frame = (h + 1) * hop;
+    if (end_frame < full.num_frames)
+      continue;
+    full.audio_buffer = (float *)&audio[(size_t)(end_frame - full.num_frames) * full.frame_shift];
+    full.extract_features();
+    failures += compare_window("owned", h, hop, stream.mfcc_buffer, full.mfcc_buffer,
+                               window_values, failures);
+    failures += compare_window("bound", h, hop, bound.mfcc_buffer, full.mfcc_buffer,
+                               window_values, failures);
+  }
+  return failures;
+}
+
+int main(int argc, char **argv)
+{
+  int hops_per_size = (argc > 1) ? atoi(argv[1]) : 3;
+  int failed = 0;
+
+  for (size_t k = 0; k < sizeof(kHops) / sizeof(kHops[0]); k++) {
+    int hop = kHops[k];
+    /* enough hops to fill the window, then hops_per_size windows more */
+    int num_hops = (kFrontendConfig44k.num_frames + hop - 1) / hop +
+                   hops_per_size * kFrontendConfig44k.num_frames / hop;
+    int frames = num_hops * hop;
+    std::vector<float> audio((size_t)frames * kFrontendConfig44k.frame_shift() +
+                             kFrontendConfig44k.frame_len());
+    make_clip(audio, kFrontendConfig44k.samp_freq);
+
+    int failures = check_hops(hop, num_hops, audio);
+    printf("hop %2d frames: %d hops, %s\n", hop, num_hops,
+           failures ? "MISMATCH" : "identical to full windows");
+    failed += failures != 0;
+  }
+  return failed ? 1 : 0;
+}
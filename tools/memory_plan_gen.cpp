@@ -0,0 +1,483 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that writes the offline memory plan for a model,
+ * e.g. source/ds_cnn_s_model_plan.h, consumed at boot by PlannedArena
+ * (source/memory_plan.h).
+ *
+ * It mirrors GraphOptimizer on the flatbuffer (activation fusion, reshape
+ * aliases), takes the lifetime of every intermediate tensor over the
+ * resulting plan, and searches for the placement with the smallest peak:
+ * all orders for up to EXHAUSTIVE_MAX tensors, otherwise the best of a few
+ * sorted orders and RANDOM_ORDERS shuffles, each placed first fit. The
+ * interpreter's ArenaPlanner is emulated for comparison on the graph it
+ * runs without a plan, activations fused but reshapes kept (best fit in
+ * execution order, 64-byte alignment, inputs preserved). Kernel
+ * temporaries are not counted; the optimized CONV_2D has none.
+ *
+ *   g++ -O2 -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -DMODEL_HEADER='"ds_cnn_s_model.h"' -DMODEL_NAME=ds_cnn_s_model \
+ *       tools/memory_plan_gen.cpp -o memory_plan_gen
+ *   ./memory_plan_gen > source/ds_cnn_s_model_plan.h
+ *   ./memory_plan_gen model.tflite name > source/name_plan.h
+ *
+ * The plan is tied to the model by its length and checksum. A model that
+ * is exported again needs the plan generated again; PlannedArena refuses
+ * a stale one and the interpreter plans the arena as before.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "memory_plan.h"
+
+#ifdef MODEL_HEADER
+#include MODEL_HEADER
+#define STR_(x) #x
+#define STR(x) STR_(x)
+#define CAT_(a, b) a##b
+#define CAT(a, b) CAT_(a, b)
+#endif
+
+#define EXHAUSTIVE_MAX 8
+#define RANDOM_ORDERS 2000
+/* ArenaPlanner's kDefaultTensorAlignment */
+#define INTERPRETER_ALIGNMENT 64
+
+struct Node {
+  std::vector<int> inputs;
+  std::vector<int> outputs;
+};
+
+/* Intermediate tensor live over plan positions [first, last] */
+struct Buffer {
+  int tensor;
+  int bytes;
+  int first;
+  int last;
+  int offset;
+};
+
+static bool read_file(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size);
+  bool ok = fread(data.data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+static int align_up(int bytes, int alignment)
+{
+  return (bytes + alignment - 1) / alignment * alignment;
+}
+
+static int type_size(tflite::TensorType type)
+{
+  switch (type) {
+    case tflite::TensorType_FLOAT32:
+    case tflite::TensorType_INT32:
+      return 4;
+    case tflite::TensorType_INT16:
+    case tflite::TensorType_FLOAT16:
+      return 2;
+    case tflite::TensorType_INT64:
+      return 8;
+    default:
+      return 1;
+  }
+}
+
+static bool contains(const std::vector<int> &list, int value)
+{
+  return std::find(list.begin(), list.end(), value) != list.end();
+}
+
+static bool overlaps(const Buffer &a, const Buffer &b)
+{
+  return a.first <= b.last && b.first <= a.last;
+}
+
+/* Fused activation of a producer that can absorb a RELU, or NULL */
+static tflite::ActivationFunctionType activation_of(const tflite::Operator *op,
+                                                    tflite::BuiltinOperator code, bool *fusable)
+{
+  *fusable = true;
+  if (code == tflite::BuiltinOperator_CONV_2D && op->builtin_options_as_Conv2DOptions())
+    return op->builtin_options_as_Conv2DOptions()->fused_activation_function();
+  if (code == tflite::BuiltinOperator_DEPTHWISE_CONV_2D && op->builtin_options_as_DepthwiseConv2DOptions())
+    return op->builtin_options_as_DepthwiseConv2DOptions()->fused_activation_function();
+  if (code == tflite::BuiltinOperator_FULLY_CONNECTED && op->builtin_options_as_FullyConnectedOptions())
+    return op->builtin_options_as_FullyConnectedOptions()->fused_activation_function();
+  *fusable = false;
+  return tflite::ActivationFunctionType_NONE;
+}
+
+/* Places buffers in the given order, each at the lowest conflict-free offset */
+static int place_first_fit(std::vector<Buffer> &buffers, const std::vector<int> &order)
+{
+  int peak = 0;
+  std::vector<int> placed;
+  for (int index : order) {
+    Buffer &b = buffers[index];
+    std::vector<std::pair<int, int> > busy;
+    for (int other : placed)
+      if (overlaps(b, buffers[other]))
+        busy.push_back(std::make_pair(buffers[other].offset,
+                                      buffers[other].offset + buffers[other].bytes));
+    std::sort(busy.begin(), busy.end());
+    int offset = 0;
+    for (size_t i = 0; i < busy.size(); i++) {
+      if (offset + b.bytes <= busy[i].first)
+        break;
+      offset = std::max(offset, align_up(busy[i].second, MEMORY_PLAN_ALIGNMENT));
+    }
+    b.offset = offset;
+    peak = std::max(peak, offset + b.bytes);
+    placed.push_back(index);
+  }
+  return align_up(peak, MEMORY_PLAN_ALIGNMENT);
+}
+
+/* Live bytes at the busiest point, no placement can go below it */
+static int lower_bound(const std::vector<Buffer> &buffers, int positions)
+{
+  int bound = 0;
+  for (int pos = 0; pos < positions; pos++) {
+    int live = 0;
+    for (size_t i = 0; i < buffers.size(); i++)
+      if (buffers[i].first <= pos && pos <= buffers[i].last)
+        live += align_up(buffers[i].bytes, MEMORY_PLAN_ALIGNMENT);
+    bound = std::max(bound, live);
+  }
+  return bound;
+}
+
+/* Tries orders until one reaches the lower bound, keeps the best offsets */
+static int search_plan(std::vector<Buffer> &buffers, int positions, const char **method)
+{
+  int n = buffers.size();
+  int bound = lower_bound(buffers, positions);
+  int best = -1;
+  std::vector<Buffer> best_buffers = buffers;
+  std::vector<int> order(n);
+  for (int i = 0; i < n; i++)
+    order[i] = i;
+
+  auto consider = [&](const std::vector<int> &o) {
+    int size = place_first_fit(buffers, o);
+    if (best < 0 || size < best) {
+      best = size;
+      best_buffers = buffers;
+    }
+    return best <= bound;
+  };
+
+  if (n <= EXHAUSTIVE_MAX) {
+    *method = "exhaustive";
+    do {
+      if (consider(order))
+        break;
+    } while (std::next_permutation(order.begin(), order.end()));
+  } else {
+    *method = "best-of-N";
+    std::vector<std::vector<int> > orders;
+    orders.push_back(order);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return buffers[a].bytes > buffers[b].bytes; });
+    orders.push_back(order);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      return buffers[a].last - buffers[a].first > buffers[b].last - buffers[b].first; });
+    orders.push_back(order);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      return (long)buffers[a].bytes * (buffers[a].last - buffers[a].first + 1) >
+             (long)buffers[b].bytes * (buffers[b].last - buffers[b].first + 1); });
+    orders.push_back(order);
+    srand(1);
+    for (int i = 0; i < RANDOM_ORDERS; i++) {
+      for (int j = n - 1; j > 0; j--)
+        std::swap(order[j], order[rand() % (j + 1)]);
+      orders.push_back(order);
+    }
+    for (size_t i = 0; i < orders.size(); i++)
+      if (consider(orders[i]))
+        break;
+  }
+  buffers = best_buffers;
+  return best;
+}
+
+/* First writer and last reader position of every memory owner (alias root) */
+static void lifetimes(const std::vector<Node> &nodes, const std::vector<int> &root,
+                      const std::vector<bool> &constant, const std::vector<int> &inputs,
+                      const std::vector<int> &outputs, std::vector<int> &first, std::vector<int> &last)
+{
+  int positions = nodes.size();
+  first.assign(root.size(), positions);
+  last.assign(root.size(), -1);
+  for (int t : inputs) {
+    first[t] = -1;
+    last[t] = positions - 1;
+  }
+  for (int pos = 0; pos < positions; pos++) {
+    for (int t : nodes[pos].outputs)
+      first[root[t]] = std::min(first[root[t]], pos);
+    for (int t : nodes[pos].inputs)
+      if (t >= 0 && !constant[t])
+        last[root[t]] = std::max(last[root[t]], pos);
+  }
+  for (int t : outputs)
+    last[root[t]] = positions - 1;
+}
+
+/*
+ * ArenaPlanner: tensors allocated when first written, freed after their
+ * last reader, each placed in the smallest gap between live allocations
+ * that fits.
+ */
+static int interpreter_arena(const std::vector<Buffer> &rw, int positions)
+{
+  struct Live { int offset; int bytes; int last; };
+  std::vector<Live> live;
+  int high = 0;
+
+  for (int pos = -1; pos < positions; pos++) {
+    for (size_t i = 0; i < rw.size(); i++) {
+      if (rw[i].first != pos)
+        continue;
+      int bytes = align_up(rw[i].bytes, INTERPRETER_ALIGNMENT);
+      std::sort(live.begin(), live.end(), [](const Live &a, const Live &b) { return a.offset < b.offset; });
+      int offset = 0, best_offset = -1, best_gap = 0;
+      for (size_t j = 0; j < live.size(); j++) {
+        int gap = live[j].offset - offset;
+        if (gap >= bytes && (best_offset < 0 || gap < best_gap)) {
+          best_offset = offset;
+          best_gap = gap;
+        }
+        offset = std::max(offset, live[j].offset + live[j].bytes);
+      }
+      if (best_offset < 0)
+        best_offset = offset;
+      Live l = {best_offset, bytes, rw[i].last};
+      live.push_back(l);
+      high = std::max(high, best_offset + bytes);
+    }
+    for (size_t i = 0; i < live.size(); )
+      if (live[i].last == pos)
+        live.erase(live.begin() + i);
+      else
+        i++;
+  }
+  return high;
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<unsigned char> data;
+  std::string name;
+
+  if (argc > 1) {
+    if (!read_file(argv[1], data)) {
+      fprintf(stderr, "cannot read %s\n", argv[1]);
+      return 1;
+    }
+    name = (argc > 2) ? argv[2] : "model";
+  } else {
+#ifdef MODEL_HEADER
+    data.assign(MODEL_NAME, MODEL_NAME + CAT(MODEL_NAME, _len));
+    name = STR(MODEL_NAME);
+#else
+    fprintf(stderr, "usage: %s model.tflite [name]\n", argv[0]);
+    return 1;
+#endif
+  }
+
+  flatbuffers::Verifier verifier(data.data(), data.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid TFLite model\n", name.c_str());
+    return 1;
+  }
+  const tflite::Model *model = tflite::GetModel(data.data());
+  const tflite::SubGraph *graph = model->subgraphs()->Get(0);
+  const auto *tensors = graph->tensors();
+  int num_tensors = tensors->size();
+  std::vector<int> inputs(graph->inputs()->begin(), graph->inputs()->end());
+  std::vector<int> outputs(graph->outputs()->begin(), graph->outputs()->end());
+
+  std::vector<int> bytes(num_tensors, 0);
+  std::vector<bool> constant(num_tensors, false);
+  for (int t = 0; t < num_tensors; t++) {
+    const tflite::Tensor *tensor = tensors->Get(t);
+    const tflite::Buffer *buffer = model->buffers()->Get(tensor->buffer());
+    constant[t] = buffer && buffer->data() && buffer->data()->size() > 0;
+    int count = 1;
+    for (unsigned d = 0; tensor->shape() && d < tensor->shape()->size(); d++)
+      count *= tensor->shape()->Get(d);
+    bytes[t] = count * type_size(tensor->type());
+  }
+
+  /* GraphOptimizer::optimize() on the flatbuffer */
+  std::vector<int> producer(num_tensors, -1), readers(num_tensors, 0);
+  std::vector<int> root(num_tensors);
+  for (int t = 0; t < num_tensors; t++)
+    root[t] = t;
+  std::vector<Node> nodes, interpreter_nodes;
+  std::vector<int> interpreter_index;
+  std::vector<const tflite::Operator *> node_ops;
+  const auto *ops = graph->operators();
+  for (unsigned i = 0; i < ops->size(); i++)
+    for (unsigned j = 0; j < ops->Get(i)->inputs()->size(); j++)
+      if (ops->Get(i)->inputs()->Get(j) >= 0)
+        readers[ops->Get(i)->inputs()->Get(j)]++;
+
+  for (unsigned i = 0; i < ops->size(); i++) {
+    const tflite::Operator *op = ops->Get(i);
+    tflite::BuiltinOperator code = model->operator_codes()->Get(op->opcode_index())->builtin_code();
+    int in = op->inputs()->Get(0);
+    int out = op->outputs()->Get(0);
+
+    if (code == tflite::BuiltinOperator_RELU || code == tflite::BuiltinOperator_RELU6) {
+      int p = producer[in];
+      bool fusable = false;
+      if (p >= 0) {
+        tflite::BuiltinOperator p_code =
+            model->operator_codes()->Get(node_ops[p]->opcode_index())->builtin_code();
+        fusable = activation_of(node_ops[p], p_code, &fusable) == tflite::ActivationFunctionType_NONE && fusable;
+      }
+      if (fusable && readers[in] == 1 && !contains(outputs, in)) {
+        nodes[p].outputs[0] = out;
+        interpreter_nodes[interpreter_index[p]].outputs[0] = out;
+        producer[out] = p;
+        continue;
+      }
+    }
+
+    Node node;
+    for (unsigned j = 0; j < op->inputs()->size(); j++)
+      node.inputs.push_back(op->inputs()->Get(j));
+    for (unsigned j = 0; j < op->outputs()->size(); j++)
+      node.outputs.push_back(op->outputs()->Get(j));
+    interpreter_nodes.push_back(node);
+
+    /* reshapes are aliased only under a plan, the interpreter still runs them */
+    if (code == tflite::BuiltinOperator_RESHAPE &&
+        tensors->Get(in)->type() == tensors->Get(out)->type() && bytes[in] == bytes[out] &&
+        bytes[in] > 0 && !contains(outputs, out) && !contains(outputs, in)) {
+      root[out] = root[in];
+      continue;
+    }
+
+    for (int t : node.outputs)
+      producer[t] = nodes.size();
+    nodes.push_back(node);
+    node_ops.push_back(op);
+    interpreter_index.push_back(interpreter_nodes.size() - 1);
+  }
+  int positions = nodes.size();
+
+  /* lifetimes of the memory owners (alias roots) over the plan */
+  std::vector<int> first, last;
+  lifetimes(nodes, root, constant, inputs, outputs, first, last);
+
+  std::vector<Buffer> planned;
+  int boundary = 0;
+  for (int t = 0; t < num_tensors; t++) {
+    if (root[t] != t || constant[t] || first[t] > last[t])
+      continue;
+    Buffer b = {t, bytes[t], first[t], last[t], 0};
+    if (contains(inputs, t) || contains(outputs, t))
+      boundary += align_up(bytes[t], INTERPRETER_ALIGNMENT);
+    else
+      planned.push_back(b);
+  }
+
+  /* every tensor owns its memory on the interpreter's graph */
+  std::vector<int> identity(num_tensors);
+  for (int t = 0; t < num_tensors; t++)
+    identity[t] = t;
+  lifetimes(interpreter_nodes, identity, constant, inputs, outputs, first, last);
+  std::vector<Buffer> rw;
+  for (int t = 0; t < num_tensors; t++) {
+    if (constant[t] || first[t] > last[t])
+      continue;
+    Buffer b = {t, bytes[t], first[t], last[t], 0};
+    rw.push_back(b);
+  }
+
+  const char *method = "";
+  int greedy = interpreter_arena(rw, interpreter_nodes.size());
+  int bound = lower_bound(planned, positions);
+  int arena = search_plan(planned, positions, &method);
+
+  fprintf(stderr, "%s: %d nodes, %d planned tensors (%s)\n", name.c_str(), positions,
+          (int)planned.size(), method);
+  fprintf(stderr, "  planned:     %6d bytes + %d bytes graph inputs/outputs = %d\n",
+          arena, boundary, arena + boundary);
+  fprintf(stderr, "  lower bound: %6d bytes\n", bound);
+  fprintf(stderr, "  interpreter: %6d bytes over %d nodes\n", greedy, (int)interpreter_nodes.size());
+
+  std::string guard = "__" + name + "_PLAN_H__";
+  std::string macro = name + "_PLAN_ARENA_SIZE";
+  for (size_t i = 0; i < guard.size(); i++)
+    guard[i] = toupper(guard[i]);
+  for (size_t i = 0; i < macro.size(); i++)
+    macro[i] = toupper(macro[i]);
+
+  printf("/* Generated by tools/memory_plan_gen.cpp from %s, do not edit. */\n\n", name.c_str());
+  printf("#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+  printf("#include \"memory_plan.h\"\n\n");
+  printf("/* %s placement of %d intermediate tensors over %d nodes. Interpreter\n"
+         "   arena without the plan: %d bytes, lower bound: %d bytes. */\n",
+         method, (int)planned.size(), positions, greedy, bound);
+  printf("#define %s %d\n\n", macro.c_str(), arena);
+
+  printf("static const MemoryPlanEntry %s_plan_entries[] = {\n", name.c_str());
+  for (size_t i = 0; i < planned.size(); i++) {
+    const Buffer &b = planned[i];
+    for (int t = 0; t < num_tensors; t++) {
+      if (root[t] != b.tensor)
+        continue;
+      /* converter names list every fused op, the first one is enough */
+      std::string tensor_name = tensors->Get(t)->name() ? tensors->Get(t)->name()->str() : "";
+      tensor_name = tensor_name.substr(0, tensor_name.find(';'));
+      std::string entry = "{" + std::to_string(t) + ", " + std::to_string(b.offset) + ", " +
+                          std::to_string(bytes[t]) + "},";
+      printf("  %-20s// %s\n", entry.c_str(), tensor_name.c_str());
+    }
+  }
+  printf("};\n\n");
+
+  printf("static const MemoryPlan %s_plan = {\n", name.c_str());
+  printf("  %uu, 0x%08xu,\n", (unsigned)data.size(), MemoryPlanChecksum(data.data(), data.size()));
+  printf("  %s, %d, %d,\n", macro.c_str(), boundary, greedy);
+  printf("  %s_plan_entries,\n", name.c_str());
+  printf("  sizeof(%s_plan_entries) / sizeof(%s_plan_entries[0])\n", name.c_str(), name.c_str());
+  printf("};\n\n#endif\n");
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host accuracy report of the integer front-end
+ * (source/mfcc_q15.h) against the float MFCC. Both engines get the same
+ * frames: tones from 100 Hz to 3.9 kHz at -50 to -5 dBFS over a little
+ * noise, plus white noise and silence. For each feature the report gives
+ * the maximum and mean absolute error of the Q15 output, in feature units
+ * and in output LSBs (1 / 2^dec_bits), for both front-end configurations.
+ *
+ *   g++ -O2 -Isource -I<cmsis-dsp>/Include -DARM_MATH_CM7 \
+ *       tools/mfcc_q15_report.cpp source/mfcc_q15.cpp source/mfcc.cpp \
+ *       source/mfcc_tables.cpp source/memory_tiers.cpp \
+ *       -L<cmsis-dsp> -lCMSISDSP -o mfcc_q15_report
+ *   ./mfcc_q15_report [dec_bits]
+ *
+ * It exits non-zero if a mean error exceeds one output LSB.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include "mfcc.h"
+#include "mfcc_q15.h"
+
+static const float kLevelsDb[] = {-50.0f, -40.0f, -30.0f, -20.0f, -10.0f, -5.0f};
+static const float kTonesHz[] = {100.0f, 250.0f, 500.0f, 1000.0f, 2000.0f, 3900.0f};
+
+/* Frame of a tone at level_db relative to int16 full scale; 0 Hz is white noise */
+static void make_frame(std::vector<int16_t> &pcm, float tone_hz, float level_db, int samp_freq)
+{
+  float amplitude = 32767.0f * powf(10.0f, level_db / 20.0f);
+  for (size_t i = 0; i < pcm.size(); i++) {
+    float noise = (rand() / (float)RAND_MAX - 0.5f);
+    float v = (tone_hz > 0.0f)
+                  ? amplitude * sinf(2.0f * (float)M_PI * tone_hz * i / samp_freq) + 20.0f * noise
+                  : 2.0f * amplitude * noise;
+    pcm[i] = (int16_t)std::max(-32768.0f, std::min(32767.0f, roundf(v)));
+  }
+}
+
+/* Returns the worst mean error in LSBs */
+static double report(const char *name, const FrontendConfig &config, int dec_bits)
+{
+  MFCC reference(config);
+  MFCC_Q15 engine(config, dec_bits);
+  const int frame_len = config.frame_len();
+  const int features = config.num_features();
+  const double lsb = 1.0 / (1 << dec_bits);
+
+  std::vector<int16_t> pcm(frame_len);
+  std::vector<float> audio(frame_len);
+  std::vector<float> expected(features);
+  std::vector<q15_t> actual(features);
+  std::vector<double> max_err(features, 0.0), sum_err(features, 0.0);
+  int frames = 0;
+
+  srand(1);
+  for (size_t l = 0; l < sizeof(kLevelsDb) / sizeof(kLevelsDb[0]); l++) {
+    for (int t = -1; t < (int)(sizeof(kTonesHz) / sizeof(kTonesHz[0])); t++) {
+      make_frame(pcm, (t < 0) ? 0.0f : kTonesHz[t], kLevelsDb[l], config.samp_freq);
+      for (int i = 0; i < frame_len; i++)
+        audio[i] = pcm[i];
+      reference.mfcc_compute(audio.data(), expected.data());
+      engine.mfcc_compute(pcm.data(), actual.data());
+      for (int k = 0; k < features; k++) {
+        double err = fabs(expected[k] - actual[k] * lsb);
+        max_err[k] = std::max(max_err[k], err);
+        sum_err[k] += err;
+      }
+      frames++;
+    }
+  }
+  /* silence, where the log floors of the two engines meet */
+  std::fill(pcm.begin(), pcm.end(), 0);
+  std::fill(audio.begin(), audio.end(), 0.0f);
+  reference.mfcc_compute(audio.data(), expected.data());
+  engine.mfcc_compute(pcm.data(), actual.data());
+  for (int k = 0; k < features; k++) {
+    double err = fabs(expected[k] - actual[k] * lsb);
+    max_err[k] = std::max(max_err[k], err);
+    sum_err[k] += err;
+  }
+  frames++;
+
+  printf("%s, %d frames, %d fractional bits (LSB %.4f)\n", name, frames, dec_bits, lsb);
+  printf("%8s %10s %10s %9s %9s\n", "feature", "max err", "mean err", "max LSB", "mean LSB");
+  double worst = 0.0;
+  for (int k = 0; k < features; k++) {
+    double mean = sum_err[k] / frames;
+    printf("%8d %10.4f %10.4f %9.2f %9.2f\n", k, max_err[k], mean, max_err[k] / lsb, mean / lsb);
+    worst = std::max(worst, mean / lsb);
+  }
+  printf("\n");
+  return worst;
+}
+
+int main(int argc, char **argv)
+{
+  int dec_bits = (argc > 1) ? atoi(argv[1]) : MFCC_DEC_BITS;
+  double worst = report("44.1 kHz", kFrontendConfig44k, dec_bits);
+  worst = std::max(worst, report("16 kHz", kFrontendConfig16k, dec_bits));
+  printf("worst mean error %.2f LSB\n", worst);
+  return worst > 1.0 ? 1 : 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * Description: Host check of the generated source/mfcc_tables.cpp. For each
+ * front-end configuration the flash tables (window, filterbank CSR layout
+ * and weights, DCT matrix) have to equal, bit for bit:
+ *  - the float tables of the table construction MFCC used before the tables
+ *    moved to flash, copied below as reference_tables(), and
+ *  - the float and Q15 tables MFCC and MFCC_Q15 build at runtime with
+ *    MFCC_RUNTIME_TABLES.
+ * Every generated table set has to be covered by one configuration. Run it
+ * after regenerating source/mfcc_tables.cpp with tools/mfcc_tables_gen.cpp.
+ *
+ *   g++ -DMFCC_RUNTIME_TABLES -Isource -I<cmsis-dsp>/Include \
+ *       tools/mfcc_tables_check.cpp source/mfcc.cpp source/mfcc_q15.cpp \
+ *       source/mfcc_tables.cpp source/memory_tiers.cpp \
+ *       -L<cmsis-dsp> -lCMSISDSP -o mfcc_tables_check
+ *   ./mfcc_tables_check
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+#include "mfcc.h"
+#include "mfcc_q15.h"
+
+#ifndef MFCC_RUNTIME_TABLES
+#error "Build the check with MFCC_RUNTIME_TABLES"
+#endif
+
+/* Same list as tools/mfcc_tables_gen.cpp */
+static const FrontendConfig configs[] = {
+  kFrontendConfig44k,
+  kFrontendConfig16k,
+};
+
+struct ReferenceTables {
+  std::vector<float> window_func;
+  std::vector<int32_t> fbank_filter_first;
+  std::vector<int32_t> fbank_weight_offset;
+  std::vector<float> mel_fbank;
+  std::vector<float> dct_matrix;
+};
+
+/*
+ * The runtime construction of the MFCC constructor, create_mel_fbank and
+ * create_dct_matrix from before the tables were generated, with the
+ * SAMP_FREQ / NUM_FBANK_BINS / MEL_*_FREQ defines replaced by the
+ * configuration. Kept apart from source/mfcc.cpp on purpose, so the check
+ * still catches a change to the runtime path.
+ */
+static void reference_tables(const FrontendConfig &config, ReferenceTables &r)
+{
+  int32_t bin, i, j, k, n;
+  int32_t frame_len = config.frame_len();
+  int32_t num_fbank_bins = config.num_fbank_bins;
+  int32_t frame_len_padded = pow(2, ceil((log(frame_len) / log(2))));
+
+  r.window_func.resize(frame_len);
+  for (i = 0; i < frame_len; i++)
+    r.window_func[i] = 0.5 - 0.5 * cos(M_2PI * ((float)i) / (frame_len));
+
+  int32_t num_fft_bins = frame_len_padded / 2;
+  float fft_bin_width = ((float)config.samp_freq) / frame_len_padded;
+  float mel_low_freq = MFCC::MelScale(config.mel_low_freq);
+  float mel_high_freq = MFCC::MelScale(config.mel_high_freq);
+  float mel_freq_delta = (mel_high_freq - mel_low_freq) / (num_fbank_bins + 1);
+
+  r.fbank_filter_first.resize(num_fbank_bins);
+  r.fbank_weight_offset.resize(num_fbank_bins + 1);
+  int32_t num_weights = 0;
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float left_mel = mel_low_freq + bin * mel_freq_delta;
+    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
+    int32_t first_index = -1, last_index = -1;
+    for (i = 0; i < num_fft_bins; i++) {
+      float mel = MFCC::MelScale(fft_bin_width * i);
+      if (mel > left_mel && mel < right_mel) {
+        if (first_index == -1)
+          first_index = i;
+        last_index = i;
+      }
+    }
+    if (first_index == -1) {
+      first_index = 0;
+      last_index = -1;
+    }
+    r.fbank_filter_first[bin] = first_index;
+    r.fbank_weight_offset[bin] = num_weights;
+    num_weights += last_index - first_index + 1;
+  }
+  r.fbank_weight_offset[num_fbank_bins] = num_weights;
+
+  r.mel_fbank.resize(num_weights);
+  for (bin = 0; bin < num_fbank_bins; bin++) {
+    float left_mel = mel_low_freq + bin * mel_freq_delta;
+    float center_mel = mel_low_freq + (bin + 1) * mel_freq_delta;
+    float right_mel = mel_low_freq + (bin + 2) * mel_freq_delta;
+    i = r.fbank_filter_first[bin];
+    for (j = r.fbank_weight_offset[bin]; j < r.fbank_weight_offset[bin + 1]; j++, i++) {
+      float mel = MFCC::MelScale(fft_bin_width * i);
+      if (mel <= center_mel)
+        r.mel_fbank[j] = (mel - left_mel) / (center_mel - left_mel);
+      else
+        r.mel_fbank[j] = (right_mel - mel) / (right_mel - center_mel);
+    }
+  }
+
+  int32_t coefficient_count = config.num_mfcc_coeffs;
+  r.dct_matrix.resize(num_fbank_bins * coefficient_count);
+  float normalizer;
+  arm_sqrt_f32(2.0 / (float)num_fbank_bins, &normalizer);
+  for (k = 0; k < coefficient_count; k++)
+    for (n = 0; n < num_fbank_bins; n++)
+      r.dct_matrix[k * num_fbank_bins + n] =
+          normalizer * cos(((double)M_PI) / num_fbank_bins * (n + 0.5) * k);
+}
+
+static const MFCC_Tables *find_flash_tables(const FrontendConfig &config)
+{
+  for (int i = 0; i < mfcc_const_tables_count; i++) {
+    const MFCC_Tables *t = mfcc_const_tables[i];
+    if (t->samp_freq == config.samp_freq &&
+        t->frame_len == config.frame_len() &&
+        t->num_fbank_bins == config.num_fbank_bins &&
+        t->num_mfcc_features == config.num_mfcc_coeffs &&
+        t->mel_low_freq == config.mel_low_freq &&
+        t->mel_high_freq == config.mel_high_freq)
+      return t;
+  }
+  return 0;
+}
+
+/* Counts a mismatch and names the table; both arrays hold n elements */
+static int compare(const char *what, const char *table, const void *flash,
+                   const void *expected, int n, size_t elem_size)
+{
+  if (n > 0 && expected == 0) {
+    printf("  %-9s %-20s missing\n", what, table);
+    return 1;
+  }
+  const unsigned char *a = (const unsigned char *)flash;
+  const unsigned char *b = (const unsigned char *)expected;
+  for (int i = 0; i < n; i++) {
+    if (memcmp(a + i * elem_size, b + i * elem_size, elem_size) != 0) {
+      printf("  %-9s %-20s differs at [%d] of %d\n", what, table, i, n);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int check_config(const FrontendConfig &config, const MFCC_Tables *f)
+{
+  ReferenceTables r;
+  reference_tables(config, r);
+  MFCC mfcc(config);
+  MFCC_Q15 mfcc_q15(config, MFCC_DEC_BITS);
+  MFCC_Tables t, q;
+  mfcc.get_tables(&t);
+  mfcc_q15.get_tables(&q);
+
+  int bins = f->num_fbank_bins;
+  int frame_len = f->frame_len;
+  int num_weights = f->fbank_weight_offset[bins];
+  int dct_size = bins * f->num_mfcc_features;
+  int errors = 0;
+
+  if ((int)r.mel_fbank.size() != num_weights) {
+    printf("  reference filterbank has %d weights, flash %d\n", (int)r.mel_fbank.size(), num_weights);
+    return 1;
+  }
+
+  errors += compare("reference", "window_func", f->window_func, &r.window_func[0], frame_len, sizeof(float));
+  errors += compare("reference", "fbank_filter_first", f->fbank_filter_first, &r.fbank_filter_first[0], bins, sizeof(int32_t));
+  errors += compare("reference", "fbank_weight_offset", f->fbank_weight_offset, &r.fbank_weight_offset[0], bins + 1, sizeof(int32_t));
+  errors += compare("reference", "mel_fbank", f->mel_fbank, &r.mel_fbank[0], num_weights, sizeof(float));
+  errors += compare("reference", "dct_matrix", f->dct_matrix, &r.dct_matrix[0], dct_size, sizeof(float));
+
+  errors += compare("MFCC", "window_func", f->window_func, t.window_func, frame_len, sizeof(float));
+  errors += compare("MFCC", "fbank_filter_first", f->fbank_filter_first, t.fbank_filter_first, bins, sizeof(int32_t));
+  errors += compare("MFCC", "fbank_weight_offset", f->fbank_weight_offset, t.fbank_weight_offset, bins + 1, sizeof(int32_t));
+  errors += compare("MFCC", "mel_fbank", f->mel_fbank, t.mel_fbank, num_weights, sizeof(float));
+  errors += compare("MFCC", "dct_matrix", f->dct_matrix, t.dct_matrix, dct_size, sizeof(float));
+
+  errors += compare("MFCC_Q15", "fbank_filter_first", f->fbank_filter_first, q.fbank_filter_first, bins, sizeof(int32_t));
+  errors += compare("MFCC_Q15", "fbank_weight_offset", f->fbank_weight_offset, q.fbank_weight_offset, bins + 1, sizeof(int32_t));
+  errors += compare("MFCC_Q15", "window_func_q15", f->window_func_q15, q.window_func_q15, frame_len, sizeof(q15_t));
+  errors += compare("MFCC_Q15", "mel_fbank_q15", f->mel_fbank_q15, q.mel_fbank_q15, num_weights, sizeof(q15_t));
+  errors += compare("MFCC_Q15", "dct_matrix_q15", f->dct_matrix_q15, q.dct_matrix_q15, dct_size, sizeof(q15_t));
+  return errors;
+}
+
+int main(void)
+{
+  const int num_configs = sizeof(configs) / sizeof(configs[0]);
+  int errors = 0;
+  int covered = 0;
+
+  for (int i = 0; i < num_configs; i++) {
+    const FrontendConfig &config = configs[i];
+    const MFCC_Tables *f = find_flash_tables(config);
+    printf("%d Hz, %d sample frame, %d mel bins, %d coefficients\n",
+           config.samp_freq, config.frame_len(), config.num_fbank_bins, config.num_mfcc_coeffs);
+    if (!f) {
+      printf("  no generated tables, regenerate source/mfcc_tables.cpp\n");
+      errors++;
+      continue;
+    }
+    covered++;
+    int e = check_config(config, f);
+    printf("  %s\n", e ? "FAIL" : "ok");
+    errors += e;
+  }
+
+  if (covered != mfcc_const_tables_count) {
+    printf("%d generated table sets, %d checked\n", mfcc_const_tables_count, covered);
+    errors++;
+  }
+  printf("%s\n", errors ? "FAIL" : "PASS");
+  return errors ? 1 : 0;
+}
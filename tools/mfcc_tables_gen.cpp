@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that writes source/mfcc_tables.cpp. It builds the
+ * MFCC and MFCC_Q15 engines with MFCC_RUNTIME_TABLES, so the emitted tables
+ * are exactly what the runtime code computes, and prints them as const
+ * arrays. Every float is printed with 9 significant digits, which round
+ * trips bit for bit.
+ *
+ * Build against a host build of CMSIS-DSP, e.g.
+ *   g++ -DMFCC_RUNTIME_TABLES -Isource -I<cmsis-dsp>/Include \
+ *       tools/mfcc_tables_gen.cpp source/mfcc.cpp source/mfcc_q15.cpp \
+ *       source/memory_tiers.cpp \
+ *       -L<cmsis-dsp> -lCMSISDSP -o mfcc_tables_gen
+ *   ./mfcc_tables_gen > source/mfcc_tables.cpp
+ */
+
+#include <stdio.h>
+
+#include "mfcc.h"
+#include "mfcc_q15.h"
+
+#ifndef MFCC_RUNTIME_TABLES
+#error "Build the generator with MFCC_RUNTIME_TABLES"
+#endif
+
+static void print_int32(const char *name, const char *suffix, const int32_t *v, int n)
+{
+  printf("static const int32_t %s_%s[%d] = {", name, suffix, n);
+  for (int i = 0; i < n; i++)
+    printf("%s%ld,", (i % 10) ? " " : "\n  ", (long)v[i]);
+  printf("\n};\n\n");
+}
+
+static void print_q15(const char *name, const char *suffix, const q15_t *v, int n)
+{
+  printf("static const q15_t %s_%s[%d] = {", name, suffix, n);
+  for (int i = 0; i < n; i++)
+    printf("%s%d,", (i % 10) ? " " : "\n  ", v[i]);
+  printf("\n};\n\n");
+}
+
+static void print_float(const char *name, const char *suffix, const float *v, int n)
+{
+  printf("static const float %s_%s[%d] = {", name, suffix, n);
+  for (int i = 0; i < n; i++)
+    printf("%s%.8ef,", (i % 5) ? " " : "\n  ", v[i]);
+  printf("\n};\n\n");
+}
+
+static int emit_tables(const FrontendConfig &config, char *suffix, int suffix_len)
+{
+  MFCC mfcc(config);
+  MFCC_Q15 mfcc_q15(config, MFCC_DEC_BITS);
+  MFCC_Tables t, q;
+  mfcc.get_tables(&t);
+  mfcc_q15.get_tables(&q);
+
+  int num_weights = t.fbank_weight_offset[t.num_fbank_bins];
+  if (memcmp(t.fbank_filter_first, q.fbank_filter_first, sizeof(int32_t) * t.num_fbank_bins) ||
+      memcmp(t.fbank_weight_offset, q.fbank_weight_offset, sizeof(int32_t) * (t.num_fbank_bins + 1))) {
+    fprintf(stderr, "float and Q15 filterbank layouts differ\n");
+    return -1;
+  }
+
+  snprintf(suffix, suffix_len, "%ld_%ld", (long)t.samp_freq, (long)t.frame_len);
+
+  printf("/* %ld Hz, %ld sample frame, %ld mel bins (%ld-%ld Hz), %ld coefficients */\n\n",
+         (long)t.samp_freq, (long)t.frame_len, (long)t.num_fbank_bins,
+         (long)t.mel_low_freq, (long)t.mel_high_freq, (long)t.num_mfcc_features);
+  print_int32("fbank_filter_first", suffix, t.fbank_filter_first, t.num_fbank_bins);
+  print_int32("fbank_weight_offset", suffix, t.fbank_weight_offset, t.num_fbank_bins + 1);
+  print_float("window_func", suffix, t.window_func, t.frame_len);
+  print_float("mel_fbank", suffix, t.mel_fbank, num_weights);
+  print_float("dct_matrix", suffix, t.dct_matrix, t.num_fbank_bins * t.num_mfcc_features);
+  print_q15("window_func_q15", suffix, q.window_func_q15, t.frame_len);
+  print_q15("mel_fbank_q15", suffix, q.mel_fbank_q15, num_weights);
+  print_q15("dct_matrix_q15", suffix, q.dct_matrix_q15, t.num_fbank_bins * t.num_mfcc_features);
+
+  printf("static const MFCC_Tables tables_%s = {\n", suffix);
+  printf("  %ld, %ld, %ld, %ld, %ld, %ld,\n", (long)t.samp_freq, (long)t.frame_len,
+         (long)t.num_fbank_bins, (long)t.num_mfcc_features,
+         (long)t.mel_low_freq, (long)t.mel_high_freq);
+  printf("  fbank_filter_first_%s, fbank_weight_offset_%s,\n", suffix, suffix);
+  printf("  window_func_%s, mel_fbank_%s, dct_matrix_%s,\n", suffix, suffix, suffix);
+  printf("  window_func_q15_%s, mel_fbank_q15_%s, dct_matrix_q15_%s\n", suffix, suffix, suffix);
+  printf("};\n\n");
+  return 0;
+}
+
+/* Front-end configurations to bake into flash */
+static const FrontendConfig configs[] = {
+  kFrontendConfig44k,
+  kFrontendConfig16k,
+};
+
+int main(void)
+{
+  const int num_configs = sizeof(configs) / sizeof(configs[0]);
+  char suffix[num_configs][32];
+
+  printf("/*\n * Generated by tools/mfcc_tables_gen.cpp, do not edit.\n */\n\n");
+  printf("#include \"mfcc_tables.h\"\n\n");
+
+  for (int i = 0; i < num_configs; i++) {
+    if (emit_tables(configs[i], suffix[i], sizeof(suffix[i])) != 0)
+      return 1;
+  }
+
+  printf("const MFCC_Tables * const mfcc_const_tables[] = {\n");
+  for (int i = 0; i < num_configs; i++)
+    printf("  &tables_%s,\n", suffix[i]);
+  printf("};\n\n");
+  printf("const int mfcc_const_tables_count = sizeof(mfcc_const_tables) / sizeof(mfcc_const_tables[0]);\n");
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that writes the minimal op resolver for a model,
+ * e.g. source/ds_cnn_s_model_ops.h. It walks the operator code table of the
+ * flatbuffer and emits RegisterModelOps_<name>(), which adds only the
+ * builtins the model uses to a tflite::MutableOpResolver, each with the
+ * version range the model asks for. The function and count are named after
+ * the model so several resolvers can be linked into one image. Custom operators have no known registration and turn into
+ * an #error, so the firmware build stops instead of failing at boot.
+ *
+ * The model is either a .tflite file given on the command line or the
+ * xxd array the firmware links, selected at build time:
+ *   g++ -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -DMODEL_HEADER='"ds_cnn_s_model.h"' -DMODEL_NAME=ds_cnn_s_model \
+ *       tools/op_resolver_gen.cpp -o op_resolver_gen
+ *   ./op_resolver_gen > source/ds_cnn_s_model_ops.h
+ *   ./op_resolver_gen ds_cnn_int8.tflite ds_cnn_s_model_int8 \
+ *       > source/ds_cnn_s_model_int8_ops.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#ifdef MODEL_HEADER
+#include MODEL_HEADER
+#define STR_(x) #x
+#define STR(x) STR_(x)
+#define CAT_(a, b) a##b
+#define CAT(a, b) CAT_(a, b)
+#endif
+
+struct OpEntry {
+  tflite::BuiltinOperator code;
+  std::string custom_name;
+  int min_version;
+  int max_version;
+};
+
+static bool read_file(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size);
+  bool ok = fread(data.data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+static void add_op(std::vector<OpEntry> &ops, tflite::BuiltinOperator code,
+                   const std::string &custom_name, int version)
+{
+  for (size_t i = 0; i < ops.size(); i++) {
+    if (ops[i].code == code && ops[i].custom_name == custom_name) {
+      if (version < ops[i].min_version) ops[i].min_version = version;
+      if (version > ops[i].max_version) ops[i].max_version = version;
+      return;
+    }
+  }
+  OpEntry entry = {code, custom_name, version, version};
+  ops.push_back(entry);
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<unsigned char> data;
+  std::string name;
+
+  if (argc > 1) {
+    if (!read_file(argv[1], data)) {
+      fprintf(stderr, "cannot read %s\n", argv[1]);
+      return 1;
+    }
+    name = (argc > 2) ? argv[2] : "model";
+  } else {
+#ifdef MODEL_HEADER
+    data.assign(MODEL_NAME, MODEL_NAME + CAT(MODEL_NAME, _len));
+    name = STR(MODEL_NAME);
+#else
+    fprintf(stderr, "usage: %s model.tflite [name]\n", argv[0]);
+    return 1;
+#endif
+  }
+
+  flatbuffers::Verifier verifier(data.data(), data.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid TFLite model\n", name.c_str());
+    return 1;
+  }
+  const tflite::Model *model = tflite::GetModel(data.data());
+
+  std::vector<OpEntry> ops;
+  const auto *opcodes = model->operator_codes();
+  for (unsigned i = 0; opcodes && i < opcodes->size(); i++) {
+    const tflite::OperatorCode *opcode = opcodes->Get(i);
+    std::string custom_name;
+    if (opcode->builtin_code() == tflite::BuiltinOperator_CUSTOM)
+      custom_name = opcode->custom_code() ? opcode->custom_code()->str() : "";
+    add_op(ops, opcode->builtin_code(), custom_name, opcode->version());
+  }
+
+  std::string upper = name;
+  for (size_t i = 0; i < upper.size(); i++)
+    upper[i] = toupper(upper[i]);
+  std::string guard = "__" + upper + "_OPS_H__";
+
+  printf("/* Generated by tools/op_resolver_gen.cpp from %s, do not edit. */\n\n", name.c_str());
+  printf("#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+  printf("#include \"tensorflow/lite/kernels/builtin_op_kernels.h\"\n");
+  printf("#include \"tensorflow/lite/mutable_op_resolver.h\"\n\n");
+  printf("/* Operators used by %s */\n", name.c_str());
+  printf("#define %s_OPS_COUNT %d\n\n", upper.c_str(), (int)ops.size());
+
+  for (size_t i = 0; i < ops.size(); i++) {
+    if (ops[i].code == tflite::BuiltinOperator_CUSTOM)
+      printf("#error \"%s uses custom op '%s', which needs a hand written registration\"\n\n",
+             name.c_str(), ops[i].custom_name.c_str());
+  }
+
+  printf("static inline void RegisterModelOps_%s(tflite::MutableOpResolver *resolver)\n{\n",
+         name.c_str());
+  for (size_t i = 0; i < ops.size(); i++) {
+    if (ops[i].code == tflite::BuiltinOperator_CUSTOM)
+      continue;
+    const char *op = tflite::EnumNameBuiltinOperator(ops[i].code);
+    printf("  resolver->AddBuiltin(tflite::BuiltinOperator_%s,\n", op);
+    printf("                       tflite::ops::builtin::Register_%s(), %d, %d);\n",
+           op, ops[i].min_version, ops[i].max_version);
+  }
+  printf("}\n\n#endif\n");
+  return 0;
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host build of the pipeline benchmark (source/
+ * pipeline_benchmark.h): window copy, feature extraction, Invoke and
+ * GetTopN on the workstation, with the same stages, percentiles and
+ * listeners as the DEMO_BENCHMARK firmware build. Audio is a 16-bit PCM
+ * WAV file at the front-end rate, or a synthetic tone in noise without
+ * one. Keep its output next to a front-end or model change as the
+ * regression baseline.
+ *
+ * The timed runs must not allocate: operator new is counted around every
+ * timed run and the tool fails if the steady state touched the heap.
+ *
+ *   g++ -O2 -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -I<cmsis-dsp>/Include -DARM_MATH_CM7 \
+ *       -DMODEL_HEADER='"ds_cnn_s_model.h"' -DMODEL_NAME=ds_cnn_s_model \
+ *       tools/pipeline_bench.cpp source/pipeline_benchmark.cpp \
+ *       source/model_registry.cpp source/op_profiler.cpp \
+ *       source/kws_mfcc.cpp source/mfcc.cpp source/mfcc_tables.cpp \
+ *       source/optimized_ops.cpp source/conv1d_kernels.cpp \
+ *       source/graph_optimizer.cpp source/memory_plan.cpp \
+ *       source/fp16_weights.cpp source/memory_tiers.cpp \
+ *       -L<tflite-host> -ltensorflow-lite -L<cmsis-dsp> -lCMSISDSP \
+ *       -o pipeline_bench
+ *   ./pipeline_bench [clip.wav] [num_runs]
+ *
+ * Add -DENABLE_OPTIMIZED_OPS -DENABLE_GRAPH_OPTIMIZER -DENABLE_MEMORY_PLAN
+ * -DENABLE_SHARED_INPUT to compare the opt-in load-time features
+ * (model_registry.h) against the graph as exported.
+ *
+ * libtensorflow-lite.a in libs/ is built for the M7; link a host build of
+ * the same TensorFlow Lite version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <new>
+#include <vector>
+
+#include "tensorflow/lite/kernels/register.h"
+#include "kws_mfcc.h"
+#include "model_registry.h"
+#include "pipeline_benchmark.h"
+#include "timer.h"
+
+#ifndef MODEL_HEADER
+#error "Build with MODEL_HEADER and MODEL_NAME, see above"
+#endif
+#include MODEL_HEADER
+#define CAT_(a, b) a##b
+#define CAT(a, b) CAT_(a, b)
+
+/* timer.c is board code */
+extern "C" int GetTimeInUS(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/* C++ heap allocations, counted in the timed runs */
+static volatile long allocations;
+
+void *operator new(size_t size)
+{
+  allocations++;
+  void *p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+  free(p);
+}
+
+/* sized forms, or -Wsized-deallocation flags the replacements above */
+void operator delete(void *p, size_t) noexcept
+{
+  free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+  free(p);
+}
+
+class AllocationListener : public tflite::benchmark::BenchmarkListener {
+ public:
+  long timed_allocations = 0;
+
+  void OnSingleRunStart(tflite::benchmark::RunType type) override
+  {
+    timed = (type == tflite::benchmark::REGULAR);
+    start = allocations;
+  }
+  void OnSingleRunEnd() override
+  {
+    if (timed)
+      timed_allocations += allocations - start;
+  }
+
+ private:
+  bool timed = false;
+  long start = 0;
+};
+
+/* Any model the host library can run, not only the firmware's op set */
+static void register_builtin_ops(tflite::MutableOpResolver *resolver)
+{
+  resolver->AddAll(tflite::ops::builtin::BuiltinOpResolver());
+}
+
+static bool read_file(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size);
+  bool ok = fread(data.data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+/* Samples of a mono 16-bit PCM WAV file, int16 scale */
+static bool read_wav(const char *path, std::vector<float> &audio, int *rate)
+{
+  std::vector<unsigned char> data;
+  if (!read_file(path, data) || data.size() < 12 || memcmp(data.data() + 8, "WAVE", 4))
+    return false;
+  size_t pos = 12;
+  int bits = 0, channels = 0;
+  while (pos + 8 <= data.size()) {
+    const unsigned char *chunk = data.data() + pos;
+    size_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((size_t)chunk[7] << 24);
+    size = std::min(size, data.size() - pos - 8);
+    if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+      channels = chunk[10] | (chunk[11] << 8);
+      *rate = chunk[12] | (chunk[13] << 8) | (chunk[14] << 16) | (chunk[15] << 24);
+      bits = chunk[22] | (chunk[23] << 8);
+    } else if (!memcmp(chunk, "data", 4)) {
+      if (bits != 16 || channels != 1)
+        return false;
+      const int16_t *pcm = (const int16_t *)(chunk + 8);
+      audio.assign(pcm, pcm + size / 2);
+      return true;
+    }
+    pos += 8 + size + (size & 1);
+  }
+  return false;
+}
+
+int main(int argc, char **argv)
+{
+  KWS_MFCC kws(kFrontendConfig44k.num_frames, kFrontendConfig44k);
+  std::vector<float> audio;
+
+  if (argc > 1) {
+    int rate = 0;
+    if (!read_wav(argv[1], audio, &rate) || rate != kws.config.samp_freq) {
+      fprintf(stderr, "%s: need mono 16-bit PCM at %d Hz\n", argv[1], kws.config.samp_freq);
+      return 1;
+    }
+  } else {
+    /* 440 Hz at -12 dBFS over white noise, two windows long */
+    audio.resize(2 * kws.audio_buffer_size);
+    srand(1);
+    for (size_t i = 0; i < audio.size(); i++)
+      audio[i] = 8192.0f * sinf(2.0f * (float)M_PI * 440.0f * i / kws.config.samp_freq) +
+                 1024.0f * (rand() / (float)RAND_MAX - 0.5f);
+  }
+  if ((int)audio.size() < kws.audio_buffer_size) {
+    fprintf(stderr, "audio is shorter than one window\n");
+    return 1;
+  }
+
+  static const std::string labels[] = {"baby_cry", "baby_laugh", "silence"};
+  const ModelSpec spec = {"model", MODEL_NAME, CAT(MODEL_NAME, _len), register_builtin_ops,
+                          NULL, true, labels, 3, 0};
+  ModelRegistry registry;
+  registry.add(spec);
+  int start = GetTimeInUS();
+  if (!registry.load())
+    return 1;
+  int startup_us = GetTimeInUS() - start;
+  kws.bind_output(registry.feature_buffer(), registry.feature_capacity());
+
+  PipelineBenchmark benchmark(&kws, &registry, startup_us);
+  PipelineLoggingListener log;
+  AllocationListener heap;
+  benchmark.add_listener(&log);
+  benchmark.add_listener(&heap);
+  if (argc > 2)
+    benchmark.mutable_params()->Set<int32_t>("num_runs", atoi(argv[2]));
+  for (size_t offset = 0; offset + kws.audio_buffer_size <= audio.size();
+       offset += kws.audio_block_size)
+    benchmark.add_window(audio.data() + offset);
+
+  if (!benchmark.run()) {
+    fprintf(stderr, "benchmark failed\n");
+    return 1;
+  }
+  benchmark.report();
+  printf("Heap allocations in the timed runs: %ld\n", heap.timed_allocations);
+  return heap.timed_allocations ? 1 : 0;
+}
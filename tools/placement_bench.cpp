@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that ranks memory tier layouts for a model with
+ * the access cost model of source/memory_tiers.cpp. It derives the
+ * per-window traffic of each placeable buffer from the model's layer
+ * shapes and the front-end configuration:
+ *
+ *   tensor arena   activations read and written by the layers
+ *   hot weights    conv weights repacked for Conv1dFloat (2x4 blocks)
+ *   model data     the flatbuffer: fully connected weights and biases
+ *   mfcc scratch   frame, FFT and mel buffers, once per frame
+ *
+ * then tries every assignment of the buffers to the tiers whose pools
+ * (MEMORY_TIER_POOL_*) can hold them and prints the cheapest ones with
+ * the -D flags that select them in the firmware.
+ *
+ *   g++ -O2 -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -DMODEL_HEADER='"ds_cnn_s_model.h"' -DMODEL_NAME=ds_cnn_s_model \
+ *       tools/placement_bench.cpp source/memory_tiers.cpp -o placement_bench
+ *   ./placement_bench [model.tflite] [16k]
+ *
+ * The costs are modeled memory cycles only, without compute, the input
+ * tensor (interpreter heap) or cache conflicts between buffers. They rank
+ * layouts against each other; confirm the winner with the timings on the
+ * board.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "frontend_config.h"
+#include "memory_tiers.h"
+
+#ifdef MODEL_HEADER
+#include MODEL_HEADER
+#define STR_(x) #x
+#define STR(x) STR_(x)
+#define CAT_(a, b) a##b
+#define CAT(a, b) CAT_(a, b)
+#endif
+
+/* as in source/mfcc.h, which needs CMSIS-DSP */
+#define MFCC_BATCH_FRAMES 16
+
+enum {
+  BUFFER_ARENA,
+  BUFFER_HOT_WEIGHTS,
+  BUFFER_MODEL,
+  BUFFER_MFCC,
+  BUFFER_COUNT
+};
+
+static const char *kBufferNames[BUFFER_COUNT] = {
+  "tensor arena", "hot weights", "model data", "mfcc scratch"
+};
+static const char *kBufferMacros[BUFFER_COUNT] = {
+  "TENSOR_ARENA_TIER", "HOT_WEIGHTS_TIER", "MODEL_DATA_TIER", "MFCC_SCRATCH_TIER"
+};
+
+/* Size and per-window traffic of one placeable buffer, in bytes */
+struct Traffic {
+  size_t bytes;
+  size_t read;
+  size_t written;
+};
+
+struct Layout {
+  MemoryTier tier[BUFFER_COUNT];
+  float cycles;
+};
+
+static bool read_file(const char *path, std::vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data.resize(size);
+  bool ok = fread(data.data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+static int elements(const tflite::Tensor *tensor)
+{
+  int count = 1;
+  for (unsigned d = 0; tensor->shape() && d < tensor->shape()->size(); d++)
+    count *= tensor->shape()->Get(d);
+  return count;
+}
+
+/* Time length and channels of a [1,1,T,C] or [1,T,1,C] tensor */
+static void time_shape(const tflite::Tensor *tensor, int *len, int *ch)
+{
+  const auto *shape = tensor->shape();
+  *ch = shape->Get(shape->size() - 1);
+  *len = elements(tensor) / *ch;
+}
+
+static size_t pool_size(MemoryTier tier)
+{
+  switch (tier) {
+    case kMemoryTierITCM: return MEMORY_TIER_POOL_ITCM;
+    case kMemoryTierDTCM: return MEMORY_TIER_POOL_DTCM;
+    case kMemoryTierOCRAM: return MEMORY_TIER_POOL_OCRAM;
+    case kMemoryTierSDRAM: return MEMORY_TIER_POOL_SDRAM;
+    default: return 0;
+  }
+}
+
+/* Layer traffic of the float graph as the firmware kernels run it */
+static void model_traffic(const tflite::Model *model, size_t model_len, Traffic *t)
+{
+  const tflite::SubGraph *graph = model->subgraphs()->Get(0);
+  const auto *tensors = graph->tensors();
+  const auto *ops = graph->operators();
+  size_t peak = 0;
+  /* the graph input and its reshapes live in the interpreter arena */
+  std::vector<bool> external(tensors->size(), false);
+  for (unsigned i = 0; i < graph->inputs()->size(); i++)
+    external[graph->inputs()->Get(i)] = true;
+
+  t[BUFFER_MODEL].bytes = model_len;
+  for (unsigned i = 0; i < ops->size(); i++) {
+    const tflite::Operator *op = ops->Get(i);
+    tflite::BuiltinOperator code = model->operator_codes()->Get(op->opcode_index())->builtin_code();
+    const tflite::Tensor *in = tensors->Get(op->inputs()->Get(0));
+    const tflite::Tensor *out = tensors->Get(op->outputs()->Get(0));
+    bool in_external = external[op->inputs()->Get(0)];
+    size_t in_bytes = in_external ? 0 : elements(in) * 4;
+    size_t out_bytes = elements(out) * 4;
+    /* RESHAPE is an alias after GraphOptimizer, no traffic */
+    if (code == tflite::BuiltinOperator_RESHAPE) {
+      external[op->outputs()->Get(0)] = in_external;
+      continue;
+    }
+    peak = std::max(peak, in_bytes + out_bytes);
+
+    if (code == tflite::BuiltinOperator_CONV_2D) {
+      const tflite::Tensor *filter = tensors->Get(op->inputs()->Get(1));
+      int in_len, in_ch, out_len, out_ch;
+      time_shape(in, &in_len, &in_ch);
+      time_shape(out, &out_len, &out_ch);
+      int kernel = elements(filter) / (out_ch * in_ch);
+      size_t blocks = (size_t)((out_len + 1) / 2) * ((out_ch + 3) / 4);
+      /* 2 input columns and 4 weights per kernel tap and input channel */
+      if (!in_external)
+        t[BUFFER_ARENA].read += blocks * kernel * in_ch * 2 * 4;
+      t[BUFFER_HOT_WEIGHTS].read += blocks * kernel * in_ch * 4 * 4;
+      t[BUFFER_HOT_WEIGHTS].bytes += ((out_ch + 3) / 4) * 4 * kernel * in_ch * 4;
+      t[BUFFER_MODEL].read += blocks * 4 * 4;
+      t[BUFFER_ARENA].written += out_bytes;
+    } else if (code == tflite::BuiltinOperator_MAX_POOL_2D ||
+               code == tflite::BuiltinOperator_AVERAGE_POOL_2D) {
+      const tflite::Pool2DOptions *pool = op->builtin_options_as_Pool2DOptions();
+      int filter = pool ? pool->filter_height() * pool->filter_width() : 1;
+      t[BUFFER_ARENA].read += out_bytes * filter;
+      t[BUFFER_ARENA].written += out_bytes;
+    } else if (code == tflite::BuiltinOperator_FULLY_CONNECTED) {
+      const tflite::Tensor *weights = tensors->Get(op->inputs()->Get(1));
+      int units = weights->shape()->Get(0);
+      t[BUFFER_ARENA].read += in_bytes * units;
+      t[BUFFER_MODEL].read += elements(weights) * 4 + units * 4;
+      t[BUFFER_ARENA].written += out_bytes;
+    } else if (code == tflite::BuiltinOperator_SOFTMAX) {
+      t[BUFFER_ARENA].read += 2 * in_bytes;
+      t[BUFFER_ARENA].written += out_bytes;
+    }
+  }
+  t[BUFFER_ARENA].bytes = peak;
+}
+
+/* MFCC working set: window, real FFT in place, power spectrum and mel */
+static void mfcc_traffic(const FrontendConfig &config, Traffic *t)
+{
+  int padded = 1 << (int)ceil(log2((double)config.frame_len()));
+  int bins = config.num_fbank_bins;
+  size_t stages = (size_t)log2((double)padded);
+  size_t frames = config.num_frames;
+
+  t->bytes = (2 * padded + bins + MFCC_BATCH_FRAMES * bins +
+              bins * config.num_mfcc_coeffs) * 4;
+  t->read = frames * (padded * (stages + 3) + bins * config.num_mfcc_coeffs) * 4;
+  t->written = frames * (padded * (stages + 2) + bins) * 4;
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<unsigned char> data;
+  std::string name;
+  const FrontendConfig *config = &kFrontendConfig44k;
+
+  int arg = 1;
+  if (argc > arg && strcmp(argv[arg], "16k") != 0) {
+    if (!read_file(argv[arg], data)) {
+      fprintf(stderr, "cannot read %s\n", argv[arg]);
+      return 1;
+    }
+    name = argv[arg++];
+  } else {
+#ifdef MODEL_HEADER
+    data.assign(MODEL_NAME, MODEL_NAME + CAT(MODEL_NAME, _len));
+    name = STR(MODEL_NAME);
+#else
+    fprintf(stderr, "usage: %s model.tflite [16k]\n", argv[0]);
+    return 1;
+#endif
+  }
+  if (argc > arg && strcmp(argv[arg], "16k") == 0)
+    config = &kFrontendConfig16k;
+
+  flatbuffers::Verifier verifier(data.data(), data.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid TFLite model\n", name.c_str());
+    return 1;
+  }
+
+  Traffic traffic[BUFFER_COUNT];
+  memset(traffic, 0, sizeof(traffic));
+  model_traffic(tflite::GetModel(data.data()), data.size(), traffic);
+  mfcc_traffic(*config, &traffic[BUFFER_MFCC]);
+
+  printf("%s, %d Hz front end, per window:\n", name.c_str(), config->samp_freq);
+  for (int b = 0; b < BUFFER_COUNT; b++)
+    printf("  %-14s %8zu B  read %9zu B  written %9zu B\n", kBufferNames[b],
+           traffic[b].bytes, traffic[b].read, traffic[b].written);
+
+  /* every assignment that fits the pools; FLASH only holds the model */
+  std::vector<Layout> layouts;
+  int combinations = 1;
+  for (int b = 0; b < BUFFER_COUNT; b++)
+    combinations *= kMemoryTierCount;
+  for (int c = 0; c < combinations; c++) {
+    Layout layout;
+    size_t used[kMemoryTierCount] = {0};
+    bool fits = true;
+    layout.cycles = 0.0f;
+    for (int b = 0, rest = c; b < BUFFER_COUNT; b++, rest /= kMemoryTierCount) {
+      MemoryTier tier = (MemoryTier)(rest % kMemoryTierCount);
+      layout.tier[b] = tier;
+      if (tier == kMemoryTierFLASH) {
+        fits = fits && b == BUFFER_MODEL;
+      } else {
+        used[tier] += traffic[b].bytes;
+        fits = fits && used[tier] <= pool_size(tier);
+      }
+      layout.cycles += MemoryTierCycles(tier, traffic[b].read, traffic[b].written);
+    }
+    if (fits)
+      layouts.push_back(layout);
+  }
+  if (layouts.empty()) {
+    printf("no layout fits the pools\n");
+    return 1;
+  }
+  std::sort(layouts.begin(), layouts.end(),
+            [](const Layout &a, const Layout &b) { return a.cycles < b.cycles; });
+
+  printf("\n%zu layouts fit, modeled memory cycles per window:\n", layouts.size());
+  printf("  %-12s", "cycles");
+  for (int b = 0; b < BUFFER_COUNT; b++)
+    printf(" %-14s", kBufferNames[b]);
+  printf("\n");
+  for (size_t i = 0; i < layouts.size(); i++) {
+    if (i == 10 && layouts.size() > 11) {
+      printf("  ...\n");
+      i = layouts.size() - 1;
+    }
+    printf("  %-12.0f", layouts[i].cycles);
+    for (int b = 0; b < BUFFER_COUNT; b++)
+      printf(" %-14s", kMemoryTiers[layouts[i].tier[b]].name);
+    printf("\n");
+  }
+
+  printf("\nfastest:");
+  for (int b = 0; b < BUFFER_COUNT; b++)
+    printf(" -D%s=kMemoryTier%s", kBufferMacros[b], kMemoryTiers[layouts[0].tier[b]].name);
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Description: Host tool that tunes the live decision layer
+ * (source/posterior_filter.h) on the dataset. It replays the window
+ * scores written by batch_eval -o through a PosteriorFilter for every
+ * point of a grid: average, attack and release hops, an on threshold per
+ * label, and the off threshold as a fraction of it. Each clip starts from
+ * a reset filter, as after a restart of the live stream.
+ *
+ * A clip of a label other than silence is detected when its label is
+ * raised on any hop, and its time to alert is the step time of the first
+ * such hop. Every raise of another label is a false alarm. The points
+ * with at most the allowed false alarms per hour of replayed audio are
+ * ranked by recall, time to alert and false alarms, and the best ones are printed
+ * with the -D flags and threshold table of kws.cpp.
+ *
+ *   g++ -O2 -Isource tools/posterior_replay.cpp source/posterior_filter.cpp \
+ *       -o posterior_replay
+ *   ./batch_eval -s 8 -o scores.csv dataset/
+ *   ./posterior_replay scores.csv [false_alarms_per_hour] [results]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "posterior_filter.h"
+
+/* Label order of the model's output, as in batch_eval */
+static const char *kLabels[] = {"baby_cry", "baby_laugh", "silence"};
+static const int kNumLabels = sizeof(kLabels) / sizeof(kLabels[0]);
+static const int kSilence = 2;
+
+/* The grid */
+static const int kAverageHops[] = {1, 2, 3, 4, 6, 8};
+static const int kAttackHops[] = {1, 2, 3, 4};
+static const int kReleaseHops[] = {1, 3, 6};
+static const float kOnThresholds[] = {0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f, 0.9f};
+static const float kOffRatios[] = {1.0f, 0.75f, 0.5f};
+
+#define COUNT(a) (int)(sizeof(a) / sizeof(a[0]))
+
+struct Clip {
+  int label;
+  std::vector<float> scores;    // kNumLabels per hop
+  int hops;
+};
+
+struct Result {
+  PosteriorConfig config;
+  ClassThreshold thresholds[kNumLabels];
+  float off_ratio;
+  int hits[kNumLabels];
+  int positives[kNumLabels];
+  int false_alarms;
+  double alert_ms;              // mean time to alert of the hits
+};
+
+static bool read_scores(const char *path, std::vector<Clip> &clips, double *step_ms)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+    return false;
+  char line[4096];
+  std::string last;
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') {
+      sscanf(line, "# step_ms %lf", step_ms);
+      continue;
+    }
+    /* path,label,window,scores... with the path possibly holding commas */
+    std::vector<std::string> fields;
+    std::string s(line);
+    while (!s.empty() && (s.back() == '\n' || s.back() == '\r'))
+      s.pop_back();
+    size_t end = s.size();
+    for (int i = 0; i < kNumLabels + 2; i++) {
+      size_t comma = s.rfind(',', end - 1);
+      if (comma == std::string::npos || end == 0) {
+        fclose(f);
+        return false;
+      }
+      fields.push_back(s.substr(comma + 1, end - comma - 1));
+      end = comma;
+    }
+    std::string clip_path = s.substr(0, end);
+    if (clips.empty() || clip_path != last) {
+      Clip clip;
+      clip.label = atoi(fields[kNumLabels + 1].c_str());
+      clip.hops = 0;
+      clips.push_back(clip);
+      last = clip_path;
+    }
+    Clip &clip = clips.back();
+    for (int k = 0; k < kNumLabels; k++)
+      clip.scores.push_back(atof(fields[kNumLabels - 1 - k].c_str()));
+    clip.hops++;
+  }
+  fclose(f);
+  return true;
+}
+
+static void replay(const std::vector<Clip> &clips, double step_ms, Result &r)
+{
+  PosteriorFilter filter(kNumLabels, r.thresholds, r.config);
+  int alerts = 0;
+  r.false_alarms = 0;
+  r.alert_ms = 0.0;
+  for (int k = 0; k < kNumLabels; k++)
+    r.hits[k] = r.positives[k] = 0;
+
+  for (size_t c = 0; c < clips.size(); c++) {
+    const Clip &clip = clips[c];
+    bool hit = false;
+    filter.reset();
+    for (int h = 0; h < clip.hops; h++) {
+      filter.process(&clip.scores[h * kNumLabels]);
+      if (!filter.raised())
+        continue;
+      if (filter.active_class() != clip.label) {
+        r.false_alarms++;
+      } else if (!hit) {
+        hit = true;
+        r.alert_ms += h * step_ms;
+        alerts++;
+      }
+    }
+    r.positives[clip.label]++;
+    r.hits[clip.label] += hit;
+  }
+  if (alerts)
+    r.alert_ms /= alerts;
+}
+
+static float recall(const Result &r)
+{
+  int hits = 0, positives = 0;
+  for (int k = 0; k < kNumLabels; k++) {
+    if (k == kSilence)
+      continue;
+    hits += r.hits[k];
+    positives += r.positives[k];
+  }
+  return positives ? (float)hits / positives : 0.0f;
+}
+
+static void print_result(const Result &r, double hours)
+{
+  printf("%4d %4d %4d %5.2f", r.config.average_hops, r.config.attack_hops,
+         r.config.release_hops, r.off_ratio);
+  for (int k = 0; k < kNumLabels; k++)
+    if (k != kSilence)
+      printf(" %11.2f", r.thresholds[k].on);
+  for (int k = 0; k < kNumLabels; k++)
+    if (k != kSilence)
+      printf(" %10.1f%%", r.positives[k] ? 100.0 * r.hits[k] / r.positives[k] : 0.0);
+  printf(" %5d %7.1f %8.0f\n", r.false_alarms, r.false_alarms / hours, r.alert_ms);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s scores.csv [false_alarms_per_hour] [results]\n", argv[0]);
+    return 1;
+  }
+  double budget = (argc > 2) ? atof(argv[2]) : 1.0;
+  int shown = (argc > 3) ? atoi(argv[3]) : 10;
+
+  std::vector<Clip> clips;
+  double step_ms = 0.0;
+  if (!read_scores(argv[1], clips, &step_ms) || clips.empty()) {
+    fprintf(stderr, "cannot read scores from %s\n", argv[1]);
+    return 1;
+  }
+  if (step_ms <= 0.0) {
+    fprintf(stderr, "%s has no step, write it with batch_eval -s\n", argv[1]);
+    return 1;
+  }
+  long hops = 0;
+  for (size_t c = 0; c < clips.size(); c++)
+    hops += clips[c].hops;
+  const double hours = hops * step_ms / 3600000.0;
+
+  /* on thresholds of the labels other than silence, one grid index each */
+  int labels = kNumLabels - 1;
+  int combinations = 1;
+  for (int k = 0; k < labels; k++)
+    combinations *= COUNT(kOnThresholds);
+
+  std::vector<Result> results;
+  for (int a = 0; a < COUNT(kAverageHops); a++)
+  for (int t = 0; t < COUNT(kAttackHops); t++)
+  for (int l = 0; l < COUNT(kReleaseHops); l++)
+  for (int o = 0; o < COUNT(kOffRatios); o++)
+  for (int n = 0; n < combinations; n++) {
+    Result r;
+    r.config.average_hops = kAverageHops[a];
+    r.config.attack_hops = kAttackHops[t];
+    r.config.release_hops = kReleaseHops[l];
+    r.off_ratio = kOffRatios[o];
+    for (int k = 0, rest = n; k < kNumLabels; k++) {
+      if (k == kSilence) {
+        r.thresholds[k].on = r.thresholds[k].off = 2.0f;
+        continue;
+      }
+      r.thresholds[k].on = kOnThresholds[rest % COUNT(kOnThresholds)];
+      r.thresholds[k].off = r.thresholds[k].on * r.off_ratio;
+      rest /= COUNT(kOnThresholds);
+    }
+    replay(clips, step_ms, r);
+    results.push_back(r);
+  }
+
+  /* the single-window decision of the static demo, for reference */
+  Result baseline;
+  baseline.config.average_hops = baseline.config.attack_hops = baseline.config.release_hops = 1;
+  baseline.off_ratio = 1.0f;
+  for (int k = 0; k < kNumLabels; k++)
+    baseline.thresholds[k].on = baseline.thresholds[k].off = (k == kSilence) ? 2.0f : 0.3f;
+  replay(clips, step_ms, baseline);
+
+  std::vector<Result> kept;
+  for (size_t i = 0; i < results.size(); i++)
+    if (results[i].false_alarms / hours <= budget)
+      kept.push_back(results[i]);
+  std::stable_sort(kept.begin(), kept.end(), [](const Result &a, const Result &b) {
+    if (recall(a) != recall(b))
+      return recall(a) > recall(b);
+    if (a.alert_ms != b.alert_ms)
+      return a.alert_ms < b.alert_ms;
+    return a.false_alarms < b.false_alarms;
+  });
+
+  printf("%d clips, %ld hops of %.0f ms (%.2f h), %d grid points, %d within %.1f false alarms/h\n\n",
+         (int)clips.size(), hops, step_ms, hours, (int)results.size(), (int)kept.size(), budget);
+  /* on thresholds, then recall, of each label */
+  printf(" avg  att  rel   off");
+  for (int k = 0; k < kNumLabels; k++)
+    if (k != kSilence)
+      printf(" %11s", kLabels[k]);
+  for (int k = 0; k < kNumLabels; k++)
+    if (k != kSilence)
+      printf(" %11s", kLabels[k]);
+  printf(" %5s %7s %8s\n", "FA", "FA/h", "alert ms");
+  print_result(baseline, hours);
+  printf("\n");
+  for (int i = 0; i < shown && i < (int)kept.size(); i++)
+    print_result(kept[i], hours);
+
+  if (kept.empty()) {
+    printf("\nno grid point within the false alarm budget\n");
+    return 0;
+  }
+  const Result &best = kept[0];
+  printf("\n-DLIVE_AVERAGE_HOPS=%d -DLIVE_ATTACK_HOPS=%d -DLIVE_RELEASE_HOPS=%d\n",
+         best.config.average_hops, best.config.attack_hops, best.config.release_hops);
+  printf("kLiveThresholds:\n");
+  for (int k = 0; k < kNumLabels; k++)
+    printf("  {%.2ff, %.2ff},   // %s\n", best.thresholds[k].on, best.thresholds[k].off, kLabels[k]);
+  return 0;
+}
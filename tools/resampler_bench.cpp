@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * Description: Host benchmark for Resampler (source/resampler.h). For each
+ * rate pair it reports
+ *
+ *   throughput      input and output samples/s of Resampler::process fed
+ *                   in RESAMPLE_CHUNK pieces as the live loop does, and of
+ *                   the reference resampler below
+ *   passband error  worst deviation, in dB relative to the tone amplitude,
+ *                   of tones up to the front-end's mel_high_freq from the
+ *                   ideal resampled tone (the tone evaluated in double
+ *                   precision at each output instant)
+ *   max diff        largest difference between Resampler and the reference,
+ *                   in int16 units
+ *
+ * The reference resampler evaluates the same Kaiser windowed sinc directly
+ * in double precision at the exact time of every output sample, without
+ * polyphase tables, so "max diff" isolates the float polyphase
+ * implementation and the passband error of both shows the filter design.
+ *
+ *   g++ -O2 -Isource -I<cmsis-dsp>/Include -DARM_MATH_CM7 \
+ *       tools/resampler_bench.cpp source/resampler.cpp \
+ *       -L<cmsis-dsp> -lCMSISDSP -o resampler_bench
+ *   ./resampler_bench
+ *
+ * Host throughput only ranks the implementations; cycle counts on the M7
+ * have to come from the target. When decimating, RESAMPLER_TAPS_PER_PHASE
+ * taps span that many input samples, so the transition band is wide at the
+ * higher input rate; the 44.1k -> 16k row shows the loss at 4 kHz. The live
+ * path only upsamples.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "resampler.h"
+#include "frontend_config.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Filter design of source/resampler.cpp, must stay in sync */
+#define RESAMPLER_CUTOFF 0.8
+#define RESAMPLER_KAISER_BETA 8.0
+
+/* Capture samples per process() call, RESAMPLE_CHUNK in source/kws.cpp */
+#define BENCH_CHUNK 512
+/* Seconds of input audio per throughput run */
+#define BENCH_SECONDS 2
+#define BENCH_ITERATIONS 5
+/* Tone amplitude, int16 scale */
+#define TONE_AMPLITUDE 16000.0
+/* Tones from 100 Hz to mel_high_freq */
+#define TONE_STEP_HZ 100
+
+typedef struct {
+  const char *name;
+  int in_rate;
+  int out_rate;
+} RatePair;
+
+static const RatePair kRates[] = {
+  {"16k -> 44.1k (live)", 16000, 44100},
+  {"48k -> 44.1k",        48000, 44100},
+  {"44.1k -> 16k",        44100, 16000},
+};
+
+static int gcd(int a, int b)
+{
+  while (b) {
+    int t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+static double bessel_i0(double x)
+{
+  double sum = 1.0, term = 1.0;
+  for (int k = 1; k < 64; k++) {
+    term *= (0.5 * x / k) * (0.5 * x / k);
+    sum += term;
+    if (term < 1e-15 * sum)
+      break;
+  }
+  return sum;
+}
+
+/*
+ * Direct band-limited interpolation with the prototype of Resampler in
+ * double precision. Output k sits at input time k * in_rate / out_rate
+ * minus the filter delay, taps_per_phase / 2 input samples less half an
+ * upsampled sample, which is where the polyphase outputs land.
+ */
+class ReferenceResampler
+{
+  private:
+    int up;
+    int down;
+    int taps;
+    double cutoff;          // relative to the input rate
+    double half_span;       // filter half length in input samples
+    double i0_beta;
+
+    double h(double t) const
+    {
+      if (fabs(t) > half_span)
+        return 0.0;
+      double x = 2.0 * M_PI * cutoff * t;
+      double sinc = (t == 0.0) ? 1.0 : sin(x) / x;
+      double r = t / half_span;
+      return 2.0 * cutoff * sinc * bessel_i0(RESAMPLER_KAISER_BETA * sqrt(1.0 - r * r)) / i0_beta;
+    }
+
+  public:
+    ReferenceResampler(int in_rate, int out_rate, int taps)
+      : taps(taps)
+    {
+      int g = gcd(in_rate, out_rate);
+      up = out_rate / g;
+      down = in_rate / g;
+      double nyquist = 0.5 * ((in_rate < out_rate) ? in_rate : out_rate);
+      cutoff = RESAMPLER_CUTOFF * nyquist / in_rate;
+      half_span = 0.5 * (up * taps - 1) / up;
+      i0_beta = bessel_i0(RESAMPLER_KAISER_BETA);
+    }
+
+    double delay() const { return half_span; }
+
+    /* Time of output k in input samples */
+    double output_time(int k) const { return (double)k * down / up - half_span; }
+
+    int process(const int16_t *in, int num_in, float *out, int max_out) const
+    {
+      int num_out = 0;
+      for (int k = 0; num_out < max_out; k++) {
+        double t = output_time(k);
+        int newest = (int)floor(t + half_span);
+        if (newest >= num_in)
+          break;
+        double sum = 0.0;
+        for (int n = newest - taps + 1; n <= newest; n++)
+          if (n >= 0)
+            sum += in[n] * h(t - n);
+        out[num_out++] = (float)sum;
+      }
+      return num_out;
+    }
+};
+
+static void make_noise(std::vector<int16_t> &in)
+{
+  srand(1);
+  for (size_t i = 0; i < in.size(); i++)
+    in[i] = (int16_t)((rand() % 20001) - 10000);
+}
+
+static int run_resampler(Resampler &r, const std::vector<int16_t> &in, std::vector<float> &out)
+{
+  r.reset();
+  int num_out = 0;
+  for (size_t i = 0; i < in.size(); i += BENCH_CHUNK) {
+    int n = (int)((in.size() - i < BENCH_CHUNK) ? in.size() - i : BENCH_CHUNK);
+    num_out += r.process(&in[i], n, &out[num_out], (int)out.size() - num_out);
+  }
+  return num_out;
+}
+
+/* Seconds per call of f, best of BENCH_ITERATIONS */
+template <class F>
+static double time_s(F f)
+{
+  double best = 1e30;
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    double s = std::chrono::duration<double>(end - start).count();
+    if (s < best)
+      best = s;
+  }
+  return best;
+}
+
+/* Worst error of a tone's resampled output against the ideal tone, in dB */
+static double tone_error_db(const float *out, int num_out, const ReferenceResampler &ref,
+                            double freq, int in_rate, int num_in)
+{
+  double worst = 0.0;
+  for (int k = 0; k < num_out; k++) {
+    double t = ref.output_time(k);
+    // skip outputs whose filter span reaches before the first input or past the last
+    if (t - ref.delay() < 0.0 || t + ref.delay() >= num_in)
+      continue;
+    double ideal = TONE_AMPLITUDE * sin(2.0 * M_PI * freq * t / in_rate);
+    double err = fabs(out[k] - ideal);
+    if (err > worst)
+      worst = err;
+  }
+  return 20.0 * log10(worst / TONE_AMPLITUDE + 1e-12);
+}
+
+int main()
+{
+  const int max_tone = kFrontendConfig44k.mel_high_freq;
+
+  printf("%-20s %10s %10s %12s %8s %8s %10s %10s %10s\n", "rates", "in Ms/s", "out Ms/s",
+         "ref out Ms/s", "speedup", "err dB", "at Hz", "ref err dB", "max diff");
+  for (size_t n = 0; n < sizeof(kRates) / sizeof(kRates[0]); n++) {
+    const RatePair &p = kRates[n];
+    Resampler resampler(p.in_rate, p.out_rate);
+    ReferenceResampler reference(p.in_rate, p.out_rate, RESAMPLER_TAPS_PER_PHASE);
+
+    // throughput on noise
+    std::vector<int16_t> in(p.in_rate * BENCH_SECONDS);
+    make_noise(in);
+    std::vector<float> out(resampler.max_output(BENCH_CHUNK) * (in.size() / BENCH_CHUNK + 1));
+    std::vector<float> ref_out(out.size());
+    int num_out = 0, ref_num_out = 0;
+    double t_opt = time_s([&]() { num_out = run_resampler(resampler, in, out); });
+    double t_ref = time_s([&]() { ref_num_out = reference.process(&in[0], (int)in.size(), &ref_out[0], (int)ref_out.size()); });
+
+    float max_diff = 0.0f;
+    for (int i = 0; i < num_out && i < ref_num_out; i++)
+      max_diff = fmaxf(max_diff, fabsf(out[i] - ref_out[i]));
+
+    // passband error over tones, 0.25 s each
+    std::vector<int16_t> tone(p.in_rate / 4);
+    double err_db = -1e30, ref_err_db = -1e30;
+    int worst_freq = 0;
+    for (int freq = TONE_STEP_HZ; freq <= max_tone; freq += TONE_STEP_HZ) {
+      for (size_t i = 0; i < tone.size(); i++)
+        tone[i] = (int16_t)lrint(TONE_AMPLITUDE * sin(2.0 * M_PI * freq * i / p.in_rate));
+      int n_opt = run_resampler(resampler, tone, out);
+      int n_ref = reference.process(&tone[0], (int)tone.size(), &ref_out[0], (int)ref_out.size());
+      double e = tone_error_db(&out[0], n_opt, reference, freq, p.in_rate, (int)tone.size());
+      if (e > err_db) {
+        err_db = e;
+        worst_freq = freq;
+      }
+      ref_err_db = fmax(ref_err_db, tone_error_db(&ref_out[0], n_ref, reference, freq, p.in_rate, (int)tone.size()));
+    }
+
+    printf("%-20s %10.2f %10.2f %12.2f %7.1fx %8.1f %10d %10.1f %10.2e\n", p.name,
+           in.size() / t_opt * 1e-6, num_out / t_opt * 1e-6, ref_num_out / t_ref * 1e-6,
+           t_ref / t_opt, err_db, worst_freq, ref_err_db, max_diff);
+  }
+  printf("\nerror: worst |output - ideal tone| over %d..%d Hz, dB relative to the tone amplitude\n",
+         TONE_STEP_HZ, max_tone);
+  return 0;
+}
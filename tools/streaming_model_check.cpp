@@ -0,0 +1,620 @@
+/*
+ * Copyright (C) 2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * Description: Host check of StreamingModel (source/streaming_model.h). A
+ * layer stack is built with add_conv / add_max_pool / set_head, a random
+ * feature stream is fed hop by hop through shift() and invoke(), and every
+ * hop's scores are compared with a double precision full-window pass over
+ * the same window. A score passes when it is within kTolerance of the
+ * reference, scaled by max(1, |reference|).
+ *
+ * kHops mixes hops the caches stay aligned to, which only recompute the
+ * columns that see new frames, with hops that are not a multiple of
+ * alignment() or longer than the window, which recompute everything. The
+ * second stack covers strided VALID convolutions, stride 1 pooling, ReLU6
+ * and a head without softmax.
+ *
+ * The shipped ds_cnn_s_model is then read from its flatbuffer into a
+ * TfLiteContext with the real weights and handed to build(), and every hop
+ * is checked against a double precision pass over the flatbuffer's own
+ * NHWC graph. Built with HOST_TFLITE and linked against a host TFLite,
+ * build(tflite::Interpreter *) is also run and every hop is diffed against
+ * Invoke(), as STREAMING_VERIFY does on the board.
+ *
+ *   g++ -O2 -Isource -Itensorflow-lite \
+ *       -Itensorflow-lite/third_party/flatbuffers/include \
+ *       -I<cmsis-dsp>/Include -DARM_MATH_CM7 \
+ *       tools/streaming_model_check.cpp source/streaming_model.cpp \
+ *       source/conv1d_kernels.cpp source/memory_tiers.cpp \
+ *       -L<cmsis-dsp> -lCMSISDSP -o streaming_model_check
+ *   ./streaming_model_check
+ *
+ * For the interpreter pass add -DHOST_TFLITE and
+ * -L<host-tflite> -ltensorflow-lite -lpthread -ldl.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "tensorflow/lite/builtin_ops.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#ifdef HOST_TFLITE
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/kernels/register.h"
+#include "tensorflow/lite/model.h"
+#endif
+#include "ds_cnn_s_model.h"
+#include "streaming_model.h"
+
+/* Float kernels against a double reference, relative above 1 */
+static const double kTolerance = 1e-5;
+
+/* Frames the window moves before each invoke; 0 is the first window */
+static const int kHops[] = {0, 8, 8, 4, 12, 8, 6, 8, 8, 3, 8, 400, 8, 8, 16, 8, 8, 8};
+
+typedef struct {
+  stream_layer_t type;
+  int out_ch;                   // conv only
+  int kernel;
+  int stride;
+  TfLitePadding padding;
+  TfLiteFusedActivation activation;
+} LayerSpec;
+
+typedef struct {
+  const char *name;
+  int in_len;
+  int in_ch;
+  const LayerSpec *layers;
+  int num_layers;
+  int units;
+  bool softmax;
+} StackSpec;
+
+/* conv1d, max_pool, conv1d_1, max_pool_1 and the head of ds_cnn_s_model */
+static const LayerSpec kModelLayers[] = {
+  {STREAM_LAYER_CONV,     8, 3, 1, kTfLitePaddingSame, kTfLiteActRelu},
+  {STREAM_LAYER_MAX_POOL, 0, 2, 2, kTfLitePaddingSame, kTfLiteActNone},
+  {STREAM_LAYER_CONV,    16, 3, 1, kTfLitePaddingSame, kTfLiteActRelu},
+  {STREAM_LAYER_MAX_POOL, 0, 2, 2, kTfLitePaddingSame, kTfLiteActNone},
+};
+
+static const LayerSpec kStridedLayers[] = {
+  {STREAM_LAYER_CONV,    12, 5, 2, kTfLitePaddingValid, kTfLiteActRelu6},
+  {STREAM_LAYER_MAX_POOL, 0, 3, 1, kTfLitePaddingValid, kTfLiteActNone},
+  {STREAM_LAYER_CONV,     8, 3, 1, kTfLitePaddingSame,  kTfLiteActNone},
+};
+
+static const StackSpec kStacks[] = {
+  {"ds_cnn_s_model 249x13", 249, 13, kModelLayers, 4, 3, true},
+  {"strided valid 100x10",  100, 10, kStridedLayers, 3, 4, false},
+};
+
+/* Weights of one layer and the shapes the reference needs */
+struct RefLayer {
+  LayerSpec spec;
+  int in_len, in_ch, out_len, out_ch, pad;
+  std::vector<float> weights;   // [out_ch x kernel x in_ch]
+  std::vector<float> bias;
+};
+
+static float random_value(float scale)
+{
+  return scale * (2.0f * rand() / (float)RAND_MAX - 1.0f);
+}
+
+static int output_len(const LayerSpec &l, int in_len)
+{
+  if (l.padding == kTfLitePaddingSame)
+    return (in_len + l.stride - 1) / l.stride;
+  return (in_len - l.kernel) / l.stride + 1;
+}
+
+/* Leading padding, TFLite SAME convention */
+static int leading_pad(const LayerSpec &l, int in_len, int out_len)
+{
+  if (l.padding != kTfLitePaddingSame)
+    return 0;
+  int total = (out_len - 1) * l.stride + l.kernel - in_len;
+  return (total > 0) ? total / 2 : 0;
+}
+
+static double activate(double x, TfLiteFusedActivation activation)
+{
+  if (activation == kTfLiteActRelu || activation == kTfLiteActRelu6)
+    x = std::max(x, 0.0);
+  if (activation == kTfLiteActRelu6)
+    x = std::min(x, 6.0);
+  return x;
+}
+
+/* Full-window pass in double precision */
+static void reference(const std::vector<RefLayer> &layers, const std::vector<float> &fc_weights,
+                      const std::vector<float> &fc_bias, bool softmax, const float *window,
+                      std::vector<double> &scores)
+{
+  std::vector<double> in(window, window + layers[0].in_len * layers[0].in_ch), out;
+  for (size_t i = 0; i < layers.size(); i++) {
+    const RefLayer &l = layers[i];
+    out.assign(l.out_len * l.out_ch, 0.0);
+    for (int j = 0; j < l.out_len; j++) {
+      int start = j * l.spec.stride - l.pad;
+      for (int o = 0; o < l.out_ch; o++) {
+        double acc = (l.spec.type == STREAM_LAYER_CONV) ? l.bias[o] : -HUGE_VAL;
+        for (int k = 0; k < l.spec.kernel; k++) {
+          int t = start + k;
+          if (t < 0 || t >= l.in_len)
+            continue;
+          if (l.spec.type == STREAM_LAYER_MAX_POOL) {
+            acc = std::max(acc, in[t * l.in_ch + o]);
+            continue;
+          }
+          for (int c = 0; c < l.in_ch; c++)
+            acc += in[t * l.in_ch + c] * l.weights[(o * l.spec.kernel + k) * l.in_ch + c];
+        }
+        out[j * l.out_ch + o] = activate(acc, l.spec.activation);
+      }
+    }
+    in.swap(out);
+  }
+
+  int units = (int)fc_bias.size();
+  scores.assign(units, 0.0);
+  for (int u = 0; u < units; u++) {
+    double acc = fc_bias[u];
+    for (size_t i = 0; i < in.size(); i++)
+      acc += in[i] * fc_weights[u * in.size() + i];
+    scores[u] = acc;
+  }
+  if (softmax) {
+    double max_score = *std::max_element(scores.begin(), scores.end()), sum = 0.0;
+    for (int u = 0; u < units; u++)
+      sum += (scores[u] = exp(scores[u] - max_score));
+    for (int u = 0; u < units; u++)
+      scores[u] /= sum;
+  }
+}
+
+/* Full-window scores of one window, the expected output of a hop */
+typedef std::function<void(const float *window, std::vector<double> &scores)> ReferenceFn;
+
+/* Streams random features through the model hop by hop; failing hops */
+static int check_hops(const char *name, StreamingModel &model, int in_len, int in_ch,
+                      const ReferenceFn &expected_scores)
+{
+  const int num_hops = sizeof(kHops) / sizeof(kHops[0]);
+  int units = model.output_size();
+  int total_frames = in_len;
+  for (int h = 0; h < num_hops; h++)
+    total_frames += kHops[h];
+  std::vector<float> features(total_frames * in_ch);
+  for (size_t i = 0; i < features.size(); i++)
+    features[i] = random_value(1.0f);
+
+  printf("%s, alignment %d, %u MACs per full window\n", name, model.alignment(),
+         model.macs_full_window());
+  int failures = 0, position = 0;
+  double worst = 0.0;
+  std::vector<double> expected;
+  for (int h = 0; h < num_hops; h++) {
+    position += kHops[h];
+    const float *window = &features[position * in_ch];
+    model.shift(kHops[h]);
+    const float *scores = model.invoke(window);
+    expected_scores(window, expected);
+
+    double diff = 0.0;
+    bool ok = true;
+    for (int u = 0; u < units; u++) {
+      double d = fabs(scores[u] - expected[u]);
+      diff = std::max(diff, d);
+      ok = ok && d <= kTolerance * std::max(1.0, fabs(expected[u]));
+    }
+    worst = std::max(worst, diff);
+    bool aligned = h > 0 && kHops[h] > 0 && kHops[h] % model.alignment() == 0 &&
+                   kHops[h] < in_len;
+    printf("  hop %2d +%3d frames %-9s %6u MACs, max diff %.2e%s\n", h, kHops[h],
+           aligned ? "cached" : "full", model.macs(), diff, ok ? "" : "  FAIL");
+    failures += !ok;
+  }
+  printf("  worst diff %.2e, tolerance %.0e\n", worst, kTolerance);
+  return failures;
+}
+
+/* Failing hops of one stack */
+static int check_stack(const StackSpec &stack)
+{
+  StreamingModel model;
+  std::vector<RefLayer> layers(stack.num_layers);
+  int len = stack.in_len, ch = stack.in_ch;
+
+  for (int i = 0; i < stack.num_layers; i++) {
+    RefLayer &l = layers[i];
+    l.spec = stack.layers[i];
+    l.in_len = len;
+    l.in_ch = ch;
+    l.out_len = output_len(l.spec, len);
+    l.out_ch = (l.spec.type == STREAM_LAYER_CONV) ? l.spec.out_ch : ch;
+    l.pad = leading_pad(l.spec, len, l.out_len);
+    if (l.spec.type == STREAM_LAYER_CONV) {
+      float scale = 1.0f / sqrtf((float)(l.spec.kernel * ch));
+      l.weights.resize(l.out_ch * l.spec.kernel * ch);
+      l.bias.resize(l.out_ch);
+      for (size_t w = 0; w < l.weights.size(); w++)
+        l.weights[w] = random_value(scale);
+      for (size_t b = 0; b < l.bias.size(); b++)
+        l.bias[b] = random_value(0.1f);
+      model.add_conv(len, ch, l.out_len, l.out_ch, l.spec.kernel, l.spec.stride, l.spec.padding,
+                     &l.weights[0], &l.bias[0], l.spec.activation);
+    } else {
+      model.add_max_pool(len, ch, l.out_len, l.spec.kernel, l.spec.stride, l.spec.padding,
+                         l.spec.activation);
+    }
+    len = l.out_len;
+    ch = l.out_ch;
+  }
+
+  int fc_inputs = len * ch;
+  std::vector<float> fc_weights(stack.units * fc_inputs), fc_bias(stack.units);
+  for (size_t w = 0; w < fc_weights.size(); w++)
+    fc_weights[w] = random_value(1.0f / sqrtf((float)fc_inputs));
+  for (size_t b = 0; b < fc_bias.size(); b++)
+    fc_bias[b] = random_value(0.1f);
+  model.set_head(fc_inputs, stack.units, &fc_weights[0], &fc_bias[0], kTfLiteActNone,
+                 stack.softmax, 1.0f);
+
+  return check_hops(stack.name, model, stack.in_len, stack.in_ch,
+                    [&](const float *window, std::vector<double> &scores) {
+    reference(layers, fc_weights, fc_bias, stack.softmax, window, scores);
+  });
+}
+
+/* Builtin data of one flatbuffer operator */
+union NodeParams {
+  TfLiteConvParams conv;
+  TfLitePoolParams pool;
+  TfLiteFullyConnectedParams fc;
+  TfLiteSoftmaxParams softmax;
+};
+
+/*
+ * TfLiteContext over the first subgraph of a flatbuffer model, with what
+ * build() reads: tensor types, dims and data, nodes, builtin codes and
+ * builtin data. Constant tensors hold aligned copies of the flatbuffer
+ * buffers, every other tensor its own zeroed buffer.
+ */
+struct FlatbufferGraph {
+  TfLiteContext context;
+  std::vector<TfLiteTensor> tensors;
+  std::vector<TfLiteNode> nodes;
+  std::vector<TfLiteRegistration> registrations;
+  std::vector<NodeParams> params;
+  std::vector<std::vector<float> > data;
+  std::vector<std::vector<int> > arrays;  // storage behind every TfLiteIntArray
+  TfLiteIntArray *plan;
+  int input;
+  int output;
+};
+
+static TfLiteIntArray* new_array(FlatbufferGraph &graph, const flatbuffers::Vector<int32_t> *values)
+{
+  int size = values ? values->size() : 0;
+  graph.arrays.push_back(std::vector<int>(size + 1));
+  std::vector<int> &array = graph.arrays.back();
+  array[0] = size;
+  for (int i = 0; i < size; i++)
+    array[i + 1] = values->Get(i);
+  return (TfLiteIntArray *)&array[0];
+}
+
+static TfLiteStatus graph_execution_plan(TfLiteContext *context, TfLiteIntArray **plan)
+{
+  *plan = ((FlatbufferGraph *)context->impl_)->plan;
+  return kTfLiteOk;
+}
+
+static TfLiteStatus graph_node_and_registration(TfLiteContext *context, int node_index,
+                                                TfLiteNode **node, TfLiteRegistration **registration)
+{
+  FlatbufferGraph *graph = (FlatbufferGraph *)context->impl_;
+  if (node_index < 0 || node_index >= (int)graph->nodes.size())
+    return kTfLiteError;
+  *node = &graph->nodes[node_index];
+  *registration = &graph->registrations[node_index];
+  return kTfLiteOk;
+}
+
+static TfLitePadding to_padding(tflite::Padding padding)
+{
+  return (padding == tflite::Padding_SAME) ? kTfLitePaddingSame : kTfLitePaddingValid;
+}
+
+static TfLiteFusedActivation to_activation(tflite::ActivationFunctionType activation)
+{
+  switch (activation) {
+    case tflite::ActivationFunctionType_RELU:         return kTfLiteActRelu;
+    case tflite::ActivationFunctionType_RELU_N1_TO_1: return kTfLiteActRelu1;
+    case tflite::ActivationFunctionType_RELU6:        return kTfLiteActRelu6;
+    case tflite::ActivationFunctionType_TANH:         return kTfLiteActTanh;
+    default:                                          return kTfLiteActNone;
+  }
+}
+
+/* Loads the model's first subgraph; false on operators the check has no builtin data for */
+static bool load_graph(const tflite::Model *model, FlatbufferGraph &graph)
+{
+  const tflite::SubGraph *subgraph = model->subgraphs()->Get(0);
+  int num_tensors = subgraph->tensors()->size();
+  int num_ops = subgraph->operators()->size();
+
+  graph.tensors.assign(num_tensors, TfLiteTensor());
+  graph.data.resize(num_tensors);
+  for (int t = 0; t < num_tensors; t++) {
+    const tflite::Tensor *tensor = subgraph->tensors()->Get(t);
+    const flatbuffers::Vector<uint8_t> *buffer = model->buffers()->Get(tensor->buffer())->data();
+    TfLiteTensor &out = graph.tensors[t];
+    out.type = (tensor->type() == tflite::TensorType_FLOAT32) ? kTfLiteFloat32 :
+               (tensor->type() == tflite::TensorType_INT32) ? kTfLiteInt32 : kTfLiteNoType;
+    out.dims = new_array(graph, tensor->shape());
+    size_t count = 1;
+    for (int d = 0; d < out.dims->size; d++)
+      count *= out.dims->data[d];
+    out.bytes = count * sizeof(float);
+    graph.data[t].assign(count, 0.0f);
+    if (buffer && buffer->size() > 0) {
+      out.allocation_type = kTfLiteMmapRo;
+      memcpy(&graph.data[t][0], buffer->data(), std::min((size_t)buffer->size(), out.bytes));
+    } else {
+      out.allocation_type = kTfLiteArenaRw;
+    }
+    out.data.f = &graph.data[t][0];
+  }
+
+  graph.nodes.assign(num_ops, TfLiteNode());
+  graph.registrations.assign(num_ops, TfLiteRegistration());
+  graph.params.resize(num_ops);
+  for (int i = 0; i < num_ops; i++) {
+    const tflite::Operator *op = subgraph->operators()->Get(i);
+    tflite::BuiltinOperator code = model->operator_codes()->Get(op->opcode_index())->builtin_code();
+    TfLiteNode &node = graph.nodes[i];
+    NodeParams &params = graph.params[i];
+    node.inputs = new_array(graph, op->inputs());
+    node.outputs = new_array(graph, op->outputs());
+    node.temporaries = new_array(graph, 0);
+    node.builtin_data = &params;
+    graph.registrations[i].builtin_code = code;
+
+    if (code == tflite::BuiltinOperator_CONV_2D) {
+      const tflite::Conv2DOptions *options = op->builtin_options_as_Conv2DOptions();
+      params.conv.padding = to_padding(options->padding());
+      params.conv.stride_width = options->stride_w();
+      params.conv.stride_height = options->stride_h();
+      params.conv.dilation_width_factor = options->dilation_w_factor();
+      params.conv.dilation_height_factor = options->dilation_h_factor();
+      params.conv.activation = to_activation(options->fused_activation_function());
+    } else if (code == tflite::BuiltinOperator_MAX_POOL_2D) {
+      const tflite::Pool2DOptions *options = op->builtin_options_as_Pool2DOptions();
+      params.pool.padding = to_padding(options->padding());
+      params.pool.stride_width = options->stride_w();
+      params.pool.stride_height = options->stride_h();
+      params.pool.filter_width = options->filter_width();
+      params.pool.filter_height = options->filter_height();
+      params.pool.activation = to_activation(options->fused_activation_function());
+    } else if (code == tflite::BuiltinOperator_FULLY_CONNECTED) {
+      const tflite::FullyConnectedOptions *options = op->builtin_options_as_FullyConnectedOptions();
+      params.fc.activation = to_activation(options->fused_activation_function());
+    } else if (code == tflite::BuiltinOperator_SOFTMAX) {
+      params.softmax.beta = op->builtin_options_as_SoftmaxOptions()->beta();
+    } else if (code != tflite::BuiltinOperator_RESHAPE) {
+      printf("unsupported operator %s\n", tflite::EnumNameBuiltinOperator(code));
+      return false;
+    }
+  }
+
+  /* operators run in flatbuffer order */
+  graph.arrays.push_back(std::vector<int>(1, num_ops));
+  for (int i = 0; i < num_ops; i++)
+    graph.arrays.back().push_back(i);
+  graph.plan = (TfLiteIntArray *)&graph.arrays.back()[0];
+  graph.input = subgraph->inputs()->Get(0);
+  graph.output = subgraph->outputs()->Get(0);
+
+  memset(&graph.context, 0, sizeof(graph.context));
+  graph.context.tensors = &graph.tensors[0];
+  graph.context.tensors_size = num_tensors;
+  graph.context.impl_ = &graph;
+  graph.context.GetExecutionPlan = graph_execution_plan;
+  graph.context.GetNodeAndRegistration = graph_node_and_registration;
+  return true;
+}
+
+/* SAME padding before the first row / column, as TFLite computes it */
+static int graph_pad(TfLitePadding padding, int in, int out, int filter, int stride)
+{
+  int total = (out - 1) * stride + filter - in;
+  return (padding == kTfLitePaddingSame && total > 0) ? total / 2 : 0;
+}
+
+/*
+ * Full-window pass over the graph in double precision, one operator at a
+ * time on NHWC tensors, without the 1-D mapping build() makes.
+ */
+static void graph_reference(const FlatbufferGraph &graph, const float *window,
+                            std::vector<double> &scores)
+{
+  std::vector<std::vector<double> > values(graph.tensors.size());
+  const TfLiteTensor &input = graph.tensors[graph.input];
+  values[graph.input].assign(window, window + input.bytes / sizeof(float));
+
+  for (size_t n = 0; n < graph.nodes.size(); n++) {
+    const TfLiteNode &node = graph.nodes[n];
+    const NodeParams &params = graph.params[n];
+    const std::vector<double> &in = values[node.inputs->data[0]];
+    const TfLiteIntArray *in_dims = graph.tensors[node.inputs->data[0]].dims;
+    const TfLiteIntArray *out_dims = graph.tensors[node.outputs->data[0]].dims;
+    std::vector<double> &out = values[node.outputs->data[0]];
+
+    switch (graph.registrations[n].builtin_code) {
+      case kTfLiteBuiltinReshape:
+        out = in;
+        break;
+
+      case kTfLiteBuiltinConv2d:
+      case kTfLiteBuiltinMaxPool2d: {
+        bool conv = graph.registrations[n].builtin_code == kTfLiteBuiltinConv2d;
+        const TfLiteTensor *filter = conv ? &graph.tensors[node.inputs->data[1]] : 0;
+        const float *bias = conv ? graph.tensors[node.inputs->data[2]].data.f : 0;
+        int in_h = in_dims->data[1], in_w = in_dims->data[2], in_c = in_dims->data[3];
+        int out_h = out_dims->data[1], out_w = out_dims->data[2], out_c = out_dims->data[3];
+        int k_h = conv ? filter->dims->data[1] : params.pool.filter_height;
+        int k_w = conv ? filter->dims->data[2] : params.pool.filter_width;
+        int s_h = conv ? params.conv.stride_height : params.pool.stride_height;
+        int s_w = conv ? params.conv.stride_width : params.pool.stride_width;
+        TfLitePadding padding = conv ? params.conv.padding : params.pool.padding;
+        TfLiteFusedActivation activation = conv ? params.conv.activation : params.pool.activation;
+        int pad_h = graph_pad(padding, in_h, out_h, k_h, s_h);
+        int pad_w = graph_pad(padding, in_w, out_w, k_w, s_w);
+
+        out.assign(out_h * out_w * out_c, 0.0);
+        for (int y = 0; y < out_h; y++)
+          for (int x = 0; x < out_w; x++)
+            for (int o = 0; o < out_c; o++) {
+              double acc = conv ? bias[o] : -HUGE_VAL;
+              for (int ky = 0; ky < k_h; ky++)
+                for (int kx = 0; kx < k_w; kx++) {
+                  int iy = y * s_h - pad_h + ky, ix = x * s_w - pad_w + kx;
+                  if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+                    continue;
+                  const double *pixel = &in[(iy * in_w + ix) * in_c];
+                  if (!conv) {
+                    acc = std::max(acc, pixel[o]);
+                    continue;
+                  }
+                  const float *w = &filter->data.f[((o * k_h + ky) * k_w + kx) * in_c];
+                  for (int c = 0; c < in_c; c++)
+                    acc += pixel[c] * w[c];
+                }
+              out[(y * out_w + x) * out_c + o] = activate(acc, activation);
+            }
+        break;
+      }
+
+      case kTfLiteBuiltinFullyConnected: {
+        const TfLiteTensor &weights = graph.tensors[node.inputs->data[1]];
+        const float *bias = graph.tensors[node.inputs->data[2]].data.f;
+        int units = weights.dims->data[0], inputs = weights.dims->data[1];
+        out.assign(units, 0.0);
+        for (int u = 0; u < units; u++) {
+          double acc = bias[u];
+          for (int i = 0; i < inputs; i++)
+            acc += in[i] * weights.data.f[u * inputs + i];
+          out[u] = activate(acc, params.fc.activation);
+        }
+        break;
+      }
+
+      case kTfLiteBuiltinSoftmax: {
+        double max_score = *std::max_element(in.begin(), in.end()), sum = 0.0;
+        out.resize(in.size());
+        for (size_t u = 0; u < in.size(); u++)
+          sum += (out[u] = exp((in[u] - max_score) * params.softmax.beta));
+        for (size_t u = 0; u < in.size(); u++)
+          out[u] /= sum;
+        break;
+      }
+    }
+  }
+  scores = values[graph.output];
+}
+
+/* [len x channels] window the first CONV_2D sees, time along W or H */
+static bool graph_window(const FlatbufferGraph &graph, int *len, int *channels)
+{
+  for (size_t n = 0; n < graph.nodes.size(); n++) {
+    if (graph.registrations[n].builtin_code != kTfLiteBuiltinConv2d)
+      continue;
+    const TfLiteIntArray *dims = graph.tensors[graph.nodes[n].inputs->data[0]].dims;
+    *len = (dims->data[1] == 1) ? dims->data[2] : dims->data[1];
+    *channels = dims->data[3];
+    return true;
+  }
+  return false;
+}
+
+/* build() on the shipped model's real weights; failing hops */
+static int check_flatbuffer(int *len, int *channels)
+{
+  FlatbufferGraph graph;
+  StreamingModel model;
+  if (!load_graph(tflite::GetModel(ds_cnn_s_model), graph) || !graph_window(graph, len, channels) ||
+      !model.build(&graph.context, graph.input, graph.output)) {
+    printf("ds_cnn_s_model flatbuffer: build() rejected the graph  FAIL\n");
+    return 1;
+  }
+  return check_hops("ds_cnn_s_model flatbuffer weights", model, *len, *channels,
+                    [&](const float *window, std::vector<double> &scores) {
+    graph_reference(graph, window, scores);
+  });
+}
+
+#ifdef HOST_TFLITE
+/* build(tflite::Interpreter *) against Invoke() on the same windows; failing hops */
+static int check_interpreter(int len, int channels)
+{
+  std::unique_ptr<tflite::FlatBufferModel> flatbuffer =
+      tflite::FlatBufferModel::BuildFromBuffer((const char *)ds_cnn_s_model, ds_cnn_s_model_len);
+  tflite::ops::builtin::BuiltinOpResolver resolver;
+  std::unique_ptr<tflite::Interpreter> interpreter;
+  StreamingModel model;
+  if (!flatbuffer || tflite::InterpreterBuilder(*flatbuffer, resolver)(&interpreter) != kTfLiteOk ||
+      interpreter->AllocateTensors() != kTfLiteOk || !model.build(interpreter.get())) {
+    printf("ds_cnn_s_model interpreter: build() rejected the graph  FAIL\n");
+    return 1;
+  }
+  return check_hops("ds_cnn_s_model interpreter vs Invoke", model, len, channels,
+                    [&](const float *window, std::vector<double> &scores) {
+    memcpy(interpreter->typed_input_tensor<float>(0), window, len * channels * sizeof(float));
+    if (interpreter->Invoke() != kTfLiteOk)
+      printf("  Invoke failed\n");
+    const float *out = interpreter->typed_output_tensor<float>(0);
+    scores.assign(out, out + model.output_size());
+  });
+}
+#endif
+
+int main()
+{
+  int failures = 0;
+  srand(1);
+  for (size_t s = 0; s < sizeof(kStacks) / sizeof(kStacks[0]); s++)
+    failures += check_stack(kStacks[s]);
+
+  int len = 0, channels = 0;
+  failures += check_flatbuffer(&len, &channels);
+#ifdef HOST_TFLITE
+  if (len > 0)
+    failures += check_interpreter(len, channels);
+#endif
+  printf("%s\n", failures ? "FAIL" : "PASS");
+  return failures ? 1 : 0;
+}